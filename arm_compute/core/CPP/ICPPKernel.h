@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2025 Arm Limited.
+ * Copyright (c) 2016-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,9 @@
 #include "arm_compute/core/IKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <atomic>
+#include <memory>
+
 namespace arm_compute
 {
 class Window;
@@ -44,8 +47,43 @@ class ICPPKernel : public IKernel
 public:
     static constexpr size_t default_mws = 1; /* Default minimum workload size value  - no impact */
 
-    /** Default destructor */
-    virtual ~ICPPKernel() = default;
+    /** State attached to the kernel by the schedulers running it, such as the split of its window into workloads */
+    class SchedulerState
+    {
+    public:
+        /** Default destructor */
+        virtual ~SchedulerState() = default;
+    };
+
+    /** Default constructor */
+    ICPPKernel() = default;
+    /** Copy constructor: the scheduler state is not copied */
+    ICPPKernel(const ICPPKernel &kernel) : IKernel(kernel)
+    {
+    }
+    /** Move constructor: the scheduler state is not moved */
+    ICPPKernel(ICPPKernel &&kernel) : IKernel(std::move(kernel))
+    {
+    }
+    /** Copy assignment operator: the scheduler state of the kernel is dropped */
+    ICPPKernel &operator=(const ICPPKernel &kernel)
+    {
+        IKernel::operator=(kernel);
+        delete _scheduler_state.exchange(nullptr);
+        return *this;
+    }
+    /** Move assignment operator: the scheduler state of the kernel is dropped */
+    ICPPKernel &operator=(ICPPKernel &&kernel)
+    {
+        IKernel::operator=(std::move(kernel));
+        delete _scheduler_state.exchange(nullptr);
+        return *this;
+    }
+    /** Destructor */
+    virtual ~ICPPKernel()
+    {
+        delete _scheduler_state.load();
+    }
 
     /** Execute the kernel on the passed window
      *
@@ -113,6 +151,36 @@ public:
      * @return Kernel name
      */
     virtual const char *name() const = 0;
+
+    /** Get the state attached to the kernel by a scheduler
+     *
+     * @return The state or nullptr if the kernel hasn't been scheduled yet
+     */
+    SchedulerState *scheduler_state() const
+    {
+        return _scheduler_state.load(std::memory_order_acquire);
+    }
+
+    /** Attach a state to the kernel unless it already has one
+     *
+     * The state lives as long as the kernel, so that it is reused by all the runs of the kernel.
+     *
+     * @param[in] state State to attach.
+     *
+     * @return The state attached to the kernel: @p state, or the one another thread attached first
+     */
+    SchedulerState *attach_scheduler_state(std::unique_ptr<SchedulerState> state)
+    {
+        SchedulerState *attached = nullptr;
+        if (_scheduler_state.compare_exchange_strong(attached, state.get(), std::memory_order_acq_rel))
+        {
+            return state.release();
+        }
+        return attached;
+    }
+
+private:
+    std::atomic<SchedulerState *> _scheduler_state{nullptr};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_CPP_ICPPKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,8 @@ enum class DataType
     QASYMM8,            /**< quantized, asymmetric fixed-point 8-bit number unsigned */
     QASYMM8_SIGNED,     /**< quantized, asymmetric fixed-point 8-bit number signed */
     QSYMM8_PER_CHANNEL, /**< quantized, symmetric per channel fixed-point 8-bit number */
+    QSYMM4_PER_CHANNEL, /**< quantized, symmetric per channel fixed-point 4-bit number, packed in pairs in each byte */
+    QSYMM4_PER_BLOCK,   /**< quantized, symmetric per block fixed-point 4-bit number, packed in pairs in each byte */
     U16,                /**< unsigned 16-bit number */
     S16,                /**< signed 16-bit number */
     QSYMM16,            /**< quantized, symmetric fixed-point 16-bit number */
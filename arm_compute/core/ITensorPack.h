@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 namespace arm_compute
 {
@@ -112,6 +113,11 @@ public:
      * @return True if empty else false
      */
     bool empty() const;
+    /** Ids of the tensors registered to the pack
+     *
+     * @return The ids, in no particular order
+     */
+    std::vector<int> ids() const;
 
 private:
     std::unordered_map<int, PackElement> _pack{}; /**< Container with the packed tensors */
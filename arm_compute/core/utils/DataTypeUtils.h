@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,8 @@ inline size_t data_size_from_type(DataType data_type)
         case DataType::QASYMM8:
         case DataType::QASYMM8_SIGNED:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
             return 1;
         case DataType::U16:
         case DataType::S16:
@@ -118,6 +120,8 @@ inline size_t element_size_from_data_type(DataType dt)
         case DataType::QASYMM8:
         case DataType::QASYMM8_SIGNED:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
             return 1;
         case DataType::U16:
         case DataType::S16:
@@ -365,6 +369,8 @@ inline bool is_data_type_quantized(DataType dt)
         case DataType::QASYMM8:
         case DataType::QASYMM8_SIGNED:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
         case DataType::QSYMM16:
         case DataType::QASYMM16:
             return true;
@@ -439,6 +445,8 @@ inline bool is_data_type_quantized_symmetric(DataType dt)
     {
         case DataType::QSYMM8:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
         case DataType::QSYMM16:
             return true;
         default:
@@ -457,6 +465,25 @@ inline bool is_data_type_quantized_per_channel(DataType dt)
     switch (dt)
     {
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::QSYMM4_PER_CHANNEL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Check if a given data type is a 4-bit quantized type
+ *
+ * @param[in] dt Input data type.
+ *
+ * @return True if data type is a 4-bit quantized type, else false.
+ */
+inline bool is_data_type_quantized_4bit(DataType dt)
+{
+    switch (dt)
+    {
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
             return true;
         default:
             return false;
@@ -571,6 +598,12 @@ inline std::string cpu_impl_dt(const DataType &data_type)
         case DataType::QSYMM8_PER_CHANNEL:
             ret = "qp8";
             break;
+        case DataType::QSYMM4_PER_CHANNEL:
+            ret = "qp4";
+            break;
+        case DataType::QSYMM4_PER_BLOCK:
+            ret = "qb4";
+            break;
         case DataType::BFLOAT16:
             ret = "bf16";
             break;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,13 +47,15 @@ public:
     MMappedFile();
     /** Constructor
      *
-     * @note file will be created if it doesn't exist.
+     * @note file will be created if it doesn't exist, unless it is mapped copy-on-write.
      *
-     * @param[in] filename File to be mapped, if doesn't exist will be created.
-     * @param[in] size     Size of file to map
-     * @param[in] offset   Offset to mapping point, should be multiple of page size
+     * @param[in] filename      File to be mapped, if doesn't exist will be created.
+     * @param[in] size          Size of file to map
+     * @param[in] offset        Offset to mapping point, should be multiple of page size
+     * @param[in] copy_on_write (Optional) Open the file read-only and keep the writes to the mapping private to the
+     *                          process. Defaults to false.
      */
-    MMappedFile(std::string filename, size_t size, size_t offset);
+    MMappedFile(std::string filename, size_t size, size_t offset, bool copy_on_write = false);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     MMappedFile(const MMappedFile &) = delete;
     /** Default move constructor */
@@ -66,15 +68,17 @@ public:
     ~MMappedFile();
     /** Opens and maps a file
      *
-     * @note file will be created if it doesn't exist.
+     * @note file will be created if it doesn't exist, unless it is mapped copy-on-write.
      *
-     * @param[in] filename File to be mapped, if doesn't exist will be created.
-     * @param[in] size     Size of file to map. If 0 all the file will be mapped.
-     * @param[in] offset   Offset to mapping point, should be multiple of page size.
+     * @param[in] filename      File to be mapped, if doesn't exist will be created.
+     * @param[in] size          Size of file to map. If 0 all the file will be mapped.
+     * @param[in] offset        Offset to mapping point, should be multiple of page size.
+     * @param[in] copy_on_write (Optional) Open the file read-only and keep the writes to the mapping private to the
+     *                          process, e.g. to share read-only data between processes. Defaults to false.
      *
      * @return True if operation was successful else false
      */
-    bool map(const std::string &filename, size_t size, size_t offset);
+    bool map(const std::string &filename, size_t size, size_t offset, bool copy_on_write = false);
     /** Unmaps and closes file */
     void release();
     /** Mapped data accessor
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+/** Operations available in an element-wise chain */
+enum class ElementwiseChainOperation
+{
+    ADD,       /**< Add an input to the running result */
+    SUB,       /**< Subtract an input from the running result */
+    MUL,       /**< Multiply the running result by an input */
+    DIV,       /**< Divide the running result by an input */
+    MAX,       /**< Maximum of the running result and an input */
+    MIN,       /**< Minimum of the running result and an input */
+    EXP,       /**< Exponential of the running result */
+    ACTIVATION /**< Activation function applied to the running result */
+};
+
+/** Single step of an element-wise chain */
+struct ElementwiseChainStep
+{
+    /** Default constructor */
+    ElementwiseChainStep() = default;
+    /** Constructor for binary and unary operations
+     *
+     * @param[in] op      Operation to perform.
+     * @param[in] operand (Optional) Index of the input combined with the running result by binary operations.
+     * @param[in] reverse (Optional) Use the input as the left-hand side operand of binary operations.
+     */
+    ElementwiseChainStep(ElementwiseChainOperation op, size_t operand = 0, bool reverse = false)
+        : op(op), operand(operand), reverse(reverse)
+    {
+    }
+    /** Constructor for activation steps
+     *
+     * @param[in] act_info Activation function to apply.
+     */
+    ElementwiseChainStep(const ActivationLayerInfo &act_info)
+        : op(ElementwiseChainOperation::ACTIVATION), act_info(act_info)
+    {
+    }
+
+    ElementwiseChainOperation op{ElementwiseChainOperation::ACTIVATION}; /**< Operation to perform */
+    size_t                    operand{0};                                /**< Input used by binary operations */
+    bool                      reverse{false};                            /**< Input is the left-hand side operand */
+    ActivationLayerInfo       act_info{};                                /**< Activation of ACTIVATION steps */
+};
+
+/** Maximum number of inputs of an element-wise chain */
+constexpr size_t max_elementwise_chain_inputs = 8;
+
+/** Element-wise chain: the running result starts as the first input and is updated by every step in order */
+using ElementwiseChainInfo = std::vector<ElementwiseChainStep>;
+
+/** Check whether a step consumes one of the chain inputs
+ *
+ * @param[in] step Step to check.
+ *
+ * @return True if the step is a binary operation
+ */
+inline bool is_binary_chain_step(const ElementwiseChainStep &step)
+{
+    return step.op != ElementwiseChainOperation::EXP && step.op != ElementwiseChainOperation::ACTIVATION;
+}
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
  */
 
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
@@ -124,6 +125,13 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
+    /** Gets the runtime context of the CPU functions
+     *
+     * The context is installed on the threads configuring and running the graph.
+     *
+     * @return The tuners, prepared weights cache and profiler used by the CPU functions of the graph
+     */
+    CPPRuntimeContext &cpp_runtime_ctx();
     /** Finalizes memory managers in graph context */
     void finalize();
 
@@ -131,6 +139,7 @@ private:
     GraphConfig                             _config;           /**< Graph configuration */
     std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
     std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
+    CPPRuntimeContext                       _cpp_runtime_ctx;  /**< Runtime context of the CPU functions */
 };
 } // namespace graph
 } // namespace arm_compute
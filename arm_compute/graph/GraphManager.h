@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,14 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Sets the batch of the next executions of a graph
+     *
+     * @note The graph must have been finalized with a non-zero @ref GraphConfig::batch_chunk_size
+     *
+     * @param[in] graph      Graph to set the batch of
+     * @param[in] batch_size Batch, up to the one of the inputs the graph was built with
+     */
+    void set_batch_size(Graph &graph, unsigned int batch_size);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -138,6 +138,11 @@ public:
      * @param[in] target Final execution target
      */
     void set_assigned_target(Target target);
+    /** Sets the pipeline stage the node is executed in
+     *
+     * @param[in] stage Pipeline stage
+     */
+    void set_pipeline_stage(unsigned int stage);
     /** Sets the output tensor of at a given index
      *
      * @note All edges will get updated
@@ -245,6 +250,11 @@ public:
      * @return Assigned target of this node
      */
     Target assigned_target() const;
+    /** Returns the pipeline stage the node is executed in
+     *
+     * @return Pipeline stage of this node, 0 if the graph is not pipelined
+     */
+    unsigned int pipeline_stage() const;
 
 protected:
     friend class Graph;
@@ -257,6 +267,7 @@ protected:
     std::vector<EdgeID>   _input_edges;     /**< Inputs edge set */
     std::set<EdgeID>      _output_edges;    /**< Output edge set */
     Target                _assigned_target; /**< Assigned target by the Graph executor */
+    unsigned int          _pipeline_stage;  /**< Pipeline stage assigned by the Graph executor */
 };
 } // namespace graph
 } // namespace arm_compute
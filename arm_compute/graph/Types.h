@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,7 +87,12 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 // Forward declarations
 struct TensorDescriptor;
 
-/** Graph configuration structure */
+/** Graph configuration structure
+ *
+ * @note The stages of a pipelined graph (@ref num_pipeline_stages greater than 1) work on different inferences at the
+ *       same time and cannot share transition buffers: their tensors are allocated statically and
+ *       @ref use_transition_memory_manager is ignored.
+ */
 struct GraphConfig
 {
     bool        use_function_memory_manager{true};   /**< Use a memory manager to manage per-function auxilary memory */
@@ -102,6 +107,17 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    std::string   weights_cache_file{};                /**< File to load/store the prepared CPU weights from, disabled if empty */
+    unsigned int  num_parallel_branches{1};            /**< Maximum number of independent CPU branches executed concurrently */
+    unsigned int  num_pipeline_stages{1};              /**< Number of CPU pipeline stages running consecutive inferences */
+    bool          plan_data_layout{false};             /**< Choose the data layout of each node from a cost model */
+    bool          plan_data_type{false};               /**< Lower the precision of float nodes where it pays off */
+    bool          tune_convolution_method{false};      /**< Measure the methods of the CPU convolutions to pick one */
+    std::string   convolution_tuner_file{};            /**< File to load/store the measured convolution methods from */
+    unsigned int  batch_chunk_size{0};                 /**< Samples per run of a batch set at execution time, disabled if 0 */
+    std::string   profiling_file{};                    /**< File to save the Chrome trace of the CPU runs to, disabled if empty */
+    bool          fuse_f16_elementwise_chains{false};  /**< Fuse F16 element-wise chains, whose results are then rounded to F16 once instead of after every node */
+    bool          fold_quantization{false};            /**< Fold the quantization round trips and requantizations, whose results may differ by a rounding step */
 };
 
 /**< Device target types */
@@ -161,6 +177,7 @@ enum class NodeType
     ArgMinMaxLayer,
     BatchNormalizationLayer,
     BoundingBoxTransformLayer,
+    CastLayer,
     ChannelShuffleLayer,
     ConcatenateLayer,
     ConvolutionLayer,
@@ -175,6 +192,7 @@ enum class NodeType
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedElementwiseLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
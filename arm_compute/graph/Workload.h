@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,13 @@ class ITensorHandle;
 class INode;
 class Graph;
 
+namespace detail
+{
+class BranchExecutor;
+class DynamicBatchExecutor;
+class PipelineExecutor;
+} // namespace detail
+
 struct ExecutionTask;
 
 void execute_task(ExecutionTask &task);
@@ -100,11 +107,15 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};        /**< Input handles */
-    std::vector<Tensor *>      outputs = {};        /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
-    Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
-    GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    std::vector<Tensor *>                         inputs            = {};        /**< Input handles */
+    std::vector<Tensor *>                         outputs           = {};        /**< Output handles */
+    std::vector<ExecutionTask>                    tasks             = {};        /**< Execution workload */
+    Graph                                        *graph             = {nullptr}; /**< Graph bound to the workload */
+    GraphContext                                 *ctx               = {nullptr}; /**< Graph execution context */
+    std::vector<std::vector<unsigned int>>        dependents        = {};        /**< Tasks waiting for each task */
+    std::shared_ptr<detail::BranchExecutor>       branch_executor   = {nullptr}; /**< Executor of the concurrent tasks */
+    std::shared_ptr<detail::PipelineExecutor>     pipeline_executor = {nullptr}; /**< Executor of the pipeline stages */
+    std::shared_ptr<detail::DynamicBatchExecutor> batch_executor    = {nullptr}; /**< Executor of the batch chunks */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
 
 #include "support/Cast.h"
 
@@ -248,6 +249,64 @@ create_fused_convolution_batch_normalization_layer(FusedConvolutionBatchNormaliz
     return func;
 }
 
+/** Create a backend fused convolution batch normalization layer function accumulating a residual tensor into its output
+ *
+ * @tparam FusedLayerTypes Fused layer types, whose convolution layer is GEMM-based and supports accumulation
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution batch normalization layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction>
+create_fused_convolution_batch_normalization_layer_with_residual(FusedConvolutionBatchNormalizationNode &node,
+                                                                 GraphContext                           &ctx)
+{
+    validate_node<TargetInfo>(node, 8 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *mean    = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *var     = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *beta    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *gamma   = get_backing_tensor<TargetInfo>(node.input(6));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON_MSG(get_backing_tensor<TargetInfo>(
+                                 node.input(FusedConvolutionBatchNormalizationNode::residual_input_idx)) != output,
+                             "The residual must be accumulated in place");
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const float               epsilon   = node.epsilon();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedConvolutionBatchNormalizationFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("FusedConvolutionBatchNormalizationLayer"), mm, input, weights, biases, output, mean, var, beta,
+        gamma, epsilon, conv_info, 1U, fast_math, fused_act, true /* accumulate */);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape() << " Residual accumulated"
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+    return func;
+}
+
 /** Create a backend fused depthwise convolution batch normalization layer function
  *
  * @tparam FusedLayerTypes             Fused layer types
@@ -337,6 +396,38 @@ std::unique_ptr<IFunction> create_bounding_box_transform_layer(BoundingBoxTransf
     return std::move(func);
 }
 
+/** Create a backend cast layer function
+ *
+ * @tparam CastLayerFunction Backend cast function
+ * @tparam TargetInfo        Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend cast layer function
+ */
+template <typename CastLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_cast_layer(CastLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create function
+    auto func = std::make_unique<CastLayerFunction>();
+    func->configure(input, output, node.convert_policy());
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
+                                               << " Output Data Type: " << output->info()->data_type()
+                                               << " Shape: " << input->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend channel shuffle layer function
  *
  * @tparam ChannelShuffleLayerFunction Backend channel shuffle function
@@ -505,6 +596,65 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     return func;
 }
 
+/** Create a backend convolution layer function accumulating a residual tensor into its output
+ *
+ * @tparam GEMMConv2dFunction           Backend GEMM-based direct convolution function
+ * @tparam GEMMConvolutionLayerFunction Backend GEMM-based convolution function
+ * @tparam TargetInfo                   Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend convolution layer function
+ */
+template <typename GEMMConv2dFunction, typename GEMMConvolutionLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_convolution_layer_with_residual(ConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 4 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON_MSG(get_backing_tensor<TargetInfo>(node.input(ConvolutionLayerNode::residual_input_idx)) !=
+                                 output,
+                             "The residual must be accumulated in place");
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const Conv2dInfo          conv2d_info(conv_info, Size2D(1U, 1U), fused_act, fast_math, 1U, WeightsInfo(),
+                                          true /* accumulate */);
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    if (bool(GEMMConv2dFunction::validate(input->info(), weights->info(),
+                                          biases != nullptr ? biases->info() : nullptr, output->info(), conv2d_info)))
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<GEMMConv2dFunction>(
+            std::string("GEMMConv2d"), mm, input, weights, biases, output, conv2d_info);
+    }
+    else
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<GEMMConvolutionLayerFunction>(
+            std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(),
+            Size2D(1U, 1U), fused_act, fast_math, 1U, true /* accumulate */);
+    }
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << func_name << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape() << " Residual accumulated"
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+    return func;
+}
+
 /** Create a backend deconvolution layer function
  *
  * @tparam DeconvolutionLayerFunction Backend deconvolution function
@@ -873,6 +1023,43 @@ std::unique_ptr<IFunction> create_unary_eltwise_layer(UnaryEltwiseLayerNode &nod
     return func;
 }
 
+/** Create a backend fused element-wise chain function
+ *
+ * @tparam FusedElementwiseFunction Backend fused element-wise function
+ * @tparam TargetInfo               Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused element-wise function
+ */
+template <typename FusedElementwiseFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_elementwise_layer(FusedElementwiseLayerNode &node)
+{
+    validate_node<TargetInfo>(node, node.num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    std::vector<typename TargetInfo::SrcTensorType *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor<TargetInfo>(node.input(i)));
+        ARM_COMPUTE_ERROR_ON(inputs.back() == nullptr);
+    }
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<FusedElementwiseFunction>();
+    func->configure(inputs, output, node.chain());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO(
+        "Instantiated " << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                        << " Data Type: " << output->info()->data_type() << " Shape: " << output->info()->tensor_shape()
+                        << " Num Inputs: " << inputs.size() << " Num Steps: " << node.chain().size() << std::endl);
+
+    return func;
+}
+
 /** Create a backend flatten layer function
  *
  * @tparam FlattenLayerFunction Backend flatten function
@@ -1206,10 +1393,13 @@ std::unique_ptr<IFunction> create_pooling_layer(PoolingLayerNode &node)
     // Extract IO and info
     typename TargetInfo::TensorType *input     = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output    = get_backing_tensor<TargetInfo>(node.output(0));
-    const PoolingLayerInfo           pool_info = node.pooling_info();
+    PoolingLayerInfo                 pool_info = node.pooling_info();
     ARM_COMPUTE_ERROR_ON(input == nullptr);
     ARM_COMPUTE_ERROR_ON(output == nullptr);
 
+    // The data layout of the tensors may have been planned after the pooling information was created
+    pool_info.data_layout = input->info()->data_layout();
+
     // Create and configure function
     auto func = std::make_unique<PoolingLayerFunction>();
     func->configure(input, output, pool_info);
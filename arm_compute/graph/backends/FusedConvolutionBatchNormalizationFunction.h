@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2023, 2025 Arm Limited.
+ * Copyright (c) 2019, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,8 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 
+#include <utility>
+
 namespace arm_compute
 {
 namespace graph
@@ -72,8 +74,11 @@ public:
      * @param[in]  fast_math  Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                        available which may introduce a drop of accuracy as well. Default is false
      * @param[in]  fused_act  Activation layer information in case of a fused activation.
+     * @param[in]  conv_args  (Optional) Extra arguments forwarded to the convolution layer, e.g. to accumulate the result
+     *                        into @p output with a GEMM-based convolution layer.
      *
      */
+    template <typename... ConvArgs>
     void configure(TensorType                *input,
                    TensorType                *weights,
                    TensorType                *bias,
@@ -86,7 +91,8 @@ public:
                    const PadStrideInfo       &conv_info,
                    unsigned int               num_groups,
                    bool                       fast_math,
-                   ActivationLayerInfo const &fused_act)
+                   ActivationLayerInfo const &fused_act,
+                   ConvArgs &&...conv_args)
     {
         // We don't run any validate, as we assume that the layers have been already validated
         const bool        has_bias = (bias != nullptr);
@@ -106,7 +112,7 @@ public:
         }
 
         _conv_layer.configure(input, weights, bias_to_use, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act,
-                              fast_math, num_groups);
+                              fast_math, num_groups, std::forward<ConvArgs>(conv_args)...);
 
         if (!has_bias)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,13 @@
 
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/CPP/CPPConvolutionTuner.h"
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+
+#include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -59,7 +66,15 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    Allocator                            _allocator;          /**< Backend allocator */
+    std::unique_ptr<CPPWeightsCache>     _weights_cache;      /**< Prepared weights cache */
+    std::string                          _weights_cache_file; /**< File to load/store the prepared weights from */
+    size_t                               _num_loaded_weights; /**< Number of prepared weights loaded from the file */
+    IWeightsManager                      _shared_weights_mgr; /**< Transformed weights shared by all graphs */
+    std::unique_ptr<CPPConvolutionTuner> _conv_tuner;         /**< Convolution method tuner */
+    std::string                          _conv_tuner_file;    /**< File to load/store the convolution methods from */
+    std::unique_ptr<CPPProfiler>         _profiler;           /**< Profiler of the nodes and kernels */
+    std::string                          _profiling_file;     /**< File to save the Chrome trace to */
 };
 } // namespace backends
 } // namespace graph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,10 +31,12 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
 
 namespace arm_compute
 {
@@ -104,6 +106,29 @@ Status validate_bounding_box_transform_layer(BoundingBoxTransformLayerNode &node
     return BoundingBoxTransformLayer::validate(input, output, deltas, bbox_info);
 }
 
+/** Validates a Cast layer node
+ *
+ * @tparam CastLayer Cast layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename CastLayer>
+Status validate_cast_layer(CastLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating CastLayer node with ID : " << node.id() << " and Name: " << node.name()
+                                                                         << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return CastLayer::validate(input, output, node.convert_policy());
+}
+
 /** Validates a Channel Shuffle layer node
  *
  * @tparam ChannelShuffleLayer  Channel Shuffle layer function type
@@ -194,6 +219,82 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     return status;
 }
 
+/** Validates a Convolution layer node accumulating a residual tensor into its output
+ *
+ * @tparam GEMMConv2d           GEMM-based direct convolution function type
+ * @tparam GEMMConvolutionLayer GEMM Convolution layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GEMMConv2d, typename GEMMConvolutionLayer>
+Status validate_convolution_layer_with_residual(ConvolutionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating ConvolutionLayer node with residual with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.input(ConvolutionLayerNode::residual_input_idx) != node.output(0),
+                                    "The residual must be accumulated in place");
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+
+    // Validate function
+    const Conv2dInfo conv2d_info(conv_info, Size2D(1U, 1U), fused_act, fast_math, 1U, WeightsInfo(),
+                                 true /* accumulate */);
+    if (bool(GEMMConv2d::validate(input, weights, biases, output, conv2d_info)))
+    {
+        return Status{};
+    }
+    return GEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                          fused_act, fast_math, 1U, true /* accumulate */);
+}
+
+/** Validates a Fused Convolution Batch Normalization layer node accumulating a residual tensor into its output
+ *
+ * @tparam GEMMConvolutionLayer GEMM Convolution layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GEMMConvolutionLayer>
+Status validate_fused_convolution_batch_normalization_layer_with_residual(FusedConvolutionBatchNormalizationNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionBatchNormalizationLayer node with residual with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 8);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.input(FusedConvolutionBatchNormalizationNode::residual_input_idx) !=
+                                        node.output(0),
+                                    "The residual must be accumulated in place");
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+
+    // The batch normalization always leaves the convolution with a bias, one per output feature map
+    const TensorInfo biases(TensorShape(weights->dimension(3)), 1, input->data_type());
+
+    // Validate function
+    return GEMMConvolutionLayer::validate(input, weights, &biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                          fused_act, fast_math, 1U, true /* accumulate */);
+}
+
 /** Validates a Depthwise Convolution layer node
  *
  * @tparam DepthwiseConvolutionLayer    Default Depthwise Convolution layer type
@@ -768,6 +869,33 @@ Status validate_unary_eltwise_layer(UnaryEltwiseLayerNode &node)
 
     return Status{};
 }
+
+/** Validates a fused element-wise chain node
+ *
+ * @tparam FusedElementwiseFunction Backend fused element-wise function
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename FusedElementwiseFunction>
+Status validate_fused_elementwise_layer(FusedElementwiseLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedElementwiseLayer node with ID : " << node.id() << " and Name: "
+                                                                                     << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract inputs and output
+    std::vector<const arm_compute::ITensorInfo *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor_info(node.input(i)));
+    }
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    // Validate function
+    return FusedElementwiseFunction::validate(inputs, output, node.chain());
+}
 } // namespace detail
 } // namespace backends
 } // namespace graph
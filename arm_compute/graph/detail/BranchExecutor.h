@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_BRANCHEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_BRANCHEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionTask;
+
+namespace detail
+{
+/** Executes the independent tasks of a workload concurrently
+ *
+ * A task is started as soon as all the tasks it depends on have completed, on the first idle branch. A task
+ * running alone gets the whole thread pool of the scheduler of the calling thread, concurrent tasks share the
+ * threads evenly: when a branch runs out of ready tasks, its threads go to the tasks started afterwards.
+ */
+class BranchExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_branches Maximum number of tasks executed concurrently
+     * @param[in] num_threads  Number of threads shared between the branches
+     */
+    BranchExecutor(unsigned int num_branches, unsigned int num_threads);
+    /** Prevent instances of this class from being copied */
+    BranchExecutor(const BranchExecutor &) = delete;
+    /** Prevent instances of this class from being copied */
+    BranchExecutor &operator=(const BranchExecutor &) = delete;
+    /** Destructor, joins the worker threads */
+    ~BranchExecutor();
+    /** Returns the maximum number of tasks executed concurrently
+     *
+     * @return Maximum number of tasks executed concurrently
+     */
+    unsigned int num_branches() const;
+    /** Executes tasks as their dependencies complete and waits for all of them
+     *
+     * @param[in] tasks      Tasks to execute, in topological order
+     * @param[in] dependents Indices of the tasks waiting for each task, all greater than the index of the task
+     */
+    void run(std::vector<ExecutionTask> &tasks, const std::vector<std::vector<unsigned int>> &dependents);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_BRANCHEXECUTOR_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_DYNAMICBATCHEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_DYNAMICBATCHEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/TensorDescriptor.h"
+#include "arm_compute/graph/Types.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Input or output of a graph whose batch is chosen at execution time */
+struct BatchedTensor
+{
+    NodeID           node_id{EmptyNodeID}; /**< Input or output node */
+    TensorDescriptor desc{};               /**< Descriptor of the tensor for the maximum batch */
+    unsigned int     dimension{0};         /**< Dimension holding the samples */
+    unsigned int     sample_size{1};       /**< Elements of a sample along the batch dimension */
+};
+
+/** Executes a graph lowered to a chunk of its batch over any batch up to the maximum one
+ *
+ * The accessors of the inputs and outputs see tensors holding the requested batch. Consecutive chunks of the batch
+ * are copied to the inputs of the graph and run one after the other, so the functions of the graph and their
+ * prepared weights are reused whatever the batch is.
+ */
+class DynamicBatchExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] inputs         Inputs of the graph
+     * @param[in] outputs        Outputs of the graph
+     * @param[in] max_batch_size Batch the graph was built with
+     * @param[in] chunk_size     Batch the graph was lowered to
+     */
+    DynamicBatchExecutor(std::vector<BatchedTensor> inputs,
+                         std::vector<BatchedTensor> outputs,
+                         unsigned int               max_batch_size,
+                         unsigned int               chunk_size);
+    /** Prevent instances of this class from being copied */
+    DynamicBatchExecutor(const DynamicBatchExecutor &) = delete;
+    /** Prevent instances of this class from being copied */
+    DynamicBatchExecutor &operator=(const DynamicBatchExecutor &) = delete;
+    /** Default destructor */
+    ~DynamicBatchExecutor();
+    /** Returns the batch the graph was built with
+     *
+     * @return Maximum batch
+     */
+    unsigned int max_batch_size() const;
+    /** Returns the batch of the next executions
+     *
+     * @return Batch
+     */
+    unsigned int batch_size() const;
+    /** Sets the batch of the next executions
+     *
+     * @param[in] batch_size Batch, between 1 and @ref max_batch_size()
+     */
+    void set_batch_size(unsigned int batch_size);
+    /** Executes a workload until its input accessors have no more data or its output accessors expect no more
+     *
+     * @param[in] workload Workload to execute
+     */
+    void run(ExecutionWorkload &workload);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+/** Lowers the batch of a graph to a chunk of samples
+ *
+ * The batch is the batch dimension of the data layout of the inputs of the graph, it must be greater than 1. The inputs
+ * are replaced by inputs holding a chunk of the batch and the descriptors of the graph are updated accordingly.
+ *
+ * @note Must be called before the tensors of the graph are configured.
+ *
+ * @param[in, out] g          Graph to lower
+ * @param[in]      chunk_size Number of samples the graph runs at once
+ *
+ * @return Executor of the lowered graph, nullptr if the graph has no input
+ */
+std::shared_ptr<DynamicBatchExecutor> lower_batch_size(Graph &g, unsigned int chunk_size);
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_DYNAMICBATCHEXECUTOR_H
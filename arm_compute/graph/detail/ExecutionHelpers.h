@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -116,6 +116,26 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  * @param[in] workload Workload to prepare
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
+/** Finds the tasks of a workload waiting for each task to execute the independent ones concurrently
+ *
+ * A task waits for the tasks producing its inputs, through the nodes without a task. Nothing is done if the
+ * tasks form a single chain. Only workloads whose tasks all run on the CPU are executed concurrently.
+ *
+ * @param[in, out] workload     Workload to find the dependencies of the tasks of
+ * @param[in]      node_order   Topologically sorted nodes of the graph
+ * @param[in]      num_branches Maximum number of tasks executed concurrently
+ */
+void configure_task_dependencies(ExecutionWorkload         &workload,
+                                 const std::vector<NodeID> &node_order,
+                                 unsigned int               num_branches);
+/** Splits the tasks of a workload in the pipeline stages assigned to their nodes
+ *
+ * The tasks reading a tensor produced by a previous stage run first in their stage. Nothing is done if the
+ * graph has not been split by a @ref PipelineStageMutator.
+ *
+ * @param[in, out] workload Workload to split the tasks of
+ */
+void configure_pipeline_stages(ExecutionWorkload &workload);
 /** Executes all tasks of a workload
  *
  * @param[in] workload Workload to execute
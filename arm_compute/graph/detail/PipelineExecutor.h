@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINEEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINEEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Tasks of a pipeline stage */
+struct PipelineStage
+{
+    std::vector<unsigned int> input_tasks{}; /**< Tasks copying the tensors received from the previous stage */
+    std::vector<unsigned int> tasks{};       /**< Remaining tasks of the stage in execution order */
+};
+
+/** Streams consecutive inferences through the pipeline stages of a workload
+ *
+ * Every stage runs on its own thread with a scheduler pinned to a separate group of cores. A stage starts the
+ * next inference as soon as the following stage has copied the tensors it produced for the previous one.
+ */
+class PipelineExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] stages      Tasks of each stage, indexing the tasks of the workload
+     * @param[in] num_threads Number of threads shared between the stages
+     */
+    PipelineExecutor(std::vector<PipelineStage> stages, unsigned int num_threads);
+    /** Prevent instances of this class from being copied */
+    PipelineExecutor(const PipelineExecutor &) = delete;
+    /** Prevent instances of this class from being copied */
+    PipelineExecutor &operator=(const PipelineExecutor &) = delete;
+    /** Destructor, joins the threads of the stages */
+    ~PipelineExecutor();
+    /** Returns the number of pipeline stages
+     *
+     * @return Number of pipeline stages
+     */
+    unsigned int num_stages() const;
+    /** Executes a workload until its input accessors have no more data or its output accessors expect no more
+     *
+     * @note The input accessors are called from the thread of the first stage and the output accessors from the
+     *       thread of the last stage. The input accessors can be called for up to @ref num_stages() - 1 inferences
+     *       after the one the output accessors stopped at.
+     *
+     * @param[in] workload Workload to execute
+     */
+    void run(ExecutionWorkload &workload);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINEEXECUTOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,13 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Sets the batch of the next executions of the stream
+     *
+     * @note The stream must have been finalized with a non-zero @ref GraphConfig::batch_chunk_size
+     *
+     * @param[in] batch_size Batch, up to the one of the inputs the stream was built with
+     */
+    void set_batch_size(unsigned int batch_size);
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
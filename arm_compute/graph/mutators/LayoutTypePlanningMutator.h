@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTTYPEPLANNINGMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTTYPEPLANNINGMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/Types.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to choose the data layout and the data type of each node
+ *
+ * The nodes are visited in topological order and each node that can run in more than one configuration picks
+ * the cheapest one according to a cost model of the node and of the conversions of its inputs. The layout can be
+ * NCHW or NHWC, the data type F32 or F16, and F32 convolutions and fully connected layers can run with BF16
+ * fast math. Permute and cast nodes are inserted where consecutive nodes disagree, the graph inputs and outputs
+ * keep the layout and data type they were created with.
+ *
+ * @note The accessors of the constant tensors must fill them in the planned layout and data type,
+ *       as NumPyBinLoader does.
+ */
+class LayoutTypePlanningMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] target         Target the graph will be executed on
+     * @param[in] plan_layout    Choose the data layout of the nodes
+     * @param[in] plan_data_type Lower the precision of the F32 nodes where the target supports it
+     */
+    LayoutTypePlanningMutator(Target target, bool plan_layout, bool plan_data_type);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    Target _target;
+    bool   _plan_layout;
+    bool   _plan_data_type;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTTYPEPLANNINGMUTATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,10 +43,20 @@ namespace graph
 class NodeExecutionMethodMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] use_convolution_tuner (Optional) Reset the method of the CPU convolutions to the default one, so that
+     *                                  it is picked by the convolution tuner set on the scheduler. Defaults to false
+     */
+    explicit NodeExecutionMethodMutator(bool use_convolution_tuner = false);
+
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char  *name() override;
+
+private:
+    bool _use_convolution_tuner;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,10 +39,21 @@ namespace graph
 class NodeFusionMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] fuse_f16_elementwise_chains (Optional) Fuse the chains of F16 element-wise nodes as well as the F32 ones.
+     *                                        The fused chains keep their intermediate results in F32, so the results of
+     *                                        F16 chains differ from the ones of the unfused nodes. Defaults to false
+     */
+    explicit NodeFusionMutator(bool fuse_f16_elementwise_chains = false);
+
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char  *name() override;
+
+private:
+    bool _fuse_f16_elementwise_chains;
 };
 } // namespace graph
 } // namespace arm_compute
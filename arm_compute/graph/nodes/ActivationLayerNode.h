@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,11 @@ public:
      * @return The activation info of the layer
      */
     ActivationLayerInfo activation_info() const;
+    /** Output quantization info accessor
+     *
+     * @return The output quantization info, empty if the output keeps the quantization of the input
+     */
+    QuantizationInfo output_quantization_info() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,6 +99,22 @@ public:
      * @param[in] info Convolution info to set
      */
     void set_convolution_info(PadStrideInfo info);
+    /** Sets the quantization info of the output
+     *
+     * @param[in] out_quant_info Output quantization info to set
+     */
+    void set_output_quantization_info(QuantizationInfo out_quant_info);
+    /** Adds an input through which a residual tensor is accumulated into the output
+     *
+     * @note The residual is bound to input @ref residual_input_idx and is expected to be the output tensor of the node
+     *       as well, so that the node computes fused_activation(conv(input) + bias + residual) in place.
+     */
+    void enable_residual_input();
+    /** Checks if the node accumulates a residual tensor into its output
+     *
+     * @return True if the node has a residual input
+     */
+    bool has_residual_input() const;
     /** Computes convolution output descriptor
      *
      * @param[in] input_descriptor   Input descriptor
@@ -119,6 +135,8 @@ public:
 
 public:
     static constexpr NodeType node_type = NodeType::ConvolutionLayer;
+    /** Index of the residual input, see @ref enable_residual_input */
+    static constexpr size_t residual_input_idx = 3;
 
 private:
     PadStrideInfo       _info;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,6 +87,11 @@ public:
      * @param[in] info Convolution info to set
      */
     void set_convolution_info(PadStrideInfo info);
+    /** Sets the quantization info of the output
+     *
+     * @param[in] out_quant_info Output quantization info to set
+     */
+    void set_output_quantization_info(QuantizationInfo out_quant_info);
     /** Computes depthwise convolution output descriptor
      *
      * @param[in] input_descriptor   Input descriptor
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,6 +64,11 @@ public:
      * @param[in] fused_activation Fused activation to set
      */
     void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Sets the quantization info of the output
+     *
+     * @param[in] out_quant_info Output quantization info to set
+     */
+    void set_output_quantization_info(QuantizationInfo out_quant_info);
     /** Computes weights descriptor
      *
      * @warning Works for inputs with 1D batch space
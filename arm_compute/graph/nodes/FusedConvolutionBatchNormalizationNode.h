@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -123,6 +123,19 @@ public:
      */
     PadStrideInfo convolution_info() const;
 
+    /** Adds an input through which a residual tensor is accumulated into the output
+     *
+     * @note The residual is bound to input @ref residual_input_idx and is expected to be the output tensor of the node
+     *       as well, so that the node computes fused_activation(batch_norm(conv(input)) + residual) in place.
+     */
+    void enable_residual_input();
+
+    /** Checks if the node accumulates a residual tensor into its output
+     *
+     * @return True if the node has a residual input
+     */
+    bool has_residual_input() const;
+
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
@@ -131,6 +144,8 @@ public:
 
 public:
     static constexpr NodeType node_type = NodeType::FusedConvolutionBatchNormalizationLayer;
+    /** Index of the residual input, see @ref enable_residual_input */
+    static constexpr size_t residual_input_idx = 7;
 
 private:
     float _epsilon;
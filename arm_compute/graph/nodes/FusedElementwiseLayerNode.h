@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISELAYERNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISELAYERNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused element-wise chain node
+ *
+ * Replaces a chain of element-wise and activation nodes, evaluating it in a single pass over the data.
+ */
+class FusedElementwiseLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_inputs Number of inputs of the chain
+     * @param[in] chain      Steps of the chain, applied in order to the first input
+     */
+    FusedElementwiseLayerNode(unsigned int num_inputs, ElementwiseChainInfo chain);
+    /** Chain accessor
+     *
+     * @return Steps of the chain
+     */
+    const ElementwiseChainInfo &chain() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::FusedElementwiseLayer;
+
+private:
+    ElementwiseChainInfo _chain;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISELAYERNODE_H
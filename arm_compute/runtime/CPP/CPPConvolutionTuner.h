@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPCONVOLUTIONTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPCONVOLUTIONTUNER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner of the method used by the CPU convolutions
+ *
+ * The table maps a convolution configuration (shapes, data types, convolution info, CPU model, number of threads...) to
+ * the method (GEMM, GEMM_CONV2D, DIRECT or WINOGRAD) to use instead of the one picked by the heuristics of
+ * @ref NEConvolutionLayer. Once set with @ref CPPRuntimeContext::set_convolution_tuner on the runtime context of the calling
+ * thread, the convolutions look their configuration up in the table when their method is selected. If tuning of new
+ * convolutions is enabled, every method supporting a convolution missing from the table is configured and timed on
+ * scratch tensors, and the fastest one is added to the table, which can then be saved to a file and reloaded in
+ * production.
+ *
+ * @note The convolutions must be configured with the same number of threads as in production for the table to apply.
+ */
+class CPPConvolutionTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_convolutions Find the fastest method of the convolutions which are not present in the table?
+     */
+    explicit CPPConvolutionTuner(bool tune_new_convolutions = true);
+    /** Destructor */
+    ~CPPConvolutionTuner();
+
+    /** Setter for tune_new_convolutions option
+     *
+     * @param[in] tune_new_convolutions Find the fastest method of the convolutions which are not present in the table?
+     */
+    void set_tune_new_convolutions(bool tune_new_convolutions);
+    /** Tune convolutions that are not in the method table
+     *
+     * @return True if tuning of new convolutions is enabled.
+     */
+    bool tune_new_convolutions() const;
+
+    /** Manually add the method to use for a convolution
+     *
+     * @param[in] conv_id Unique identifier of the convolution configuration
+     * @param[in] method  Method to use for the given convolution
+     */
+    void add_method(const std::string &conv_id, ConvolutionMethod method);
+    /** Look up the method to use for a convolution
+     *
+     * @param[in]  conv_id Unique identifier of the convolution configuration
+     * @param[out] method  Method found in the table
+     *
+     * @return True if the convolution is in the table.
+     */
+    bool find_method(const std::string &conv_id, ConvolutionMethod &method) const;
+    /** Give read access to the method table
+     *
+     * @return The method table as unordered_map container
+     */
+    const std::unordered_map<std::string, ConvolutionMethod> &method_table() const;
+
+    /** Load the method table from file
+     *
+     * @param[in] filename Load the method table from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the method table to file
+     *
+     * @param[in] filename Save the method table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPCONVOLUTIONTUNER_H
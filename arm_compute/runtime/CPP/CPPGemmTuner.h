@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPGEMMTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPGEMMTUNER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner of the assembly kernels used by the CPU GEMMs
+ *
+ * The table maps a GEMM configuration (shape, data types, CPU model, number of threads...) to the name of the arm_gemm
+ * kernel to use instead of the one picked by the heuristics. Once set with @ref CPPRuntimeContext::set_gemm_tuner on
+ * the runtime context of the calling thread, the assembly GEMMs look their configuration up in the table when they are
+ * configured. If tuning of new GEMMs is enabled, all the kernels supporting a GEMM missing from the table are
+ * benchmarked at configure time and the fastest one is added to the table, which can then be saved to a file and
+ * reloaded in production.
+ *
+ * @note The GEMMs must be configured with the same number of threads as in production for the table to apply.
+ */
+class CPPGemmTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_gemms Find the optimal kernel for the GEMMs which are not present in the table?
+     */
+    explicit CPPGemmTuner(bool tune_new_gemms = true);
+    /** Destructor */
+    ~CPPGemmTuner();
+
+    /** Setter for tune_new_gemms option
+     *
+     * @param[in] tune_new_gemms Find the optimal kernel for the GEMMs which are not present in the table?
+     */
+    void set_tune_new_gemms(bool tune_new_gemms);
+    /** Tune GEMMs that are not in the kernel table
+     *
+     * @return True if tuning of new GEMMs is enabled.
+     */
+    bool tune_new_gemms() const;
+
+    /** Manually add the kernel to use for a GEMM
+     *
+     * @param[in] gemm_id     Unique identifier of the GEMM configuration
+     * @param[in] kernel_name Name of the arm_gemm kernel to use for the given GEMM
+     */
+    void add_kernel(const std::string &gemm_id, const std::string &kernel_name);
+    /** Look up the kernel to use for a GEMM
+     *
+     * @param[in]  gemm_id     Unique identifier of the GEMM configuration
+     * @param[out] kernel_name Name of the arm_gemm kernel found in the table
+     *
+     * @return True if the GEMM is in the table.
+     */
+    bool find_kernel(const std::string &gemm_id, std::string &kernel_name) const;
+    /** Give read access to the kernel table
+     *
+     * @return The kernel table as unordered_map container
+     */
+    const std::unordered_map<std::string, std::string> &kernel_table() const;
+
+    /** Load the kernel table from file
+     *
+     * @param[in] filename Load the kernel table from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the kernel table to file
+     *
+     * @param[in] filename Save the kernel table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPGEMMTUNER_H
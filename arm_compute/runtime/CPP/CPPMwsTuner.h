@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPMWSTUNER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPMWSTUNER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+class ICPPKernel;
+class Window;
+
+/** Tuner of the minimum workload size (MWS) used by the CPU schedulers to split the kernels' execution windows
+ *
+ * The table maps a kernel, a CPU model, a number of threads and the shape of the execution window to the MWS to use
+ * instead of the value returned by @ref ICPPKernel::get_mws. Once set with @ref CPPRuntimeContext::set_mws_tuner on the
+ * runtime context of the calling thread, the scheduler looks the kernels up in the table when it builds their dispatch
+ * plan. If tuning of new kernels is enabled, the kernels missing from the table are timed with different splits at that
+ * point and the fastest one is added to the table, which can then be saved to a file and reloaded in production.
+ *
+ * Tuning runs the kernels on scratch copies of their tensors, so the tensors of the actual run are left untouched.
+ * Kernels without a tensor pack, which are bound to their tensors at configure time, are not tuned.
+ */
+class CPPMwsTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_kernels Find the optimal MWS for the kernels which are not present in the table?
+     */
+    explicit CPPMwsTuner(bool tune_new_kernels = true);
+    /** Destructor */
+    ~CPPMwsTuner();
+
+    /** Setter for tune_new_kernels option
+     *
+     * @param[in] tune_new_kernels Find the optimal MWS for the kernels which are not present in the table?
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+    /** Tune kernels that are not in the MWS table
+     *
+     * @return True if tuning of new kernels is enabled.
+     */
+    bool tune_new_kernels() const;
+
+    /** Manually add the MWS of a kernel
+     *
+     * @param[in] kernel_id Unique identifier of the kernel, CPU model and number of threads. See @ref kernel_id
+     * @param[in] mws       Minimum workload size to use for the given kernel
+     */
+    void add_mws(const std::string &kernel_id, std::size_t mws);
+    /** Look up the MWS of a kernel
+     *
+     * @param[in]  kernel_id Unique identifier of the kernel, CPU model and number of threads. See @ref kernel_id
+     * @param[out] mws       Minimum workload size found in the table
+     *
+     * @return True if the kernel is in the table.
+     */
+    bool find_mws(const std::string &kernel_id, std::size_t &mws) const;
+    /** Get a snapshot of the MWS table
+     *
+     * @return A copy of the MWS table, taken while no other thread updates it
+     */
+    std::unordered_map<std::string, std::size_t> mws_table() const;
+
+    /** Load the MWS table from file
+     *
+     * @param[in] filename Load the MWS table from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the MWS table to file
+     *
+     * @param[in] filename Save the MWS table to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+    /** Identifier of a kernel in the MWS table
+     *
+     * @param[in] kernel      Kernel to identify
+     * @param[in] cpu_info    CPU the kernel runs on
+     * @param[in] num_threads Number of threads the kernel is split between
+     * @param[in] window      Execution window of the kernel
+     *
+     * @return The kernel identifier
+     */
+    static std::string
+    kernel_id(const ICPPKernel &kernel, const CPUInfo &cpu_info, unsigned int num_threads, const Window &window);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPMWSTUNER_H
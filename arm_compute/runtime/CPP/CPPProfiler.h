@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPPROFILER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPPROFILER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Profiler of the CPU executions
+ *
+ * Once set with @ref CPPRuntimeContext::set_profiler on the runtime context of the calling thread, the scheduler
+ * records the wall time of every kernel it runs, with the number of threads sharing it, how busy they were and the
+ * bytes of the tensors it read and wrote, and the wall time of every workload run by its threads. The graph API records
+ * the wall time of its nodes as well. The events can be saved as a Chrome trace, which chrome://tracing and Perfetto
+ * display as a timeline per thread.
+ *
+ * Every thread records its events into a buffer preallocated on its first event, which keeps the last events once it
+ * is full. The names of the events are copied once per distinct name, and recording an event doesn't allocate.
+ *
+ * @note The profiler is meant to locate the hot layers, not to measure the absolute performance of a network.
+ */
+class CPPProfiler
+{
+public:
+    /** Clock of the events */
+    using Clock = std::chrono::steady_clock;
+
+    /** Profiled event */
+    struct Event
+    {
+        const char  *name{""};         /**< Name of the node, kernel or workloads, valid as long as the profiler */
+        const char  *category{""};     /**< Category of the event: "node", "kernel" or "workload" */
+        unsigned int thread{0};        /**< Index of the thread, in the order the threads recorded their first event */
+        double       start_us{0.};     /**< Start time in microseconds since the creation of the profiler */
+        double       duration_us{0.};  /**< Wall time in microseconds */
+        std::size_t  bytes{0};         /**< Bytes of the tensors read and written, 0 if unknown */
+        unsigned int num_threads{1};   /**< Number of threads sharing the event */
+        float        utilisation{1.f}; /**< Share of the wall time the threads sharing the event were busy */
+    };
+
+    /** Default number of events kept per thread */
+    static constexpr std::size_t default_max_events_per_thread = 16384;
+
+    /** Constructor
+     *
+     * @param[in] max_events_per_thread (Optional) Number of events kept per thread, the oldest ones are dropped past it
+     */
+    explicit CPPProfiler(std::size_t max_events_per_thread = default_max_events_per_thread);
+    /** Destructor */
+    ~CPPProfiler();
+
+    /** Record an event run by the calling thread
+     *
+     * @param[in] name        Name of the node, kernel or workloads. Only needs to be valid during the call.
+     * @param[in] category    Category of the event. Only needs to be valid during the call.
+     * @param[in] start       Start time
+     * @param[in] end         End time
+     * @param[in] bytes       (Optional) Bytes of the tensors read and written, 0 if unknown
+     * @param[in] num_threads (Optional) Number of threads sharing the event
+     * @param[in] utilisation (Optional) Share of the wall time the threads sharing the event were busy
+     */
+    void add_event(const char       *name,
+                   const char       *category,
+                   Clock::time_point start,
+                   Clock::time_point end,
+                   std::size_t       bytes       = 0,
+                   unsigned int      num_threads = 1,
+                   float             utilisation = 1.f);
+    /** Get the recorded events
+     *
+     * @return A copy of the events kept, sorted by start time
+     */
+    std::vector<Event> events() const;
+    /** Get the number of events dropped because the buffer of their thread was full
+     *
+     * @return The number of dropped events
+     */
+    std::size_t num_dropped_events() const;
+    /** Drop the recorded events */
+    void clear();
+
+    /** Save the recorded events as a Chrome trace
+     *
+     * @param[in] filename Save the trace to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPPROFILER_H
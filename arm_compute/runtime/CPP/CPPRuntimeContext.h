@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPRUNTIMECONTEXT_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPRUNTIMECONTEXT_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+class CPPConvolutionTuner;
+class CPPGemmTuner;
+class CPPMwsTuner;
+class CPPProfiler;
+class CPPWeightsCache;
+
+/** Tuners, prepared weights cache and profiler used by the CPU functions and schedulers
+ *
+ * The context doesn't own any of them: they must outlive it or be reset before being destroyed. A context takes
+ * effect on the threads it is installed on with @ref CPPRuntimeContextScope: the functions configured, prepared and
+ * run on such a thread, and the kernels they dispatch to any scheduler, use it. The graph API installs the context of
+ * its @ref graph::GraphContext on the threads running the graph.
+ */
+class CPPRuntimeContext
+{
+public:
+    /** Set the tuner providing the minimum workload size of the kernels
+     *
+     * @param[in] tuner (Optional) Minimum workload size tuner. Pass nullptr to use the kernels' own get_mws() values.
+     */
+    void set_mws_tuner(CPPMwsTuner *tuner);
+    /** Get the minimum workload size tuner
+     *
+     * @return The tuner set with @ref set_mws_tuner or nullptr.
+     */
+    CPPMwsTuner *mws_tuner() const;
+
+    /** Set the tuner providing the assembly kernels of the CPU GEMMs
+     *
+     * @note Only the GEMMs configured after this call use the tuner.
+     *
+     * @param[in] tuner (Optional) GEMM tuner. Pass nullptr to let the heuristics pick the kernels.
+     */
+    void set_gemm_tuner(CPPGemmTuner *tuner);
+    /** Get the tuner providing the assembly kernels of the CPU GEMMs
+     *
+     * @return The tuner set with @ref set_gemm_tuner or nullptr.
+     */
+    CPPGemmTuner *gemm_tuner() const;
+
+    /** Set the tuner providing the method of the CPU convolutions
+     *
+     * @note Only the convolutions configured after this call use the tuner.
+     *
+     * @param[in] tuner (Optional) Convolution tuner. Pass nullptr to let the heuristics pick the methods.
+     */
+    void set_convolution_tuner(CPPConvolutionTuner *tuner);
+    /** Get the tuner providing the method of the CPU convolutions
+     *
+     * @return The tuner set with @ref set_convolution_tuner or nullptr.
+     */
+    CPPConvolutionTuner *convolution_tuner() const;
+
+    /** Set the cache of the weights prepared by the CPU functions
+     *
+     * @note Only the functions prepared after this call use the cache.
+     *
+     * @param[in] cache (Optional) Prepared weights cache. Pass nullptr to always prepare the weights.
+     */
+    void set_weights_cache(CPPWeightsCache *cache);
+    /** Get the cache of the weights prepared by the CPU functions
+     *
+     * @return The cache set with @ref set_weights_cache or nullptr.
+     */
+    CPPWeightsCache *weights_cache() const;
+
+    /** Set the profiler recording the kernels and workloads run
+     *
+     * @param[in] profiler (Optional) Profiler. Pass nullptr to stop profiling.
+     */
+    void set_profiler(CPPProfiler *profiler);
+    /** Get the profiler recording the kernels and workloads run
+     *
+     * @return The profiler set with @ref set_profiler or nullptr.
+     */
+    CPPProfiler *profiler() const;
+
+    /** Access the context installed on the calling thread
+     *
+     * @return The installed context, or an empty context if there is none.
+     */
+    static const CPPRuntimeContext &get();
+    /** Get the context installed on the calling thread
+     *
+     * @return The installed context, or nullptr if there is none.
+     */
+    static CPPRuntimeContext *thread_context();
+    /** Install a context on the calling thread
+     *
+     * @note Prefer @ref CPPRuntimeContextScope, which restores the previous context.
+     *
+     * @param[in] ctx Context to use on the calling thread, nullptr to remove it.
+     */
+    static void set_thread_context(CPPRuntimeContext *ctx);
+
+private:
+    CPPMwsTuner         *_mws_tuner{nullptr};
+    CPPGemmTuner        *_gemm_tuner{nullptr};
+    CPPConvolutionTuner *_convolution_tuner{nullptr};
+    CPPWeightsCache     *_weights_cache{nullptr};
+    CPPProfiler         *_profiler{nullptr};
+};
+
+/** Installs a runtime context on the calling thread for the lifetime of the object */
+class CPPRuntimeContextScope final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] ctx Context to install. Pass nullptr to run without a context.
+     */
+    explicit CPPRuntimeContextScope(CPPRuntimeContext *ctx);
+    /** Prevent instances of this class from being copied */
+    CPPRuntimeContextScope(const CPPRuntimeContextScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    CPPRuntimeContextScope &operator=(const CPPRuntimeContextScope &) = delete;
+    /** Destructor: restore the context installed before */
+    ~CPPRuntimeContextScope();
+
+private:
+    CPPRuntimeContext *_previous;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPRUNTIMECONTEXT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,9 @@ namespace arm_compute
  * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ *
+ * Inside a parallel region (see @ref IScheduler::begin_parallel_region) the threads spin between dispatches instead
+ * of going back to sleep, unless there are more threads than cores.
 */
 class CPPScheduler final : public IScheduler
 {
@@ -64,6 +67,8 @@ public:
     unsigned int num_threads() const override;
     void         schedule(ICPPKernel *kernel, const Hints &hints) override;
     void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+    void begin_parallel_region() override;
+    void end_parallel_region() override;
 
 protected:
     /** Will run the workloads in parallel using num_threads
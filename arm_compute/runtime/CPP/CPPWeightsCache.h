@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWEIGHTSCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWEIGHTSCACHE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+class CPUInfo;
+class ITensor;
+
+/** Cache of the prepared weights of the CPU functions
+ *
+ * Preparing a function reshapes its constant weights into the layout expected by its kernels (pretransposed B of the
+ * assembly GEMMs, Winograd-transformed weights, packed parameters of the assembly depthwise convolutions), which can
+ * dominate the start-up time of a network. Once set with @ref CPPRuntimeContext::set_weights_cache on the runtime
+ * context of the calling thread, the functions look their prepared weights up in the cache when they are prepared and
+ * copy them instead of running the transformation. If storing of new weights is enabled, the weights prepared by the
+ * functions are added to the cache, which can then be saved to a file and reloaded on the next start.
+ *
+ * The weights are identified by the name of the kernel consuming them, the configuration of the function, the data
+ * type, shape and content of the original weights and the CPU features, so a cache file written on a different
+ * machine or for a different network is simply not used.
+ *
+ * @note The weights loaded from a file are only read from it when a function looks them up.
+ */
+class CPPWeightsCache
+{
+public:
+    /** Constructor
+     *
+     * @param[in] store_new_weights Add the weights prepared by the functions to the cache if they are not present?
+     */
+    explicit CPPWeightsCache(bool store_new_weights = true);
+    /** Destructor */
+    ~CPPWeightsCache();
+
+    /** Setter for store_new_weights option
+     *
+     * @param[in] store_new_weights Add the weights prepared by the functions to the cache if they are not present?
+     */
+    void set_store_new_weights(bool store_new_weights);
+    /** Store the weights prepared by the functions which are not in the cache
+     *
+     * @return True if storing of new weights is enabled.
+     */
+    bool store_new_weights() const;
+
+    /** Compute the identifier of prepared weights
+     *
+     * @param[in] kernel_name Name of the kernel consuming the prepared weights.
+     * @param[in] config      Configuration of the function which affects the prepared weights.
+     * @param[in] weights     Tensors the prepared weights are computed from. Null tensors are ignored.
+     * @param[in] cpu_info    Information of the CPU the weights are prepared for.
+     *
+     * @return The identifier of the prepared weights.
+     */
+    static std::string weights_id(const std::string                 &kernel_name,
+                                  const std::string                 &config,
+                                  const std::vector<const ITensor *> &weights,
+                                  const CPUInfo                     &cpu_info);
+
+    /** Add prepared weights to the cache
+     *
+     * @param[in] weights_id Identifier of the prepared weights returned by @ref weights_id
+     * @param[in] data       Prepared weights to copy in the cache.
+     * @param[in] size       Size in bytes of the prepared weights.
+     */
+    void add_weights(const std::string &weights_id, const void *data, size_t size);
+    /** Look prepared weights up and copy them
+     *
+     * @param[in]  weights_id Identifier of the prepared weights returned by @ref weights_id
+     * @param[out] data       Buffer to copy the prepared weights to.
+     * @param[in]  size       Size in bytes of the buffer.
+     *
+     * @return True if the weights are in the cache with the given size and were copied to the buffer.
+     */
+    bool find_weights(const std::string &weights_id, void *data, size_t size) const;
+    /** Number of prepared weights in the cache
+     *
+     * @return The number of entries in the cache.
+     */
+    size_t num_weights() const;
+
+    /** Load the cache from file
+     *
+     * @param[in] filename Load the cache from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the cache to file
+     *
+     * @param[in] filename Save the cache to this file. (Content will be overwritten)
+     *
+     * @return true if the file was created
+     */
+    bool save_to_file(const std::string &filename) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWEIGHTSCACHE_H
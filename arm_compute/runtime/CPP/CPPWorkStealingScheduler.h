@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWORKSTEALINGSCHEDULER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWORKSTEALINGSCHEDULER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** C++11 pool of spinning worker threads that balance a kernel's workloads by work stealing.
+ *
+ * Compared to @ref CPPScheduler, which wakes every worker through its own mutex and condition variable and
+ * hands out workloads through a single shared counter, this scheduler:
+ * - Gives each thread a contiguous range of workloads in its own lock-free queue. Owners pop from the front
+ *   of their queue and idle threads steal half of the remaining range from the back of a peer's queue.
+ * - Publishes new work by bumping an atomic generation counter. Idle workers poll it for a bounded number of
+ *   iterations before parking on a condition variable, so back-to-back kernel launches do not pay a
+ *   sleep/wake-up cycle.
+ *
+ * The number of polling iterations can be overridden via the environment variable
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_COUNT or @ref CPPWorkStealingScheduler::set_spin_count. A spin count of 0
+ * makes idle workers park immediately. Spinning is disabled when there are more threads than cores.
+ *
+ * Inside a parallel region (see @ref IScheduler::begin_parallel_region) the workers are woken up once and keep
+ * spinning between the kernels of the region regardless of the spin count.
+ *
+ * @note Spinning workers keep their cores busy for a short while after each run. It is opt-in through
+ *       Scheduler::set(Scheduler::Type::CPP_WORK_STEALING) or SchedulerFactory::Type::CPP_WORK_STEALING.
+ */
+class CPPWorkStealingScheduler final : public IScheduler
+{
+public:
+    /** Constructor: create a pool of threads. */
+    CPPWorkStealingScheduler();
+    /** Default destructor */
+    ~CPPWorkStealingScheduler();
+
+    /** Set the number of polling iterations idle workers perform before parking
+     *
+     * @param[in] spin_count Number of polling iterations. 0 to park immediately.
+     */
+    void set_spin_count(unsigned int spin_count);
+
+    // Inherited functions overridden
+    void         set_num_threads(unsigned int num_threads) override;
+    void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
+    unsigned int num_threads() const override;
+    void         schedule(ICPPKernel *kernel, const Hints &hints) override;
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+    void begin_parallel_region() override;
+    void end_parallel_region() override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_CPPWORKSTEALINGSCHEDULER_H
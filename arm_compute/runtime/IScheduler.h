@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,9 +34,11 @@
 
 #include <functional>
 #include <limits>
+#include <memory>
 
 namespace arm_compute
 {
+class CPPMwsTuner;
 class ICPPKernel;
 class ITensor;
 class Window;
@@ -141,7 +143,7 @@ public:
     IScheduler();
 
     /** Destructor. */
-    virtual ~IScheduler() = default;
+    virtual ~IScheduler();
 
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
@@ -187,6 +189,17 @@ public:
      */
     virtual void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag);
 
+    /** Open a parallel region: a sequence of kernels and workloads is about to be scheduled back to back
+     *
+     * Schedulers supporting it keep their worker threads awake and spinning until the matching call to
+     * @ref end_parallel_region, so that the dispatches of the region cost a single wake-up of the thread pool
+     * instead of one per kernel. Regions can be nested. The default implementation does nothing.
+     */
+    virtual void begin_parallel_region();
+
+    /** Close the parallel region opened by the last call to @ref begin_parallel_region */
+    virtual void end_parallel_region();
+
     /** Get CPU info.
      *
      * @return CPU info.
@@ -211,6 +224,9 @@ protected:
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
 
     /** Common scheduler logic to execute the given kernel
+     *
+     * The split of the window and the resulting workloads are attached to the kernel and reused as long as the window,
+     * the hints and the number of threads don't change, so repeated runs don't allocate.
      *
      * @param[in] kernel  Kernel to execute.
      * @param[in] hints   Hints for the scheduler.
@@ -222,6 +238,9 @@ protected:
     /** Adjust the number of windows to the optimize performance
      * (used for small workloads where smaller number of threads might improve the performance)
      *
+     * The minimum workload size of the kernel is read from the MWS tuner if one is set and knows the kernel,
+     * otherwise from @ref ICPPKernel::get_mws.
+     *
      * @param[in] window           Window to use for kernel execution
      * @param[in] split_dimension  Axis of dimension to split
      * @param[in] init_num_windows Initial number of sub-windows to split
@@ -237,6 +256,33 @@ protected:
                                       const CPUInfo    &cpu_info);
 
 private:
+    struct DispatchPlan;
+
+    /** Split the window of a kernel into the workloads of a dispatch plan
+     *
+     * @param[out] plan   Plan to (re)build.
+     * @param[in]  kernel Kernel to execute.
+     * @param[in]  hints  Hints for the scheduler.
+     * @param[in]  window Window to use for kernel execution.
+     */
+    void build_dispatch_plan(DispatchPlan &plan, ICPPKernel *kernel, const Hints &hints, const Window &window);
+
+    /** Time the given kernel with different splits and add the fastest one to the MWS tuner if it isn't there yet
+     *
+     * The kernel is run on scratch copies of the tensors.
+     *
+     * @param[in] tuner   Tuner to add the kernel to.
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     */
+    void tune_mws(CPPMwsTuner       &tuner,
+                  ICPPKernel        *kernel,
+                  const Hints       &hints,
+                  const Window      &window,
+                  const ITensorPack &tensors);
+
     unsigned int _num_threads_hint = {};
 };
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,9 @@
 #include "arm_compute/runtime/ITransformWeights.h"
 
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -91,7 +94,39 @@ public:
      */
     void pre_mark_as_unused(const ITensor *weights);
 
+    /** Transformed weights shared between functions, indexed by their workspace slot */
+    using SharedWeights = std::map<int, std::unique_ptr<ITensor>>;
+
+    /** Compute the identifier of a weights transformation
+     *
+     * @param[in] uid     Identifier of the transformation function and of its configuration.
+     * @param[in] weights Tensors the transformed weights are computed from. Null tensors are ignored.
+     *
+     * @return The identifier of the transformation, which also depends on the content of the weights.
+     */
+    static std::string transform_id(const std::string &uid, const std::vector<const ITensor *> &weights);
+    /** Share transformed weights with the other functions using this weights manager
+     *
+     * Functions applying the same transformation to the same weights data, like the replicas of a network serving
+     * several requests, only need one read-only copy of the transformed weights. The first function sharing a
+     * transformation registers its tensors, the following ones get these tensors back and can release their own.
+     * The shared tensors are destroyed with the last function holding them.
+     *
+     * @param[in] transform_id Identifier of the transformation returned by @ref transform_id
+     * @param[in] weights      Transformed weights prepared by the calling function.
+     *
+     * @return The transformed weights to use from now on, to be held by the function as long as it uses them.
+     */
+    std::shared_ptr<const SharedWeights> share(const std::string &transform_id, std::shared_ptr<SharedWeights> weights);
+    /** Share the transformed weights with the ones of another weights manager
+     *
+     * @param[in] other Weights manager whose shared transformed weights are also used by this one.
+     */
+    void share_transformed_weights_with(const IWeightsManager &other);
+
 private:
+    struct SharedWeightsRegistry;
+
     struct CounterElement
     {
         bool             is_unused{false};
@@ -102,6 +137,7 @@ private:
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, CounterElement>                   _managed_counter;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::shared_ptr<SharedWeightsRegistry>                      _shared_weights;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IWEIGHTSMANAGER_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Cache of the keys and values of the tokens already processed by an autoregressive decoder
+ *
+ * The keys and values are stored in buffers of shapes [head size, capacity, heads, batches] and
+ * [value size, capacity, heads, batches]. Each append copies the rows of the new tokens only, and the capacity is
+ * doubled when it is exceeded, so appending a token costs a constant amortized time.
+ *
+ * @ref key() and @ref value() return tensors viewing the rows appended so far, of shapes
+ * [head size, length, heads, batches] and [value size, length, heads, batches], their dimension 1 being marked dynamic.
+ * These tensors stay the same objects when the cache is appended to or grows, so a function such as @ref NEAttention
+ * can be configured once with them and run at each decoding step on the current length.
+ */
+class KVCache
+{
+public:
+    /** Default constructor */
+    KVCache();
+    /** Prevent instances of this class from being copy constructed */
+    KVCache(const KVCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    KVCache &operator=(const KVCache &) = delete;
+    /** Prevent instances of this class from being move constructed, as functions hold pointers to the views */
+    KVCache(KVCache &&) = delete;
+    /** Prevent instances of this class from being moved, as functions hold pointers to the views */
+    KVCache &operator=(KVCache &&) = delete;
+    /** Default destructor */
+    ~KVCache() = default;
+    /** Initialize the cache and allocate its buffers
+     *
+     * @param[in] key_info   Info of the keys to append, of shape [head size, tokens, heads, batches]. The number of tokens is ignored.
+     *                       Data types supported: All.
+     * @param[in] value_info Info of the values to append, of shape [value size, tokens, heads, batches]. The number of tokens is ignored.
+     *                       Data types supported: Same as @p key_info.
+     * @param[in] capacity   (Optional) Number of tokens the cache can hold before growing.
+     */
+    void init(const ITensorInfo &key_info, const ITensorInfo &value_info, size_t capacity = 64);
+    /** Append the keys and values of new tokens
+     *
+     * @param[in] key   Keys of the new tokens, of shape [head size, tokens, heads, batches].
+     * @param[in] value Values of the new tokens, of shape [value size, tokens, heads, batches]. Must hold as many tokens as @p key.
+     */
+    void append(const ITensor *key, const ITensor *value);
+    /** Make sure the cache can hold a number of tokens without growing
+     *
+     * @param[in] capacity Number of tokens
+     */
+    void reserve(size_t capacity);
+    /** Drop all the tokens, keeping the buffers */
+    void clear();
+    /** Number of tokens held by the cache
+     *
+     * @return The number of tokens
+     */
+    size_t length() const;
+    /** Number of tokens the cache can hold before growing
+     *
+     * @return The capacity
+     */
+    size_t capacity() const;
+    /** View of the cached keys
+     *
+     * @return A tensor of shape [head size, length, heads, batches]
+     */
+    ITensor *key();
+    /** View of the cached values
+     *
+     * @return A tensor of shape [value size, length, heads, batches]
+     */
+    ITensor *value();
+
+private:
+    /** Update the shapes and buffers of the views to the current length and storage */
+    void update_views();
+
+    TensorInfo _key_info;
+    TensorInfo _value_info;
+    Tensor     _key_storage;
+    Tensor     _value_storage;
+    Tensor     _key;
+    Tensor     _value;
+    size_t     _length;
+    size_t     _capacity;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEATTENTION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEATTENTION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/AttentionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+class Status;
+
+/** Basic function to compute the scaled dot-product attention softmax(scale * query * key^T + mask) * value
+ *
+ * The scores of each query are computed, normalized and multiplied by the values one tile of keys at a time with
+ * an online softmax, so that the [queries x keys] score matrix is never stored in memory.
+ *
+ * The keys and values can have a dynamic number of keys, such as the views of a @ref KVCache. The function is then
+ * configured once and each run reads the current number of keys, so an incremental decoding step only appends the
+ * keys and values of the new tokens to the cache. A mask must then hold a value for at least as many keys as the run
+ * sees, and with causal masking the queries before the first key output zeros.
+ *
+ * This function runs the following operators:
+ *
+ * -# cpu::CpuAttention
+ */
+class NEAttention : public IFunction
+{
+public:
+    /** Constructor */
+    NEAttention(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Destructor */
+    ~NEAttention();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAttention(const NEAttention &) = delete;
+    /** Default move constructor */
+    NEAttention(NEAttention &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAttention &operator=(const NEAttention &) = delete;
+    /** Default move assignment operator */
+    NEAttention &operator=(NEAttention &&) = default;
+    /** Initialize the function
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |query          |key            |value          |mask           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |F32            |
+     * |F16            |F16            |F16            |F16            |F16            |
+     *
+     * @param[in]  query Query tensor of shape [head size, queries, heads, batches]. Data types supported: F16/F32.
+     * @param[in]  key   Key tensor of shape [head size, keys, heads, batches]. Data types supported: Same as @p query.
+     * @param[in]  value Value tensor of shape [value size, keys, heads, batches]. Data types supported: Same as @p query.
+     * @param[in]  mask  (Optional) Additive mask of shape [keys, queries, heads, batches], whose heads and batches dimensions can be 1 to be broadcast.
+     *                   Can be nullptr. Data types supported: Same as @p query.
+     * @param[out] dst   Destination tensor of shape [value size, queries, heads, batches]. Data types supported: Same as @p query.
+     * @param[in]  info  (Optional) Scale and causal masking of the attention, see @ref AttentionInfo.
+     */
+    void configure(const ITensor       *query,
+                   const ITensor       *key,
+                   const ITensor       *value,
+                   const ITensor       *mask,
+                   ITensor             *dst,
+                   const AttentionInfo &info = AttentionInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEAttention
+     *
+     * Similar to @ref NEAttention::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo   *query,
+                           const ITensorInfo   *key,
+                           const ITensorInfo   *value,
+                           const ITensorInfo   *mask,
+                           const ITensorInfo   *dst,
+                           const AttentionInfo &info = AttentionInfo());
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEATTENTION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -166,6 +166,9 @@ public:
                            bool                       enable_fast_math = false,
                            unsigned int               num_groups       = 1);
     /** Static function to check if given info will return the convolution called by @ref NEConvolutionLayer
+     *
+     * @note If a @ref CPPConvolutionTuner is set on the runtime context, the method of its table is returned instead of
+     *       the one of the heuristics. The convolutions missing from the table are only benchmarked by @ref configure.
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -114,6 +114,9 @@ public:
      * |:--------------|:------------------|:------|:--------------|
      * |F16            |F16                |F16    |F16            |
      * |F32            |F32                |F32    |F32            |
+     * |F32            |QSYMM4_PER_CHANNEL |F32    |F32            |
+     * |F32            |QSYMM4_PER_BLOCK   |F32    |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      *
@@ -121,8 +124,10 @@ public:
      * @param[in]  weights      Weights tensor. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p input.
-     * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                          Data type supported: Same as @p input, QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL if @p input is F32.
+     *                          4-bit weights hold two values per byte and must be neither transposed nor reshaped.
+     *                          With QSYMM8_PER_CHANNEL weights, @p input is quantized to 8 bits per row on the fly.
+     * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p input if @p weights is QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL, same as @p weights otherwise, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] output       Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Function to evaluate a chain of element-wise operations and activations in a single pass over the data */
+class NEFusedElementwise : public IFunction
+{
+public:
+    /** Default constructor */
+    NEFusedElementwise();
+    /** Destructor */
+    ~NEFusedElementwise();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwise(const NEFusedElementwise &) = delete;
+    /** Default move constructor */
+    NEFusedElementwise(NEFusedElementwise &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwise &operator=(const NEFusedElementwise &) = delete;
+    /** Default move assignment operator */
+    NEFusedElementwise &operator=(NEFusedElementwise &&);
+    /** Initialise the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |srcs           |dst            |
+     * |:--------------|:--------------|
+     * |F16            |F16            |
+     * |F32            |F32            |
+     *
+     * The running result starts as inputs[0] and every step of @p chain updates it in order:
+     * binary steps combine it with inputs[step.operand], unary steps and activations transform it.
+     * Inputs are broadcast against each other, and intermediate results are kept in F32.
+     *
+     * @param[in]  inputs Input tensors, at most @ref max_elementwise_chain_inputs. Data types supported: F16/F32.
+     * @param[out] output Output tensor. Data types supported: Same as @p inputs.
+     * @param[in]  chain  Steps of the chain.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *output, const ElementwiseChainInfo &chain);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedElementwise
+     *
+     * Similar to @ref NEFusedElementwise::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs,
+                           const ITensorInfo                      *output,
+                           const ElementwiseChainInfo             &chain);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,7 +88,8 @@ public:
      *                     Data type supported: Should match @p input data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[out] output  Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                     Data types supported: Same as @p input.
-     * @param[in]  info    Convolution layer descriptor
+     * @param[in]  info    Convolution layer descriptor. If @ref Conv2dInfo::accumulate is set, @p output must already
+     *                     hold the values to accumulate into: output = act(output + conv(input) + biases).
      */
     void
     configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -97,6 +97,8 @@ public:
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
      * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  accumulate       (Optional) Accumulate into @p output, which must already hold the values to add (e.g. a residual branch):
+     *                              output = act(output + conv(input) + biases). Only F16/F32 in NHWC are supported. Default is false
      */
     void configure(const ITensor             *input,
                    const ITensor             *weights,
@@ -107,7 +109,8 @@ public:
                    const Size2D              &dilation         = Size2D(1U, 1U),
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                    bool                       enable_fast_math = false,
-                   unsigned int               num_groups       = 1);
+                   unsigned int               num_groups       = 1,
+                   bool                       accumulate       = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer
      *
      * @param[in] input            Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
@@ -127,6 +130,7 @@ public:
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
      * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] accumulate       (Optional) Accumulate into @p output instead of overwriting it. Default is false
      *
      * @return a status
      */
@@ -139,7 +143,8 @@ public:
                            const Size2D              &dilation         = Size2D(1U, 1U),
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                            bool                       enable_fast_math = false,
-                           unsigned int               num_groups       = 1);
+                           unsigned int               num_groups       = 1,
+                           bool                       accumulate       = false);
 
     /** Static function to check if there is an optimized version of
      * GEMM available for the input parameters.
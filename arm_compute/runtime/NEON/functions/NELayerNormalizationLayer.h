@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATIONLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+class Status;
+
+/** Basic function to normalize each row of a tensor with a layer norm or an RMS norm, fused with an optional residual
+ * addition before it and an optional scale and offset after it:
+ *
+ * sum = input + residual
+ * output = (sum - mean(sum)) / sqrt(var(sum) + epsilon) * gamma + beta  for @ref LayerNormalizationType::LayerNorm
+ * output = sum / sqrt(mean(sum * sum) + epsilon) * gamma + beta         for @ref LayerNormalizationType::RMSNorm
+ *
+ * Each row is read once from memory and written once, instead of running an addition, a normalization and a
+ * multiply-add as separate layers. The sum can also be written to @p add_output to be used as the residual of the
+ * next block of a transformer.
+ *
+ * This function runs the following operators:
+ *
+ * -# cpu::CpuLayerNormalization
+ */
+class NELayerNormalizationLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NELayerNormalizationLayer();
+    /** Destructor */
+    ~NELayerNormalizationLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNormalizationLayer(const NELayerNormalizationLayer &) = delete;
+    /** Default move constructor */
+    NELayerNormalizationLayer(NELayerNormalizationLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNormalizationLayer &operator=(const NELayerNormalizationLayer &) = delete;
+    /** Default move assignment operator */
+    NELayerNormalizationLayer &operator=(NELayerNormalizationLayer &&) = default;
+    /** Initialize the function
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |input          |residual       |gamma          |beta           |add_output     |output         |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |F32            |F32            |
+     * |F16            |F16            |F16            |F16            |F16            |F16            |
+     * |BFLOAT16       |BFLOAT16       |BFLOAT16       |BFLOAT16       |BFLOAT16       |BFLOAT16       |
+     *
+     * @param[in]  input      Input tensor, normalized along dimension 0. Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  residual   (Optional) Residual tensor added to @p input before the normalization. Can be nullptr.
+     *                        Data types supported: Same as @p input.
+     * @param[in]  gamma      (Optional) Scale tensor of shape [input dimension 0]. Can be nullptr. Data types supported: Same as @p input.
+     * @param[in]  beta       (Optional) Offset tensor of shape [input dimension 0]. Can be nullptr. Data types supported: Same as @p input.
+     * @param[out] add_output (Optional) Destination tensor of the sum of @p input and @p residual. Can be nullptr, and must be
+     *                        when there is no @p residual. It can be the same tensor as @p residual. Data types supported: Same as @p input.
+     * @param[out] output     Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  info       (Optional) Normalization type and epsilon, see @ref LayerNormalizationInfo.
+     */
+    void configure(const ITensor                *input,
+                   const ITensor                *residual,
+                   const ITensor                *gamma,
+                   const ITensor                *beta,
+                   ITensor                      *add_output,
+                   ITensor                      *output,
+                   const LayerNormalizationInfo &info = LayerNormalizationInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NELayerNormalizationLayer
+     *
+     * Similar to @ref NELayerNormalizationLayer::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *input,
+                           const ITensorInfo            *residual,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *add_output,
+                           const ITensorInfo            *output,
+                           const LayerNormalizationInfo &info = LayerNormalizationInfo());
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORMALIZATIONLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -102,13 +102,19 @@ public:
      * |lhs            |rhs                |dst            |
      * |:--------------|:------------------|:--------------|
      * |F32            |F32                |F32            |
+     * |F32            |QSYMM4_PER_CHANNEL |F32            |
+     * |F32            |QSYMM4_PER_BLOCK   |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32            |
      * |F16            |F16                |F16            |
      * |BFLOAT16       |BFLOAT16           |BFLOAT16       |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |QASYMM8_SIGNED |
      * |QASYMM8        |QASYMM8            |QASYMM8        |
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL if @p lhs is F32.
+     *                      A 4-bit @p rhs must be 2 dimensional, can be constant and requires @p info adj_rhs to be set, its
+     *                      values of the same output channel being contiguous. A QSYMM8_PER_CHANNEL @p rhs must be 2 dimensional and can be constant.
+     *                      The LHS is quantized to 8 bits per row on the fly for either.
      * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -123,7 +129,7 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEMatMul
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL if @p lhs is F32.
      * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
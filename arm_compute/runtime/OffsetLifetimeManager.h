@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,7 +40,12 @@ namespace arm_compute
 class IMemoryPool;
 
 /** Concrete class that tracks the lifetime of registered tensors and
- *  calculates the systems memory requirements in terms of a single blob and a list of offsets */
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * The offsets are planned over the whole lifetime of a group: the objects are placed from the largest to the
+ * smallest in the tightest gap left by the objects alive at the same time. The plan reusing whole blobs is kept
+ * instead when it needs less memory.
+ */
 class OffsetLifetimeManager : public ISimpleLifetimeManager
 {
 public:
@@ -62,8 +67,17 @@ public:
      * @return Lifetime manager internal configuration meta-data
      */
     const info_type &info() const;
+    /** Returns the largest amount of memory simultaneously used by the objects of a group
+     *
+     * @note This is the lower bound of the blob size, which also accounts for fragmentation and alignment
+     *
+     * @return Peak memory usage in bytes
+     */
+    size_t peak_size() const;
 
     // Inherited methods overridden:
+    void                         start_lifetime(void *obj) override;
+    void                         end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType                  mapping_type() const override;
 
@@ -72,7 +86,10 @@ private:
     void update_blobs_and_mappings() override;
 
 private:
-    BlobInfo _blob; /**< Memory blob size */
+    BlobInfo                                    _blob;      /**< Memory blob size */
+    size_t                                      _peak_size; /**< Peak memory usage of the groups */
+    size_t                                      _clock;     /**< Counter of the lifetime events of the active group */
+    std::map<void *, std::pair<size_t, size_t>> _lifetimes; /**< First and last event of the active objects */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_OFFSETLIFETIMEMANAGER_H
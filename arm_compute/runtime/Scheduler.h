@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,10 +42,11 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,    /**< Single thread. */
-        CPP,   /**< C++11 threads. */
-        OMP,   /**< OpenMP. */
-        CUSTOM /**< Provided by the user. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        OMP,               /**< OpenMP. */
+        CUSTOM,            /**< Provided by the user. */
+        CPP_WORK_STEALING, /**< C++11 spinning threads with work stealing. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
      *
@@ -76,9 +77,17 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Overrides the scheduler returned by @ref Scheduler::get() on the calling thread only.
+     *
+     * Used to run independent workloads concurrently, each of them on its own scheduler.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread, nullptr to use the active scheduler again.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
 
 private:
     static Type _scheduler_type;
+    static thread_local IScheduler *_thread_scheduler;
 #ifndef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
     static std::shared_ptr<IScheduler> _custom_scheduler;
 #else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,9 +41,10 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,  /**< Single thread. */
-        CPP, /**< C++11 threads. */
-        OMP, /**< OpenMP. */
+        ST,                /**< Single thread. */
+        CPP,               /**< C++11 threads. */
+        OMP,               /**< OpenMP. */
+        CPP_WORK_STEALING, /**< C++11 spinning threads with work stealing. */
     };
 
 public:
@@ -1,4 +1,4 @@
-# Copyright (c) 2025 Arm Limited.
+# Copyright (c) 2025-2026 Arm Limited.
 #
 # SPDX-License-Identifier: MIT
 #
@@ -124,6 +124,8 @@ set(
 # Add -march to arch values.
 string(PREPEND ARM_COMPUTE_ARCH -march=)
 string(PREPEND ARM_COMPUTE_CORE_FP16_ARCH -march=)
+string(PREPEND ARM_COMPUTE_CORE_DOTPROD_ARCH -march=)
+string(PREPEND ARM_COMPUTE_CORE_I8MM_ARCH -march=)
 string(PREPEND ARM_COMPUTE_SVE_ARCH -march=)
 string(PREPEND ARM_COMPUTE_SVE2_ARCH -march=)
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,11 +72,15 @@ public:
         model.setup(common_params, *expected_output_filename);
 
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
-        config.mlgo_file   = common_params.mlgo_file;
+        config.num_threads             = common_params.threads;
+        config.use_tuner               = common_params.enable_tuner;
+        config.tuner_mode              = common_params.tuner_mode;
+        config.tuner_file              = common_params.tuner_file;
+        config.mlgo_file               = common_params.mlgo_file;
+        config.weights_cache_file      = common_params.weights_cache_file;
+        config.tune_convolution_method = common_params.tune_convolution_method;
+        config.convolution_tuner_file  = common_params.convolution_tuner_file;
+        config.profiling_file          = common_params.profiling_file;
 
         context.set_config(config);
 
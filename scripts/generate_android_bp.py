@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 
-# Copyright (c) 2023-2025 Arm Limited.
+# Copyright (c) 2023-2026 Arm Limited.
 #
 # SPDX-License-Identifier: MIT
 #
@@ -105,6 +105,40 @@ arm_compute_library_defaults {
     rtti: true,
 }
 
+// KleidiAI micro-kernels requiring the dot product extension, only run after checking for it at runtime
+cc_library_static {
+    name: "arm_compute_library_kleidiai_dotprod",
+    defaults: ["acl-default-cppflags"],
+    proprietary: true,
+    local_include_dirs: ["third_party/kleidiai"],
+    cflags: ["-march=armv8.2-a+dotprod"],
+    arch: {
+        arm64: {
+            srcs: [
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4c32p/kai_matmul_clamp_f32_qai8dxp1x8_qsi4c32p4x8_1x4x32_neon_dotprod.c",
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4cxp/kai_matmul_clamp_f32_qai8dxp1x8_qsi4cxp4x8_1x4x32_neon_dotprod.c",
+            ],
+        },
+    },
+}
+
+// KleidiAI micro-kernels requiring the matrix multiply extension, only run after checking for it at runtime
+cc_library_static {
+    name: "arm_compute_library_kleidiai_i8mm",
+    defaults: ["acl-default-cppflags"],
+    proprietary: true,
+    local_include_dirs: ["third_party/kleidiai"],
+    cflags: ["-march=armv8.2-a+dotprod+i8mm"],
+    arch: {
+        arm64: {
+            srcs: [
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4c32p/kai_matmul_clamp_f32_qai8dxp4x8_qsi4c32p4x8_16x4x32_neon_i8mm.c",
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4cxp/kai_matmul_clamp_f32_qai8dxp4x8_qsi4cxp4x8_8x4x32_neon_i8mm.c",
+            ],
+        },
+    },
+}
+
 cc_library_static {
     name: "arm_compute_library",
     defaults: ["acl-default-cppflags"],
@@ -136,7 +170,20 @@ cc_library_static {
             ],
         },
         arm64: {
+            whole_static_libs: [
+                "arm_compute_library_kleidiai_dotprod",
+                "arm_compute_library_kleidiai_i8mm",
+            ],
             srcs: [
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp1x4_qsi8cxp4x4_1x4_neon_dotprod.c",
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp1x8_qsi8cxp4x8_1x4_neon_dotprod.c",
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp4x4_qsi8cxp4x4_16x4_neon_dotprod.c",
+                "third_party/kleidiai/kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp4x8_qsi8cxp4x8_16x4_neon_i8mm.c",
+                "third_party/kleidiai/kai/ukernels/matmul/pack/kai_lhs_quant_pack_qai8dxp_f32.c",
+                "third_party/kleidiai/kai/ukernels/matmul/pack/kai_rhs_pack_kxn_qsi8cxp_qsi8cx_neon.c",
+                "third_party/kleidiai/kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi8cxp_qsi8cx_neon.c",
+                "third_party/kleidiai/kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi4c32p_qsu4c32s1s0.c",
+                "third_party/kleidiai/kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi4cxp_qs4cxs1s0.c",
                 {% for arm64_src in arm64_srcs -%}
                     "{{ arm64_src }}",
                 {% endfor %}
@@ -1,7 +1,7 @@
 #!/usr/bin/python
 # -*- coding: utf-8 -*-
 
-# Copyright (c) 2023-2025 Arm Limited.
+# Copyright (c) 2023-2026 Arm Limited.
 #
 # SPDX-License-Identifier: MIT
 #
@@ -165,7 +165,7 @@ filegroup(
     return template
 
 
-def build_from_template_cmake(srcs_graph, srcs_sve, srcs_sve2, srcs_core, srcs_core_fp16):
+def build_from_template_cmake(srcs_graph, srcs_sve, srcs_sve2, srcs_core, srcs_core_fp16, srcs_core_dotprod, srcs_core_i8mm):
 
     line_separator = '\n\t'
 
@@ -199,6 +199,18 @@ target_sources(
     arm_compute_core_fp16
     PRIVATE
     {line_separator.join(srcs_core_fp16)}
+)
+
+target_sources(
+    arm_compute_core_dotprod
+    PRIVATE
+    {line_separator.join(srcs_core_dotprod)}
+)
+
+target_sources(
+    arm_compute_core_i8mm
+    PRIVATE
+    {line_separator.join(srcs_core_i8mm)}
 )"""
     return template
 
@@ -254,6 +266,10 @@ def gather_sources():
     # Get all the fp16 files
     fp16_cpu_files = get_operator_backend_files(filelist, cpu_ops_to_build, 'cpu', simd, ['fp16'], False)
 
+    # Get the files requiring the dot product or the matrix multiply instructions
+    dotprod_cpu_files = get_operator_backend_files(filelist, cpu_ops_to_build, 'cpu', ['neon'], ['dotprod'], False)
+    i8mm_cpu_files = get_operator_backend_files(filelist, cpu_ops_to_build, 'cpu', ['neon'], ['i8mm'], False)
+
     # Shared among ALL CPU files
     lib_files += cpu_files.get('common', [])
 
@@ -263,6 +279,10 @@ def gather_sources():
     # FP16 Arm® Neon™ specific files
     lib_files_neon_fp16 = fp16_cpu_files.get('neon',[])
 
+    # Dot product and matrix multiply Arm® Neon™ specific files
+    lib_files_neon_dotprod = dotprod_cpu_files.get('neon',[])
+    lib_files_neon_i8mm = i8mm_cpu_files.get('neon',[])
+
     # SVE files only
     lib_files_sve = cpu_files.get('sve', [])
     lib_files_sve += fp16_cpu_files.get('sve', [])
@@ -283,8 +303,11 @@ def gather_sources():
     lib_files_sve2 = sorted([strip_prefix(path, "src/") for path in lib_files_sve2])
     lib_files = sorted([strip_prefix(path, "src/") for path in lib_files])
     lib_files_neon_fp16 = sorted([strip_prefix(path, "src/") for path in lib_files_neon_fp16])
+    lib_files_neon_dotprod = sorted([strip_prefix(path, "src/") for path in lib_files_neon_dotprod])
+    lib_files_neon_i8mm = sorted([strip_prefix(path, "src/") for path in lib_files_neon_i8mm])
 
-    return (graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16)
+    return (graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16, lib_files_neon_dotprod,
+            lib_files_neon_i8mm)
 
 
 if "__main__" in __name__:
@@ -294,20 +317,23 @@ if "__main__" in __name__:
     parser.add_argument("--cmake", action="store_true")
     args = parser.parse_args()
 
-    (graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16) = gather_sources()
+    (graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16, lib_files_neon_dotprod,
+     lib_files_neon_i8mm) = gather_sources()
 
     if args.bazel:
         # 8562a4ec: Remove CommonGraphOptions from Utils target and warnings
         graph_files += ["//utils:CommonGraphOptions.cpp"]
 
         bazel_build_string = build_from_template_bazel(
-            graph_files, lib_files_sve, lib_files_sve2, lib_files + lib_files_neon_fp16)
+            graph_files, lib_files_sve, lib_files_sve2,
+            lib_files + lib_files_neon_fp16 + lib_files_neon_dotprod + lib_files_neon_i8mm)
         with open("src/BUILD.bazel", "w") as fp:
             fp.write(bazel_build_string)
 
     if args.cmake:
         cmake_build_string = build_from_template_cmake(
-            graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16)
+            graph_files, lib_files_sve, lib_files_sve2, lib_files, lib_files_neon_fp16, lib_files_neon_dotprod,
+            lib_files_neon_i8mm)
         with open("src/CMakeLists.txt", "w") as fp:
             fp.write(cmake_build_string)
 
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2026 Arm Limited
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+""" Pack the numpy arrays of a network in a single file that the graph examples can memory map.
+Usage:
+    python pack_npy_weights.py -d path_to_the_data -o packed_weights_file
+
+Packs all the .npy files found under the data path, named after their path relative to it, e.g. the
+file path_to_the_data/cnn_data/resnet50_model/conv1_weights.npy can be loaded from the packed file by
+passing it to the graph examples as --data=packed_weights_file
+
+File format:
+    ACL_PACKED_WEIGHTS 1
+    <number of entries>
+    <name> <offset> <size>      (one line per .npy file)
+followed by the content of the .npy files at the given offsets, which are multiples of 64 bytes.
+"""
+import argparse
+import os
+
+magic = "ACL_PACKED_WEIGHTS 1"
+alignment = 64
+number_width = 16
+
+def align(value):
+    return (value + alignment - 1) // alignment * alignment
+
+if __name__ == "__main__":
+    # Parse arguments
+    parser = argparse.ArgumentParser('Pack numpy arrays in a single file')
+    parser.add_argument('-d', dest='dataPath', type=str, required=True, help='Path to the .npy files to pack.')
+    parser.add_argument('-o', dest='outputFile', type=str, required=True, help='Packed weights file to create.')
+    args = parser.parse_args()
+
+    entries = []
+    for root, _, files in os.walk(args.dataPath):
+        for name in sorted(files):
+            if name.endswith(".npy"):
+                path = os.path.join(root, name)
+                entry = os.path.relpath(path, args.dataPath).replace(os.sep, "/")
+                if any(c.isspace() for c in entry):
+                    raise ValueError("Whitespaces are not supported in the names: " + entry)
+                entries.append((entry, path, os.path.getsize(path)))
+    entries.sort()
+
+    # Fixed width numbers give the size of the index before computing the offsets
+    index_size = len(magic) + 1 + len(str(len(entries))) + 1
+    index_size += sum(len(entry) + 2 * (number_width + 1) for entry, _, _ in entries)
+
+    offset = align(index_size)
+    index = [magic, str(len(entries))]
+    for entry, _, size in entries:
+        index.append("{} {:0{w}d} {:0{w}d}".format(entry, offset, size, w=number_width))
+        offset = align(offset + size)
+
+    with open(args.outputFile, "wb") as packed:
+        packed.write(("\n".join(index) + "\n").encode("ascii"))
+        for (_, path, _), line in zip(entries, index[2:]):
+            packed.seek(int(line.split(" ")[1]))
+            with open(path, "rb") as npy:
+                packed.write(npy.read())
+        packed.truncate(packed.tell())
+    print("Packed {} files in {}".format(len(entries), args.outputFile))
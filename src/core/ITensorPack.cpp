@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,4 +80,15 @@ bool ITensorPack::empty() const
 {
     return _pack.empty();
 }
+
+std::vector<int> ITensorPack::ids() const
+{
+    std::vector<int> ids;
+    ids.reserve(_pack.size());
+    for (const auto &e : _pack)
+    {
+        ids.push_back(e.first);
+    }
+    return ids;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include <cassert>
 
 #include "arm_gemm.hpp"
+#include "bias_adder.hpp"
 #include "convolver.hpp"
 #include "kernel_weight_format.hpp"
 #include "ndrange.hpp"
@@ -66,6 +67,17 @@ public:
         const OutputStage &os, const int32_t *col_bias, unsigned int n_0 );
 };
 
+template<typename Tr>
+inline void add_bias_to_output(IndirectOutputArg<Tr> output_arg, const Tr *bias_ptr, unsigned int M, unsigned int N) {
+    if (output_arg.is_indirect) {
+        for (unsigned int row=0; row<M; row++) {
+            bias_adder(output_arg.indirect.ptr[row] + output_arg.indirect.offset, 0, bias_ptr, 1, N);
+        }
+    } else {
+        bias_adder(output_arg.direct.base, output_arg.direct.stride, bias_ptr, M, N);
+    }
+}
+
 template<>
 template<typename strategy, typename Tlo, typename Tro, typename Tr>
 inline void run_hybrid_kernel<Nothing, false, false>::run(
@@ -80,6 +92,11 @@ inline void run_hybrid_kernel<Nothing, false, false>::run(
 #endif
     UNUSED(kern_k);
 
+    /* The kernels ignore the bias when accumulating, so add it to the block of the output they accumulate into. */
+    if (bias_ptr && accumulate) {
+        add_bias_to_output(output_arg, bias_ptr, M, N);
+    }
+
     /* Indirect hybrid kernels read the full width of the bias.  So we need to detect the case where we are writing
      * a partial block and pad the bias for that block. */
     if (bias_ptr && !accumulate && (N % strategy::out_width() != 0)) {
@@ -126,6 +143,11 @@ inline void run_hybrid_kernel<Nothing, false, true>::run(
 #endif
     UNUSED(kern_k);
 
+    /* The kernels ignore the bias when accumulating, so add it to the block of the output they accumulate into. */
+    if (bias_ptr && accumulate) {
+        add_bias_to_output(output_arg, bias_ptr, M, N);
+    }
+
     /* Indirect hybrid kernels read the full width of the bias.  So we need to detect the case where we are writing
      * a partial block and pad the bias for that block. */
     if (bias_ptr && !accumulate && (N % strategy::out_width() != 0)) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 
 #include "arm_gemm.hpp"
 #include "bfloat.hpp"
+#include "bias_adder.hpp"
 #include "convolver.hpp"
 #include "kernel_traits.hpp"
 #include "kernel_weight_format.hpp"
@@ -98,6 +99,10 @@ void kernel_and_merge<true, false, Nothing>::run(
 #ifdef CYCLE_PROFILING
         auto p=prof.ScopedProfiler(PROFILE_MERGE, (strategy::out_height() * bblocks * strategy::out_width() * sizeof(Tr)));
 #endif
+        // The merge ignores the bias when accumulating, so add it to the block of the output first.
+        if (biasptr && accumulate) {
+            bias_adder(c_ptr + m_0 * ldc + n_0, ldc, biasptr + n_0, m_max - m_0, n_max - n_0);
+        }
         strat.transforms.Merge(c_ptr, c_panel, ldc, m_0, m_max, n_0, n_max, biasptr, act, accumulate);
     }
 }
@@ -128,6 +133,10 @@ void kernel_and_merge<true, true, Nothing>::run(
         const int bblocks = iceildiv(n_max - n_0, strategy::out_width());
         auto p=prof.ScopedProfiler(PROFILE_MERGE, (strategy::out_height() * bblocks * strategy::out_width() * sizeof(Tr)));
 #endif
+        // The merge ignores the bias when accumulating, so add it to the block of the output first.
+        if (biasptr && accumulate) {
+            bias_adder(c_ptr + m_0 * ldc + n_0, ldc, biasptr + n_0, m_max - m_0, n_max - n_0);
+        }
         strat.transforms.Merge(c_ptr, c_panel, ldc, m_0, m_max, n_0, n_max, biasptr, act, accumulate);
     }
 }
@@ -159,6 +168,11 @@ void kernel_and_merge<false, false, Nothing>::run(
         offset_c_ptr = c_ptr + m_0 * ldc + n_0;
     }
 
+    // The kernel ignores the bias when accumulating, so add it to the block of the output first.
+    if (biasptr && accumulate && offset_c_ptr != nullptr) {
+        bias_adder(offset_c_ptr, ldc, biasptr + n_0, m_max - m_0, n_max - n_0);
+    }
+
     strat.kernel(// A and B pointers are just the packed panels.
                  a_ptr, b_panel,
                  // Provide relevant part of output array and row stride.
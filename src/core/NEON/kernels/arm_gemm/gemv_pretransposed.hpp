@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "arm_gemm.hpp"
+#include "bias_adder.hpp"
 
 #ifdef CYCLE_PROFILING
 #include "profiler.hpp"
@@ -172,6 +173,11 @@ public:
 #ifdef CYCLE_PROFILING
                     auto p = prof.ScopedProfiler(PROFILE_KERNEL, (kmax-k0) * (nmax-n));
 #endif
+                    // The kernel ignores the bias when accumulating, so add it to the output first.
+                    if (std::is_same<OutputStage, Nothing>::value && k0 == 0 && _args._accumulate && g_arrays._bias) {
+                        bias_adder(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + n, 0,
+                                   g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n, 1, (nmax - n));
+                    }
                     run_gemv_kernel<OutputStage>::run(strat, g_arrays._Aptr + (multi * g_arrays._A_multi_stride) + k0,
                                  _B_pretransposed + (multi * _buffer_per_multi) + (n * roundup(_args._Ksize, strategy::k_unroll())) + (k0 * strategy::out_width()),
                                  g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + n,
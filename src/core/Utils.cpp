@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -508,6 +508,8 @@ void print_consecutive_elements(std::ostream      &s,
     {
         case DataType::U8:
         case DataType::QASYMM8:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
             print_consecutive_elements_impl<uint8_t>(s, ptr, n, stream_width, element_delim);
             break;
         case DataType::S8:
@@ -566,6 +568,8 @@ int max_consecutive_elements_display_width(std::ostream &s, DataType dt, const u
     {
         case DataType::U8:
         case DataType::QASYMM8:
+        case DataType::QSYMM4_PER_CHANNEL:
+        case DataType::QSYMM4_PER_BLOCK:
             return max_consecutive_elements_display_width_impl<uint8_t>(s, ptr, n);
         case DataType::S8:
         case DataType::QSYMM8:
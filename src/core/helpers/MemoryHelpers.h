@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,9 +27,15 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 
+#include <algorithm>
+#include <initializer_list>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -196,5 +202,88 @@ void release_temporaries(const experimental::MemoryRequirements &mem_reqs, Works
         }
     }
 }
+
+/** Identify the transformation of the weights done when preparing a function
+ *
+ * @param[in] function_name Name of the function.
+ * @param[in] infos         Infos of the tensors the function is configured with. Null infos are ignored.
+ * @param[in] mem_reqs      Workspace requirements of the function.
+ * @param[in] config        (Optional) Configuration of the function not captured by the tensor infos.
+ *
+ * @return Identifier of the transformation to pass to @ref IWeightsManager::transform_id
+ */
+inline std::string weights_transform_uid(const char                              *function_name,
+                                         std::initializer_list<const ITensorInfo *> infos,
+                                         const experimental::MemoryRequirements  &mem_reqs,
+                                         const std::string                       &config = "")
+{
+    std::stringstream ss;
+    ss << function_name << ";" << config;
+    for (const ITensorInfo *info : infos)
+    {
+        if (info == nullptr)
+        {
+            continue;
+        }
+        ss << ";" << string_from_data_type(info->data_type());
+        for (size_t d = 0; d < info->num_dimensions(); ++d)
+        {
+            ss << (d == 0 ? ":" : "x") << info->dimension(d);
+        }
+        const UniformQuantizationInfo qinfo = info->quantization_info().uniform();
+        ss << ":" << qinfo.scale << ":" << qinfo.offset;
+    }
+    for (const auto &req : mem_reqs)
+    {
+        if (req.lifetime == experimental::MemoryLifetime::Persistent)
+        {
+            ss << ";" << req.slot << ":" << req.size << ":" << req.alignment;
+        }
+    }
+    return ss.str();
+}
+
+/** Share the persistent tensors of a prepared function with the other functions of a weights manager
+ *
+ * The allocated tensors with Persistent lifetime are moved out of the workspace and registered in the weights manager,
+ * or released if another function already shared the same transformation. The packs then point to the shared tensors.
+ *
+ * @param[in]     weights_manager Weights manager sharing the tensors.
+ * @param[in]     transform_id    Identifier of the transformation returned by @ref IWeightsManager::transform_id
+ * @param[in,out] workspace       Workspace of the function.
+ * @param[in,out] run_pack        Pack used to run the function.
+ * @param[in,out] prep_pack       Pack used to prepare the function.
+ *
+ * @return The shared tensors, to be held by the function as long as the packs are used.
+ */
+template <typename TensorType>
+std::shared_ptr<const IWeightsManager::SharedWeights> share_persistent_tensors(IWeightsManager           &weights_manager,
+                                                                               const std::string         &transform_id,
+                                                                               WorkspaceData<TensorType> &workspace,
+                                                                               ITensorPack               &run_pack,
+                                                                               ITensorPack               &prep_pack)
+{
+    auto prepared = std::make_shared<IWeightsManager::SharedWeights>();
+    for (auto &ws : workspace)
+    {
+        if (ws.lifetime == experimental::MemoryLifetime::Persistent && ws.tensor->allocator()->is_allocated())
+        {
+            (*prepared)[ws.slot] = std::move(ws.tensor);
+        }
+    }
+    workspace.erase(std::remove_if(workspace.begin(), workspace.end(), [](auto &ws) { return ws.tensor == nullptr; }),
+                    workspace.end());
+
+    auto shared = weights_manager.share(transform_id, prepared);
+    for (const auto &weights : *shared)
+    {
+        run_pack.add_tensor(weights.first, weights.second.get());
+        if (prep_pack.get_tensor(weights.first) != nullptr)
+        {
+            prep_pack.add_tensor(weights.first, weights.second.get());
+        }
+    }
+    return shared;
+}
 } // namespace arm_compute
 #endif // ACL_SRC_CORE_HELPERS_MEMORYHELPERS_H
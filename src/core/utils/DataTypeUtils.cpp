@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,8 @@ const std::string &string_from_data_type(DataType dt)
         {DataType::SIZET, "SIZET"},
         {DataType::QSYMM8, "QSYMM8"},
         {DataType::QSYMM8_PER_CHANNEL, "QSYMM8_PER_CHANNEL"},
+        {DataType::QSYMM4_PER_CHANNEL, "QSYMM4_PER_CHANNEL"},
+        {DataType::QSYMM4_PER_BLOCK, "QSYMM4_PER_BLOCK"},
         {DataType::QASYMM8, "QASYMM8"},
         {DataType::QASYMM8_SIGNED, "QASYMM8_SIGNED"},
         {DataType::QSYMM16, "QSYMM16"},
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuAttentionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/attention/list.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuAttentionKernel::AttentionKernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_attention", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_attention)},
+    {"neon_fp16_attention", [](const DataTypeISASelectorData &data)
+     { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_attention)},
+#endif // __aarch64__
+};
+
+TensorShape compute_dst_shape(const ITensorInfo *query, const ITensorInfo *value)
+{
+    return TensorShape(query->tensor_shape()).set(0, value->dimension(0));
+}
+
+Status validate_arguments(const ITensorInfo   *query,
+                          const ITensorInfo   *key,
+                          const ITensorInfo   *value,
+                          const ITensorInfo   *mask,
+                          const ITensorInfo   *dst,
+                          const AttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(query, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON(query->num_dimensions() > 4 || key->num_dimensions() > 4 ||
+                                value->num_dimensions() > 4);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(key->dimension(0) != query->dimension(0),
+                                    "The queries and the keys must have the same size");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(value->dimension(1) != key->dimension(1),
+                                    "There must be as many values as keys");
+    for (size_t d = 2; d < 4; ++d)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(key->dimension(d) != query->dimension(d) ||
+                                            value->dimension(d) != query->dimension(d),
+                                        "The queries, keys and values must have the same heads and batches");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->is_dynamic() || dst->is_dynamic(),
+                                    "Only the number of keys and values can be dynamic");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(key->is_dynamic() != value->is_dynamic(),
+                                    "The keys and values must both be static or dynamic");
+
+    // The number of keys of dynamic keys and values, such as the views of a KVCache, is only known at run time
+    const bool dynamic_keys = key->is_dynamic();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!dynamic_keys && info.is_causal() && key->dimension(1) < query->dimension(1),
+                                    "Causal attention requires at least as many keys as queries");
+    ARM_COMPUTE_RETURN_ERROR_ON(!std::isfinite(info.scale()));
+
+    if (mask != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, mask);
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->num_dimensions() > 4);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((dynamic_keys ? mask->dimension(0) < key->dimension(1)
+                                                      : mask->dimension(0) != key->dimension(1)) ||
+                                            mask->dimension(1) != query->dimension(1),
+                                        "The mask must hold a value per key and query");
+        for (size_t d = 2; d < 4; ++d)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(mask->dimension(d) != 1 && mask->dimension(d) != query->dimension(d),
+                                            "The mask must match or be broadcast along the heads and batches");
+        }
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_dst_shape(query, value));
+    }
+
+    const auto uk = CpuAttentionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(uk == nullptr || uk->ukernel == nullptr,
+                                    "No attention micro-kernel available for this configuration");
+
+    return Status{};
+}
+} // namespace
+
+void CpuAttentionKernel::configure(const ITensorInfo   *query,
+                                   const ITensorInfo   *key,
+                                   const ITensorInfo   *value,
+                                   const ITensorInfo   *mask,
+                                   ITensorInfo         *dst,
+                                   const AttentionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+
+    // Auto initialize the output if not initialized
+    auto_init_if_empty(*dst, query->clone()->set_tensor_shape(compute_dst_shape(query, value)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(query, key, value, mask, dst, info));
+
+    const auto uk = CpuAttentionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    const size_t head_size = query->dimension(0);
+
+    _run_method           = uk->ukernel;
+    _name                 = std::string("CpuAttentionKernel/").append(uk->name);
+    _scale                = info.scale() != 0.f ? info.scale() : 1.f / std::sqrt(static_cast<float>(head_size));
+    _is_causal            = info.is_causal();
+    _workspace_per_thread = attention_workspace_size(head_size, value->dimension(0)) * sizeof(float);
+
+    // A tile of queries is processed by a single thread, the heads are split when there are too few tiles
+    const size_t num_query_tiles = DIV_CEIL(dst->dimension(1), attention_query_tile);
+    _split_dimension             = num_query_tiles >= dst->dimension(2) ? Window::DimY : Window::DimZ;
+
+    Window win = calculate_max_window(*dst, Steps(dst->dimension(0), attention_query_tile));
+    ICpuKernel::configure(win);
+}
+
+Status CpuAttentionKernel::validate(const ITensorInfo   *query,
+                                    const ITensorInfo   *key,
+                                    const ITensorInfo   *value,
+                                    const ITensorInfo   *mask,
+                                    const ITensorInfo   *dst,
+                                    const AttentionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(query, key, value, mask, dst, info));
+    return Status{};
+}
+
+size_t CpuAttentionKernel::get_working_size(unsigned int num_threads) const
+{
+    return _workspace_per_thread * num_threads;
+}
+
+void CpuAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *query     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *key       = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *value     = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *mask      = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(workspace);
+    ARM_COMPUTE_ERROR_ON(workspace->info()->total_size() < _workspace_per_thread * (info.thread_id + 1));
+
+    ARM_COMPUTE_ERROR_ON_MSG(mask != nullptr && mask->info()->dimension(0) < key->info()->dimension(1),
+                             "The mask must hold a value per key");
+
+    float *thread_workspace = reinterpret_cast<float *>(workspace->buffer() + info.thread_id * _workspace_per_thread);
+    _run_method(query, key, value, mask, dst, _scale, _is_causal, thread_workspace, window);
+}
+
+const char *CpuAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuAttentionKernel::AttentionKernel> &CpuAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
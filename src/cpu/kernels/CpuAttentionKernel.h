@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUATTENTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUATTENTIONKERNEL_H
+
+#include "arm_compute/function_info/AttentionInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute the scaled dot-product attention softmax(scale * query * key^T + mask) * value
+ *
+ * Each thread processes tiles of queries against tiles of keys, keeping a running maximum and sum of the softmax of
+ * each query to rescale its output accumulators, so that only the scores of the current tiles are kept in its
+ * workspace.
+ */
+class CpuAttentionKernel : public ICpuKernel<CpuAttentionKernel>
+{
+private:
+    using AttentionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     float,
+                                                     bool,
+                                                     float *,
+                                                     const Window &)>::type;
+
+public:
+    struct AttentionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        AttentionKernelPtr           ukernel;
+    };
+
+    CpuAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuAttentionKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  query Query tensor info of shape [head size, queries, heads, batches]. Data types supported: F16/F32
+     * @param[in]  key   Key tensor info of shape [head size, keys, heads, batches]. Data types supported: Same as @p query
+     * @param[in]  value Value tensor info of shape [value size, keys, heads, batches]. Data types supported: Same as @p query
+     * @param[in]  mask  (Optional) Additive mask tensor info of shape [keys, queries, heads, batches], the heads and batches
+     *                   dimensions being broadcast if 1. Can be nullptr. Data types supported: Same as @p query
+     * @param[out] dst   Destination tensor info of shape [value size, queries, heads, batches]. Data types supported: Same as @p query
+     * @param[in]  info  Scale and causal masking of the attention
+     */
+    void configure(const ITensorInfo   *query,
+                   const ITensorInfo   *key,
+                   const ITensorInfo   *value,
+                   const ITensorInfo   *mask,
+                   ITensorInfo         *dst,
+                   const AttentionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo   *query,
+                           const ITensorInfo   *key,
+                           const ITensorInfo   *value,
+                           const ITensorInfo   *mask,
+                           const ITensorInfo   *dst,
+                           const AttentionInfo &info);
+
+    /** Size in bytes of the workspace to pass as ACL_INT_0
+     *
+     * @param[in] num_threads Number of threads the kernel is scheduled on
+     *
+     * @return The size of the workspace
+     */
+    size_t get_working_size(unsigned int num_threads) const;
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs
+     *
+     * @return The split dimension hint
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<AttentionKernel> &get_available_kernels();
+
+private:
+    AttentionKernelPtr _run_method{nullptr};
+    std::string        _name{};
+    float              _scale{1.f};
+    bool               _is_causal{false};
+    size_t             _workspace_per_thread{0};
+    size_t             _split_dimension{Window::DimY};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUATTENTIONKERNEL_H
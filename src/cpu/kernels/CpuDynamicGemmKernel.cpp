@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "src/cpu/kernels/CpuDynamicGemmKernel.h"
 
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/function_info/GEMMInfo.h"
 
@@ -76,8 +77,36 @@ Status CpuDynamicGemmKernel::validate(const ITensorInfo *a,
     ARM_COMPUTE_UNUSED(beta);
     ARM_COMPUTE_UNUSED(gemm_info);
 
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, c, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
+                                                         DataType::QASYMM8_SIGNED);
+    if (a->data_type() == DataType::QASYMM8_SIGNED)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8_SIGNED,
+                                                             DataType::QSYMM8_PER_CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(c, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, d);
+        // The zero point of a is folded into the packed bias, which requires b to be symmetric.
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->quantization_info().uniform().offset != 0,
+                                        "Only symmetric quantization is supported for b");
+        if (b->data_type() == DataType::QSYMM8_PER_CHANNEL && !b->is_dynamic())
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(b->quantization_info().scale().size() != b->dimension(0));
+        }
+        // The output is requantized with the fixed-point multipliers of gemmlowp
+        GEMMLowpOutputStageInfo output_stage{};
+        ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers(
+            a->quantization_info(), b->quantization_info(), d->quantization_info(), output_stage));
+    }
+    else if (a->data_type() == DataType::BFLOAT16)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(c, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(d, 1, DataType::F32);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, c, d);
+    }
 
     // If both a and b are static, so are c and d, rendering this kernel moot.
     ARM_COMPUTE_RETURN_ERROR_ON(!a->is_dynamic() && !b->is_dynamic());
@@ -118,6 +147,10 @@ Status CpuDynamicGemmKernel::validate(const ITensorInfo *a,
     ARM_COMPUTE_RETURN_ERROR_ON(gemm_info.weight_format() != WeightFormat::UNSPECIFIED);
     ARM_COMPUTE_RETURN_ERROR_ON(gemm_info.accumulate());
 
+    const CpuDynamicGemmKernelHeuristics heuristics{a, b, c, d, alpha, beta, gemm_info};
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!heuristics.is_kernel_selected(),
+                                    "No dynamic GEMM micro-kernel available for this configuration");
+
     return Status{};
 }
 
@@ -178,12 +211,13 @@ void CpuDynamicGemmKernel::prepare(ITensorPack &tensors, const bool reuse_b)
     const bool run_packing = !reuse_b;
     if (run_packing)
     {
+        const ITensor *const lhs                  = tensors.get_const_tensor(ACL_SRC_0);
         const ITensor *const rhs                  = tensors.get_const_tensor(ACL_SRC_1);
         const ITensor *const bias                 = tensors.get_const_tensor(ACL_SRC_2);
         const int            pack_b_tensor_offset = offset_int_vec(_base_aux_slot + PackedRHS);
         ITensor *const       pack_b               = tensors.get_tensor(pack_b_tensor_offset);
 
-        _heuristics.pack_rhs()(rhs, bias, pack_b);
+        _heuristics.pack_rhs()(lhs, rhs, bias, dst, pack_b);
     }
 }
 
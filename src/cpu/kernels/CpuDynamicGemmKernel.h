@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,10 +45,10 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicGemmKernel);
     /** Initialise the kernel's input and output.
      *
-     * @param[in]  a             First input tensor info (Matrix A or Vector A). Data type supported: F32
-     * @param[in]  b             Second input tensor info (Matrix B). Data type supported: same as @p a
-     * @param[in]  c             Third input tensor info (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
-     * @param[out] d             Output tensor info. Data type supported: same as @p a
+     * @param[in]  a             First input tensor info (Matrix A or Vector A). Data type supported: F32/F16/BFLOAT16/QASYMM8_SIGNED
+     * @param[in]  b             Second input tensor info (Matrix B). Data type supported: same as @p a, QSYMM8_PER_CHANNEL if @p a is QASYMM8_SIGNED, in which case @p b must be symmetric
+     * @param[in]  c             Third input tensor info (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a, F32 if @p a is BFLOAT16, S32 if @p a is QASYMM8_SIGNED
+     * @param[out] d             Output tensor info. Data type supported: same as @p a, F32 if @p a is BFLOAT16
      * @param[in]  alpha         Weight of the matrix product
      * @param[in]  beta          Weight of matrix C
      * @param[in]  base_aux_slot First slot to use for intermediate tensor allocations
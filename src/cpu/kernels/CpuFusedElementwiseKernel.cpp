@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuFusedElementwiseKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/fused_elementwise/list.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuFusedElementwiseKernel::FusedElementwiseKernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_fused_elementwise", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::fused_elementwise_fp32_neon)},
+    {"neon_fp16_fused_elementwise",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fused_elementwise_fp16_neon)},
+#endif // __aarch64__
+};
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    switch (act_info.activation())
+    {
+        case ActFunction::IDENTITY:
+        case ActFunction::RELU:
+        case ActFunction::BOUNDED_RELU:
+        case ActFunction::LU_BOUNDED_RELU:
+        case ActFunction::LEAKY_RELU:
+        case ActFunction::LINEAR:
+        case ActFunction::ABS:
+        case ActFunction::SQUARE:
+        case ActFunction::LOGISTIC:
+        case ActFunction::TANH:
+        case ActFunction::SWISH:
+        case ActFunction::HARD_SWISH:
+        case ActFunction::ELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.empty(), "At least one input is required");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.size() > max_elementwise_chain_inputs, "Too many inputs");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(chain.empty(), "The chain must contain at least one step");
+
+    const ITensorInfo *src0 = srcs[0];
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src0, 1, DataType::F16, DataType::F32);
+
+    TensorShape out_shape = src0->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src);
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+    }
+
+    for (const ElementwiseChainStep &step : chain)
+    {
+        if (is_binary_chain_step(step))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(step.operand >= srcs.size(), "Chain step refers to a missing input");
+        }
+        else if (step.op == ElementwiseChainOperation::ACTIVATION)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_supported_activation(step.act_info),
+                                            "Activation function not supported in element-wise chains");
+        }
+    }
+
+    // Validate in case the output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(detail::have_different_dimensions(out_shape, dst->tensor_shape(), 0),
+                                        "Wrong shape for output");
+    }
+
+    const auto uk = CpuFusedElementwiseKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuFusedElementwiseKernel::configure(const std::vector<const ITensorInfo *> &srcs,
+                                          ITensorInfo                            *dst,
+                                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, chain));
+
+    const auto uk = CpuFusedElementwiseKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{srcs[0]->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+    ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
+
+    _chain      = chain;
+    _num_srcs   = srcs.size();
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuFusedElementwiseKernel/").append(uk->name);
+
+    // Auto initialize the output if not initialized
+    TensorShape out_shape = srcs[0]->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+    }
+    set_shape_if_empty(*dst, out_shape);
+    set_data_type_if_unknown(*dst, srcs[0]->data_type());
+
+    // Configure kernel window
+    Window win = calculate_max_window(out_shape, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuFusedElementwiseKernel::validate(const std::vector<const ITensorInfo *> &srcs,
+                                           const ITensorInfo                      *dst,
+                                           const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, chain));
+    return Status{};
+}
+
+void CpuFusedElementwiseKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    std::array<const ITensor *, max_elementwise_chain_inputs> srcs{};
+    for (size_t i = 0; i < _num_srcs; ++i)
+    {
+        srcs[i] = tensors.get_const_tensor(ACL_SRC_VEC + i);
+    }
+    ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(srcs.data(), _num_srcs, dst, _chain, window);
+}
+
+const char *CpuFusedElementwiseKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuFusedElementwiseKernel::FusedElementwiseKernel> &CpuFusedElementwiseKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
+
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to evaluate a chain of element-wise operations and activations in a single pass over the data */
+class CpuFusedElementwiseKernel : public ICpuKernel<CpuFusedElementwiseKernel>
+{
+private:
+    using FusedElementwiseKernelPtr = std::add_pointer<void(
+        const ITensor *const *, size_t, ITensor *, const ElementwiseChainInfo &, const Window &)>::type;
+
+public:
+    struct FusedElementwiseKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        FusedElementwiseKernelPtr    ukernel;
+    };
+
+    CpuFusedElementwiseKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuFusedElementwiseKernel);
+    /** Initialize the kernel's inputs and output.
+     *
+     * Similar to @ref NEFusedElementwise::configure()
+     *
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, const ElementwiseChainInfo &chain);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuFusedElementwiseKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, const ElementwiseChainInfo &chain);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<FusedElementwiseKernel> &get_available_kernels();
+
+private:
+    ElementwiseChainInfo      _chain{};
+    size_t                    _num_srcs{0};
+    FusedElementwiseKernelPtr _run_method{nullptr};
+    std::string               _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLayerNormalizationKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/layernorm/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLayerNormalizationKernel::LayerNormKernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_layernorm", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_layernorm)},
+    {"neon_fp16_layernorm", [](const DataTypeISASelectorData &data)
+     { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_layernorm)},
+    // BF16 values are widened to F32 with integer shifts, so no BF16 instruction is needed
+    {"neon_bf16_layernorm", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::BFLOAT16); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_bf16_layernorm)},
+#endif // __aarch64__
+};
+
+Status validate_arguments(const ITensorInfo            *src,
+                          const ITensorInfo            *residual,
+                          const ITensorInfo            *gamma,
+                          const ITensorInfo            *beta,
+                          const ITensorInfo            *add_output,
+                          const ITensorInfo            *dst,
+                          const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.type != LayerNormalizationType::LayerNorm &&
+                                info.type != LayerNormalizationType::RMSNorm);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.epsilon >= 0.f), "Epsilon must be positive");
+
+    if (residual != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, residual);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, residual);
+    }
+
+    for (const ITensorInfo *param : {gamma, beta})
+    {
+        if (param != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, param);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(param->num_dimensions() > 1 || param->dimension(0) != src->dimension(0),
+                                            "Gamma and beta must hold a value per element of a row");
+        }
+    }
+
+    if (add_output != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(residual == nullptr, "The sum can only be output with a residual");
+        if (add_output->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, add_output);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, add_output);
+        }
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    const auto uk = CpuLayerNormalizationKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(uk == nullptr || uk->ukernel == nullptr,
+                                    "No layer normalization micro-kernel available for this configuration");
+
+    return Status{};
+}
+} // namespace
+
+void CpuLayerNormalizationKernel::configure(const ITensorInfo            *src,
+                                            const ITensorInfo            *residual,
+                                            const ITensorInfo            *gamma,
+                                            const ITensorInfo            *beta,
+                                            ITensorInfo                  *add_output,
+                                            ITensorInfo                  *dst,
+                                            const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    // Auto initialize the outputs if not initialized
+    auto_init_if_empty(*dst, *src->clone());
+    if (add_output != nullptr)
+    {
+        auto_init_if_empty(*add_output, *src->clone());
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, residual, gamma, beta, add_output, dst, info));
+
+    const auto uk = CpuLayerNormalizationKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLayerNormalizationKernel/").append(uk->name);
+    _info       = info;
+
+    // A row is processed by a single thread, the outer dimension is split when there are too few rows
+    _split_dimension = src->dimension(1) >= src->dimension(2) ? Window::DimY : Window::DimZ;
+
+    Window win = calculate_max_window(*src, Steps(src->dimension(0)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuLayerNormalizationKernel::validate(const ITensorInfo            *src,
+                                             const ITensorInfo            *residual,
+                                             const ITensorInfo            *gamma,
+                                             const ITensorInfo            *beta,
+                                             const ITensorInfo            *add_output,
+                                             const ITensorInfo            *dst,
+                                             const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, residual, gamma, beta, add_output, dst, info));
+    return Status{};
+}
+
+void CpuLayerNormalizationKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *residual   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *gamma      = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *beta       = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *add_output = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, residual, gamma, beta, add_output, dst, _info, window);
+}
+
+const char *CpuLayerNormalizationKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuLayerNormalizationKernel::LayerNormKernel> &
+CpuLayerNormalizationKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
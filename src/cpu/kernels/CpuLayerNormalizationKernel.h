@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
+
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to normalize the rows of a tensor, optionally after adding a residual, and scale and shift them
+ *
+ * The residual addition, the normalization (layer norm or RMS norm) and the affine transform are computed in a single
+ * pass over each row, accumulating in F32.
+ */
+class CpuLayerNormalizationKernel : public ICpuKernel<CpuLayerNormalizationKernel>
+{
+private:
+    using LayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     ITensor *,
+                                                     const LayerNormalizationInfo &,
+                                                     const Window &)>::type;
+
+public:
+    struct LayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormKernelPtr           ukernel;
+    };
+
+    CpuLayerNormalizationKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLayerNormalizationKernel);
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  src        Source tensor info, normalized along dimension 0. Data types supported: F16/F32/BFLOAT16
+     * @param[in]  residual   (Optional) Residual tensor info added to @p src before the normalization. Can be nullptr.
+     *                        Data types supported: Same as @p src
+     * @param[in]  gamma      (Optional) Scale tensor info of shape [src dimension 0]. Can be nullptr. Data types supported: Same as @p src
+     * @param[in]  beta       (Optional) Offset tensor info of shape [src dimension 0]. Can be nullptr. Data types supported: Same as @p src
+     * @param[out] add_output (Optional) Destination tensor info of the sum of @p src and @p residual. Can be nullptr,
+     *                        and must be when there is no @p residual. Data types supported: Same as @p src
+     * @param[out] dst        Destination tensor info. Data types supported: Same as @p src
+     * @param[in]  info       Normalization type and epsilon
+     */
+    void configure(const ITensorInfo            *src,
+                   const ITensorInfo            *residual,
+                   const ITensorInfo            *gamma,
+                   const ITensorInfo            *beta,
+                   ITensorInfo                  *add_output,
+                   ITensorInfo                  *dst,
+                   const LayerNormalizationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLayerNormalizationKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *src,
+                           const ITensorInfo            *residual,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *add_output,
+                           const ITensorInfo            *dst,
+                           const LayerNormalizationInfo &info);
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs
+     *
+     * @return The split dimension hint
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<LayerNormKernel> &get_available_kernels();
+
+private:
+    LayerNormKernelPtr     _run_method{nullptr};
+    std::string            _name{};
+    LayerNormalizationInfo _info{};
+    size_t                 _split_dimension{Window::DimY};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULAYERNORMALIZATIONKERNEL_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuMatMulQsi4Kernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/matmul_qsi4/list.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuMatMulQsi4Kernel::MatMulQsi4Kernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_matmul_qsi4_i8mm",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.i8mm && data.isa.dot; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_i8mm),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_i8mm_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_i8mm_size_of_packed_rhs), qsi4_kai_n_step},
+    {"neon_fp32_matmul_qsi4_dotprod",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.dot; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_dotprod),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_dotprod_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_dotprod_size_of_packed_rhs), qsi4_kai_n_step},
+    {"neon_fp32_matmul_qsi4", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi4_size_of_packed_rhs), 1},
+#endif // __aarch64__
+};
+
+/** Number of values of K sharing a scale, the per channel weights being a single block of K rounded up to 32 values */
+size_t block_size(const ITensorInfo *lhs, const ITensorInfo *rhs)
+{
+    const size_t k = lhs->dimension(0);
+    return rhs->data_type() == DataType::QSYMM4_PER_CHANNEL
+               ? ceil_to_multiple(k, qsi4_chunk_size)
+               : k / (rhs->quantization_info().scale().size() / rhs->dimension(1));
+}
+
+Status validate_arguments(const ITensorInfo         *lhs,
+                          const ITensorInfo         *rhs,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs, 1, DataType::QSYMM4_PER_CHANNEL,
+                                                         DataType::QSYMM4_PER_BLOCK);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->num_dimensions() > 2, "Batched weights are not supported");
+
+    const size_t k          = lhs->dimension(0);
+    const size_t n          = rhs->dimension(1);
+    const size_t num_scales = rhs->quantization_info().scale().size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->dimension(0) != (k + 1) / 2,
+                                    "The weights must hold K 4-bit values per output channel");
+    if (rhs->data_type() == DataType::QSYMM4_PER_CHANNEL)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_scales != n, "The weights must have one scale per output channel");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_scales == 0 || num_scales % n != 0,
+                                        "The weights must have the same number of scales per output channel");
+        const size_t num_blocks = num_scales / n;
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(k % num_blocks != 0 || (k / num_blocks) % qsi4_chunk_size != 0,
+                                        "The block length must divide K and be a multiple of 32");
+    }
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != n);
+    }
+
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_info.enabled() && act_info.activation() != ActFunction::RELU &&
+                                        act_info.activation() != ActFunction::BOUNDED_RELU &&
+                                        act_info.activation() != ActFunction::LU_BOUNDED_RELU,
+                                    "Only RELU Family activations, or no activation, is supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        const TensorShape dst_shape = TensorShape(lhs->tensor_shape()).set(0, n);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    const auto uk = CpuMatMulQsi4Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(uk == nullptr || uk->ukernel == nullptr,
+                                    "No 4-bit matrix multiplication micro-kernel available for this configuration");
+
+    return Status{};
+}
+} // namespace
+
+void CpuMatMulQsi4Kernel::configure(const ITensorInfo         *lhs,
+                                    const ITensorInfo         *rhs,
+                                    const ITensorInfo         *bias,
+                                    ITensorInfo               *dst,
+                                    const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
+
+    // Auto initialize the output if not initialized
+    const TensorShape dst_shape = TensorShape(lhs->tensor_shape()).set(0, rhs->dimension(1));
+    auto_init_if_empty(*dst, lhs->clone()->set_tensor_shape(dst_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(lhs, rhs, bias, dst, act_info));
+
+    const auto uk = CpuMatMulQsi4Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method  = uk->ukernel;
+    _pack_method = uk->pack_rhs;
+    _name        = std::string("CpuMatMulQsi4Kernel/").append(uk->name);
+    _k           = lhs->dimension(0);
+    _block_size  = block_size(lhs, rhs);
+
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    _min              = std::numeric_limits<float>::lowest();
+    _max              = std::numeric_limits<float>::max();
+    if (act_info.enabled())
+    {
+        _min = act_info.activation() == ActFunction::LU_BOUNDED_RELU ? act_info.b() : 0.f;
+        _max = act_info.activation() == ActFunction::RELU ? _max : act_info.a();
+    }
+
+    // A single row is split over the output channels, several rows over the rows
+    _split_dimension = dst->dimension(1) == 1 ? Window::DimX : Window::DimY;
+
+    Window win = calculate_max_window(*dst, Steps(uk->n_step));
+    ICpuKernel::configure(win);
+}
+
+Status CpuMatMulQsi4Kernel::validate(const ITensorInfo         *lhs,
+                                     const ITensorInfo         *rhs,
+                                     const ITensorInfo         *bias,
+                                     const ITensorInfo         *dst,
+                                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(lhs, rhs, bias, dst, act_info));
+    return Status{};
+}
+
+size_t CpuMatMulQsi4Kernel::size_of_packed_rhs(const ITensorInfo *lhs, const ITensorInfo *rhs)
+{
+    const auto uk = CpuMatMulQsi4Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    return uk->size_of_packed_rhs(lhs->dimension(0), rhs->dimension(1), block_size(lhs, rhs));
+}
+
+void CpuMatMulQsi4Kernel::pack_rhs(const ITensor *rhs, ITensor *packed_rhs) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(rhs, packed_rhs);
+    ARM_COMPUTE_ERROR_ON(_pack_method == nullptr);
+
+    _pack_method(rhs, packed_rhs, _k, _block_size);
+}
+
+void CpuMatMulQsi4Kernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed_rhs = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *bias       = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, packed_rhs, bias, dst, _block_size, _min, _max, window);
+}
+
+const char *CpuMatMulQsi4Kernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuMatMulQsi4Kernel::MatMulQsi4Kernel> &CpuMatMulQsi4Kernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUMATMULQSI4KERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUMATMULQSI4KERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a floating-point matrix by a matrix of 4-bit symmetric quantized weights
+ *
+ * The weights are given as a [K, N] matrix where the K values of each of the N output channels are contiguous, two
+ * values per byte: the value of even index in the low nibble and the value of odd index in the high nibble, both in
+ * two's complement. The first dimension of the weights tensor is therefore the number of bytes of a channel, K / 2
+ * rounded up.
+ *
+ * - @ref DataType::QSYMM4_PER_CHANNEL weights have N scales.
+ * - @ref DataType::QSYMM4_PER_BLOCK weights have N * (K / block length) scales, the scales of each channel being
+ *   contiguous. The block length must be a multiple of 32.
+ *
+ * Each row of the LHS is quantized to 8 bits on the fly, so that the products are accumulated on integers. The KleidiAI
+ * qai8dxp/qsi4cxp micro-kernels are run on the per channel weights and the qai8dxp/qsi4c32p ones on the per block
+ * weights of the cores with the matrix multiply or dot product instructions, the NEON implementation on the others.
+ *
+ * The weights are repacked once by @ref CpuMatMulQsi4Kernel::pack_rhs, in the layout of the selected micro-kernel.
+ */
+class CpuMatMulQsi4Kernel : public ICpuKernel<CpuMatMulQsi4Kernel>
+{
+private:
+    using MatMulQsi4KernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, ITensor *, size_t, float, float, const Window &)>::type;
+    using PackRhsPtr = std::add_pointer<void(const ITensor *, ITensor *, size_t, size_t)>::type;
+    using SizeOfPackedRhsPtr = std::add_pointer<size_t(size_t, size_t, size_t)>::type;
+
+public:
+    struct MatMulQsi4Kernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        MatMulQsi4KernelPtr          ukernel;
+        PackRhsPtr                   pack_rhs;
+        SizeOfPackedRhsPtr           size_of_packed_rhs;
+        size_t                       n_step; /**< Step of the window along the output channels */
+    };
+
+    CpuMatMulQsi4Kernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuMatMulQsi4Kernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  lhs      Left-hand side tensor info of shape [K, M, batches...]. Data type supported: F32
+     * @param[in]  rhs      Weights tensor info of shape [ceil(K / 2), N]. Data type supported: QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK
+     * @param[in]  bias     (Optional) Bias tensor info of shape [N]. Can be nullptr. Data type supported: F32
+     * @param[out] dst      Output tensor info of shape [N, M, batches...]. Data type supported: F32
+     * @param[in]  act_info (Optional) Fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported
+     */
+    void configure(const ITensorInfo         *lhs,
+                   const ITensorInfo         *rhs,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuMatMulQsi4Kernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *lhs,
+                           const ITensorInfo         *rhs,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    /** Size in bytes of the packed weights
+     *
+     * @param[in] lhs Left-hand side tensor info
+     * @param[in] rhs Weights tensor info
+     *
+     * @return The size of the tensor to pass to @ref CpuMatMulQsi4Kernel::pack_rhs
+     */
+    static size_t size_of_packed_rhs(const ITensorInfo *lhs, const ITensorInfo *rhs);
+
+    /** Pack the weights and their scales in the layout read by the kernel
+     *
+     * @param[in]  rhs        Weights tensor, as passed to configure()
+     * @param[out] packed_rhs Packed weights, of at least @ref CpuMatMulQsi4Kernel::size_of_packed_rhs bytes
+     */
+    void pack_rhs(const ITensor *rhs, ITensor *packed_rhs) const;
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs
+     *
+     * @return The split dimension hint
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<MatMulQsi4Kernel> &get_available_kernels();
+
+private:
+    MatMulQsi4KernelPtr _run_method{nullptr};
+    PackRhsPtr          _pack_method{nullptr};
+    std::string         _name{};
+    size_t              _k{0};
+    size_t              _block_size{0};
+    float               _min{0.f};
+    float               _max{0.f};
+    size_t              _split_dimension{Window::DimY};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUMATMULQSI4KERNEL_H
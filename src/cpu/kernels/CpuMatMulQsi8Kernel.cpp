@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuMatMulQsi8Kernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/matmul_qsi8/list.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuMatMulQsi8Kernel::MatMulQsi8Kernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_matmul_qsi8_i8mm",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.i8mm && data.isa.dot; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_i8mm),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_i8mm_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_i8mm_size_of_packed_rhs), qsi8_kai_n_step},
+    {"neon_fp32_matmul_qsi8_dotprod",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.dot; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_dotprod),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_dotprod_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_dotprod_size_of_packed_rhs), qsi8_kai_n_step},
+    {"neon_fp32_matmul_qsi8", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_pack_rhs),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_matmul_qsi8_size_of_packed_rhs), 1},
+#endif // __aarch64__
+};
+
+Status validate_arguments(const ITensorInfo         *lhs,
+                          const ITensorInfo         *rhs,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          bool                       adj_rhs,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs, 1, DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->num_dimensions() > 2, "Batched weights are not supported");
+
+    const size_t k          = lhs->dimension(0);
+    const size_t n          = rhs->dimension(adj_rhs ? 1 : 0);
+    const size_t num_scales = rhs->quantization_info().scale().size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->dimension(adj_rhs ? 0 : 1) != k,
+                                    "The weights must hold K values per output channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_scales != n && num_scales != 1,
+                                    "The weights must have one scale per output channel or a single one");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != n);
+    }
+
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_info.enabled() && act_info.activation() != ActFunction::RELU &&
+                                        act_info.activation() != ActFunction::BOUNDED_RELU &&
+                                        act_info.activation() != ActFunction::LU_BOUNDED_RELU,
+                                    "Only RELU Family activations, or no activation, is supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        const TensorShape dst_shape = TensorShape(lhs->tensor_shape()).set(0, n);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    const auto uk = CpuMatMulQsi8Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(uk == nullptr || uk->ukernel == nullptr,
+                                    "No 8-bit matrix multiplication micro-kernel available for this configuration");
+
+    return Status{};
+}
+} // namespace
+
+void CpuMatMulQsi8Kernel::configure(const ITensorInfo         *lhs,
+                                    const ITensorInfo         *rhs,
+                                    const ITensorInfo         *bias,
+                                    ITensorInfo               *dst,
+                                    bool                       adj_rhs,
+                                    const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
+
+    // Auto initialize the output if not initialized
+    const TensorShape dst_shape = TensorShape(lhs->tensor_shape()).set(0, rhs->dimension(adj_rhs ? 1 : 0));
+    auto_init_if_empty(*dst, lhs->clone()->set_tensor_shape(dst_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(lhs, rhs, bias, dst, adj_rhs, act_info));
+
+    const auto uk = CpuMatMulQsi8Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method  = uk->ukernel;
+    _pack_method = uk->pack_rhs;
+    _name        = std::string("CpuMatMulQsi8Kernel/").append(uk->name);
+    _k          = lhs->dimension(0);
+    _n          = dst->dimension(0);
+    _adj_rhs    = adj_rhs;
+
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    _min              = std::numeric_limits<float>::lowest();
+    _max              = std::numeric_limits<float>::max();
+    if (act_info.enabled())
+    {
+        _min = act_info.activation() == ActFunction::LU_BOUNDED_RELU ? act_info.b() : 0.f;
+        _max = act_info.activation() == ActFunction::RELU ? _max : act_info.a();
+    }
+
+    // A single row is split over the output channels, several rows over the rows
+    _split_dimension = dst->dimension(1) == 1 ? Window::DimX : Window::DimY;
+
+    Window win = calculate_max_window(*dst, Steps(uk->n_step));
+    ICpuKernel::configure(win);
+}
+
+Status CpuMatMulQsi8Kernel::validate(const ITensorInfo         *lhs,
+                                     const ITensorInfo         *rhs,
+                                     const ITensorInfo         *bias,
+                                     const ITensorInfo         *dst,
+                                     bool                       adj_rhs,
+                                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(lhs, rhs, bias, dst, adj_rhs, act_info));
+    return Status{};
+}
+
+size_t CpuMatMulQsi8Kernel::size_of_packed_rhs(const ITensorInfo *lhs, const ITensorInfo *rhs, bool adj_rhs)
+{
+    const auto uk = CpuMatMulQsi8Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    return uk->size_of_packed_rhs(lhs->dimension(0), rhs->dimension(adj_rhs ? 1 : 0));
+}
+
+void CpuMatMulQsi8Kernel::pack_rhs(const ITensor *rhs, ITensor *packed_rhs) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(rhs, packed_rhs);
+    ARM_COMPUTE_ERROR_ON(_pack_method == nullptr);
+
+    _pack_method(rhs, packed_rhs, _k, _n, _adj_rhs);
+}
+
+void CpuMatMulQsi8Kernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed_rhs = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *bias       = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, packed_rhs, bias, dst, _min, _max, window);
+}
+
+const char *CpuMatMulQsi8Kernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuMatMulQsi8Kernel::MatMulQsi8Kernel> &CpuMatMulQsi8Kernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUMATMULQSI8KERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUMATMULQSI8KERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a floating-point matrix by a matrix of 8-bit symmetric per channel quantized weights
+ *
+ * Each row of the LHS is quantized to QASYMM8_SIGNED at run time, with a scale and an offset computed from the range of
+ * the row, so that no quantization information has to be calibrated for the LHS. The products are accumulated on
+ * integers and dequantized to F32 with the scales of the row and of the output channel.
+ *
+ * The KleidiAI qai8dxp/qsi8cxp micro-kernels are run on the cores with the matrix multiply or dot product
+ * instructions, the NEON implementation on the others.
+ *
+ * The weights are repacked once by @ref CpuMatMulQsi8Kernel::pack_rhs, in the layout of the selected micro-kernel,
+ * together with their scales and the sum of the weights of each output channel used to take the LHS offset into
+ * account.
+ */
+class CpuMatMulQsi8Kernel : public ICpuKernel<CpuMatMulQsi8Kernel>
+{
+private:
+    using MatMulQsi8KernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, ITensor *, float, float, const Window &)>::type;
+    using PackRhsPtr = std::add_pointer<void(const ITensor *, ITensor *, size_t, size_t, bool)>::type;
+    using SizeOfPackedRhsPtr = std::add_pointer<size_t(size_t, size_t)>::type;
+
+public:
+    struct MatMulQsi8Kernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        MatMulQsi8KernelPtr          ukernel;
+        PackRhsPtr                   pack_rhs;
+        SizeOfPackedRhsPtr           size_of_packed_rhs;
+        size_t                       n_step; /**< Step of the window along the output channels */
+    };
+
+    CpuMatMulQsi8Kernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuMatMulQsi8Kernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  lhs      Left-hand side tensor info of shape [K, M, batches...]. Data type supported: F32
+     * @param[in]  rhs      Weights tensor info of shape [K, N] if @p adj_rhs is set, [N, K] otherwise.
+     *                      Data type supported: QSYMM8_PER_CHANNEL, with N scales or a single one
+     * @param[in]  bias     (Optional) Bias tensor info of shape [N]. Can be nullptr. Data type supported: F32
+     * @param[out] dst      Output tensor info of shape [N, M, batches...]. Data type supported: F32
+     * @param[in]  adj_rhs  True if the K values of each output channel of @p rhs are contiguous
+     * @param[in]  act_info (Optional) Fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported
+     */
+    void configure(const ITensorInfo         *lhs,
+                   const ITensorInfo         *rhs,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   bool                       adj_rhs,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuMatMulQsi8Kernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *lhs,
+                           const ITensorInfo         *rhs,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           bool                       adj_rhs,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    /** Size in bytes of the packed weights
+     *
+     * @param[in] lhs     Left-hand side tensor info
+     * @param[in] rhs     Weights tensor info
+     * @param[in] adj_rhs True if the K values of each output channel of @p rhs are contiguous
+     *
+     * @return The size of the tensor to pass to @ref CpuMatMulQsi8Kernel::pack_rhs
+     */
+    static size_t size_of_packed_rhs(const ITensorInfo *lhs, const ITensorInfo *rhs, bool adj_rhs);
+
+    /** Pack the weights, their scales and their sums in the layout read by the kernel
+     *
+     * @param[in]  rhs        Weights tensor, as passed to configure()
+     * @param[out] packed_rhs Packed weights, of at least @ref CpuMatMulQsi8Kernel::size_of_packed_rhs bytes
+     */
+    void pack_rhs(const ITensor *rhs, ITensor *packed_rhs) const;
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs
+     *
+     * @return The split dimension hint
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<MatMulQsi8Kernel> &get_available_kernels();
+
+private:
+    MatMulQsi8KernelPtr _run_method{nullptr};
+    PackRhsPtr          _pack_method{nullptr};
+    std::string         _name{};
+    size_t              _k{0};
+    size_t              _n{0};
+    bool                _adj_rhs{false};
+    float               _min{0.f};
+    float               _max{0.f};
+    size_t              _split_dimension{Window::DimY};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUMATMULQSI8KERNEL_H
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/cpu/kernels/attention/list.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+#ifdef __aarch64__
+namespace
+{
+// The scores and the accumulators are computed in F32 whatever the data type of the tensors
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+/** Compute the scores of a tile of queries against a tile of keys
+ *
+ * @param[in]  queries    Scaled queries, of @p head_size values each
+ * @param[in]  rows       Number of queries
+ * @param[in]  head_size  Size of the queries and keys
+ * @param[in]  keys       First key of the tile
+ * @param[in]  key_stride Stride in bytes between two keys
+ * @param[in]  num_keys   Number of keys of the tile
+ * @param[out] scores     Scores, @ref attention_key_tile per query
+ */
+template <typename T>
+void compute_scores(const float   *queries,
+                    size_t         rows,
+                    size_t         head_size,
+                    const uint8_t *keys,
+                    size_t         key_stride,
+                    size_t         num_keys,
+                    float         *scores)
+{
+    for (size_t j = 0; j < num_keys; ++j)
+    {
+        const T    *k = reinterpret_cast<const T *>(keys + j * key_stride);
+        float32x4_t acc[attention_query_tile];
+        for (size_t r = 0; r < rows; ++r)
+        {
+            acc[r] = vdupq_n_f32(0.f);
+        }
+
+        size_t d = 0;
+        for (; d + 4 <= head_size; d += 4)
+        {
+            // Each key is loaded once for the whole tile of queries
+            const float32x4_t vk = load_f32x4(k + d);
+            for (size_t r = 0; r < rows; ++r)
+            {
+                acc[r] = vfmaq_f32(acc[r], vld1q_f32(queries + r * head_size + d), vk);
+            }
+        }
+
+        for (size_t r = 0; r < rows; ++r)
+        {
+            float score = vaddvq_f32(acc[r]);
+            for (size_t i = d; i < head_size; ++i)
+            {
+                score += queries[r * head_size + i] * static_cast<float>(k[i]);
+            }
+            scores[r * attention_key_tile + j] = score;
+        }
+    }
+}
+
+/** Turn the scores of a query into probabilities relative to the running maximum, rescaling what was accumulated
+ *
+ * @param[in,out] scores     Scores of the tile of keys, replaced by their exponentials
+ * @param[in]     visible    Number of keys of the tile visible to the query, the scores of the others being ignored
+ * @param[in]     num_keys   Number of keys of the tile
+ * @param[in,out] row_max    Maximum of the scores seen so far
+ * @param[in,out] row_sum    Sum of the exponentials seen so far, relative to @p row_max
+ * @param[in,out] acc        Accumulated values, relative to @p row_max
+ * @param[in]     value_size Size of the values
+ */
+inline void online_softmax(
+    float *scores, size_t visible, size_t num_keys, float &row_max, float &row_sum, float *acc, size_t value_size)
+{
+    float tile_max = -std::numeric_limits<float>::infinity();
+    for (size_t j = 0; j < visible; ++j)
+    {
+        tile_max = std::max(tile_max, scores[j]);
+    }
+
+    const float new_max = std::max(row_max, tile_max);
+    if (new_max == -std::numeric_limits<float>::infinity())
+    {
+        // No visible key yet: nothing to accumulate
+        std::fill_n(scores, num_keys, 0.f);
+        return;
+    }
+
+    if (new_max > row_max)
+    {
+        const float correction = std::exp(row_max - new_max);
+        row_sum *= correction;
+        size_t d = 0;
+        for (; d + 4 <= value_size; d += 4)
+        {
+            vst1q_f32(acc + d, vmulq_n_f32(vld1q_f32(acc + d), correction));
+        }
+        for (; d < value_size; ++d)
+        {
+            acc[d] *= correction;
+        }
+        row_max = new_max;
+    }
+
+    const float32x4_t vmax = vdupq_n_f32(new_max);
+    float32x4_t       vsum = vdupq_n_f32(0.f);
+    size_t            j    = 0;
+    for (; j + 4 <= visible; j += 4)
+    {
+        const float32x4_t p = vexpq_f32(vsubq_f32(vld1q_f32(scores + j), vmax));
+        vsum                = vaddq_f32(vsum, p);
+        vst1q_f32(scores + j, p);
+    }
+    float sum = vaddvq_f32(vsum);
+    for (; j < visible; ++j)
+    {
+        scores[j] = std::exp(scores[j] - new_max);
+        sum += scores[j];
+    }
+    std::fill(scores + visible, scores + num_keys, 0.f);
+    row_sum += sum;
+}
+
+/** Accumulate the values of a tile of keys weighted by the probabilities of a tile of queries
+ *
+ * @param[in]     probs        Probabilities, @ref attention_key_tile per query
+ * @param[in]     rows         Number of queries
+ * @param[in]     values       First value of the tile
+ * @param[in]     value_stride Stride in bytes between two values
+ * @param[in]     num_keys     Number of keys of the tile
+ * @param[in]     value_size   Size of the values
+ * @param[in,out] acc          Accumulators, @p value_size per query
+ */
+template <typename T>
+void accumulate_values(const float   *probs,
+                       size_t         rows,
+                       const uint8_t *values,
+                       size_t         value_stride,
+                       size_t         num_keys,
+                       size_t         value_size,
+                       float         *acc)
+{
+    size_t d = 0;
+    for (; d + 4 <= value_size; d += 4)
+    {
+        // The accumulators of the tile stay in registers over the keys
+        float32x4_t vacc[attention_query_tile];
+        for (size_t r = 0; r < rows; ++r)
+        {
+            vacc[r] = vld1q_f32(acc + r * value_size + d);
+        }
+        for (size_t j = 0; j < num_keys; ++j)
+        {
+            const float32x4_t v = load_f32x4(reinterpret_cast<const T *>(values + j * value_stride) + d);
+            for (size_t r = 0; r < rows; ++r)
+            {
+                vacc[r] = vfmaq_n_f32(vacc[r], v, probs[r * attention_key_tile + j]);
+            }
+        }
+        for (size_t r = 0; r < rows; ++r)
+        {
+            vst1q_f32(acc + r * value_size + d, vacc[r]);
+        }
+    }
+    for (; d < value_size; ++d)
+    {
+        for (size_t j = 0; j < num_keys; ++j)
+        {
+            const float v = static_cast<float>(reinterpret_cast<const T *>(values + j * value_stride)[d]);
+            for (size_t r = 0; r < rows; ++r)
+            {
+                acc[r * value_size + d] += probs[r * attention_key_tile + j] * v;
+            }
+        }
+    }
+}
+} // namespace
+
+template <typename T>
+void neon_attention_float(const ITensor *query,
+                          const ITensor *key,
+                          const ITensor *value,
+                          const ITensor *mask,
+                          ITensor       *dst,
+                          float          scale,
+                          bool           is_causal,
+                          float         *workspace,
+                          const Window  &window)
+{
+    const ITensorInfo *q_info      = query->info();
+    const size_t       head_size   = q_info->dimension(0);
+    const size_t       num_queries = q_info->dimension(1);
+    const size_t       num_keys    = key->info()->dimension(1);
+    const size_t       value_size  = value->info()->dimension(0);
+    // With causal masking, the queries are aligned with the last keys. When there are fewer keys than queries, which
+    // dynamic keys allow, the first queries see no key.
+    const auto causal_keys = [num_keys, num_queries](size_t q)
+    { return q + 1 + num_keys > num_queries ? q + 1 + num_keys - num_queries : size_t(0); };
+
+    const Strides &q_strides = q_info->strides_in_bytes();
+    const Strides &k_strides = key->info()->strides_in_bytes();
+    const Strides &v_strides = value->info()->strides_in_bytes();
+    const Strides &d_strides = dst->info()->strides_in_bytes();
+
+    // A mask broadcast along the heads or the batches does not move in these dimensions
+    size_t m_stride_y = 0;
+    size_t m_stride_z = 0;
+    size_t m_stride_w = 0;
+    if (mask != nullptr)
+    {
+        const ITensorInfo *m_info = mask->info();
+        m_stride_y                = m_info->strides_in_bytes()[1];
+        m_stride_z                = m_info->dimension(2) > 1 ? m_info->strides_in_bytes()[2] : 0;
+        m_stride_w                = m_info->dimension(3) > 1 ? m_info->strides_in_bytes()[3] : 0;
+    }
+
+    float *q_tile  = workspace;
+    float *scores  = q_tile + attention_query_tile * head_size;
+    float *acc     = scores + attention_query_tile * attention_key_tile;
+    float *row_max = acc + attention_query_tile * value_size;
+    float *row_sum = row_max + attention_query_tile;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const size_t q0 = id.y();
+            if (q0 >= num_queries)
+            {
+                return;
+            }
+            const size_t rows = std::min(attention_query_tile, num_queries - q0);
+
+            const uint8_t *q_ptr = query->buffer() + q_info->offset_first_element_in_bytes() + q0 * q_strides[1] +
+                                   id.z() * q_strides[2] + id[3] * q_strides[3];
+            const uint8_t *k_ptr = key->buffer() + key->info()->offset_first_element_in_bytes() +
+                                   id.z() * k_strides[2] + id[3] * k_strides[3];
+            const uint8_t *v_ptr = value->buffer() + value->info()->offset_first_element_in_bytes() +
+                                   id.z() * v_strides[2] + id[3] * v_strides[3];
+            const uint8_t *m_ptr = mask == nullptr ? nullptr
+                                                   : mask->buffer() + mask->info()->offset_first_element_in_bytes() +
+                                                         q0 * m_stride_y + id.z() * m_stride_z + id[3] * m_stride_w;
+            uint8_t *d_ptr = dst->buffer() + dst->info()->offset_first_element_in_bytes() + q0 * d_strides[1] +
+                             id.z() * d_strides[2] + id[3] * d_strides[3];
+
+            // The queries are scaled once rather than each of their scores
+            for (size_t r = 0; r < rows; ++r)
+            {
+                const T *src = reinterpret_cast<const T *>(q_ptr + r * q_strides[1]);
+                float   *q   = q_tile + r * head_size;
+                size_t   d   = 0;
+                for (; d + 4 <= head_size; d += 4)
+                {
+                    vst1q_f32(q + d, vmulq_n_f32(load_f32x4(src + d), scale));
+                }
+                for (; d < head_size; ++d)
+                {
+                    q[d] = static_cast<float>(src[d]) * scale;
+                }
+                row_max[r] = -std::numeric_limits<float>::infinity();
+                row_sum[r] = 0.f;
+                std::fill_n(acc + r * value_size, value_size, 0.f);
+            }
+
+            // The keys following the last query of the tile are not visited when causal
+            const size_t end_key = is_causal ? causal_keys(q0 + rows - 1) : num_keys;
+            for (size_t k0 = 0; k0 < end_key; k0 += attention_key_tile)
+            {
+                const size_t tile_keys = std::min(attention_key_tile, end_key - k0);
+                compute_scores<T>(q_tile, rows, head_size, k_ptr + k0 * k_strides[1], k_strides[1], tile_keys, scores);
+
+                for (size_t r = 0; r < rows; ++r)
+                {
+                    float       *s       = scores + r * attention_key_tile;
+                    const size_t limit   = causal_keys(q0 + r);
+                    const size_t visible = is_causal ? (limit > k0 ? std::min(tile_keys, limit - k0) : 0) : tile_keys;
+                    if (m_ptr != nullptr)
+                    {
+                        const T *m = reinterpret_cast<const T *>(m_ptr + r * m_stride_y) + k0;
+                        for (size_t j = 0; j < visible; ++j)
+                        {
+                            s[j] += static_cast<float>(m[j]);
+                        }
+                    }
+                    online_softmax(s, visible, tile_keys, row_max[r], row_sum[r], acc + r * value_size, value_size);
+                }
+
+                accumulate_values<T>(scores, rows, v_ptr + k0 * v_strides[1], v_strides[1], tile_keys, value_size,
+                                     acc);
+            }
+
+            // Queries that see no key output zeros
+            for (size_t r = 0; r < rows; ++r)
+            {
+                const float  inv_sum = row_sum[r] > 0.f ? 1.f / row_sum[r] : 0.f;
+                const float *a       = acc + r * value_size;
+                T           *out     = reinterpret_cast<T *>(d_ptr + r * d_strides[1]);
+                size_t       d       = 0;
+                for (; d + 4 <= value_size; d += 4)
+                {
+                    store_f32x4(out + d, vmulq_n_f32(vld1q_f32(a + d), inv_sum));
+                }
+                for (; d < value_size; ++d)
+                {
+                    out[d] = static_cast<T>(a[d] * inv_sum);
+                }
+            }
+        });
+}
+#endif // __aarch64__
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ATTENTION_LIST_H
+#define ACL_SRC_CPU_KERNELS_ATTENTION_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of queries processed together, sharing the loads of the keys and values */
+constexpr size_t attention_query_tile = 4;
+/** Number of keys whose scores are computed and normalized at once */
+constexpr size_t attention_key_tile = 64;
+
+/** Number of F32 values of the workspace of a thread
+ *
+ * The workspace holds the scaled queries of a tile, their scores for a tile of keys, their output accumulators and
+ * their running maximum and sum of the softmax.
+ *
+ * @param[in] head_size  Size of the queries and keys
+ * @param[in] value_size Size of the values
+ *
+ * @return The number of F32 values
+ */
+inline size_t attention_workspace_size(size_t head_size, size_t value_size)
+{
+    return attention_query_tile * (head_size + attention_key_tile + value_size + 2);
+}
+
+#define DECLARE_ATTENTION_KERNEL(func_name)                                                                       \
+    void func_name(const ITensor *query, const ITensor *key, const ITensor *value, const ITensor *mask,          \
+                   ITensor *dst, float scale, bool is_causal, float *workspace, const Window &window)
+
+DECLARE_ATTENTION_KERNEL(neon_fp32_attention);
+DECLARE_ATTENTION_KERNEL(neon_fp16_attention);
+
+#undef DECLARE_ATTENTION_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ATTENTION_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,17 +32,27 @@ namespace arm_compute
 namespace cpu
 {
 
-#define DECLARE_DYNAMIC_GEMM_KERNEL(kernel_name)                                                                \
-    void   kernel_name##_run(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, ITensor *pack_b, \
-                             const Window &window);                                                             \
-    void   kernel_name##_pack_rhs(const ITensor *rhs, const ITensor *bias, ITensor *pack_b);                    \
-    size_t kernel_name##_size_of_packed_rhs(size_t rows, size_t columns);                                       \
+#define DECLARE_DYNAMIC_GEMM_KERNEL(kernel_name)                                                                   \
+    void   kernel_name##_run(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, ITensor *pack_b,    \
+                             const Window &window);                                                                \
+    void   kernel_name##_pack_rhs(const ITensor *lhs, const ITensor *rhs, const ITensor *bias, const ITensor *dst, \
+                                  ITensor *pack_b);                                                                \
+    size_t kernel_name##_size_of_packed_rhs(size_t rows, size_t columns);                                          \
     Window kernel_name##_window(const ITensorInfo *dst)
 
 #if defined(__aarch64__) && defined(ENABLE_FP32_KERNELS)
 DECLARE_DYNAMIC_GEMM_KERNEL(neon_fp32_dynamic_gemm);
+DECLARE_DYNAMIC_GEMM_KERNEL(neon_bf16_dynamic_gemm);
 #endif // __aarch64__ && ENABLE_FP32_KERNELS
 
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+DECLARE_DYNAMIC_GEMM_KERNEL(neon_fp16_dynamic_gemm);
+#endif // __aarch64__ && ENABLE_FP16_KERNELS && __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+#if defined(__aarch64__) && defined(ENABLE_QASYMM8_SIGNED_KERNELS)
+DECLARE_DYNAMIC_GEMM_KERNEL(neon_qs8_dynamic_gemm);
+#endif // __aarch64__ && ENABLE_QASYMM8_SIGNED_KERNELS
+
 #undef DECLARE_DYNAMIC_GEMM_KERNEL
 
 } // namespace cpu
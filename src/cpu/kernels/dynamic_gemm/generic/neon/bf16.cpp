@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Steps.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#if defined(__aarch64__) && defined(ENABLE_FP32_KERNELS)
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstring>
+#endif // __aarch64__ && ENABLE_FP32_KERNELS
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+#if defined(__aarch64__) && defined(ENABLE_FP32_KERNELS)
+namespace
+{
+// BF16 operands are widened to F32 on load, every row of the block is accumulated in two F32 vectors.
+constexpr size_t m_step = 6;
+constexpr size_t n_step = 8;
+
+inline float bf16_to_float(uint16_t value)
+{
+    const uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float          result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/** Size in bytes of a packed RHS block: n_step F32 bias values followed by K rows of n_step BF16 values */
+inline size_t packed_block_size(size_t k)
+{
+    return n_step * sizeof(float) + k * n_step * sizeof(uint16_t);
+}
+
+/** Compute a block of at most m_step rows and n_step columns of the output */
+template <size_t rows>
+void bf16_dynamic_gemm_block(const uint16_t *lhs,
+                             size_t          lhs_stride,
+                             const uint8_t  *rhs_packed,
+                             size_t          k_len,
+                             float          *dst,
+                             size_t          dst_stride,
+                             size_t          n_len)
+{
+    float32x4_t acc[rows][2];
+
+    const float *const bias    = reinterpret_cast<const float *>(rhs_packed);
+    const float32x4_t  bias_lo = vld1q_f32(bias);
+    const float32x4_t  bias_hi = vld1q_f32(bias + 4);
+    for (size_t r = 0; r < rows; ++r)
+    {
+        acc[r][0] = bias_lo;
+        acc[r][1] = bias_hi;
+    }
+
+    const uint16_t *rhs_ptr = reinterpret_cast<const uint16_t *>(rhs_packed + n_step * sizeof(float));
+    for (size_t k = 0; k < k_len; ++k, rhs_ptr += n_step)
+    {
+        const uint16x8_t  b    = vld1q_u16(rhs_ptr);
+        const float32x4_t b_lo = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(b), 16));
+        const float32x4_t b_hi = vreinterpretq_f32_u32(vshll_high_n_u16(b, 16));
+        for (size_t r = 0; r < rows; ++r)
+        {
+            const float a_value = bf16_to_float(lhs[r * lhs_stride + k]);
+            acc[r][0]           = vfmaq_n_f32(acc[r][0], b_lo, a_value);
+            acc[r][1]           = vfmaq_n_f32(acc[r][1], b_hi, a_value);
+        }
+    }
+
+    for (size_t r = 0; r < rows; ++r)
+    {
+        float *dst_row = dst + r * dst_stride;
+        if (n_len == n_step)
+        {
+            vst1q_f32(dst_row, acc[r][0]);
+            vst1q_f32(dst_row + 4, acc[r][1]);
+        }
+        else
+        {
+            float tmp[n_step];
+            vst1q_f32(tmp, acc[r][0]);
+            vst1q_f32(tmp + 4, acc[r][1]);
+            std::memcpy(dst_row, tmp, n_len * sizeof(float));
+        }
+    }
+}
+
+using BlockPtr = void (*)(const uint16_t *, size_t, const uint8_t *, size_t, float *, size_t, size_t);
+
+const BlockPtr block_kernels[m_step] = {
+    &bf16_dynamic_gemm_block<1>, &bf16_dynamic_gemm_block<2>, &bf16_dynamic_gemm_block<3>,
+    &bf16_dynamic_gemm_block<4>, &bf16_dynamic_gemm_block<5>, &bf16_dynamic_gemm_block<6>,
+};
+} // namespace
+
+void neon_bf16_dynamic_gemm_pack_rhs(
+    const ITensor *lhs, const ITensor *rhs, const ITensor *bias, const ITensor *dst, ITensor *pack_b)
+{
+    ARM_COMPUTE_UNUSED(lhs);
+    ARM_COMPUTE_UNUSED(dst);
+
+    const size_t N          = rhs->info()->tensor_shape().x();
+    const size_t K          = rhs->info()->tensor_shape().y();
+    const size_t rhs_stride = rhs->info()->strides_in_bytes().y();
+
+    const uint8_t *const rhs_buf = rhs->buffer() + rhs->info()->offset_first_element_in_bytes();
+    const float *const   bias_ptr =
+        reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    uint8_t *packed = pack_b->buffer();
+
+    for (size_t n_start = 0; n_start < N; n_start += n_step, packed += packed_block_size(K))
+    {
+        const size_t n_len = std::min(n_step, N - n_start);
+
+        float *const packed_bias = reinterpret_cast<float *>(packed);
+        std::fill_n(packed_bias, n_step, 0.f);
+        std::copy_n(bias_ptr + n_start, n_len, packed_bias);
+
+        uint16_t *packed_rhs = reinterpret_cast<uint16_t *>(packed + n_step * sizeof(float));
+        for (size_t k = 0; k < K; ++k, packed_rhs += n_step)
+        {
+            const uint16_t *const rhs_row = reinterpret_cast<const uint16_t *>(rhs_buf + k * rhs_stride) + n_start;
+            std::fill_n(packed_rhs, n_step, static_cast<uint16_t>(0));
+            std::copy_n(rhs_row, n_len, packed_rhs);
+        }
+    }
+}
+
+void neon_bf16_dynamic_gemm_run(
+    const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, ITensor *pack_b, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(b);
+    ARM_COMPUTE_UNUSED(c);
+
+    const size_t M = d->info()->tensor_shape().y();
+    const size_t N = d->info()->tensor_shape().x();
+    const size_t K = a->info()->tensor_shape().x();
+
+    const size_t m_start = window.y().start();
+    const size_t m_end   = std::min<size_t>(window.y().end(), M);
+
+    // As the workload is split in Y dimensions only, each window should start
+    // from the beginning of a row.
+    ARM_COMPUTE_ASSERT(window.x().start() == 0);
+
+    const size_t lhs_stride = a->info()->strides_in_bytes().y() / sizeof(uint16_t);
+    const size_t dst_stride = d->info()->strides_in_bytes().y() / sizeof(float);
+
+    const uint16_t *const lhs_buf =
+        reinterpret_cast<const uint16_t *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    float *const         dst_buf    = reinterpret_cast<float *>(d->buffer() + d->info()->offset_first_element_in_bytes());
+    const uint8_t *const rhs_packed = pack_b->buffer();
+
+    for (size_t m = m_start; m < m_end; m += m_step)
+    {
+        const size_t   m_len = std::min(m_step, m_end - m);
+        const BlockPtr block = block_kernels[m_len - 1];
+
+        for (size_t n = 0; n < N; n += n_step)
+        {
+            block(lhs_buf + m * lhs_stride, lhs_stride, rhs_packed + (n / n_step) * packed_block_size(K), K,
+                  dst_buf + m * dst_stride + n, dst_stride, std::min(n_step, N - n));
+        }
+    }
+}
+
+size_t neon_bf16_dynamic_gemm_size_of_packed_rhs(size_t rows, size_t columns)
+{
+    // In a kxn matrix, k=rows and n=columns.
+    const size_t num_blocks = (columns + n_step - 1) / n_step;
+    return num_blocks * packed_block_size(rows);
+}
+
+Window neon_bf16_dynamic_gemm_window(const ITensorInfo *dst)
+{
+    const Steps steps(n_step, m_step);
+
+    const Window window = calculate_max_window(*dst, steps);
+
+    return window;
+}
+#endif // __aarch64__ && ENABLE_FP32_KERNELS
+
+} // namespace cpu
+} // namespace arm_compute
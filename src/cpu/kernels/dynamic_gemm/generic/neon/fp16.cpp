@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Steps.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#endif // __aarch64__ && ENABLE_FP16_KERNELS && __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+namespace
+{
+// Every row of the micro-kernel block is accumulated in two vectors of 8 half-precision values.
+constexpr size_t m_step = 6;
+constexpr size_t n_step = 16;
+
+/** Compute a block of at most m_step rows and n_step columns of the output
+ *
+ * The packed RHS block holds the bias in its first row, followed by the K rows of the RHS. Both are
+ * zero-padded to n_step columns.
+ */
+template <size_t rows>
+void fp16_dynamic_gemm_block(const float16_t *lhs,
+                             size_t           lhs_stride,
+                             const float16_t *rhs_packed,
+                             size_t           k_len,
+                             float16_t       *dst,
+                             size_t           dst_stride,
+                             size_t           n_len)
+{
+    float16x8_t acc[rows][2];
+
+    const float16x8_t bias_lo = vld1q_f16(rhs_packed);
+    const float16x8_t bias_hi = vld1q_f16(rhs_packed + 8);
+    for (size_t r = 0; r < rows; ++r)
+    {
+        acc[r][0] = bias_lo;
+        acc[r][1] = bias_hi;
+    }
+
+    const float16_t *rhs_ptr = rhs_packed + n_step;
+    for (size_t k = 0; k < k_len; ++k, rhs_ptr += n_step)
+    {
+        const float16x8_t b_lo = vld1q_f16(rhs_ptr);
+        const float16x8_t b_hi = vld1q_f16(rhs_ptr + 8);
+        for (size_t r = 0; r < rows; ++r)
+        {
+            const float16_t a_value = lhs[r * lhs_stride + k];
+            acc[r][0]               = vfmaq_n_f16(acc[r][0], b_lo, a_value);
+            acc[r][1]               = vfmaq_n_f16(acc[r][1], b_hi, a_value);
+        }
+    }
+
+    for (size_t r = 0; r < rows; ++r)
+    {
+        float16_t *dst_row = dst + r * dst_stride;
+        if (n_len == n_step)
+        {
+            vst1q_f16(dst_row, acc[r][0]);
+            vst1q_f16(dst_row + 8, acc[r][1]);
+        }
+        else
+        {
+            float16_t tmp[n_step];
+            vst1q_f16(tmp, acc[r][0]);
+            vst1q_f16(tmp + 8, acc[r][1]);
+            std::memcpy(dst_row, tmp, n_len * sizeof(float16_t));
+        }
+    }
+}
+
+using BlockPtr = void (*)(const float16_t *, size_t, const float16_t *, size_t, float16_t *, size_t, size_t);
+
+const BlockPtr block_kernels[m_step] = {
+    &fp16_dynamic_gemm_block<1>, &fp16_dynamic_gemm_block<2>, &fp16_dynamic_gemm_block<3>,
+    &fp16_dynamic_gemm_block<4>, &fp16_dynamic_gemm_block<5>, &fp16_dynamic_gemm_block<6>,
+};
+} // namespace
+
+void neon_fp16_dynamic_gemm_pack_rhs(
+    const ITensor *lhs, const ITensor *rhs, const ITensor *bias, const ITensor *dst, ITensor *pack_b)
+{
+    ARM_COMPUTE_UNUSED(lhs);
+    ARM_COMPUTE_UNUSED(dst);
+
+    const size_t N          = rhs->info()->tensor_shape().x();
+    const size_t K          = rhs->info()->tensor_shape().y();
+    const size_t rhs_stride = rhs->info()->strides_in_bytes().y();
+
+    const uint8_t *const   rhs_buf  = rhs->buffer() + rhs->info()->offset_first_element_in_bytes();
+    const float16_t *const bias_ptr = reinterpret_cast<const float16_t *>(bias->buffer() +
+                                                                          bias->info()->offset_first_element_in_bytes());
+    float16_t *packed = reinterpret_cast<float16_t *>(pack_b->buffer());
+
+    for (size_t n_start = 0; n_start < N; n_start += n_step)
+    {
+        const size_t n_len = std::min(n_step, N - n_start);
+
+        std::fill_n(packed, n_step, static_cast<float16_t>(0));
+        std::copy_n(bias_ptr + n_start, n_len, packed);
+        packed += n_step;
+
+        for (size_t k = 0; k < K; ++k, packed += n_step)
+        {
+            const float16_t *const rhs_row = reinterpret_cast<const float16_t *>(rhs_buf + k * rhs_stride) + n_start;
+            std::fill_n(packed, n_step, static_cast<float16_t>(0));
+            std::copy_n(rhs_row, n_len, packed);
+        }
+    }
+}
+
+void neon_fp16_dynamic_gemm_run(
+    const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, ITensor *pack_b, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(b);
+    ARM_COMPUTE_UNUSED(c);
+
+    const size_t M = d->info()->tensor_shape().y();
+    const size_t N = d->info()->tensor_shape().x();
+    const size_t K = a->info()->tensor_shape().x();
+
+    const size_t m_start = window.y().start();
+    const size_t m_end   = std::min<size_t>(window.y().end(), M);
+
+    // As the workload is split in Y dimensions only, each window should start
+    // from the beginning of a row.
+    ARM_COMPUTE_ASSERT(window.x().start() == 0);
+
+    const size_t lhs_stride = a->info()->strides_in_bytes().y() / sizeof(float16_t);
+    const size_t dst_stride = d->info()->strides_in_bytes().y() / sizeof(float16_t);
+
+    const float16_t *const lhs_buf =
+        reinterpret_cast<const float16_t *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    float16_t *const dst_buf = reinterpret_cast<float16_t *>(d->buffer() + d->info()->offset_first_element_in_bytes());
+    const float16_t *const rhs_packed = reinterpret_cast<const float16_t *>(pack_b->buffer());
+
+    const size_t packed_block_size = (K + 1) * n_step;
+
+    for (size_t m = m_start; m < m_end; m += m_step)
+    {
+        const size_t   m_len = std::min(m_step, m_end - m);
+        const BlockPtr block = block_kernels[m_len - 1];
+
+        for (size_t n = 0; n < N; n += n_step)
+        {
+            block(lhs_buf + m * lhs_stride, lhs_stride, rhs_packed + (n / n_step) * packed_block_size, K,
+                  dst_buf + m * dst_stride + n, dst_stride, std::min(n_step, N - n));
+        }
+    }
+}
+
+size_t neon_fp16_dynamic_gemm_size_of_packed_rhs(size_t rows, size_t columns)
+{
+    // In a kxn matrix, k=rows and n=columns. One extra row per block holds the bias.
+    const size_t num_blocks = (columns + n_step - 1) / n_step;
+    return num_blocks * (rows + 1) * n_step * sizeof(float16_t);
+}
+
+Window neon_fp16_dynamic_gemm_window(const ITensorInfo *dst)
+{
+    const Steps steps(n_step, m_step);
+
+    const Window window = calculate_max_window(*dst, steps);
+
+    return window;
+}
+#endif // __aarch64__ && ENABLE_FP16_KERNELS && __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+} // namespace cpu
+} // namespace arm_compute
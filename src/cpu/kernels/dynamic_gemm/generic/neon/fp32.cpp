@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,8 +39,12 @@ namespace cpu
 {
 
 #if defined(__aarch64__) && defined(ENABLE_FP32_KERNELS)
-void neon_fp32_dynamic_gemm_pack_rhs(const ITensor *rhs, const ITensor *bias, ITensor *pack_b)
+void neon_fp32_dynamic_gemm_pack_rhs(
+    const ITensor *lhs, const ITensor *rhs, const ITensor *bias, const ITensor *dst, ITensor *pack_b)
 {
+    ARM_COMPUTE_UNUSED(lhs);
+    ARM_COMPUTE_UNUSED(dst);
+
     const size_t      num_groups  = 1;
     const size_t      n           = rhs->info()->tensor_shape().x();
     const size_t      k           = rhs->info()->tensor_shape().y();
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Steps.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#if defined(__aarch64__) && defined(ENABLE_QASYMM8_SIGNED_KERNELS)
+#include "src/core/NEON/NEAsymm.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#endif // __aarch64__ && ENABLE_QASYMM8_SIGNED_KERNELS
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+#if defined(__aarch64__) && defined(ENABLE_QASYMM8_SIGNED_KERNELS)
+namespace
+{
+// Every row of the block is accumulated in four vectors of 4 S32 values.
+constexpr size_t m_step = 6;
+constexpr size_t n_step = 16;
+
+/** Size in bytes of the requantization parameters of a packed RHS block
+ *
+ * They are n_step S32 bias values with the LHS zero point folded in, then the n_step fixed-point multipliers and the
+ * n_step shifts of the gemmlowp output stage.
+ */
+constexpr size_t packed_params_size = 3 * n_step * sizeof(int32_t);
+
+/** Size in bytes of a packed RHS block, the requantization parameters followed by K rows of n_step S8 values */
+inline size_t packed_block_size(size_t k)
+{
+    return packed_params_size + k * n_step * sizeof(int8_t);
+}
+
+/** Load the n_step S32 values of a packed RHS block starting at @p ptr */
+inline int32x4x4_t load_s32x16(const int32_t *ptr)
+{
+    return {{vld1q_s32(ptr), vld1q_s32(ptr + 4), vld1q_s32(ptr + 8), vld1q_s32(ptr + 12)}};
+}
+
+/** Compute a block of at most m_step rows and n_step columns of the output */
+template <size_t rows>
+void qs8_dynamic_gemm_block(const int8_t  *lhs,
+                            size_t         lhs_stride,
+                            const uint8_t *rhs_packed,
+                            size_t         k_len,
+                            int8_t        *dst,
+                            size_t         dst_stride,
+                            size_t         n_len,
+                            int32_t        dst_offset)
+{
+    const int32_t *const params = reinterpret_cast<const int32_t *>(rhs_packed);
+
+    int32x4x4_t acc[rows];
+    for (size_t r = 0; r < rows; ++r)
+    {
+        acc[r] = load_s32x16(params);
+    }
+
+    const int8_t *rhs_ptr = reinterpret_cast<const int8_t *>(rhs_packed + packed_params_size);
+    for (size_t k = 0; k < k_len; ++k, rhs_ptr += n_step)
+    {
+        const int8x16_t b    = vld1q_s8(rhs_ptr);
+        const int16x8_t b_lo = vmovl_s8(vget_low_s8(b));
+        const int16x8_t b_hi = vmovl_high_s8(b);
+        for (size_t r = 0; r < rows; ++r)
+        {
+            const int16_t a_value = lhs[r * lhs_stride + k];
+            acc[r].val[0]         = vmlal_n_s16(acc[r].val[0], vget_low_s16(b_lo), a_value);
+            acc[r].val[1]         = vmlal_high_n_s16(acc[r].val[1], b_lo, a_value);
+            acc[r].val[2]         = vmlal_n_s16(acc[r].val[2], vget_low_s16(b_hi), a_value);
+            acc[r].val[3]         = vmlal_high_n_s16(acc[r].val[3], b_hi, a_value);
+        }
+    }
+
+    // Requantize with the fixed-point output stage of gemmlowp
+    const int32x4x4_t multiplier = load_s32x16(params + n_step);
+    const int32x4x4_t shift      = load_s32x16(params + 2 * n_step);
+    const int32x4_t   offset     = vdupq_n_s32(dst_offset);
+    const int8x16_t   min        = vdupq_n_s8(std::numeric_limits<int8_t>::lowest());
+    const int8x16_t   max        = vdupq_n_s8(std::numeric_limits<int8_t>::max());
+
+    for (size_t r = 0; r < rows; ++r)
+    {
+        const int8x16_t out     = finalize_quantization_symm(acc[r], multiplier, shift, offset, min, max, false);
+        int8_t         *dst_row = dst + r * dst_stride;
+        if (n_len == n_step)
+        {
+            vst1q_s8(dst_row, out);
+        }
+        else
+        {
+            int8_t tmp[n_step];
+            vst1q_s8(tmp, out);
+            std::memcpy(dst_row, tmp, n_len);
+        }
+    }
+}
+
+using BlockPtr = void (*)(const int8_t *, size_t, const uint8_t *, size_t, int8_t *, size_t, size_t, int32_t);
+
+const BlockPtr block_kernels[m_step] = {
+    &qs8_dynamic_gemm_block<1>, &qs8_dynamic_gemm_block<2>, &qs8_dynamic_gemm_block<3>,
+    &qs8_dynamic_gemm_block<4>, &qs8_dynamic_gemm_block<5>, &qs8_dynamic_gemm_block<6>,
+};
+} // namespace
+
+void neon_qs8_dynamic_gemm_pack_rhs(
+    const ITensor *lhs, const ITensor *rhs, const ITensor *bias, const ITensor *dst, ITensor *pack_b)
+{
+    const size_t N          = rhs->info()->tensor_shape().x();
+    const size_t K          = rhs->info()->tensor_shape().y();
+    const size_t rhs_stride = rhs->info()->strides_in_bytes().y();
+
+    const int32_t lhs_offset = lhs->info()->quantization_info().uniform().offset;
+
+    // Same multipliers and shifts as the output stage of the gemmlowp functions
+    GEMMLowpOutputStageInfo output_stage{};
+    quantization::calculate_quantized_multipliers(lhs->info()->quantization_info(), rhs->info()->quantization_info(),
+                                                  dst->info()->quantization_info(), output_stage);
+    const bool per_channel = rhs->info()->quantization_info().scale().size() > 1;
+
+    const uint8_t *const rhs_buf = rhs->buffer() + rhs->info()->offset_first_element_in_bytes();
+    const int32_t *const bias_ptr =
+        reinterpret_cast<const int32_t *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    uint8_t *packed = pack_b->buffer();
+
+    for (size_t n_start = 0; n_start < N; n_start += n_step, packed += packed_block_size(K))
+    {
+        const size_t n_len = std::min(n_step, N - n_start);
+
+        int32_t *const packed_bias       = reinterpret_cast<int32_t *>(packed);
+        int32_t *const packed_multiplier = packed_bias + n_step;
+        int32_t *const packed_shift      = packed_multiplier + n_step;
+        int8_t        *packed_rhs        = reinterpret_cast<int8_t *>(packed + packed_params_size);
+
+        std::fill_n(packed_bias, 3 * n_step, 0);
+        for (size_t n = 0; n < n_len; ++n)
+        {
+            const size_t channel = per_channel ? n_start + n : 0;
+            packed_bias[n]       = bias_ptr[n_start + n];
+            packed_multiplier[n] = output_stage.gemmlowp_multipliers[channel];
+            packed_shift[n]      = output_stage.gemmlowp_shifts[channel];
+        }
+
+        for (size_t k = 0; k < K; ++k, packed_rhs += n_step)
+        {
+            const int8_t *const rhs_row = reinterpret_cast<const int8_t *>(rhs_buf + k * rhs_stride) + n_start;
+            std::fill_n(packed_rhs, n_step, static_cast<int8_t>(0));
+            std::copy_n(rhs_row, n_len, packed_rhs);
+
+            // The RHS is symmetric, so the LHS zero point only contributes -lhs_offset * sum_k(rhs).
+            for (size_t n = 0; n < n_len; ++n)
+            {
+                packed_bias[n] -= lhs_offset * static_cast<int32_t>(rhs_row[n]);
+            }
+        }
+    }
+}
+
+void neon_qs8_dynamic_gemm_run(
+    const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, ITensor *pack_b, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(b);
+    ARM_COMPUTE_UNUSED(c);
+
+    const size_t M = d->info()->tensor_shape().y();
+    const size_t N = d->info()->tensor_shape().x();
+    const size_t K = a->info()->tensor_shape().x();
+
+    const size_t m_start = window.y().start();
+    const size_t m_end   = std::min<size_t>(window.y().end(), M);
+
+    // As the workload is split in Y dimensions only, each window should start
+    // from the beginning of a row.
+    ARM_COMPUTE_ASSERT(window.x().start() == 0);
+
+    const size_t  lhs_stride = a->info()->strides_in_bytes().y();
+    const size_t  dst_stride = d->info()->strides_in_bytes().y();
+    const int32_t dst_offset = d->info()->quantization_info().uniform().offset;
+
+    const int8_t *const lhs_buf =
+        reinterpret_cast<const int8_t *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    int8_t *const        dst_buf    = reinterpret_cast<int8_t *>(d->buffer() + d->info()->offset_first_element_in_bytes());
+    const uint8_t *const rhs_packed = pack_b->buffer();
+
+    for (size_t m = m_start; m < m_end; m += m_step)
+    {
+        const size_t   m_len = std::min(m_step, m_end - m);
+        const BlockPtr block = block_kernels[m_len - 1];
+
+        for (size_t n = 0; n < N; n += n_step)
+        {
+            block(lhs_buf + m * lhs_stride, lhs_stride, rhs_packed + (n / n_step) * packed_block_size(K), K,
+                  dst_buf + m * dst_stride + n, dst_stride, std::min(n_step, N - n), dst_offset);
+        }
+    }
+}
+
+size_t neon_qs8_dynamic_gemm_size_of_packed_rhs(size_t rows, size_t columns)
+{
+    // In a kxn matrix, k=rows and n=columns.
+    const size_t num_blocks = (columns + n_step - 1) / n_step;
+    return num_blocks * packed_block_size(rows);
+}
+
+Window neon_qs8_dynamic_gemm_window(const ITensorInfo *dst)
+{
+    const Steps steps(n_step, m_step);
+
+    const Window window = calculate_max_window(*dst, steps);
+
+    return window;
+}
+#endif // __aarch64__ && ENABLE_QASYMM8_SIGNED_KERNELS
+
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,18 +56,69 @@ const CpuDynamicGemmKernelHeuristics::KernelList CpuDynamicGemmKernelHeuristics:
 #endif /* __aarch64__ */
 };
 
+const CpuDynamicGemmKernelHeuristics::KernelList CpuDynamicGemmKernelHeuristics::fp16_kernels
+{
+#if defined(__aarch64__)
+    {"neon_fp16_dynamic_gemm",
+     [](const DataTypeISASelectorData &data) { return data.isa.fp16; },
+     REGISTER_FP16_NEON(neon_fp16_dynamic_gemm_run),
+     REGISTER_FP16_NEON(neon_fp16_dynamic_gemm_pack_rhs),
+     REGISTER_FP16_NEON(neon_fp16_dynamic_gemm_size_of_packed_rhs),
+     REGISTER_FP16_NEON(neon_fp16_dynamic_gemm_window)},
+#endif /* __aarch64__ */
+};
+
+const CpuDynamicGemmKernelHeuristics::KernelList CpuDynamicGemmKernelHeuristics::bf16_kernels
+{
+#if defined(__aarch64__)
+    {"neon_bf16_dynamic_gemm",
+     [](const DataTypeISASelectorData &data)
+     {
+         ARM_COMPUTE_UNUSED(data);
+         return true;
+     },
+     REGISTER_FP32_NEON(neon_bf16_dynamic_gemm_run),
+     REGISTER_FP32_NEON(neon_bf16_dynamic_gemm_pack_rhs),
+     REGISTER_FP32_NEON(neon_bf16_dynamic_gemm_size_of_packed_rhs),
+     REGISTER_FP32_NEON(neon_bf16_dynamic_gemm_window)},
+#endif /* __aarch64__ */
+};
+
+const CpuDynamicGemmKernelHeuristics::KernelList CpuDynamicGemmKernelHeuristics::qasymm8_signed_kernels
+{
+#if defined(__aarch64__)
+    {"neon_qs8_dynamic_gemm",
+     [](const DataTypeISASelectorData &data)
+     {
+         ARM_COMPUTE_UNUSED(data);
+         return true;
+     },
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_dynamic_gemm_run),
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_dynamic_gemm_pack_rhs),
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_dynamic_gemm_size_of_packed_rhs),
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_dynamic_gemm_window)},
+#endif /* __aarch64__ */
+};
+
 const CpuDynamicGemmKernelHeuristics::KernelMap CpuDynamicGemmKernelHeuristics::kernels{
     {DataType::F32, fp32_kernels},
+    {DataType::F16, fp16_kernels},
+    {DataType::BFLOAT16, bf16_kernels},
+    {DataType::QASYMM8_SIGNED, qasymm8_signed_kernels},
 };
 
 void CpuDynamicGemmKernelHeuristics::choose_kernel(const DataTypeISASelectorData &selector)
 {
     const auto &klist = kernels.find(selector.dt);
-    ARM_COMPUTE_ERROR_ON(klist == kernels.end());
+    if (klist == kernels.end())
+    {
+        return;
+    }
 
     for (const auto &uk : klist->second)
     {
-        if (uk.is_selected(selector))
+        // Micro-kernels not built for this configuration are registered as nullptr.
+        if (uk.ukernel != nullptr && uk.is_selected(selector))
         {
             _kernel = &uk;
             return;
@@ -78,7 +129,7 @@ void CpuDynamicGemmKernelHeuristics::choose_kernel(const DataTypeISASelectorData
 CpuDynamicGemmKernelHeuristics::CpuDynamicGemmKernelHeuristics(const ITensorInfo *a,
                                                                const ITensorInfo *b,
                                                                const ITensorInfo *c,
-                                                               ITensorInfo       *d,
+                                                               const ITensorInfo *d,
                                                                float              alpha,
                                                                float              beta,
                                                                const GEMMInfo    &gemm_info)
@@ -99,6 +150,11 @@ size_t CpuDynamicGemmKernelHeuristics::mws() const
     return _mws;
 }
 
+bool CpuDynamicGemmKernelHeuristics::is_kernel_selected() const
+{
+    return _kernel != nullptr;
+}
+
 CpuDynamicGemmKernelHeuristics::KernelPtr CpuDynamicGemmKernelHeuristics::kernel() const
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(_kernel);
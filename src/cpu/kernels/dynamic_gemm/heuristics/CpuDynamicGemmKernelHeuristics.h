@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,11 +63,14 @@ public:
 
     /** Pack RHS tensor
      *
+     * @param[in]  lhs        Tensor a. Only its quantization information is used for quantized kernels
      * @param[in]  rhs        Tensor b
      * @param[in]  bias       Bias data
+     * @param[in]  dst        Tensor d. Only its quantization information is used for quantized kernels
      * @param[out] packed_rhs Destination buffer for packed RHS data
      */
-    using PackRhsPtr = std::add_pointer<void(const ITensor *, const ITensor *, ITensor *)>::type;
+    using PackRhsPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, const ITensor *, ITensor *)>::type;
 
     /** Size of packed RHS for data of given size
      *
@@ -96,7 +99,7 @@ public:
     CpuDynamicGemmKernelHeuristics(const ITensorInfo *a,
                                    const ITensorInfo *b,
                                    const ITensorInfo *c,
-                                   ITensorInfo       *d,
+                                   const ITensorInfo *d,
                                    float              alpha,
                                    float              beta,
                                    const GEMMInfo    &gemm_info = GEMMInfo());
@@ -117,6 +120,12 @@ public:
      */
     void prepare(ITensorPack &tensors, bool run_packing, const int pack_b_tensor_offset);
 
+    /** Return whether a micro-kernel is available for the requested configuration
+     *
+     * @return True if a micro-kernel has been selected
+     */
+    bool is_kernel_selected() const;
+
     /** Return the kernel to run
      *
      * @return The function pointer to the chosen kernel
@@ -177,6 +186,9 @@ private:
 
 private:
     const static KernelList fp32_kernels;
+    const static KernelList fp16_kernels;
+    const static KernelList bf16_kernels;
+    const static KernelList qasymm8_signed_kernels;
     const static KernelMap  kernels;
 
     size_t                   _mws{ICPPKernel::default_mws};
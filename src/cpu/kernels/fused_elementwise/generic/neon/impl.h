@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace fused_elementwise
+{
+/** Number of elements of a row carried through the whole chain at once */
+constexpr int tile_size = 64;
+/** Number of F32 lanes of a NEON register */
+constexpr int vector_size = 4;
+
+/** Offset of the row of @p info read for the output coordinates @p id, with broadcast dimensions pinned to zero */
+inline size_t broadcast_row_offset(const ITensorInfo &info, const Coordinates &id)
+{
+    size_t offset = info.offset_first_element_in_bytes();
+    for (size_t d = 1; d < info.num_dimensions(); ++d)
+    {
+        if (info.dimension(d) != 1)
+        {
+            offset += id[d] * info.strides_in_bytes()[d];
+        }
+    }
+    return offset;
+}
+
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+/** Widen @p len elements of a row to F32, padding the tile up to a whole number of vectors */
+template <typename T>
+inline void load_tile(float *tile, const T *row, int x, int len, bool broadcast_x)
+{
+    const int padded_len = ceil_to_multiple(len, vector_size);
+    if (broadcast_x)
+    {
+        const float32x4_t value = vdupq_n_f32(static_cast<float>(row[0]));
+        for (int i = 0; i < padded_len; i += vector_size)
+        {
+            vst1q_f32(tile + i, value);
+        }
+        return;
+    }
+    int i = 0;
+    for (; i <= len - vector_size; i += vector_size)
+    {
+        vst1q_f32(tile + i, load_f32x4(row + x + i));
+    }
+    for (; i < len; ++i)
+    {
+        tile[i] = static_cast<float>(row[x + i]);
+    }
+    std::fill(tile + len, tile + padded_len, 0.f);
+}
+
+/** Narrow @p len elements of a tile to the type of the row */
+template <typename T>
+inline void store_tile(T *row, const float *tile, int x, int len)
+{
+    int i = 0;
+    for (; i <= len - vector_size; i += vector_size)
+    {
+        store_f32x4(row + x + i, vld1q_f32(tile + i));
+    }
+    for (; i < len; ++i)
+    {
+        row[x + i] = static_cast<T>(tile[i]);
+    }
+}
+
+template <typename F>
+inline void map_tile(float *tile, int len, F &&f)
+{
+    for (int i = 0; i < len; i += vector_size)
+    {
+        vst1q_f32(tile + i, f(vld1q_f32(tile + i)));
+    }
+}
+
+template <typename F>
+inline void zip_tile(float *dst, const float *lhs, const float *rhs, int len, F &&f)
+{
+    for (int i = 0; i < len; i += vector_size)
+    {
+        vst1q_f32(dst + i, f(vld1q_f32(lhs + i), vld1q_f32(rhs + i)));
+    }
+}
+
+inline void binary_tile(ElementwiseChainOperation op, float *dst, const float *lhs, const float *rhs, int len)
+{
+    switch (op)
+    {
+        case ElementwiseChainOperation::ADD:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); });
+            break;
+        case ElementwiseChainOperation::SUB:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vsubq_f32(a, b); });
+            break;
+        case ElementwiseChainOperation::MUL:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); });
+            break;
+        case ElementwiseChainOperation::DIV:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vdivq_f32(a, b); });
+            break;
+        case ElementwiseChainOperation::MAX:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vmaxq_f32(a, b); });
+            break;
+        case ElementwiseChainOperation::MIN:
+            zip_tile(dst, lhs, rhs, len, [](float32x4_t a, float32x4_t b) { return vminq_f32(a, b); });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not a binary operation");
+    }
+}
+
+inline void activation_tile(float *tile, int len, const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+
+    const float32x4_t a    = vdupq_n_f32(act_info.a());
+    const float32x4_t b    = vdupq_n_f32(act_info.b());
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one  = vdupq_n_f32(1.f);
+
+    switch (act_info.activation())
+    {
+        case ActFunction::IDENTITY:
+            break;
+        case ActFunction::RELU:
+            map_tile(tile, len, [&](float32x4_t v) { return vmaxq_f32(zero, v); });
+            break;
+        case ActFunction::BOUNDED_RELU:
+            map_tile(tile, len, [&](float32x4_t v) { return vminq_f32(a, vmaxq_f32(zero, v)); });
+            break;
+        case ActFunction::LU_BOUNDED_RELU:
+            map_tile(tile, len, [&](float32x4_t v) { return vminq_f32(a, vmaxq_f32(b, v)); });
+            break;
+        case ActFunction::LEAKY_RELU:
+            map_tile(tile, len, [&](float32x4_t v) { return vbslq_f32(vcgtq_f32(v, zero), v, vmulq_f32(a, v)); });
+            break;
+        case ActFunction::LINEAR:
+            map_tile(tile, len, [&](float32x4_t v) { return vmlaq_f32(b, a, v); });
+            break;
+        case ActFunction::ABS:
+            map_tile(tile, len, [](float32x4_t v) { return vabsq_f32(v); });
+            break;
+        case ActFunction::SQUARE:
+            map_tile(tile, len, [](float32x4_t v) { return vmulq_f32(v, v); });
+            break;
+        case ActFunction::LOGISTIC:
+            map_tile(tile, len, [&](float32x4_t v) { return vinvq_f32(vaddq_f32(one, vexpq_f32(vnegq_f32(v)))); });
+            break;
+        case ActFunction::TANH:
+            map_tile(tile, len, [&](float32x4_t v) { return vmulq_f32(a, vtanhq_f32(vmulq_f32(b, v))); });
+            break;
+        case ActFunction::SWISH:
+            map_tile(tile, len,
+                     [&](float32x4_t v)
+                     { return vmulq_f32(v, vinvq_f32(vaddq_f32(one, vexpq_f32(vnegq_f32(vmulq_f32(a, v)))))); });
+            break;
+        case ActFunction::HARD_SWISH:
+        {
+            const float32x4_t three     = vdupq_n_f32(3.f);
+            const float32x4_t six       = vdupq_n_f32(6.f);
+            const float32x4_t one_sixth = vdupq_n_f32(1.f / 6.f);
+            map_tile(tile, len,
+                     [&](float32x4_t v)
+                     {
+                         const float32x4_t gate = vminq_f32(six, vmaxq_f32(zero, vaddq_f32(v, three)));
+                         return vmulq_f32(v, vmulq_f32(gate, one_sixth));
+                     });
+            break;
+        }
+        case ActFunction::ELU:
+            map_tile(tile, len,
+                     [&](float32x4_t v)
+                     { return vbslq_f32(vcgeq_f32(v, zero), v, vmulq_f32(a, vsubq_f32(vexpq_f32(v), one))); });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Evaluate an element-wise chain tile by tile, so that intermediate results never leave the registers and stack
+ *
+ * @param[in]  srcs     Chain inputs, broadcast against the destination shape.
+ * @param[in]  num_srcs Number of chain inputs, at most @ref max_elementwise_chain_inputs.
+ * @param[out] dst      Destination tensor.
+ * @param[in]  chain    Steps to apply to the first input.
+ * @param[in]  window   Region on which to execute the kernel.
+ */
+template <typename T>
+void fused_elementwise(const ITensor *const       *srcs,
+                       size_t                      num_srcs,
+                       ITensor                    *dst,
+                       const ElementwiseChainInfo &chain,
+                       const Window               &window)
+{
+    ARM_COMPUTE_ERROR_ON(num_srcs > max_elementwise_chain_inputs);
+
+    const int window_start_x = static_cast<int>(window.x().start());
+    const int window_end_x   = static_cast<int>(window.x().end());
+
+    std::array<bool, max_elementwise_chain_inputs> broadcast_x{};
+    for (size_t i = 0; i < num_srcs; ++i)
+    {
+        broadcast_x[i] = srcs[i]->info()->dimension(0) == 1;
+    }
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator dst_it(dst, win);
+
+    std::array<const T *, max_elementwise_chain_inputs> src_rows{};
+    alignas(16) float                                   result[tile_size];
+    alignas(16) float                                   operand[tile_size];
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            for (size_t i = 0; i < num_srcs; ++i)
+            {
+                src_rows[i] =
+                    reinterpret_cast<const T *>(srcs[i]->buffer() + broadcast_row_offset(*srcs[i]->info(), id));
+            }
+            const auto dst_row = reinterpret_cast<T *>(dst_it.ptr());
+
+            for (int x = window_start_x; x < window_end_x; x += tile_size)
+            {
+                const int len        = std::min(tile_size, window_end_x - x);
+                const int padded_len = ceil_to_multiple(len, vector_size);
+
+                load_tile(result, src_rows[0], x, len, broadcast_x[0]);
+                for (const auto &step : chain)
+                {
+                    if (is_binary_chain_step(step))
+                    {
+                        load_tile(operand, src_rows[step.operand], x, len, broadcast_x[step.operand]);
+                        if (step.reverse)
+                        {
+                            binary_tile(step.op, result, operand, result, padded_len);
+                        }
+                        else
+                        {
+                            binary_tile(step.op, result, result, operand, padded_len);
+                        }
+                    }
+                    else if (step.op == ElementwiseChainOperation::EXP)
+                    {
+                        map_tile(result, padded_len, [](float32x4_t v) { return vexpq_f32(v); });
+                    }
+                    else
+                    {
+                        activation_tile(result, padded_len, step.act_info);
+                    }
+                }
+                store_tile(dst_row, result, x, len);
+            }
+        },
+        dst_it);
+}
+} // namespace fused_elementwise
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_LIST_H
+#define ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_FUSED_ELEMENTWISE_KERNEL(func_name)                                                              \
+    void func_name(const ITensor *const *srcs, size_t num_srcs, ITensor *dst, const ElementwiseChainInfo &chain, \
+                   const Window &window)
+
+DECLARE_FUSED_ELEMENTWISE_KERNEL(fused_elementwise_fp32_neon);
+DECLARE_FUSED_ELEMENTWISE_KERNEL(fused_elementwise_fp16_neon);
+
+#undef DECLARE_FUSED_ELEMENTWISE_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_LIST_H
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+#ifdef __aarch64__
+namespace
+{
+// The statistics and the normalization are computed in F32 whatever the data type of the tensors
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+inline float32x4_t load_f32x4(const bfloat16 *ptr)
+{
+    // A BF16 value holds the upper half of the bits of the F32 value
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void store_f32x4(bfloat16 *ptr, float32x4_t v)
+{
+    // Round to nearest with ties to even, as the conversion of bfloat16
+    const uint32x4_t bits    = vreinterpretq_u32_f32(v);
+    const uint32x4_t lsb     = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    const uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+    vst1_u16(reinterpret_cast<uint16_t *>(ptr), vshrn_n_u32(rounded, 16));
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+/** Load 4 values of a row, adding the residual when there is one */
+template <typename T>
+inline float32x4_t load_input(const T *src, const T *residual, size_t x)
+{
+    const float32x4_t v = load_f32x4(src + x);
+    return residual != nullptr ? vaddq_f32(v, load_f32x4(residual + x)) : v;
+}
+
+template <typename T>
+inline float load_input_scalar(const T *src, const T *residual, size_t x)
+{
+    const float v = static_cast<float>(src[x]);
+    return residual != nullptr ? v + static_cast<float>(residual[x]) : v;
+}
+} // namespace
+
+/** Normalize each row of @p src, after adding @p residual to it, and scale and shift the result
+ *
+ * A row is read twice: once to compute its statistics and once to normalize it, while it is still in the cache.
+ * When @p add_output is given, the first pass writes the sum of the input and the residual to it and the second pass
+ * reads it back, so @p add_output can alias @p residual to update a residual stream in place.
+ */
+template <typename T>
+void neon_layer_normalization(const ITensor                *src,
+                              const ITensor                *residual,
+                              const ITensor                *gamma,
+                              const ITensor                *beta,
+                              ITensor                      *add_output,
+                              ITensor                      *dst,
+                              const LayerNormalizationInfo &info,
+                              const Window                 &window)
+{
+    const size_t num_elems = src->info()->dimension(0);
+    const bool   is_rms    = info.type == LayerNormalizationType::RMSNorm;
+
+    const T *gamma_ptr = gamma == nullptr ? nullptr : reinterpret_cast<const T *>(gamma->ptr_to_element(Coordinates()));
+    const T *beta_ptr  = beta == nullptr ? nullptr : reinterpret_cast<const T *>(beta->ptr_to_element(Coordinates()));
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const T *in  = reinterpret_cast<const T *>(src->ptr_to_element(id));
+            const T *res = residual == nullptr ? nullptr : reinterpret_cast<const T *>(residual->ptr_to_element(id));
+            T       *sum_out = add_output == nullptr ? nullptr : reinterpret_cast<T *>(add_output->ptr_to_element(id));
+            T       *out     = reinterpret_cast<T *>(dst->ptr_to_element(id));
+
+            // The layer norm statistics are accumulated relative to the first value of the row, which keeps the
+            // variance accurate when the mean is large compared to the deviation
+            const float       shift  = is_rms ? 0.f : load_input_scalar(in, res, 0);
+            const float32x4_t vshift = vdupq_n_f32(shift);
+
+            float32x4_t sum0    = vdupq_n_f32(0.f);
+            float32x4_t sum1    = vdupq_n_f32(0.f);
+            float32x4_t sum_sq0 = vdupq_n_f32(0.f);
+            float32x4_t sum_sq1 = vdupq_n_f32(0.f);
+
+            size_t x = 0;
+            for (; x + 8 <= num_elems; x += 8)
+            {
+                float32x4_t v0 = load_input(in, res, x);
+                float32x4_t v1 = load_input(in, res, x + 4);
+                if (sum_out != nullptr)
+                {
+                    // The statistics are those of the values read back by the second pass
+                    store_f32x4(sum_out + x, v0);
+                    store_f32x4(sum_out + x + 4, v1);
+                    v0 = load_f32x4(sum_out + x);
+                    v1 = load_f32x4(sum_out + x + 4);
+                }
+                const float32x4_t d0 = vsubq_f32(v0, vshift);
+                const float32x4_t d1 = vsubq_f32(v1, vshift);
+                sum0                 = vaddq_f32(sum0, d0);
+                sum1                 = vaddq_f32(sum1, d1);
+                sum_sq0              = vfmaq_f32(sum_sq0, d0, d0);
+                sum_sq1              = vfmaq_f32(sum_sq1, d1, d1);
+            }
+
+            float sum    = vaddvq_f32(vaddq_f32(sum0, sum1));
+            float sum_sq = vaddvq_f32(vaddq_f32(sum_sq0, sum_sq1));
+            for (; x < num_elems; ++x)
+            {
+                float v = load_input_scalar(in, res, x);
+                if (sum_out != nullptr)
+                {
+                    sum_out[x] = static_cast<T>(v);
+                    v          = static_cast<float>(sum_out[x]);
+                }
+                const float d = v - shift;
+                sum += d;
+                sum_sq += d * d;
+            }
+
+            const float mean_shifted = sum / num_elems;
+            const float mean         = is_rms ? 0.f : shift + mean_shifted;
+            const float variance =
+                is_rms ? sum_sq / num_elems : std::max(sum_sq / num_elems - mean_shifted * mean_shifted, 0.f);
+            const float inv_stddev = 1.f / std::sqrt(variance + info.epsilon);
+
+            const T          *norm_in  = sum_out != nullptr ? sum_out : in;
+            const T          *norm_res = sum_out != nullptr ? nullptr : res;
+            const float32x4_t vmean    = vdupq_n_f32(mean);
+            const float32x4_t vinv     = vdupq_n_f32(inv_stddev);
+
+            for (x = 0; x + 4 <= num_elems; x += 4)
+            {
+                float32x4_t v = vmulq_f32(vsubq_f32(load_input(norm_in, norm_res, x), vmean), vinv);
+                if (gamma_ptr != nullptr)
+                {
+                    v = vmulq_f32(v, load_f32x4(gamma_ptr + x));
+                }
+                if (beta_ptr != nullptr)
+                {
+                    v = vaddq_f32(v, load_f32x4(beta_ptr + x));
+                }
+                store_f32x4(out + x, v);
+            }
+            for (; x < num_elems; ++x)
+            {
+                float v = (load_input_scalar(norm_in, norm_res, x) - mean) * inv_stddev;
+                if (gamma_ptr != nullptr)
+                {
+                    v *= static_cast<float>(gamma_ptr[x]);
+                }
+                if (beta_ptr != nullptr)
+                {
+                    v += static_cast<float>(beta_ptr[x]);
+                }
+                out[x] = static_cast<T>(v);
+            }
+        });
+}
+#endif // __aarch64__
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/matmul_qsi4/list.h"
+
+#ifdef __aarch64__
+#include "src/cpu/kernels/matmul_qsi8/generic/neon/impl.h"
+#include "support/Bfloat16.h"
+
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4c32p/kai_matmul_clamp_f32_qai8dxp1x8_qsi4c32p4x8_1x4x32_neon_dotprod.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4c32p/kai_matmul_clamp_f32_qai8dxp4x8_qsi4c32p4x8_16x4x32_neon_i8mm.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4c32p/kai_matmul_clamp_f32_qai8dxp_qsi4c32p_interface.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4cxp/kai_matmul_clamp_f32_qai8dxp1x8_qsi4cxp4x8_1x4x32_neon_dotprod.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4cxp/kai_matmul_clamp_f32_qai8dxp4x8_qsi4cxp4x8_8x4x32_neon_i8mm.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi4cxp/kai_matmul_clamp_f32_qai8dxp_qsi4cxp_interface.h"
+#include "kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi4c32p_qsu4c32s1s0.h"
+#include "kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi4cxp_qs4cxs1s0.h"
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Quantize a row of K values to S8 with a symmetric scale
+ *
+ * @param[in]  src Row to quantize
+ * @param[in]  k   Number of values of the row
+ * @param[out] dst Quantized row, whose values after @p k are left untouched
+ *
+ * @return The scale of the quantized row
+ */
+float quantize_row(const float *src, size_t k, int8_t *dst)
+{
+    float32x4_t vmax = vdupq_n_f32(0.f);
+    size_t      i    = 0;
+    for (; i + 4 <= k; i += 4)
+    {
+        vmax = vmaxq_f32(vmax, vabsq_f32(vld1q_f32(src + i)));
+    }
+    float amax = vmaxvq_f32(vmax);
+    for (; i < k; ++i)
+    {
+        amax = std::max(amax, std::fabs(src[i]));
+    }
+
+    const float scale     = amax / 127.f;
+    const float inv_scale = amax > 0.f ? 127.f / amax : 0.f;
+
+    i = 0;
+    for (; i + 8 <= k; i += 8)
+    {
+        const int32x4_t lo = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i), inv_scale));
+        const int32x4_t hi = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i + 4), inv_scale));
+        vst1_s8(dst + i, vqmovn_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+    }
+    for (; i < k; ++i)
+    {
+        dst[i] = static_cast<int8_t>(std::lround(src[i] * inv_scale));
+    }
+    return scale;
+}
+
+/** Dot product of a chunk of quantized LHS values with a packed chunk of 4-bit weights */
+inline int32x4_t dot_chunk(int32x4_t acc, const int8_t *lhs, const int8_t *rhs)
+{
+    const int8x16_t w     = vld1q_s8(rhs);
+    const int8x16_t w_lo  = vshrq_n_s8(vshlq_n_s8(w, 4), 4);
+    const int8x16_t w_hi  = vshrq_n_s8(w, 4);
+    const int8x16_t lhs_0 = vld1q_s8(lhs);
+    const int8x16_t lhs_1 = vld1q_s8(lhs + qsi4_chunk_size / 2);
+#ifdef __ARM_FEATURE_DOTPROD
+    acc = vdotq_s32(acc, w_lo, lhs_0);
+    acc = vdotq_s32(acc, w_hi, lhs_1);
+#else  // __ARM_FEATURE_DOTPROD
+    // The products are at most 1024 in magnitude, so a pair of them fits in S16
+    acc = vpadalq_s16(acc, vmlal_high_s8(vmull_s8(vget_low_s8(w_lo), vget_low_s8(lhs_0)), w_lo, lhs_0));
+    acc = vpadalq_s16(acc, vmlal_high_s8(vmull_s8(vget_low_s8(w_hi), vget_low_s8(lhs_1)), w_hi, lhs_1));
+#endif // __ARM_FEATURE_DOTPROD
+    return acc;
+}
+
+#define KAI_QSI4_UKERNEL(weights, variant)                                                                  \
+    kai_matmul_clamp_f32_qai8dxp_##weights##_ukernel                                                        \
+    {                                                                                                       \
+        kai_get_m_step_matmul_clamp_f32_##variant, kai_get_n_step_matmul_clamp_f32_##variant,               \
+            kai_get_mr_matmul_clamp_f32_##variant, kai_get_nr_matmul_clamp_f32_##variant,                   \
+            kai_get_kr_matmul_clamp_f32_##variant, kai_get_sr_matmul_clamp_f32_##variant,                   \
+            kai_get_lhs_packed_offset_matmul_clamp_f32_##variant,                                           \
+            kai_get_rhs_packed_offset_matmul_clamp_f32_##variant,                                           \
+            kai_get_dst_offset_matmul_clamp_f32_##variant, kai_get_dst_size_matmul_clamp_f32_##variant,     \
+            kai_run_matmul_clamp_f32_##variant                                                              \
+    }
+
+// The per channel weights use the qsi4cxp micro-kernels, the per block weights the qsi4c32p ones. The dot product
+// micro-kernel run on single rows reads the weights packed like the matrix multiply one, and is run on all the rows of
+// the cores without the matrix multiply instructions.
+const kai_matmul_clamp_f32_qai8dxp_qsi4cxp_ukernel cxp_gemv =
+    KAI_QSI4_UKERNEL(qsi4cxp, qai8dxp1x8_qsi4cxp4x8_1x4x32_neon_dotprod);
+const kai_matmul_clamp_f32_qai8dxp_qsi4cxp_ukernel cxp_i8mm_gemm =
+    KAI_QSI4_UKERNEL(qsi4cxp, qai8dxp4x8_qsi4cxp4x8_8x4x32_neon_i8mm);
+const kai_matmul_clamp_f32_qai8dxp_qsi4c32p_ukernel c32p_gemv =
+    KAI_QSI4_UKERNEL(qsi4c32p, qai8dxp1x8_qsi4c32p4x8_1x4x32_neon_dotprod);
+const kai_matmul_clamp_f32_qai8dxp_qsi4c32p_ukernel c32p_i8mm_gemm =
+    KAI_QSI4_UKERNEL(qsi4c32p, qai8dxp4x8_qsi4c32p4x8_16x4x32_neon_i8mm);
+
+#undef KAI_QSI4_UKERNEL
+
+/** Whether the weights have a single block of scales per output channel, packed for the qsi4cxp micro-kernels */
+inline bool is_per_channel(size_t k, size_t block_size)
+{
+    return block_size >= k;
+}
+
+/** Pack the weights, their scales and their sums in the layout read by the KleidiAI micro-kernels
+ *
+ * The qsi4cxp packing reads signed values and F32 scales, the qsi4c32p packing reads values with a zero point of 8 and
+ * the BF16 scales of the micro-kernels.
+ */
+void kai_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t block_size)
+{
+    const ITensorInfo *info     = rhs->info();
+    const size_t       n        = info->dimension(1);
+    const size_t       row_len  = (k + 1) / 2;
+    const size_t       stride_y = info->strides_in_bytes()[1];
+    const uint8_t     *src      = rhs->buffer() + info->offset_first_element_in_bytes();
+    void *const        dst      = packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes();
+
+    const std::vector<float> scales = info->quantization_info().scale();
+
+    if (is_per_channel(k, block_size))
+    {
+        // The packing function reads rows of exactly ceil(K / 2) bytes
+        std::vector<uint8_t> contiguous;
+        if (n > 1 && stride_y != row_len)
+        {
+            contiguous.resize(n * row_len);
+            for (size_t r = 0; r < n; ++r)
+            {
+                std::memcpy(contiguous.data() + r * row_len, src + r * stride_y, row_len);
+            }
+            src = contiguous.data();
+        }
+
+        // The bias is added after the multiplication, so that it is not part of the packed weights
+        kai_rhs_pack_nxk_qsi4cxp_qs4cxs1s0_params params{};
+        params.lhs_zero_point = 1;
+        params.rhs_zero_point = 0;
+        kai_run_rhs_pack_nxk_qsi4cxp_qs4cxs1s0(1, n, k, cxp_gemv.get_nr(), cxp_gemv.get_kr(), cxp_gemv.get_sr(), src,
+                                               nullptr, scales.data(), dst, 0, &params);
+    }
+    else
+    {
+        // Flipping the sign bit of both nibbles turns the signed values into unsigned ones with a zero point of 8
+        std::vector<uint8_t> unsigned_rhs(n * row_len);
+        for (size_t r = 0; r < n; ++r)
+        {
+            for (size_t i = 0; i < row_len; ++i)
+            {
+                unsigned_rhs[r * row_len + i] = src[r * stride_y + i] ^ 0x88;
+            }
+        }
+
+        std::vector<uint16_t> bf16_scales(scales.size());
+        std::transform(scales.begin(), scales.end(), bf16_scales.begin(), portable_float_to_bf16);
+
+        kai_rhs_pack_nxk_qsi4c32p_qsu4c32s1s0_params params{};
+        params.lhs_zero_point = 1;
+        params.rhs_zero_point = 8;
+        params.scale_dt       = kai_dt_bf16;
+        kai_run_rhs_pack_nxk_qsi4c32p_qsu4c32s1s0(1, n, k, c32p_gemv.get_nr(), c32p_gemv.get_kr(), c32p_gemv.get_sr(),
+                                                  block_size, unsigned_rhs.data(), row_len, nullptr,
+                                                  bf16_scales.data(), (k / block_size) * sizeof(uint16_t), dst, 0,
+                                                  &params);
+    }
+}
+
+/** Size in bytes of the weights packed by @ref kai_pack_rhs */
+size_t kai_size_of_packed_rhs(size_t k, size_t n, size_t block_size)
+{
+    if (is_per_channel(k, block_size))
+    {
+        return kai_get_rhs_packed_size_rhs_pack_nxk_qsi4cxp_qs4cxs1s0(n, k, cxp_gemv.get_nr(), cxp_gemv.get_kr(),
+                                                                      cxp_gemv.get_sr());
+    }
+    return kai_get_rhs_packed_size_rhs_pack_nxk_qsi4c32p_qsu4c32s1s0(
+        n, k, c32p_gemv.get_nr(), c32p_gemv.get_kr(), c32p_gemv.get_sr(), block_size, kai_dt_bf16);
+}
+
+/** Run a pair of KleidiAI micro-kernels on a window, dispatching on the layout of the packed weights */
+void kai_run_matmul(const kai_matmul_clamp_f32_qai8dxp_qsi4cxp_ukernel  &cxp_gemm,
+                    const kai_matmul_clamp_f32_qai8dxp_qsi4c32p_ukernel &c32p_gemm,
+                    const ITensor                                       *lhs,
+                    const ITensor                                       *packed_rhs,
+                    const ITensor                                       *bias,
+                    ITensor                                             *dst,
+                    size_t                                               block_size,
+                    float                                                min,
+                    float                                                max,
+                    const Window                                        &window)
+{
+    const size_t         k   = lhs->info()->dimension(0);
+    const uint8_t *const rhs = packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes();
+
+    if (is_per_channel(k, block_size))
+    {
+        kai_run_matmul_qai8dxp(
+            cxp_gemv, cxp_gemm, lhs, bias, dst, min, max, window,
+            [&](const kai_matmul_clamp_f32_qai8dxp_qsi4cxp_ukernel &uk, size_t m, size_t n_idx, size_t n,
+                const void *lhs_packed, float *dst_rows, size_t dst_stride, float kai_min, float kai_max)
+            {
+                uk.run_matmul(m, n, k, lhs_packed, rhs + uk.get_rhs_packed_offset(n_idx, k), dst_rows, dst_stride,
+                              sizeof(float), kai_min, kai_max);
+            });
+    }
+    else
+    {
+        kai_run_matmul_qai8dxp(
+            c32p_gemv, c32p_gemm, lhs, bias, dst, min, max, window,
+            [&](const kai_matmul_clamp_f32_qai8dxp_qsi4c32p_ukernel &uk, size_t m, size_t n_idx, size_t n,
+                const void *lhs_packed, float *dst_rows, size_t dst_stride, float kai_min, float kai_max)
+            {
+                uk.run_matmul(m, n, k, block_size, lhs_packed, rhs + uk.get_rhs_packed_offset(n_idx, k, block_size),
+                              dst_rows, dst_stride, sizeof(float), kai_min, kai_max);
+            });
+    }
+}
+} // namespace
+
+void neon_fp32_matmul_qsi4(const ITensor *lhs,
+                           const ITensor *packed_rhs,
+                           const ITensor *bias,
+                           ITensor       *dst,
+                           size_t         block_size,
+                           float          min,
+                           float          max,
+                           const Window  &window)
+{
+    const size_t k          = lhs->info()->dimension(0);
+    const size_t n          = dst->info()->dimension(0);
+    const size_t k_padded   = ceil_to_multiple(k, qsi4_chunk_size);
+    const size_t num_blocks = k_padded / block_size;
+    const size_t row_size   = k_padded / 2;
+
+    const int8_t *weights = reinterpret_cast<const int8_t *>(packed_rhs->buffer() +
+                                                             packed_rhs->info()->offset_first_element_in_bytes());
+    const float  *scales  = reinterpret_cast<const float *>(weights + n * row_size);
+    const float  *bias_ptr =
+        bias != nullptr
+            ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+            : nullptr;
+
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The values of the quantized row after K stay zero to match the padding of the weights
+    std::vector<int8_t> lhs_q(k_padded, 0);
+
+    Iterator lhs_it(lhs, win);
+    Iterator dst_it(dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const float  lhs_scale = quantize_row(reinterpret_cast<const float *>(lhs_it.ptr()), k, lhs_q.data());
+            float *const dst_row   = reinterpret_cast<float *>(dst_it.ptr());
+
+            for (int x = window_start_x; x < window_end_x; ++x)
+            {
+                const int8_t *w         = weights + x * row_size;
+                const float  *w_scales  = scales + x * num_blocks;
+                const int8_t *lhs_chunk = lhs_q.data();
+                float         acc       = 0.f;
+                for (size_t b = 0; b < num_blocks; ++b)
+                {
+                    int32x4_t acc_block = vdupq_n_s32(0);
+                    for (size_t i = 0; i < block_size; i += qsi4_chunk_size)
+                    {
+                        acc_block = dot_chunk(acc_block, lhs_chunk, w);
+                        lhs_chunk += qsi4_chunk_size;
+                        w += qsi4_chunk_size / 2;
+                    }
+                    acc += static_cast<float>(vaddvq_s32(acc_block)) * w_scales[b];
+                }
+
+                float res = acc * lhs_scale;
+                if (bias_ptr != nullptr)
+                {
+                    res += bias_ptr[x];
+                }
+                dst_row[x] = std::min(std::max(res, min), max);
+            }
+        },
+        lhs_it, dst_it);
+}
+
+void neon_fp32_matmul_qsi4_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t block_size)
+{
+    ARM_COMPUTE_UNUSED(block_size);
+
+    const ITensorInfo *info       = rhs->info();
+    const size_t       n          = info->dimension(1);
+    const size_t       k_padded   = ceil_to_multiple(k, qsi4_chunk_size);
+    const size_t       row_stride = info->strides_in_bytes()[1];
+    const uint8_t     *src        = rhs->buffer() + info->offset_first_element_in_bytes();
+    uint8_t           *dst        = packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes();
+
+    // The padding values of K are zeros
+    const auto value = [k](const uint8_t *row, size_t idx) -> uint8_t
+    {
+        if (idx >= k)
+        {
+            return 0;
+        }
+        return (idx % 2 == 0) ? (row[idx / 2] & 0xF) : (row[idx / 2] >> 4);
+    };
+
+    for (size_t c = 0; c < n; ++c)
+    {
+        const uint8_t *row = src + c * row_stride;
+        for (size_t chunk = 0; chunk < k_padded; chunk += qsi4_chunk_size)
+        {
+            for (size_t j = 0; j < qsi4_chunk_size / 2; ++j)
+            {
+                *dst++ = value(row, chunk + j) | (value(row, chunk + j + qsi4_chunk_size / 2) << 4);
+            }
+        }
+    }
+
+    const std::vector<float> scales = info->quantization_info().scale();
+    std::memcpy(dst, scales.data(), scales.size() * sizeof(float));
+}
+
+size_t neon_fp32_matmul_qsi4_size_of_packed_rhs(size_t k, size_t n, size_t block_size)
+{
+    const size_t k_padded = ceil_to_multiple(k, qsi4_chunk_size);
+    return n * k_padded / 2 + n * (k_padded / block_size) * sizeof(float);
+}
+
+void neon_fp32_matmul_qsi4_dotprod(const ITensor *lhs,
+                                   const ITensor *packed_rhs,
+                                   const ITensor *bias,
+                                   ITensor       *dst,
+                                   size_t         block_size,
+                                   float          min,
+                                   float          max,
+                                   const Window  &window)
+{
+    kai_run_matmul(cxp_gemv, c32p_gemv, lhs, packed_rhs, bias, dst, block_size, min, max, window);
+}
+
+void neon_fp32_matmul_qsi4_dotprod_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t block_size)
+{
+    kai_pack_rhs(rhs, packed_rhs, k, block_size);
+}
+
+size_t neon_fp32_matmul_qsi4_dotprod_size_of_packed_rhs(size_t k, size_t n, size_t block_size)
+{
+    return kai_size_of_packed_rhs(k, n, block_size);
+}
+
+void neon_fp32_matmul_qsi4_i8mm(const ITensor *lhs,
+                                const ITensor *packed_rhs,
+                                const ITensor *bias,
+                                ITensor       *dst,
+                                size_t         block_size,
+                                float          min,
+                                float          max,
+                                const Window  &window)
+{
+    kai_run_matmul(cxp_i8mm_gemm, c32p_i8mm_gemm, lhs, packed_rhs, bias, dst, block_size, min, max, window);
+}
+
+void neon_fp32_matmul_qsi4_i8mm_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t block_size)
+{
+    kai_pack_rhs(rhs, packed_rhs, k, block_size);
+}
+
+size_t neon_fp32_matmul_qsi4_i8mm_size_of_packed_rhs(size_t k, size_t n, size_t block_size)
+{
+    return kai_size_of_packed_rhs(k, n, block_size);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // __aarch64__
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_MATMUL_QSI4_LIST_H
+#define ACL_SRC_CPU_KERNELS_MATMUL_QSI4_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of weights of a packed chunk
+ *
+ * The weights packed for @ref neon_fp32_matmul_qsi4 hold, for each output channel, K rounded up to a multiple of the
+ * chunk size 4-bit values, followed by the F32 scales of all the channels. Byte j of a chunk holds value j in its low
+ * nibble and value j + 16 in its high nibble, so that a chunk unpacks into two vectors matching two consecutive vectors
+ * of the LHS.
+ */
+constexpr size_t qsi4_chunk_size = 32;
+
+/** Number of output channels computed together by the KleidiAI micro-kernels
+ *
+ * The first output channel of a window run by @ref neon_fp32_matmul_qsi4_dotprod or @ref neon_fp32_matmul_qsi4_i8mm
+ * must be a multiple of this step, the weights being packed by blocks of this many channels.
+ */
+constexpr size_t qsi4_kai_n_step = 4;
+
+#define DECLARE_MATMUL_QSI4_KERNEL(func_name)                                                                   \
+    void func_name(const ITensor *lhs, const ITensor *packed_rhs, const ITensor *bias, ITensor *dst,            \
+                   size_t block_size, float min, float max, const Window &window)
+
+#define DECLARE_MATMUL_QSI4_PACK_RHS(func_name) \
+    void func_name(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t block_size)
+
+#define DECLARE_MATMUL_QSI4_SIZE_OF_PACKED_RHS(func_name) size_t func_name(size_t k, size_t n, size_t block_size)
+
+DECLARE_MATMUL_QSI4_KERNEL(neon_fp32_matmul_qsi4);
+DECLARE_MATMUL_QSI4_PACK_RHS(neon_fp32_matmul_qsi4_pack_rhs);
+DECLARE_MATMUL_QSI4_SIZE_OF_PACKED_RHS(neon_fp32_matmul_qsi4_size_of_packed_rhs);
+
+DECLARE_MATMUL_QSI4_KERNEL(neon_fp32_matmul_qsi4_dotprod);
+DECLARE_MATMUL_QSI4_PACK_RHS(neon_fp32_matmul_qsi4_dotprod_pack_rhs);
+DECLARE_MATMUL_QSI4_SIZE_OF_PACKED_RHS(neon_fp32_matmul_qsi4_dotprod_size_of_packed_rhs);
+
+DECLARE_MATMUL_QSI4_KERNEL(neon_fp32_matmul_qsi4_i8mm);
+DECLARE_MATMUL_QSI4_PACK_RHS(neon_fp32_matmul_qsi4_i8mm_pack_rhs);
+DECLARE_MATMUL_QSI4_SIZE_OF_PACKED_RHS(neon_fp32_matmul_qsi4_i8mm_size_of_packed_rhs);
+
+#undef DECLARE_MATMUL_QSI4_KERNEL
+#undef DECLARE_MATMUL_QSI4_PACK_RHS
+#undef DECLARE_MATMUL_QSI4_SIZE_OF_PACKED_RHS
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_MATMUL_QSI4_LIST_H
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/matmul_qsi8/list.h"
+
+#ifdef __aarch64__
+#include "src/cpu/kernels/matmul_qsi8/generic/neon/impl.h"
+
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp1x4_qsi8cxp4x4_1x4_neon_dotprod.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp1x8_qsi8cxp4x8_1x4_neon_dotprod.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp4x4_qsi8cxp4x4_16x4_neon_dotprod.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp4x8_qsi8cxp4x8_16x4_neon_i8mm.h"
+#include "kai/ukernels/matmul/matmul_clamp_f32_qai8dxp_qsi8cxp/kai_matmul_clamp_f32_qai8dxp_qsi8cxp_interface.h"
+#include "kai/ukernels/matmul/pack/kai_rhs_pack_kxn_qsi8cxp_qsi8cx_neon.h"
+#include "kai/ukernels/matmul/pack/kai_rhs_pack_nxk_qsi8cxp_qsi8cx_neon.h"
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Quantize a row of K values to S8 with an asymmetric scale covering the range of the row
+ *
+ * @param[in]  src    Row to quantize
+ * @param[in]  k      Number of values of the row
+ * @param[out] dst    Quantized row, whose values after @p k are left untouched
+ * @param[out] offset Offset of the quantized row
+ *
+ * @return The scale of the quantized row
+ */
+float quantize_row(const float *src, size_t k, int8_t *dst, int32_t &offset)
+{
+    // The range always contains zero so that it is exactly represented
+    float32x4_t vmin = vdupq_n_f32(0.f);
+    float32x4_t vmax = vdupq_n_f32(0.f);
+    size_t      i    = 0;
+    for (; i + 4 <= k; i += 4)
+    {
+        const float32x4_t v = vld1q_f32(src + i);
+        vmin                = vminq_f32(vmin, v);
+        vmax                = vmaxq_f32(vmax, v);
+    }
+    float rmin = vminvq_f32(vmin);
+    float rmax = vmaxvq_f32(vmax);
+    for (; i < k; ++i)
+    {
+        rmin = std::min(rmin, src[i]);
+        rmax = std::max(rmax, src[i]);
+    }
+
+    const float scale     = (rmax - rmin) / 255.f;
+    const float inv_scale = scale > 0.f ? 1.f / scale : 0.f;
+    offset = static_cast<int32_t>(std::min(127.f, std::max(-128.f, std::round(-128.f - rmin * inv_scale))));
+
+    const int32x4_t voffset = vdupq_n_s32(offset);
+    i                       = 0;
+    for (; i + 8 <= k; i += 8)
+    {
+        const int32x4_t lo = vaddq_s32(vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i), inv_scale)), voffset);
+        const int32x4_t hi = vaddq_s32(vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i + 4), inv_scale)), voffset);
+        vst1_s8(dst + i, vqmovn_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+    }
+    for (; i < k; ++i)
+    {
+        const int32_t q = static_cast<int32_t>(std::lround(src[i] * inv_scale)) + offset;
+        dst[i]          = static_cast<int8_t>(std::min(127, std::max(-128, q)));
+    }
+    return scale;
+}
+
+/** Accumulate the dot product of a chunk of the quantized LHS with a chunk of weights */
+inline int32x4_t dot_chunk(int32x4_t acc, int8x16_t lhs, const int8_t *rhs)
+{
+    const int8x16_t w = vld1q_s8(rhs);
+#ifdef __ARM_FEATURE_DOTPROD
+    return vdotq_s32(acc, lhs, w);
+#else  // __ARM_FEATURE_DOTPROD
+    acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(lhs), vget_low_s8(w)));
+    return vpadalq_s16(acc, vmull_high_s8(lhs, w));
+#endif // __ARM_FEATURE_DOTPROD
+}
+
+/** Scales of the output channels of the weights, the single scale of per tensor quantized weights being broadcast */
+std::vector<float> channel_scales(const ITensorInfo &info, size_t n)
+{
+    const std::vector<float> scales = info.quantization_info().scale();
+    return scales.size() == 1 ? std::vector<float>(n, scales[0]) : scales;
+}
+
+#define KAI_QSI8_UKERNEL(variant)                                                                       \
+    kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel                                                        \
+    {                                                                                                   \
+        kai_get_m_step_matmul_clamp_f32_##variant, kai_get_n_step_matmul_clamp_f32_##variant,           \
+            kai_get_mr_matmul_clamp_f32_##variant, kai_get_nr_matmul_clamp_f32_##variant,               \
+            kai_get_kr_matmul_clamp_f32_##variant, kai_get_sr_matmul_clamp_f32_##variant,               \
+            kai_get_lhs_packed_offset_matmul_clamp_f32_##variant,                                       \
+            kai_get_rhs_packed_offset_matmul_clamp_f32_##variant,                                       \
+            kai_get_dst_offset_matmul_clamp_f32_##variant, kai_get_dst_size_matmul_clamp_f32_##variant, \
+            kai_run_matmul_clamp_f32_##variant                                                          \
+    }
+
+// The micro-kernels of a pair read the weights packed the same way: the first one is run on single rows, the second
+// one on blocks of rows. The cores with the matrix multiply instructions also have the dot product ones, used for the
+// single rows.
+const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel dotprod_gemv =
+    KAI_QSI8_UKERNEL(qai8dxp1x4_qsi8cxp4x4_1x4_neon_dotprod);
+const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel dotprod_gemm =
+    KAI_QSI8_UKERNEL(qai8dxp4x4_qsi8cxp4x4_16x4_neon_dotprod);
+const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel i8mm_gemv = KAI_QSI8_UKERNEL(qai8dxp1x8_qsi8cxp4x8_1x4_neon_dotprod);
+const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel i8mm_gemm = KAI_QSI8_UKERNEL(qai8dxp4x8_qsi8cxp4x8_16x4_neon_i8mm);
+
+#undef KAI_QSI8_UKERNEL
+
+/** Pack the weights, their scales and their sums in the layout read by a KleidiAI micro-kernel */
+void kai_pack_rhs(const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel &uk,
+                  const ITensor                                      *rhs,
+                  ITensor                                            *packed_rhs,
+                  size_t                                              k,
+                  size_t                                              n,
+                  bool                                                adj_rhs)
+{
+    const ITensorInfo *info = rhs->info();
+
+    // The packing functions read rows of exactly K values if adj_rhs is set, N values otherwise
+    const size_t  row_len  = adj_rhs ? k : n;
+    const size_t  num_rows = adj_rhs ? n : k;
+    const size_t  stride_y = info->strides_in_bytes()[1];
+    const int8_t *src      = reinterpret_cast<const int8_t *>(rhs->buffer() + info->offset_first_element_in_bytes());
+
+    std::vector<int8_t> contiguous;
+    if (num_rows > 1 && stride_y != row_len)
+    {
+        contiguous.resize(num_rows * row_len);
+        for (size_t r = 0; r < num_rows; ++r)
+        {
+            std::memcpy(contiguous.data() + r * row_len, src + r * stride_y, row_len);
+        }
+        src = contiguous.data();
+    }
+
+    const std::vector<float> scales = channel_scales(*info, n);
+    void *const dst = packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes();
+
+    // The bias is added by the kernel after the multiplication, so that it is not part of the packed weights
+    kai_rhs_pack_qsi8cx_params params{};
+    params.lhs_zero_point   = 1;
+    params.scale_multiplier = 1.f;
+    if (adj_rhs)
+    {
+        kai_run_rhs_pack_nxk_qsi8cxp_qsi8cx_neon(1, n, k, uk.get_nr(), uk.get_kr(), uk.get_sr(), src, nullptr,
+                                                 scales.data(), dst, 0, &params);
+    }
+    else
+    {
+        kai_run_rhs_pack_kxn_qsi8cxp_qsi8cx_neon(1, n, k, uk.get_nr(), uk.get_kr(), uk.get_sr(), src, nullptr,
+                                                 scales.data(), dst, 0, &params);
+    }
+}
+
+/** Run a pair of KleidiAI micro-kernels on a window */
+void kai_run_matmul(const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel &gemv,
+                    const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel &gemm,
+                    const ITensor                                      *lhs,
+                    const ITensor                                      *packed_rhs,
+                    const ITensor                                      *bias,
+                    ITensor                                            *dst,
+                    float                                               min,
+                    float                                               max,
+                    const Window                                       &window)
+{
+    const size_t         k   = lhs->info()->dimension(0);
+    const uint8_t *const rhs = packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes();
+
+    kai_run_matmul_qai8dxp(
+        gemv, gemm, lhs, bias, dst, min, max, window,
+        [&](const kai_matmul_clamp_f32_qai8dxp_qsi8cxp_ukernel &uk, size_t m, size_t n_idx, size_t n,
+            const void *lhs_packed, float *dst_rows, size_t dst_stride, float kai_min, float kai_max)
+        {
+            uk.run_matmul(m, n, k, lhs_packed, rhs + uk.get_rhs_packed_offset(n_idx, k), dst_rows, dst_stride,
+                          sizeof(float), kai_min, kai_max);
+        });
+}
+} // namespace
+
+void neon_fp32_matmul_qsi8(const ITensor *lhs,
+                           const ITensor *packed_rhs,
+                           const ITensor *bias,
+                           ITensor       *dst,
+                           float          min,
+                           float          max,
+                           const Window  &window)
+{
+    const size_t k        = lhs->info()->dimension(0);
+    const size_t n        = dst->info()->dimension(0);
+    const size_t k_padded = ceil_to_multiple(k, qsi8_chunk_size);
+
+    const int8_t *weights = reinterpret_cast<const int8_t *>(packed_rhs->buffer() +
+                                                             packed_rhs->info()->offset_first_element_in_bytes());
+    const float   *scales = reinterpret_cast<const float *>(weights + n * k_padded);
+    const int32_t *sums   = reinterpret_cast<const int32_t *>(scales + n);
+    const float   *bias_ptr =
+        bias != nullptr
+            ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+            : nullptr;
+
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The values of the quantized row after K are multiplied by the zero padding of the weights
+    std::vector<int8_t> lhs_q(k_padded, 0);
+
+    Iterator lhs_it(lhs, win);
+    Iterator dst_it(dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            int32_t      lhs_offset = 0;
+            const float  lhs_scale =
+                quantize_row(reinterpret_cast<const float *>(lhs_it.ptr()), k, lhs_q.data(), lhs_offset);
+            float *const dst_row = reinterpret_cast<float *>(dst_it.ptr());
+
+            const auto dequantize = [&](int x, int32_t acc)
+            {
+                // sum((q - offset) * w) = sum(q * w) - offset * sum(w)
+                float res = static_cast<float>(acc - lhs_offset * sums[x]) * lhs_scale * scales[x];
+                if (bias_ptr != nullptr)
+                {
+                    res += bias_ptr[x];
+                }
+                dst_row[x] = std::min(std::max(res, min), max);
+            };
+
+            int x = window_start_x;
+            // Four output channels at a time share each load of the LHS
+            for (; x + 4 <= window_end_x; x += 4)
+            {
+                const int8_t *w0   = weights + x * k_padded;
+                const int8_t *w1   = w0 + k_padded;
+                const int8_t *w2   = w1 + k_padded;
+                const int8_t *w3   = w2 + k_padded;
+                int32x4_t     acc0 = vdupq_n_s32(0);
+                int32x4_t     acc1 = vdupq_n_s32(0);
+                int32x4_t     acc2 = vdupq_n_s32(0);
+                int32x4_t     acc3 = vdupq_n_s32(0);
+                for (size_t i = 0; i < k_padded; i += qsi8_chunk_size)
+                {
+                    const int8x16_t a = vld1q_s8(lhs_q.data() + i);
+                    acc0              = dot_chunk(acc0, a, w0 + i);
+                    acc1              = dot_chunk(acc1, a, w1 + i);
+                    acc2              = dot_chunk(acc2, a, w2 + i);
+                    acc3              = dot_chunk(acc3, a, w3 + i);
+                }
+                dequantize(x, vaddvq_s32(acc0));
+                dequantize(x + 1, vaddvq_s32(acc1));
+                dequantize(x + 2, vaddvq_s32(acc2));
+                dequantize(x + 3, vaddvq_s32(acc3));
+            }
+            for (; x < window_end_x; ++x)
+            {
+                const int8_t *w   = weights + x * k_padded;
+                int32x4_t     acc = vdupq_n_s32(0);
+                for (size_t i = 0; i < k_padded; i += qsi8_chunk_size)
+                {
+                    acc = dot_chunk(acc, vld1q_s8(lhs_q.data() + i), w + i);
+                }
+                dequantize(x, vaddvq_s32(acc));
+            }
+        },
+        lhs_it, dst_it);
+}
+
+void neon_fp32_matmul_qsi8_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t n, bool adj_rhs)
+{
+    const ITensorInfo *info     = rhs->info();
+    const size_t       k_padded = ceil_to_multiple(k, qsi8_chunk_size);
+    const size_t       stride_y = info->strides_in_bytes()[1];
+    const uint8_t     *src      = rhs->buffer() + info->offset_first_element_in_bytes();
+    int8_t            *dst =
+        reinterpret_cast<int8_t *>(packed_rhs->buffer() + packed_rhs->info()->offset_first_element_in_bytes());
+
+    float   *scales = reinterpret_cast<float *>(dst + n * k_padded);
+    int32_t *sums   = reinterpret_cast<int32_t *>(scales + n);
+
+    // Element (c, i) is at c * stride_y + i if the values of a channel are contiguous, at i * stride_y + c otherwise
+    const size_t stride_c = adj_rhs ? stride_y : 1;
+    const size_t stride_i = adj_rhs ? 1 : stride_y;
+
+    for (size_t c = 0; c < n; ++c)
+    {
+        int32_t sum = 0;
+        for (size_t i = 0; i < k; ++i)
+        {
+            const int8_t value = static_cast<int8_t>(src[c * stride_c + i * stride_i]);
+            dst[i]             = value;
+            sum += value;
+        }
+        std::memset(dst + k, 0, k_padded - k);
+        dst += k_padded;
+        sums[c] = sum;
+    }
+
+    const std::vector<float> weights_scales = channel_scales(*info, n);
+    std::copy(weights_scales.begin(), weights_scales.end(), scales);
+}
+
+size_t neon_fp32_matmul_qsi8_size_of_packed_rhs(size_t k, size_t n)
+{
+    return n * (ceil_to_multiple(k, qsi8_chunk_size) + sizeof(float) + sizeof(int32_t));
+}
+
+void neon_fp32_matmul_qsi8_dotprod(const ITensor *lhs,
+                                   const ITensor *packed_rhs,
+                                   const ITensor *bias,
+                                   ITensor       *dst,
+                                   float          min,
+                                   float          max,
+                                   const Window  &window)
+{
+    kai_run_matmul(dotprod_gemv, dotprod_gemm, lhs, packed_rhs, bias, dst, min, max, window);
+}
+
+void neon_fp32_matmul_qsi8_dotprod_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t n, bool adj_rhs)
+{
+    kai_pack_rhs(dotprod_gemm, rhs, packed_rhs, k, n, adj_rhs);
+}
+
+size_t neon_fp32_matmul_qsi8_dotprod_size_of_packed_rhs(size_t k, size_t n)
+{
+    return kai_get_rhs_packed_size_rhs_pack_nxk_qsi8cxp_qsi8cx_neon(n, k, dotprod_gemm.get_nr(), dotprod_gemm.get_kr(),
+                                                                    dotprod_gemm.get_sr());
+}
+
+void neon_fp32_matmul_qsi8_i8mm(const ITensor *lhs,
+                                const ITensor *packed_rhs,
+                                const ITensor *bias,
+                                ITensor       *dst,
+                                float          min,
+                                float          max,
+                                const Window  &window)
+{
+    kai_run_matmul(i8mm_gemv, i8mm_gemm, lhs, packed_rhs, bias, dst, min, max, window);
+}
+
+void neon_fp32_matmul_qsi8_i8mm_pack_rhs(const ITensor *rhs, ITensor *packed_rhs, size_t k, size_t n, bool adj_rhs)
+{
+    kai_pack_rhs(i8mm_gemm, rhs, packed_rhs, k, n, adj_rhs);
+}
+
+size_t neon_fp32_matmul_qsi8_i8mm_size_of_packed_rhs(size_t k, size_t n)
+{
+    return kai_get_rhs_packed_size_rhs_pack_nxk_qsi8cxp_qsi8cx_neon(n, k, i8mm_gemm.get_nr(), i8mm_gemm.get_kr(),
+                                                                    i8mm_gemm.get_sr());
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // __aarch64__
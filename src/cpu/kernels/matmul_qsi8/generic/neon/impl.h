@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_MATMUL_QSI8_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_MATMUL_QSI8_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "kai/ukernels/matmul/pack/kai_lhs_quant_pack_qai8dxp_f32.h"
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Add the bias to a block of the output and clamp the results */
+inline void
+add_bias_and_clamp(float *dst, size_t dst_stride, const float *bias, size_t m, size_t n, float min, float max)
+{
+    const float32x4_t vmin = vdupq_n_f32(min);
+    const float32x4_t vmax = vdupq_n_f32(max);
+    for (size_t y = 0; y < m; ++y)
+    {
+        float *const row = reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(dst) + y * dst_stride);
+        size_t       x   = 0;
+        for (; x + 4 <= n; x += 4)
+        {
+            const float32x4_t res = vaddq_f32(vld1q_f32(row + x), vld1q_f32(bias + x));
+            vst1q_f32(row + x, vminq_f32(vmaxq_f32(res, vmin), vmax));
+        }
+        for (; x < n; ++x)
+        {
+            row[x] = std::min(std::max(row[x] + bias[x], min), max);
+        }
+    }
+}
+
+/** Run a pair of KleidiAI micro-kernels reading a qai8dxp LHS on a window
+ *
+ * The rows of the window are quantized and packed once per batch, @p gemv being used for windows of a single row and
+ * @p gemm otherwise. The micro-kernels of the 8-bit and of the 4-bit weights share this LHS layout, and only differ in
+ * the way they locate and read the packed weights, which is left to @p run.
+ *
+ * @param[in]  gemv   Micro-kernel run on single rows
+ * @param[in]  gemm   Micro-kernel run on blocks of rows, reading the weights packed like @p gemv
+ * @param[in]  lhs    Left-hand side tensor of shape [K, M, batches...]
+ * @param[in]  bias   (Optional) Bias tensor of shape [N]. Can be nullptr
+ * @param[out] dst    Output tensor of shape [N, M, batches...]
+ * @param[in]  min    Lower bound of the output
+ * @param[in]  max    Upper bound of the output
+ * @param[in]  window Region of the output to compute, whose first output channel is a multiple of the N step
+ * @param[in]  run    Function running a micro-kernel, called with the micro-kernel, the number of rows, the first
+ *                    output channel, the number of output channels, the packed LHS, the output, the output row stride
+ *                    and the bounds of the output
+ */
+template <typename UKernel, typename RunUKernel>
+void kai_run_matmul_qai8dxp(const UKernel &gemv,
+                            const UKernel &gemm,
+                            const ITensor *lhs,
+                            const ITensor *bias,
+                            ITensor       *dst,
+                            float          min,
+                            float          max,
+                            const Window  &window,
+                            RunUKernel   &&run)
+{
+    const size_t k       = lhs->info()->dimension(0);
+    const size_t n       = dst->info()->dimension(0);
+    const size_t m_start = window.y().start();
+    const size_t m_len   = std::min<size_t>(window.y().end(), dst->info()->dimension(1)) - m_start;
+    const size_t n_start = window.x().start();
+    const size_t n_len   = std::min<size_t>(window.x().end(), n) - n_start;
+
+    const UKernel &uk = m_len == 1 ? gemv : gemm;
+    ARM_COMPUTE_ERROR_ON(n_start % uk.get_n_step() != 0);
+
+    const size_t mr         = uk.get_mr();
+    const size_t kr         = uk.get_kr();
+    const size_t sr         = uk.get_sr();
+    const size_t lhs_stride = lhs->info()->strides_in_bytes()[1];
+    const size_t dst_stride = dst->info()->strides_in_bytes()[1];
+
+    const float *bias_ptr =
+        bias != nullptr
+            ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) + n_start
+            : nullptr;
+
+    // Without bias the micro-kernel clamps the results itself, otherwise the clamp follows the addition of the bias
+    const float kai_min = bias_ptr == nullptr ? min : std::numeric_limits<float>::lowest();
+    const float kai_max = bias_ptr == nullptr ? max : std::numeric_limits<float>::max();
+
+    std::vector<uint8_t> lhs_packed(kai_get_lhs_packed_size_lhs_quant_pack_qai8dxp_f32(m_len, k, mr, kr, sr));
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator lhs_it(lhs, win);
+    Iterator dst_it(dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const float *lhs_rows = reinterpret_cast<const float *>(lhs_it.ptr() + m_start * lhs_stride);
+            float *dst_rows = reinterpret_cast<float *>(dst_it.ptr() + m_start * dst_stride) + n_start;
+
+            kai_run_lhs_quant_pack_qai8dxp_f32(m_len, k, mr, kr, sr, 0, lhs_rows, lhs_stride, lhs_packed.data());
+            run(uk, m_len, n_start, n_len, lhs_packed.data(), dst_rows, dst_stride, kai_min, kai_max);
+            if (bias_ptr != nullptr)
+            {
+                add_bias_and_clamp(dst_rows, dst_stride, bias_ptr, m_len, n_len, min, max);
+            }
+        },
+        lhs_it, dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_MATMUL_QSI8_GENERIC_NEON_IMPL_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuAttention.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuAttention::configure(const ITensorInfo   *query,
+                             const ITensorInfo   *key,
+                             const ITensorInfo   *value,
+                             const ITensorInfo   *mask,
+                             ITensorInfo         *dst,
+                             const AttentionInfo &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(query, key, value, mask, dst);
+
+    _kernel = std::make_unique<kernels::CpuAttentionKernel>();
+    _kernel->configure(query, key, value, mask, dst, info);
+
+    // Each thread only keeps the scores of a tile of queries and keys in its own slice of the workspace
+    const size_t workspace_size = _kernel->get_working_size(NEScheduler::get().num_threads());
+    _workspace                  = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
+    _aux_mem[Workspace] = MemoryInfo(offset_int_vec(Workspace), MemoryLifetime::Temporary, _workspace.total_size());
+}
+
+Status CpuAttention::validate(const ITensorInfo   *query,
+                              const ITensorInfo   *key,
+                              const ITensorInfo   *value,
+                              const ITensorInfo   *mask,
+                              const ITensorInfo   *dst,
+                              const AttentionInfo &info)
+{
+    return kernels::CpuAttentionKernel::validate(query, key, value, mask, dst, info);
+}
+
+void CpuAttention::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    CpuAuxTensorHandler workspace(offset_int_vec(Workspace), _workspace, tensors, false);
+
+    ITensorPack pack = tensors;
+    pack.add_tensor(TensorType::ACL_INT_0, workspace.get());
+    NEScheduler::get().schedule_op(_kernel.get(), _kernel->get_split_dimension_hint(), _kernel->window(), pack);
+}
+
+experimental::MemoryRequirements CpuAttention::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUATTENTION_H
+#define ACL_SRC_CPU_OPERATORS_CPUATTENTION_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/AttentionInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuAttentionKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuAttentionKernel */
+class CpuAttention : public ICpuOperator
+{
+public:
+    /** Initialize the operator's inputs and outputs.
+     *
+     * Similar to @ref NEAttention::configure()
+     *
+     */
+    void configure(const ITensorInfo   *query,
+                   const ITensorInfo   *key,
+                   const ITensorInfo   *value,
+                   const ITensorInfo   *mask,
+                   ITensorInfo         *dst,
+                   const AttentionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuAttention::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo   *query,
+                           const ITensorInfo   *key,
+                           const ITensorInfo   *value,
+                           const ITensorInfo   *mask,
+                           const ITensorInfo   *dst,
+                           const AttentionInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        Workspace = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuAttentionKernel> _kernel{nullptr};
+    TensorInfo                                   _workspace{};
+    experimental::MemoryRequirements             _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUATTENTION_H
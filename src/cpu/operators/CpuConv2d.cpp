@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,82 +23,287 @@
  */
 #include "src/cpu/operators/CpuConv2d.h"
 
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/CPP/CPPConvolutionTuner.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
 
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
 namespace arm_compute
 {
 namespace cpu
 {
-CpuConv2d::CpuConv2d() : _function()
+namespace
 {
-}
+/** Methods benchmarked by the convolution tuner */
+constexpr ConvolutionMethod tunable_methods[] = {ConvolutionMethod::GEMM, ConvolutionMethod::GEMM_CONV2D,
+                                                 ConvolutionMethod::DIRECT, ConvolutionMethod::WINOGRAD};
 
-CpuConv2d::~CpuConv2d() = default;
-
-void CpuConv2d::configure(ITensorInfo               *input,
-                          ITensorInfo               *weights,
-                          const ITensorInfo         *biases,
-                          ITensorInfo               *output,
-                          const PadStrideInfo       &conv_info,
-                          const WeightsInfo         &weights_info,
-                          const Size2D              &dilation,
-                          const ActivationLayerInfo &act_info,
-                          bool                       enable_fast_math,
-                          unsigned int               num_groups)
+Status validate_method(ConvolutionMethod          method,
+                       const ITensorInfo         *input,
+                       const ITensorInfo         *weights,
+                       const ITensorInfo         *biases,
+                       const ITensorInfo         *output,
+                       const PadStrideInfo       &conv_info,
+                       const WeightsInfo         &weights_info,
+                       const Size2D              &dilation,
+                       const ActivationLayerInfo &act_info,
+                       bool                       enable_fast_math)
 {
-    // Perform validate step
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
-                                                   act_info, enable_fast_math, num_groups));
-
-    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
-                           enable_fast_math, num_groups);
+    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+    switch (method)
+    {
+        case ConvolutionMethod::WINOGRAD:
+            ARM_COMPUTE_RETURN_ON_ERROR(
+                CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
+            break;
+        case ConvolutionMethod::GEMM:
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info,
+                                                                dilation, act_info, enable_fast_math));
+            break;
+        case ConvolutionMethod::GEMM_CONV2D:
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmDirectConv2d::validate(input, weights, biases, output, info));
+            break;
+        case ConvolutionMethod::DIRECT:
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info));
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported.");
+            break;
+    }
+    return Status{};
+}
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+std::unique_ptr<ICpuOperator> create_method(ConvolutionMethod          method,
+                                            ITensorInfo               *input,
+                                            ITensorInfo               *weights,
+                                            const ITensorInfo         *biases,
+                                            ITensorInfo               *output,
+                                            const PadStrideInfo       &conv_info,
+                                            const WeightsInfo         &weights_info,
+                                            const Size2D              &dilation,
+                                            const ActivationLayerInfo &act_info,
+                                            bool                       enable_fast_math)
+{
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
             auto f = std::make_unique<CpuWinogradConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM:
         {
             auto f = std::make_unique<CpuGemmConv2d>();
             f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM_CONV2D:
         {
             auto f = std::make_unique<CpuGemmDirectConv2d>();
-            f->configure(input, weights, biases, output, info);
-            _function = std::move(f);
-            break;
+            f->configure(input, weights, biases, output,
+                         Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, 1));
+            return f;
         }
         case ConvolutionMethod::DIRECT:
         {
             auto f = std::make_unique<CpuDirectConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         default:
             ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            return nullptr;
+    }
+}
+
+/** Unique identifier of a convolution configuration in the convolution tuner
+ *
+ * @return The convolution identifier
+ */
+std::string convolution_tuner_id(const ITensorInfo         *input,
+                                 const ITensorInfo         *weights,
+                                 const PadStrideInfo       &conv_info,
+                                 const Size2D              &dilation,
+                                 const ActivationLayerInfo &act_info,
+                                 bool                       enable_fast_math)
+{
+    const auto shape_to_string = [](const TensorShape &shape)
+    {
+        std::stringstream ss;
+        for (size_t d = 0; d < shape.num_dimensions(); ++d)
+        {
+            ss << (d == 0 ? "" : "x") << shape[d];
+        }
+        return ss.str();
+    };
+
+    std::stringstream ss;
+    ss << string_from_data_type(input->data_type()) << ";" << string_from_data_type(weights->data_type()) << ";"
+       << (input->data_layout() == DataLayout::NCHW ? "NCHW" : "NHWC") << ";" << shape_to_string(input->tensor_shape())
+       << ";" << shape_to_string(weights->tensor_shape()) << ";" << conv_info.stride().first << "x"
+       << conv_info.stride().second << ";" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x"
+       << conv_info.pad_top() << "x" << conv_info.pad_bottom() << ";" << dilation.x() << "x" << dilation.y() << ";"
+       << (act_info.enabled() ? static_cast<int>(act_info.activation()) : -1) << ";" << enable_fast_math << ";"
+       << cpuinfo::cpu_model_to_string(CPUInfo::get().get_cpu_model()) << ";" << NEScheduler::get().num_threads();
+    return ss.str();
+}
+
+/** Time the runs of a configured convolution on zero-initialised tensors
+ *
+ * @return The average duration of a run, excluding the warm-up run which also prepares the convolution.
+ */
+std::chrono::nanoseconds benchmark_method(ICpuOperator      &op,
+                                          const ITensorInfo *input,
+                                          const ITensorInfo *weights,
+                                          const ITensorInfo *biases,
+                                          const ITensorInfo *output)
+{
+    constexpr int num_runs = 3;
+
+    Tensor src;
+    Tensor wei;
+    Tensor bia;
+    Tensor dst;
+    for (auto &t : {std::make_pair(&src, input), std::make_pair(&wei, weights), std::make_pair(&bia, biases),
+                    std::make_pair(&dst, output)})
+    {
+        if (t.second != nullptr)
+        {
+            t.first->allocator()->init(TensorInfo(*t.second));
+            t.first->allocator()->allocate();
+            std::memset(t.first->buffer(), 0, t.first->info()->total_size());
+        }
+    }
+    ITensor    *bia_ptr   = biases != nullptr ? &bia : nullptr;
+    ITensorPack run_pack  = {{ACL_SRC_0, &src}, {ACL_SRC_1, &wei}, {ACL_SRC_2, bia_ptr}, {ACL_DST, &dst}};
+    ITensorPack prep_pack = {{ACL_SRC_1, &wei}, {ACL_SRC_2, bia_ptr}};
+
+    MemoryGroup memory_group;
+    auto        workspace = manage_workspace<Tensor>(op.workspace(), memory_group, run_pack, prep_pack);
+    ARM_COMPUTE_UNUSED(workspace);
+
+    // The weights prepared from the scratch tensors must not end up in the cache of prepared weights
+    {
+        CPPRuntimeContext benchmark_ctx = CPPRuntimeContext::get();
+        benchmark_ctx.set_weights_cache(nullptr);
+        CPPRuntimeContextScope benchmark_scope(&benchmark_ctx);
+        op.prepare(prep_pack);
+        op.run(run_pack);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_runs; ++i)
+    {
+        op.run(run_pack);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start) / num_runs;
+}
+
+/** Get the convolution tuner of the runtime context if it can handle a convolution
+ *
+ * @return The tuner, or nullptr if there is none or the convolution can't be tuned.
+ */
+CPPConvolutionTuner *
+convolution_tuner(const ITensorInfo *input, const ITensorInfo *output, const WeightsInfo &weights_info)
+{
+    CPPConvolutionTuner *tuner = CPPRuntimeContext::get().convolution_tuner();
+    // The output is not initialized yet when the convolution is an internal function of another layer, and only the
+    // GEMM method supports reshaped weights
+    if (tuner == nullptr || output->total_size() == 0 || weights_info.are_reshaped() || input->is_dynamic())
+    {
+        return nullptr;
     }
+    return tuner;
+}
+
+/** Look the method of a convolution up in the convolution tuner of the runtime context, if any
+ *
+ * @param[out] method Method found in the tuner's table.
+ *
+ * @return True if the tuner provided a valid method for the convolution.
+ */
+bool find_tuned_method(const ITensorInfo         *input,
+                       const ITensorInfo         *weights,
+                       const ITensorInfo         *output,
+                       const PadStrideInfo       &conv_info,
+                       const WeightsInfo         &weights_info,
+                       const Size2D              &dilation,
+                       const ActivationLayerInfo &act_info,
+                       bool                       enable_fast_math,
+                       ConvolutionMethod         &method)
+{
+    const CPPConvolutionTuner *tuner = convolution_tuner(input, output, weights_info);
+    if (tuner == nullptr)
+    {
+        return false;
+    }
+
+    const std::string conv_id =
+        convolution_tuner_id(input, weights, conv_info, dilation, act_info, enable_fast_math);
+    if (!tuner->find_method(conv_id, method))
+    {
+        return false;
+    }
+    if (bool(validate_method(method, input, weights, nullptr, output, conv_info, weights_info, dilation, act_info,
+                             enable_fast_math)))
+    {
+        return true;
+    }
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned method does not support convolution %s", conv_id.c_str());
+    return false;
+}
+} // namespace
+
+CpuConv2d::CpuConv2d() : _function()
+{
+}
+
+CpuConv2d::~CpuConv2d() = default;
+
+void CpuConv2d::configure(ITensorInfo               *input,
+                          ITensorInfo               *weights,
+                          const ITensorInfo         *biases,
+                          ITensorInfo               *output,
+                          const PadStrideInfo       &conv_info,
+                          const WeightsInfo         &weights_info,
+                          const Size2D              &dilation,
+                          const ActivationLayerInfo &act_info,
+                          bool                       enable_fast_math,
+                          unsigned int               num_groups)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_UNUSED(num_groups);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
+                                                   act_info, enable_fast_math, num_groups));
+
+    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                           enable_fast_math, num_groups);
+
+    tune_convolution_method(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                            enable_fast_math);
+    _function = create_method(CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info,
+                                                                dilation, act_info, enable_fast_math),
+                              input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                              enable_fast_math);
 
     _aux_mem = _function->workspace();
 }
@@ -116,28 +321,11 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
 {
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
-    {
-        case ConvolutionMethod::WINOGRAD:
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
-            break;
-        case ConvolutionMethod::GEMM:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info,
-                                                                dilation, act_info, enable_fast_math));
-            break;
-        case ConvolutionMethod::GEMM_CONV2D:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmDirectConv2d::validate(input, weights, biases, output, info));
-            break;
-        case ConvolutionMethod::DIRECT:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info));
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
-    }
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_method(CpuConv2d::get_convolution_method(input, weights, output, conv_info,
+                                                                                weights_info, dilation, act_info,
+                                                                                enable_fast_math),
+                                                input, weights, biases, output, conv_info, weights_info, dilation,
+                                                act_info, enable_fast_math));
 
     return Status{};
 }
@@ -152,7 +340,13 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
                                                     bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
+
+    ConvolutionMethod tuned_method{};
+    if (find_tuned_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math,
+                          tuned_method))
+    {
+        return tuned_method;
+    }
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -289,6 +483,68 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
     }
 }
 
+void CpuConv2d::tune_convolution_method(const ITensorInfo         *input,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *biases,
+                                        const ITensorInfo         *output,
+                                        const PadStrideInfo       &conv_info,
+                                        const WeightsInfo         &weights_info,
+                                        const Size2D              &dilation,
+                                        const ActivationLayerInfo &act_info,
+                                        bool                       enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    CPPConvolutionTuner *tuner = convolution_tuner(input, output, weights_info);
+    if (tuner == nullptr || !tuner->tune_new_convolutions())
+    {
+        return;
+    }
+
+    const std::string conv_id =
+        convolution_tuner_id(input, weights, conv_info, dilation, act_info, enable_fast_math);
+    ConvolutionMethod method{};
+    if (tuner->find_method(conv_id, method))
+    {
+        return;
+    }
+
+    bool                     found     = false;
+    std::chrono::nanoseconds best_time = std::chrono::nanoseconds::max();
+    for (const ConvolutionMethod candidate : tunable_methods)
+    {
+        if (!bool(validate_method(candidate, input, weights, biases, output, conv_info, weights_info, dilation,
+                                  act_info, enable_fast_math)))
+        {
+            continue;
+        }
+
+        // The bias addition is part of the run of most methods, so the convolution is timed with its bias if any
+        TensorInfo src_info(*input);
+        TensorInfo wei_info(*weights);
+        TensorInfo bia_info = biases != nullptr ? TensorInfo(*biases) : TensorInfo();
+        TensorInfo dst_info(*output);
+        const auto bia_ptr = biases != nullptr ? &bia_info : nullptr;
+        auto       op      = create_method(candidate, &src_info, &wei_info, bia_ptr, &dst_info, conv_info,
+                                           weights_info, dilation, act_info, enable_fast_math);
+
+        const std::chrono::nanoseconds time = benchmark_method(*op, &src_info, &wei_info, bia_ptr, &dst_info);
+        if (time < best_time)
+        {
+            method    = candidate;
+            best_time = time;
+            found     = true;
+        }
+    }
+
+    if (found)
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned method of convolution %s: %d", conv_id.c_str(),
+                                                  static_cast<int>(method));
+        tuner->add_method(conv_id, method);
+    }
+}
+
 void CpuConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
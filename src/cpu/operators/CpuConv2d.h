@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -135,6 +135,9 @@ public:
                            bool                       enable_fast_math = false,
                            unsigned int               num_groups       = 1);
     /** Static function to check if given info will return the convolution called by @ref CpuConv2d
+     *
+     * @note If a @ref CPPConvolutionTuner is set on the runtime context, the method of its table is returned instead of
+     *       the one of the heuristics. The function never benchmarks: see @ref tune_convolution_method.
      *
      * @param[in] src              Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
@@ -161,6 +164,32 @@ public:
                                                     const Size2D              &dilation         = Size2D(1U, 1U),
                                                     const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                                                     bool                       enable_fast_math = false);
+    /** Benchmark the methods supporting a convolution missing from the table of the convolution tuner
+     *
+     * Every method supporting the convolution is configured and timed on scratch tensors, with a bias if @p biases is
+     * set, and the fastest one is added to the table of the @ref CPPConvolutionTuner of the runtime context. Does
+     * nothing if there is no tuner, if it doesn't tune new convolutions or if the convolution is in its table already.
+     * Called when configuring the convolutions, before their method is selected.
+     *
+     * @param[in] src              Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] weights          Weights tensor info. Data type supported: Same as @p src, also could be QSYMM8_PER_CHANNEL or QASYMM8_SIGNED if input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] biases           Biases tensor info. Can be nullptr.
+     * @param[in] dst              Destination tensor info. Data types supported: Same as @p src.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     (Optional) Specifies if the weights tensor has been reshaped. Reshaped weights are not tuned.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. Default is false
+     */
+    static void tune_convolution_method(const ITensorInfo         *src,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *biases,
+                                        const ITensorInfo         *dst,
+                                        const PadStrideInfo       &conv_info,
+                                        const WeightsInfo         &weights_info     = WeightsInfo(),
+                                        const Size2D              &dilation         = Size2D(1U, 1U),
+                                        const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                                        bool                       enable_fast_math = false);
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024 Arm Limited.
+ * Copyright (c) 2019-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 #include "src/cpu/operators/CpuDepthwiseConv2dAssemblyDispatch.h"
 
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -33,6 +35,8 @@
 #include "src/core/utils/AssemblyUtils.h"
 #include "src/cpu/kernels/internal/CpuDepthwiseConv2dAssemblyWrapperKernel.h"
 
+#include <sstream>
+
 namespace arm_compute
 {
 namespace cpu
@@ -43,6 +47,7 @@ struct CpuDepthwiseConv2dAssemblyDispatch::LocalImpl
     bool                                                              is_prepared{false};
     bool                                                              are_weights_const{true};
     experimental::MemoryRequirements                                  mem_req{};
+    std::string                                                       weights_config{};
 };
 
 #ifndef DOXYGEN_SKIP_THIS
@@ -80,6 +85,21 @@ void CpuDepthwiseConv2dAssemblyDispatch::configure(const ITensorInfo     *src,
     _pImpl->mem_req.push_back({TensorType::ACL_INT_0, dwc_wrapper->get_working_size(num_threads), alignment});
     _pImpl->mem_req.push_back({TensorType::ACL_INT_1, dwc_wrapper->get_storage_size(), alignment});
     _pImpl->asm_kernel = std::move(dwc_wrapper);
+
+    // The requantization of the quantized kernels is partly folded into the packed parameters
+    const ITensorInfo *quantized_infos[] = {src, weights, dst};
+    std::stringstream  weights_config;
+    weights_config << info.depth_multiplier;
+    for (const ITensorInfo *tensor_info : quantized_infos)
+    {
+        const QuantizationInfo &qinfo = tensor_info->quantization_info();
+        weights_config << ";" << qinfo.uniform().offset;
+        for (const float scale : qinfo.scale())
+        {
+            weights_config << "," << scale;
+        }
+    }
+    _pImpl->weights_config = weights_config.str();
 }
 
 Status CpuDepthwiseConv2dAssemblyDispatch::validate(const ITensorInfo     *src,
@@ -129,13 +149,32 @@ void CpuDepthwiseConv2dAssemblyDispatch::prepare(ITensorPack &tensors)
         const auto bias_ptr       = (bias) ? bias->buffer() + bias->info()->offset_first_element_in_bytes() : nullptr;
         auto       parameters_ptr = storage->buffer() + storage->info()->offset_first_element_in_bytes();
 
-        const auto weights_shape   = weights->info()->tensor_shape();
-        const auto weights_padding = weights->info()->padding();
+        // Constant parameters packed by a previous run can be copied from the weights cache
+        CPPWeightsCache *weights_cache = _pImpl->are_weights_const ? CPPRuntimeContext::get().weights_cache() : nullptr;
+        std::string      weights_id{};
+        if (weights_cache != nullptr)
+        {
+            weights_id = CPPWeightsCache::weights_id(_pImpl->asm_kernel->name(), _pImpl->weights_config,
+                                                     {weights, bias}, NEScheduler::get().cpu_info());
+        }
 
-        const size_t ld_weights_col = weights_shape[0] + weights_padding.left + weights_padding.right;
-        const size_t ld_weights_row =
-            ld_weights_col * (weights_shape[1] + weights_padding.top + weights_padding.bottom);
-        _pImpl->asm_kernel->pack_parameters(parameters_ptr, bias_ptr, weights_ptr, ld_weights_col, ld_weights_row);
+        const size_t storage_size = _pImpl->asm_kernel->get_storage_size();
+        if (weights_cache == nullptr || !weights_cache->find_weights(weights_id, parameters_ptr, storage_size))
+        {
+            const auto weights_shape   = weights->info()->tensor_shape();
+            const auto weights_padding = weights->info()->padding();
+
+            const size_t ld_weights_col = weights_shape[0] + weights_padding.left + weights_padding.right;
+            const size_t ld_weights_row =
+                ld_weights_col * (weights_shape[1] + weights_padding.top + weights_padding.bottom);
+            _pImpl->asm_kernel->pack_parameters(parameters_ptr, bias_ptr, weights_ptr, ld_weights_col,
+                                                ld_weights_row);
+
+            if (weights_cache != nullptr && weights_cache->store_new_weights())
+            {
+                weights_cache->add_weights(weights_id, parameters_ptr, storage_size);
+            }
+        }
 
         weights->mark_as_unused();
         if (bias != nullptr)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,12 +34,15 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/kernels/CpuMatMulQsi4Kernel.h"
+#include "src/cpu/kernels/CpuMatMulQsi8Kernel.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
 #include "src/cpu/operators/CpuFlatten.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuParallelRegion.h"
 
 namespace arm_compute
 {
@@ -125,6 +128,56 @@ Status validate_mm(const ITensorInfo         *src,
 
     return Status{};
 }
+
+bool is_fc_after_conv_layer(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    // Check if we have a fully connected layer with batches
+    const bool is_batched_fc_layer = dst->dimension(1) > 1;
+    if (is_batched_fc_layer)
+    {
+        return (TensorShape::num_max_dimensions >= 4) &&
+               (std::equal(src->tensor_shape().cbegin() + 3, src->tensor_shape().cend(),
+                           dst->tensor_shape().cbegin() + 1));
+    }
+    return src->num_dimensions() > 1;
+}
+
+bool is_dynamic_quantization(const ITensorInfo *src, const ITensorInfo *weights)
+{
+    return is_data_type_quantized_4bit(weights->data_type()) ||
+           (src->data_type() == DataType::F32 && weights->data_type() == DataType::QSYMM8_PER_CHANNEL);
+}
+
+Status validate_dynamic_quantization(const ITensorInfo             *src,
+                                     const ITensorInfo             *weights,
+                                     const ITensorInfo             *biases,
+                                     const ITensorInfo             *dst,
+                                     const FullyConnectedLayerInfo &fc_info,
+                                     const WeightsInfo             &weights_info)
+{
+    const bool is_qsi4 = is_data_type_quantized_4bit(weights->data_type());
+    const bool adj_rhs = fc_info.transpose_weights && !fc_info.are_weights_reshaped;
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_qsi4 && !adj_rhs, "4-bit weights are only supported in their original layout");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_info.weight_format() != WeightFormat::UNSPECIFIED);
+
+    const ITensorInfo *src_to_use = src;
+    TensorInfo         flatten_src;
+    if (is_fc_after_conv_layer(src, dst))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != fc_info.weights_trained_layout,
+                                        "Quantized weights can not be converted to another data layout");
+        flatten_src = src->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_flatten_shape(src));
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuFlatten::validate(src, &flatten_src));
+        src_to_use = &flatten_src;
+    }
+
+    if (is_qsi4)
+    {
+        return kernels::CpuMatMulQsi4Kernel::validate(src_to_use, weights, biases, dst, fc_info.activation_info);
+    }
+    return kernels::CpuMatMulQsi8Kernel::validate(src_to_use, weights, biases, dst, adj_rhs, fc_info.activation_info);
+}
 } // namespace
 
 CpuFullyConnected::CpuFullyConnected()
@@ -133,16 +186,21 @@ CpuFullyConnected::CpuFullyConnected()
       _transpose_weights(nullptr),
       _mm_gemm(nullptr),
       _mm_gemmlowp(nullptr),
+      _mm_qsi4(nullptr),
+      _mm_qsi8(nullptr),
       _flattened_src(),
       _converted_weights(),
       _reshaped_weights(),
       _trans_weights(),
+      _packed_weights(),
       _trans_weights_idx(AuxTensorIdx::Count),
       _aux_mem(Count),
       _needs_weights_conversion(false),
       _needs_weights_reshape(false),
       _is_fc_after_conv(false),
       _is_quantized_asymmetric(false),
+      _is_dynamic_quantization(false),
+      _is_qsi4(false),
       _is_prepared(false),
       _enable_fast_math(false),
       _fixed_format(false),
@@ -197,6 +255,62 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
     }
 }
 
+void CpuFullyConnected::configure_dynamic_quantization(const ITensorInfo             *src,
+                                                       const ITensorInfo             *weights,
+                                                       const ITensorInfo             *biases,
+                                                       ITensorInfo                   *dst,
+                                                       const FullyConnectedLayerInfo &fc_info)
+{
+    const ITensorInfo *src_to_use = src;
+    if (_is_fc_after_conv)
+    {
+        auto_init_if_empty(_flattened_src, src->clone()->set_tensor_shape(compute_flatten_shape(src)));
+
+        _flatten = std::make_unique<CpuFlatten>();
+        _flatten->configure(src, &_flattened_src);
+        src_to_use = &_flattened_src;
+    }
+
+    size_t packed_size = 0;
+    if (_is_qsi4)
+    {
+        _mm_qsi4 = std::make_unique<kernels::CpuMatMulQsi4Kernel>();
+        _mm_qsi4->configure(src_to_use, weights, biases, dst, fc_info.activation_info);
+        packed_size = kernels::CpuMatMulQsi4Kernel::size_of_packed_rhs(src_to_use, weights);
+    }
+    else
+    {
+        const bool adj_rhs = fc_info.transpose_weights && !fc_info.are_weights_reshaped;
+        _mm_qsi8           = std::make_unique<kernels::CpuMatMulQsi8Kernel>();
+        _mm_qsi8->configure(src_to_use, weights, biases, dst, adj_rhs, fc_info.activation_info);
+        packed_size = kernels::CpuMatMulQsi8Kernel::size_of_packed_rhs(src_to_use, weights, adj_rhs);
+    }
+
+    // The weights are packed by the kernel instead of being transposed or converted.
+    // Non-constant weights are packed again on every run.
+    _needs_weights_reshape = false;
+    _packed_weights        = TensorInfo(TensorShape(packed_size), 1, DataType::U8);
+
+    _aux_mem[PackedWeights] = MemoryInfo(offset_int_vec(PackedWeights),
+                                         weights->are_values_constant() ? MemoryLifetime::Persistent
+                                                                        : MemoryLifetime::Temporary,
+                                         _packed_weights.total_size());
+    _aux_mem[FlattenedSrc] =
+        MemoryInfo(offset_int_vec(FlattenedSrc), MemoryLifetime::Temporary, _flattened_src.total_size());
+}
+
+void CpuFullyConnected::pack_weights(const ITensor *weights, ITensor *packed_weights) const
+{
+    if (_is_qsi4)
+    {
+        _mm_qsi4->pack_rhs(weights, packed_weights);
+    }
+    else
+    {
+        _mm_qsi8->pack_rhs(weights, packed_weights);
+    }
+}
+
 void CpuFullyConnected::configure_conv_fc(const ITensorInfo         *src,
                                           const ITensorInfo         *weights,
                                           const ITensorInfo         *biases,
@@ -242,10 +356,11 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
         CpuFullyConnected::validate(src, weights, biases != nullptr ? biases : nullptr, dst, fc_info, weights_info));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
 
+    _is_dynamic_quantization  = is_dynamic_quantization(src, weights);
+    _is_qsi4                  = is_data_type_quantized_4bit(weights->data_type());
     _needs_weights_conversion = false;
     _needs_weights_reshape    = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
     _needs_weights_reshape    = _needs_weights_reshape && !fc_info.retain_internal_weights;
-    _is_fc_after_conv         = true;
     _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(src->data_type());
     _is_prepared              = false;
     _trans_weights_idx        = AuxTensorIdx::Count;
@@ -253,6 +368,7 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     _weight_format            = weights_info.weight_format();
     _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
+    _is_fc_after_conv         = is_fc_after_conv_layer(src, dst);
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -260,21 +376,14 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     //  3) Convolution layer -> Fully Connected layer with batches
     //  4) Fully Connected layer -> Fully Connected layer with batches
 
-    const ITensorInfo *weights_to_use = weights;
-
-    // Check if we have a fully connected layer with batches
-    const bool is_batched_fc_layer = dst->dimension(1) > 1;
-    if (is_batched_fc_layer)
+    if (_is_dynamic_quantization)
     {
-        _is_fc_after_conv = (TensorShape::num_max_dimensions >= 4) &&
-                            (std::equal(src->tensor_shape().cbegin() + 3, src->tensor_shape().cend(),
-                                        dst->tensor_shape().cbegin() + 1));
-    }
-    else
-    {
-        _is_fc_after_conv = src->num_dimensions() > 1;
+        configure_dynamic_quantization(src, weights, biases, dst, fc_info);
+        return;
     }
 
+    const ITensorInfo *weights_to_use = weights;
+
     // Reshape weights if needed
     if (_needs_weights_reshape)
     {
@@ -384,6 +493,11 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     ARM_COMPUTE_UNUSED(fc_info.retain_internal_weights);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
 
+    if (is_dynamic_quantization(src, weights))
+    {
+        return validate_dynamic_quantization(src, weights, biases, dst, fc_info, weights_info);
+    }
+
     if (is_fixed_format(weights_info.weight_format()))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
@@ -413,8 +527,8 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         fc_info.activation_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
         fc_info.activation_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
 
-    bool weights_reshaped = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
-    bool is_fc_after_conv = true;
+    bool       weights_reshaped = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
+    const bool is_fc_after_conv = is_fc_after_conv_layer(src, dst);
 
     const ITensorInfo &flatten_src =
         TensorInfo(src->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_flatten_shape(src)));
@@ -433,9 +547,6 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     const ITensorInfo *src_to_use     = src;
     const ITensorInfo *weights_to_use = weights;
 
-    // Check if we have a fully connected layer with batches
-    const bool is_batched_fc_layer = dst->dimension(1) > 1;
-
     if (biases != nullptr)
     {
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
@@ -449,17 +560,6 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         }
     }
 
-    if (is_batched_fc_layer)
-    {
-        is_fc_after_conv = (TensorShape::num_max_dimensions >= 4) &&
-                           (std::equal(src->tensor_shape().cbegin() + 3, src->tensor_shape().cend(),
-                                       dst->tensor_shape().cbegin() + 1));
-    }
-    else
-    {
-        is_fc_after_conv = src->num_dimensions() > 1;
-    }
-
     if (!weights_reshaped)
     {
         // Validate reshape weights kernel
@@ -499,6 +599,9 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
 
 void CpuFullyConnected::run(ITensorPack &tensors)
 {
+    // Flatten and gemm run in a single parallel region
+    CpuParallelRegion region;
+
     prepare(tensors);
 
 #ifdef ARM_COMPUTE_ASSERTS_ENABLED
@@ -526,7 +629,27 @@ void CpuFullyConnected::run(ITensorPack &tensors)
     }
 
     // Run matrix multiply
-    if (_is_quantized_asymmetric)
+    if (_is_dynamic_quantization)
+    {
+        auto                weights = tensors.get_const_tensor(ACL_SRC_1);
+        CpuAuxTensorHandler packed_wei(offset_int_vec(PackedWeights), _packed_weights, tensors, false);
+        if (!weights->info()->are_values_constant())
+        {
+            pack_weights(weights, packed_wei.get());
+        }
+        gemm_pack.add_const_tensor(ACL_SRC_1, packed_wei.get());
+        if (_is_qsi4)
+        {
+            NEScheduler::get().schedule_op(_mm_qsi4.get(), _mm_qsi4->get_split_dimension_hint(), _mm_qsi4->window(),
+                                           gemm_pack);
+        }
+        else
+        {
+            NEScheduler::get().schedule_op(_mm_qsi8.get(), _mm_qsi8->get_split_dimension_hint(), _mm_qsi8->window(),
+                                           gemm_pack);
+        }
+    }
+    else if (_is_quantized_asymmetric)
     {
         _mm_gemmlowp->run(gemm_pack);
     }
@@ -547,6 +670,19 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
 
         auto weights = tensors.get_const_tensor(ACL_SRC_1);
 
+        if (_is_dynamic_quantization)
+        {
+            // Non-constant weights are packed on every run instead
+            if (weights->info()->are_values_constant())
+            {
+                CpuAuxTensorHandler packed_wei(offset_int_vec(PackedWeights), _packed_weights, tensors, false);
+                pack_weights(weights, packed_wei.get());
+                weights->mark_as_unused();
+            }
+            _is_prepared = true;
+            return;
+        }
+
         CpuAuxTensorHandler reshaped_weights(offset_int_vec(TransposedWeights), _reshaped_weights, tensors, false);
         CpuAuxTensorHandler converted_weights(offset_int_vec(ConvertedWeights), _converted_weights, tensors, false);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,8 @@ class CpuGemm;
 class CpuGemmLowpMatrixMultiplyCore;
 namespace kernels
 {
+class CpuMatMulQsi4Kernel;
+class CpuMatMulQsi8Kernel;
 class CpuTransposeKernel;
 } // namespace kernels
 /** Basic function to compute a Fully Connected layer. This function calls the following kernels:
@@ -49,6 +51,8 @@ class CpuTransposeKernel;
  *  -# @ref kernels::CpuTransposeKernel (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
  *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric)
  *  -# @ref kernels::CpuGemmMatrixAdditionKernel or @ref CpuGemmLowpOutputStage (if quantized asymmetric) (if @p biases is not equal to nullptr)
+ *  -# @ref kernels::CpuMatMulQsi4Kernel (if the weights are 4-bit symmetric)
+ *  -# @ref kernels::CpuMatMulQsi8Kernel (if @p src is F32 and the weights are QSYMM8_PER_CHANNEL)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
  */
@@ -70,6 +74,9 @@ public:
      * |:--------------|:------------------|:------|:--------------|
      * |F16            |F16                |F16    |F16            |
      * |F32            |F32                |F32    |F32            |
+     * |F32            |QSYMM4_PER_CHANNEL |F32    |F32            |
+     * |F32            |QSYMM4_PER_BLOCK   |F32    |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      *
@@ -77,8 +84,10 @@ public:
      * @param[in]  weights      Weights tensor info. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p src.
-     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                          Data type supported: Same as @p src, QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL if @p src is F32.
+     *                          4-bit weights must not be transposed nor reshaped, see @ref kernels::CpuMatMulQsi4Kernel for their layout.
+     *                          With QSYMM8_PER_CHANNEL weights, @p src is quantized to 8-bit per row at run time.
+     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p src if @p weights is QSYMM4_PER_CHANNEL/QSYMM4_PER_BLOCK/QSYMM8_PER_CHANNEL, same as @p weights otherwise, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] dst          Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -140,6 +149,12 @@ private:
                       const ITensorInfo         *biases,
                       ITensorInfo               *dst,
                       const ActivationLayerInfo &act);
+    void configure_dynamic_quantization(const ITensorInfo             *src,
+                                        const ITensorInfo             *weights,
+                                        const ITensorInfo             *biases,
+                                        ITensorInfo                   *dst,
+                                        const FullyConnectedLayerInfo &fc_info);
+    void pack_weights(const ITensor *weights, ITensor *packed_weights) const;
 
     enum AuxTensorIdx
     {
@@ -157,6 +172,7 @@ private:
         TransposedWeights,
         ConvertedWeights,
         FlattenedSrc,
+        PackedWeights,
         Count
     };
 
@@ -165,11 +181,14 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel>     _transpose_weights;
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
+    std::unique_ptr<kernels::CpuMatMulQsi4Kernel>    _mm_qsi4;
+    std::unique_ptr<kernels::CpuMatMulQsi8Kernel>    _mm_qsi8;
 
     TensorInfo   _flattened_src;
     TensorInfo   _converted_weights;
     TensorInfo   _reshaped_weights;
     TensorInfo   _trans_weights;
+    TensorInfo   _packed_weights;
     AuxTensorIdx _trans_weights_idx;
 
     experimental::MemoryRequirements _aux_mem;
@@ -178,6 +197,8 @@ private:
     bool                      _needs_weights_reshape;
     bool                      _is_fc_after_conv;
     bool                      _is_quantized_asymmetric;
+    bool                      _is_dynamic_quantization;
+    bool                      _is_qsi4;
     bool                      _is_prepared;
     bool                      _enable_fast_math;
     bool                      _fixed_format;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuParallelRegion.h"
 
 using namespace arm_compute::experimental;
 using namespace arm_compute::misc::shape_calculator;
@@ -221,12 +222,14 @@ Status CpuGemm::validate(const ITensorInfo *a,
 {
     ARM_COMPUTE_UNUSED(alpha);
     // When using accumulation(in place summation), for now, the only supported values for alpha and beta are 1 respectively 0.
+    // The only exception is a bias vector c with beta equal to 1, which the optimized GEMM adds to d before accumulating.
     // Do the appropriate checks before proceeding.
     if (gemm_info.accumulate())
     {
+        const bool is_c_bias_vector = c != nullptr && beta == 1 && c->num_dimensions() == 1;
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha != 1, "Accumulation is not supported when alpha is different from 1");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(
-            (beta != 0 && c != nullptr),
+            (beta != 0 && c != nullptr && !is_c_bias_vector),
             "Accumulation is not supported when beta is different from 0 with a non-null bias matrix c");
     }
 
@@ -336,6 +339,8 @@ Status CpuGemm::validate(const ITensorInfo *a,
 
     if (!run_optimised)
     {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(),
+                                        "Accumulation is only supported by the optimized assembly GEMM");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(),
                                         "CpuGemm cannot reinterpret the input tensor as 3D");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.depth_output_gemm3d() != 0,
@@ -413,6 +418,9 @@ Status CpuGemm::validate(const ITensorInfo *a,
 
 void CpuGemm::run(ITensorPack &tensors)
 {
+    // The interleave, transpose, multiply and addition kernels share a single parallel region
+    CpuParallelRegion region;
+
     prepare(tensors);
 
     auto a = tensors.get_const_tensor(ACL_SRC_0);
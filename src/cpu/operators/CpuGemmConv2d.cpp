@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,7 @@
 #include "src/cpu/operators/CpuGemmLowpOutputStage.h"
 #include "src/cpu/operators/CpuReshape.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuParallelRegion.h"
 
 #include <set>
 #include <tuple>
@@ -227,6 +228,7 @@ CpuGemmConv2d::CpuGemmConv2d()
       _is_prepared(false),
       _wt_method(WeightTransformMethod::ReshapeThenTranspose),
       _run_wt(true),
+      _accumulate(false),
       _act_info(),
       _aux_mem(AuxTensorIdx::Count)
 {
@@ -241,11 +243,12 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
                                  bool                       enable_fast_math,
                                  int                        gemm_3d_depth,
                                  bool                       fixed_format,
-                                 arm_compute::WeightFormat  weight_format)
+                                 arm_compute::WeightFormat  weight_format,
+                                 bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights);
     ARM_COMPUTE_ERROR_THROW_ON(validate_mm(src, weights, biases, dst, act_info, enable_fast_math, gemm_3d_depth,
-                                           _skip_im2col, fixed_format, weight_format));
+                                           _skip_im2col, fixed_format, weight_format, accumulate));
 
     // Supported activations in GEMM
     const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = {
@@ -316,7 +319,8 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
                      _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
-                     flag is ignored)*/);
+                     flag is ignored)*/,
+                     accumulate);
         // Configure matrix multiply function
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -337,7 +341,8 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
                                   int                        gemm_3d_depth,
                                   bool                       skip_im2col,
                                   bool                       fixed_format,
-                                  arm_compute::WeightFormat  weight_format)
+                                  arm_compute::WeightFormat  weight_format,
+                                  bool                       accumulate)
 {
     const DataType data_type             = src->data_type();
     const bool     is_quantized          = is_data_type_quantized_asymmetric(data_type);
@@ -394,7 +399,8 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
                      skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
-                     flag is ignored)*/);
+                     flag is ignored)*/,
+                     accumulate);
 
         // Perform validation step on Matrix multiply function
         return CpuGemm::validate(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -431,14 +437,15 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
                               const Size2D              &dilation,
                               const ActivationLayerInfo &act_info,
                               bool                       enable_fast_math,
-                              unsigned int               num_groups)
+                              unsigned int               num_groups,
+                              bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
     ARM_COMPUTE_UNUSED(num_groups, weights_info);
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemmConv2d::validate(src, weights, biases, dst, conv_info, weights_info, dilation,
-                                                       act_info, enable_fast_math, num_groups));
+                                                       act_info, enable_fast_math, num_groups, accumulate));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, weights_info, dilation, act_info, enable_fast_math,
-                           num_groups);
+                           num_groups, accumulate);
 
     const DataType   data_type   = src->data_type();
     const DataLayout data_layout = src->data_layout();
@@ -452,6 +459,7 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
 
     _is_prepared  = weights_info.retain_internal_weights();
     _is_quantized = is_data_type_quantized_asymmetric(src->data_type());
+    _accumulate   = accumulate;
     _data_layout  = data_layout;
     _skip_im2col  = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 &&
                     conv_info.stride().first == 1 && conv_info.stride().second == 1);
@@ -561,8 +569,9 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
      *           1. Either expose isVarWeightsKernel() before gemm is configured somehow, or
      *           2. Take in an additional "original_weights" tensor info at configure
      */
+    // When accumulating, the assembly kernels add the bias to the destination block by block before accumulating into it
     configure_mm(gemm_input_to_use, &_weights_reshaped, biases, gemm_output_to_use, act_info, enable_fast_math,
-                 gemm_3d_depth, fixed_format, weights_info.weight_format());
+                 gemm_3d_depth, fixed_format, weights_info.weight_format(), accumulate);
 
     // Can only decide isVarWeightsKernel after gemm is configured
     _run_wt = !isVarWeightsKernel();
@@ -663,7 +672,8 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
                                const Size2D              &dilation,
                                const ActivationLayerInfo &act_info,
                                bool                       enable_fast_math,
-                               unsigned int               num_groups)
+                               unsigned int               num_groups,
+                               bool                       accumulate)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
@@ -791,9 +801,19 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
     const bool fixed_format = weights_info.weight_format() != arm_compute::WeightFormat::UNSPECIFIED;
 
     // See note_CpuGemmConv2d_weight_use_in_configure regarding the choice of the weights
+    if (accumulate)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!skip_col2im,
+                                        "Accumulation requires the GEMM to write straight to the destination (NHWC)");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0,
+                                        "The destination must be initialized to accumulate into it");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
+
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info,
                                             enable_fast_math, skip_col2im ? conv_h : 0, skip_im2col, fixed_format,
-                                            weights_info.weight_format()));
+                                            weights_info.weight_format(), accumulate));
 
     // Validate Col2Im/ReshapeLayer
     if (!skip_col2im && (data_layout == DataLayout::NCHW))
@@ -859,6 +879,9 @@ void CpuGemmConv2d::update_quantization_parameters(ITensorPack &tensors)
 
 void CpuGemmConv2d::run(ITensorPack &tensors)
 {
+    // im2col, gemm and col2im are dispatched back to back: keep the thread pool awake in between
+    CpuParallelRegion region;
+
     prepare(tensors);
 
     auto src               = tensors.get_const_tensor(ACL_SRC_0);
@@ -902,6 +925,9 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
         gemm_output_to_use = dst;
     }
 
+    ARM_COMPUTE_ERROR_ON_MSG(_accumulate && out_has_padding,
+                             "Cannot accumulate into a destination with top/bottom padding");
+
     ITensorPack gemm_pack = tensors;
     gemm_pack.add_const_tensor(TensorType::ACL_SRC_0, gemm_input_to_use);
     gemm_pack.add_tensor(TensorType::ACL_DST, gemm_output_to_use);
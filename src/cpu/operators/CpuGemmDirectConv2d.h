@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -69,6 +69,8 @@ public:
      * @param[in] dst     Destination tensor info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                    Data types supported: Same as @p input.
      * @param[in] info    Contains padding and stride information described in @ref PadStrideInfo.
+     *                    If @ref Conv2dInfo::accumulate is set, @p dst must hold the values to accumulate into
+     *                    (e.g. a residual branch): dst = act(dst + conv(src) + biases). Only F16/F32 are supported.
      */
     void configure(const ITensorInfo *src,
                    const ITensorInfo *weights,
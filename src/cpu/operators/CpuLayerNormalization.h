@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
+#define ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
+
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuLayerNormalizationKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuLayerNormalizationKernel */
+class CpuLayerNormalization : public ICpuOperator
+{
+public:
+    /** Initialize the operator's inputs and outputs.
+     *
+     * Similar to @ref NELayerNormalizationLayer::configure()
+     *
+     */
+    void configure(const ITensorInfo            *src,
+                   const ITensorInfo            *residual,
+                   const ITensorInfo            *gamma,
+                   const ITensorInfo            *beta,
+                   ITensorInfo                  *add_output,
+                   ITensorInfo                  *dst,
+                   const LayerNormalizationInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuLayerNormalization::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *src,
+                           const ITensorInfo            *residual,
+                           const ITensorInfo            *gamma,
+                           const ITensorInfo            *beta,
+                           const ITensorInfo            *add_output,
+                           const ITensorInfo            *dst,
+                           const LayerNormalizationInfo &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<kernels::CpuLayerNormalizationKernel> _kernel{nullptr};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPULAYERNORMALIZATION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,29 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
 
     return Status{};
 }
+
+Status validate_qsi4(const ITensorInfo         *lhs,
+                     const ITensorInfo         *rhs,
+                     const ITensorInfo         *dst,
+                     const MatMulInfo          &info,
+                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs(), "Transposed LHS is not supported with 4-bit RHS");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.adj_rhs(), "4-bit RHS must be transposed, with K as its first dimension");
+    return kernels::CpuMatMulQsi4Kernel::validate(lhs, rhs, nullptr, dst, act_info);
+}
+
+Status validate_qsi8(const ITensorInfo         *lhs,
+                     const ITensorInfo         *rhs,
+                     const ITensorInfo         *dst,
+                     const MatMulInfo          &info,
+                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs(), "Transposed LHS is not supported with 8-bit per-channel RHS");
+    return kernels::CpuMatMulQsi8Kernel::validate(lhs, rhs, nullptr, dst, info.adj_rhs(), act_info);
+}
 } // namespace
 
 CpuMatMul::CpuMatMul()
@@ -101,6 +124,15 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                            const CpuMatMulSettings   &settings,
                            const ActivationLayerInfo &act_info)
 {
+    if (is_data_type_quantized_4bit(rhs->data_type()))
+    {
+        return validate_qsi4(lhs, rhs, dst, info, act_info);
+    }
+    if (lhs->data_type() == DataType::F32 && rhs->data_type() == DataType::QSYMM8_PER_CHANNEL)
+    {
+        return validate_qsi8(lhs, rhs, dst, info, act_info);
+    }
+
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
                                                          DataType::QASYMM8, DataType::QASYMM8_SIGNED);
@@ -184,11 +216,44 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
     ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, info, settings);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings));
+    ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings, act_info));
 
-    _adj_lhs   = info.adj_lhs();
-    _adj_rhs   = info.adj_rhs();
-    _fast_math = settings.fast_math();
+    _adj_lhs       = info.adj_lhs();
+    _adj_rhs       = info.adj_rhs();
+    _fast_math     = settings.fast_math();
+    _is_qsi4       = is_data_type_quantized_4bit(rhs->data_type());
+    _is_qsi8       = lhs->data_type() == DataType::F32 && rhs->data_type() == DataType::QSYMM8_PER_CHANNEL;
+    _is_rhs_packed = false;
+
+    if (_is_qsi4)
+    {
+        // The transposed rhs already is in the layout expected by the kernel: it is only packed, once if constant
+        _qsi4_kernel = std::make_unique<kernels::CpuMatMulQsi4Kernel>();
+        _qsi4_kernel->configure(lhs, rhs, nullptr, dst, act_info);
+
+        _rhs_packed =
+            TensorInfo(TensorShape(kernels::CpuMatMulQsi4Kernel::size_of_packed_rhs(lhs, rhs)), 1, DataType::U8);
+        _aux_mem[PackedRHS] =
+            MemoryInfo(offset_int_vec(PackedRHS),
+                       rhs->are_values_constant() ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                       _rhs_packed.total_size());
+        return;
+    }
+
+    if (_is_qsi8)
+    {
+        // Either layout of rhs is packed by the kernel, once if constant
+        _qsi8_kernel = std::make_unique<kernels::CpuMatMulQsi8Kernel>();
+        _qsi8_kernel->configure(lhs, rhs, nullptr, dst, _adj_rhs, act_info);
+
+        _rhs_packed = TensorInfo(TensorShape(kernels::CpuMatMulQsi8Kernel::size_of_packed_rhs(lhs, rhs, _adj_rhs)), 1,
+                                 DataType::U8);
+        _aux_mem[PackedRHS] =
+            MemoryInfo(offset_int_vec(PackedRHS),
+                       rhs->are_values_constant() ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                       _rhs_packed.total_size());
+        return;
+    }
 
     // 1. Create and reshape tensors
     // ------------------------------------------------------
@@ -289,6 +354,40 @@ void CpuMatMul::run(ITensorPack &tensors)
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
     auto dst = tensors.get_tensor(ACL_DST);
 
+    if (_is_qsi4)
+    {
+        CpuAuxTensorHandler rhs_packed(offset_int_vec(PackedRHS), _rhs_packed, tensors, false);
+        if (!_is_rhs_packed)
+        {
+            _qsi4_kernel->pack_rhs(rhs, rhs_packed.get());
+            _is_rhs_packed = rhs->info()->are_values_constant();
+        }
+
+        ITensorPack qsi4_tensors{{TensorType::ACL_SRC_0, lhs},
+                                 {TensorType::ACL_SRC_1, rhs_packed.get()},
+                                 {TensorType::ACL_DST, dst}};
+        NEScheduler::get().schedule_op(_qsi4_kernel.get(), _qsi4_kernel->get_split_dimension_hint(),
+                                       _qsi4_kernel->window(), qsi4_tensors);
+        return;
+    }
+
+    if (_is_qsi8)
+    {
+        CpuAuxTensorHandler rhs_packed(offset_int_vec(PackedRHS), _rhs_packed, tensors, false);
+        if (!_is_rhs_packed)
+        {
+            _qsi8_kernel->pack_rhs(rhs, rhs_packed.get());
+            _is_rhs_packed = rhs->info()->are_values_constant();
+        }
+
+        ITensorPack qsi8_tensors{{TensorType::ACL_SRC_0, lhs},
+                                 {TensorType::ACL_SRC_1, rhs_packed.get()},
+                                 {TensorType::ACL_DST, dst}};
+        NEScheduler::get().schedule_op(_qsi8_kernel.get(), _qsi8_kernel->get_split_dimension_hint(),
+                                       _qsi8_kernel->window(), qsi8_tensors);
+        return;
+    }
+
     // Reshape LHS and DST to ensure compatibility with GEMM asm kernel (Batch dimensions is 4th for lhs and dst within asm)
     // Collapse RHS (necessary to support dimensions larger than 3 in gemm assembly)
     lhs->info()->set_tensor_shape(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuMatMulQsi4Kernel.h"
+#include "src/cpu/kernels/CpuMatMulQsi8Kernel.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
@@ -45,6 +47,12 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
  *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *
+ * If rhs is 4-bit quantized :
+ *  -# @ref cpu::kernels::CpuMatMulQsi4Kernel
+ *
+ * If lhs is F32 and rhs is QSYMM8_PER_CHANNEL :
+ *  -# @ref cpu::kernels::CpuMatMulQsi8Kernel
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -96,6 +104,7 @@ private:
         /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
         TransposeLHS = 3,
         TransposeRHS,
+        PackedRHS,
         Count
     };
 
@@ -103,10 +112,13 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
+    std::unique_ptr<kernels::CpuMatMulQsi4Kernel> _qsi4_kernel{nullptr};
+    std::unique_ptr<kernels::CpuMatMulQsi8Kernel> _qsi8_kernel{nullptr};
 
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
     TensorInfo _rhs_transposed{};
+    TensorInfo _rhs_packed{};
 
     // Original tensor shapes prior to reshaping tensors and collapsing dimensions
     TensorShape _original_lhs_shape{};
@@ -117,6 +129,9 @@ private:
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
     bool                             _fast_math{false};
+    bool                             _is_qsi4{false};
+    bool                             _is_qsi8{false};
+    bool                             _is_rhs_packed{false};
     AsmGemmInfo                      _gemm_info{};
     experimental::MemoryRequirements _aux_mem{Count};
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,9 +25,12 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/DataLayoutUtils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
@@ -46,6 +49,8 @@
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 #include "support/Cast.h"
 
+#include <sstream>
+
 namespace arm_compute
 {
 namespace cpu
@@ -424,24 +429,6 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
     if (!_is_prepared)
     {
         const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
-        ITensor       *weights_aux =
-            utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
-
-        CpuAuxTensorHandler permuted_weights(_weights_hwio, *weights_aux);
-        ITensorPack         permute_tensors{{ACL_SRC, weights}, {ACL_DST, permuted_weights.get()}};
-        _permute_weights->run(permute_tensors);
-        const int element_size_in_bytes = permuted_weights.get()->info()->element_size();
-        // Weights were in OHWI format, before being permuted "permuted_weights" to be in HWIO format.
-        const unsigned int height_idx  = 3; // H in HWIO
-        const unsigned int width_idx   = 2; // W in HWIO
-        const unsigned int channel_idx = 1; // I in HWIO
-
-        const int permuted_weight_row_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[height_idx] / element_size_in_bytes;
-        const int permuted_weight_col_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[width_idx] / element_size_in_bytes;
-        const int permuted_weight_channel_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[channel_idx] / element_size_in_bytes;
 
         // Wrap the winograd-domain transformed weight TensorInfo in Auxiliary tensor and allocate the required memory.
         ITensor *weights_transf =
@@ -449,20 +436,60 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
         ARM_COMPUTE_ERROR_ON_NULLPTR(weights_transf);
         CpuAuxTensorHandler winograd_transformed_weights(_winograd_transformed_weights, *weights_transf);
 
-        const void *permuted_weights_ptr;
-        void       *win_wght_transf_ptr;
-
-        permuted_weights_ptr = reinterpret_cast<const void *>(
-            permuted_weights.get()->buffer() + permuted_weights.get()->info()->offset_first_element_in_bytes());
-        win_wght_transf_ptr =
+        void *win_wght_transf_ptr =
             reinterpret_cast<void *>(winograd_transformed_weights.get()->buffer() +
                                      winograd_transformed_weights.get()->info()->offset_first_element_in_bytes());
 
-        // Prepare Weights
-        _winograd_impl.weight_transform->execute(
-            *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
-            permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
-        );
+        // Weights transformed by a previous run can be copied from the weights cache
+        CPPWeightsCache *weights_cache = CPPRuntimeContext::get().weights_cache();
+        std::string      weights_id{};
+        bool             are_weights_cached = false;
+        if (weights_cache != nullptr)
+        {
+            std::stringstream config;
+            config << string_from_data_layout(_data_layout) << ";" << _winograd_impl.winograd_spec.weight_ld_row << ";"
+                   << _winograd_impl.winograd_spec.weight_ld_matrix;
+            weights_id = CPPWeightsCache::weights_id(_winograd_impl.weight_transform->get_name(), config.str(),
+                                                     {weights}, NEScheduler::get().cpu_info());
+            are_weights_cached = weights_cache->find_weights(weights_id, win_wght_transf_ptr,
+                                                             _winograd_transformed_weights.total_size());
+        }
+
+        if (!are_weights_cached)
+        {
+            ITensor *weights_aux =
+                utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
+
+            CpuAuxTensorHandler permuted_weights(_weights_hwio, *weights_aux);
+            ITensorPack         permute_tensors{{ACL_SRC, weights}, {ACL_DST, permuted_weights.get()}};
+            _permute_weights->run(permute_tensors);
+            const int element_size_in_bytes = permuted_weights.get()->info()->element_size();
+            // Weights were in OHWI format, before being permuted "permuted_weights" to be in HWIO format.
+            const unsigned int height_idx  = 3; // H in HWIO
+            const unsigned int width_idx   = 2; // W in HWIO
+            const unsigned int channel_idx = 1; // I in HWIO
+
+            const int permuted_weight_row_stride =
+                permuted_weights.get()->info()->strides_in_bytes()[height_idx] / element_size_in_bytes;
+            const int permuted_weight_col_stride =
+                permuted_weights.get()->info()->strides_in_bytes()[width_idx] / element_size_in_bytes;
+            const int permuted_weight_channel_stride =
+                permuted_weights.get()->info()->strides_in_bytes()[channel_idx] / element_size_in_bytes;
+
+            const void *permuted_weights_ptr = reinterpret_cast<const void *>(
+                permuted_weights.get()->buffer() + permuted_weights.get()->info()->offset_first_element_in_bytes());
+
+            // Prepare Weights
+            _winograd_impl.weight_transform->execute(
+                *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
+                permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
+            );
+
+            if (weights_cache != nullptr && weights_cache->store_new_weights())
+            {
+                weights_cache->add_weights(weights_id, win_wght_transf_ptr, _winograd_transformed_weights.total_size());
+            }
+        }
         ITensorPack gemm_pack = tensors;
         gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
         _gemm_function->prepare(gemm_pack);
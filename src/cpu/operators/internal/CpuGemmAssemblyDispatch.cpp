@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,15 @@
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CPP/CPPGemmTuner.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/AssemblyUtils.h"
@@ -36,6 +42,10 @@
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 #include <arm_neon.h>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <sstream>
 
 namespace arm_compute
 {
@@ -220,6 +230,7 @@ public:
         }
 
         _gemm_kernel_asm->update_quantization_parameters(gemm_requant_info);
+        set_weights_config(a, b);
 
         // After update_quantization_parameters(), window may change, reconfigure it.
         auto *opt = reinterpret_cast<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> *>(
@@ -249,6 +260,12 @@ private:
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Set the configuration identifying the pretransposed B in the weights cache
+     *
+     * @param[in] a Quantization info of the Matrix A.
+     * @param[in] b Quantization info of the Matrix B.
+     */
+    void set_weights_config(const QuantizationInfo &a, const QuantizationInfo &b);
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -283,6 +300,10 @@ private:
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
     bool                                  _B_pre_pretranspose_required{false};
+    /** Number of K sections of the GEMM */
+    unsigned int _Ksections{1};
+    /** Configuration identifying the pretransposed B in the weights cache */
+    std::string _weights_config{};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -435,6 +456,16 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::set_weights_config(const QuantizationInfo &a,
+                                                                                  const QuantizationInfo &b)
+{
+    // The column sums of the quantized kernels are stored with the pretransposed B
+    std::stringstream ss;
+    ss << _Ksections << ";" << _B_pre_pretranspose_required << ";" << a.uniform().offset << ";" << b.uniform().offset;
+    _weights_config = ss.str();
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const ITensorInfo *a,
                                                                          const ITensorInfo *b,
@@ -530,6 +561,9 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
         MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
         _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+
+        _Ksections = args._Ksections;
+        set_weights_config(a->quantization_info(), b->quantization_info());
     }
 
     // Handle indirect GEMM convolution
@@ -563,15 +597,35 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         }
         const ITensor *b_to_use = b;
 
+        // Constant B pretransposed by a previous run can be copied from the weights cache
+        CPPWeightsCache *weights_cache =
+            (_B_pretranspose_required && _is_b_constant) ? CPPRuntimeContext::get().weights_cache() : nullptr;
+        std::string weights_id{};
+        bool        is_b_cached = false;
+        if (weights_cache != nullptr)
+        {
+            weights_id = CPPWeightsCache::weights_id(_gemm_kernel_asm->get_config().filter, _weights_config, {b, c},
+                                                     NEScheduler::get().cpu_info());
+
+            CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+            is_b_cached = weights_cache->find_weights(weights_id, pretranspose.get()->buffer(),
+                                                      _pretranspose_info.total_size());
+            if (is_b_cached)
+            {
+                _gemm_kernel_asm->set_pretransposed_B_data(pretranspose.get()->buffer());
+                b->mark_as_unused();
+            }
+        }
+
         // Pre-pretranspose B if required
         CpuAuxTensorHandler pre_pretransposed_b(
             offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
             /*pack_inject: no need to inject into tensors*/
             false,
             /*bypass_alloc: no need to allocate if pre-pretranspose B is not required as this handle will not be used*/
-            !_run_pre_pretranspose_b);
+            !_run_pre_pretranspose_b || is_b_cached);
 
-        if (_run_pre_pretranspose_b)
+        if (_run_pre_pretranspose_b && !is_b_cached)
         {
             ARM_COMPUTE_ERROR_ON(_pre_pretranspose_b == nullptr);
             ITensorPack pre_pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pre_pretransposed_b.get()}};
@@ -580,7 +634,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         }
 
         // Pretranspose B if required
-        if (_B_pretranspose_required)
+        if (_B_pretranspose_required && !is_b_cached)
         {
             // Fixed format kernels need no pretranspose.
             ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
@@ -599,6 +653,11 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
                 _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
                 NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
 
+            if (weights_cache != nullptr && weights_cache->store_new_weights())
+            {
+                weights_cache->add_weights(weights_id, pretranspose.get()->buffer(), _pretranspose_info.total_size());
+            }
+
             b->mark_as_unused();
             // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b,
             // its memory will be auto-managed by the handler
@@ -665,6 +724,13 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     const ITensor *b_to_use = b;
 
+    // The pretransposed B of constant weights can be shared with other functions after being prepared
+    const ITensor *pretransposed_b = tensors.get_const_tensor(offset_int_vec(Pretranspose));
+    if (_B_pretranspose_required && _is_b_constant && pretransposed_b != nullptr && pretransposed_b->buffer() != nullptr)
+    {
+        _gemm_kernel_asm->set_pretransposed_B_data(pretransposed_b->buffer());
+    }
+
     // Pre-pretranspose B if required
     CpuAuxTensorHandler pre_pretransposed_b(
         offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
@@ -814,6 +880,175 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     NEScheduler::get().schedule_op(_optimised_kernel.get(), scheduling_hint, _optimised_kernel->window(), gemm_pack);
 }
 
+/** Unique identifier of a GEMM configuration in the GEMM tuner
+ *
+ * @param[in] a            Input tensor info containing the Matrix A.
+ * @param[in] b            Input tensor info containing the Matrix B.
+ * @param[in] d            Output tensor info.
+ * @param[in] args         arm_gemm arguments of the GEMM.
+ * @param[in] output_stage Name of the output stage of the GEMM.
+ *
+ * @return The GEMM identifier
+ */
+std::string gemm_tuner_id(const ITensorInfo        *a,
+                          const ITensorInfo        *b,
+                          const ITensorInfo        *d,
+                          const arm_gemm::GemmArgs &args,
+                          const char               *output_stage)
+{
+    std::stringstream ss;
+    ss << string_from_data_type(a->data_type()) << ";" << string_from_data_type(b->data_type()) << ";"
+       << string_from_data_type(d->data_type()) << ";" << output_stage << ";" << args._Msize << ";" << args._Nsize
+       << ";" << args._Ksize << ";" << args._Ksections << ";" << args._nbatches << ";" << args._nmulti << ";"
+       << args._indirect_input << ";" << static_cast<int>(args._act.type) << ";" << args._fast_mode << ";"
+       << args._accumulate << ";" << cpuinfo::cpu_model_to_string(args._ci->get_cpu_model()) << ";"
+       << args._maxthreads;
+    return ss.str();
+}
+
+/** Time the runs of a configured assembly GEMM on zero-initialised tensors
+ *
+ * @param[in] fallback Configured assembly GEMM to benchmark.
+ * @param[in] a        Input tensor info containing the Matrix A.
+ * @param[in] b        Input tensor info containing the Matrix B.
+ * @param[in] c        Input tensor info containing the Matrix C. Can be nullptr.
+ * @param[in] d        Output tensor info.
+ *
+ * @return The average duration of a run, excluding the warm-up run which also prepares the GEMM.
+ */
+std::chrono::nanoseconds benchmark_fallback(CpuGemmAssemblyDispatch::IFallback &fallback,
+                                            const ITensorInfo                   *a,
+                                            const ITensorInfo                   *b,
+                                            const ITensorInfo                   *c,
+                                            const ITensorInfo                   *d)
+{
+    constexpr int num_runs = 5;
+
+    const ITensorInfo *infos[] = {a, b, c, d};
+    const TensorType   slots[] = {ACL_SRC_0, ACL_SRC_1, ACL_SRC_2, ACL_DST};
+    Tensor             tensors[4];
+    ITensorPack        pack;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        if (infos[i] == nullptr)
+        {
+            continue;
+        }
+        tensors[i].allocator()->init(*infos[i]);
+        tensors[i].allocator()->allocate();
+        std::memset(tensors[i].buffer(), 0, tensors[i].info()->total_size());
+        pack.add_tensor(slots[i], &tensors[i]);
+    }
+
+    MemoryGroup memory_group;
+    auto        workspace = manage_workspace<Tensor>(fallback.workspace(), memory_group, pack, pack);
+    ARM_COMPUTE_UNUSED(workspace);
+
+    fallback.run(pack);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_runs; ++i)
+    {
+        fallback.run(pack);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start) / num_runs;
+}
+
+/** Force the kernel of an assembly GEMM to the one of the GEMM tuner set on the scheduler, if any
+ *
+ * If the GEMM is missing from the tuner's table and tuning of new GEMMs is enabled, every kernel supporting the GEMM
+ * is configured with @p make_fallback and benchmarked, and the fastest one is added to the table.
+ *
+ * @param[in, out] cfg           arm_gemm configuration pointed to by @p args. The selected kernel is written to it.
+ * @param[in]      args          arm_gemm arguments of the GEMM.
+ * @param[in]      os            Output stage of the GEMM.
+ * @param[in]      output_stage  Name of the output stage of the GEMM.
+ * @param[in]      a             Input tensor info containing the Matrix A.
+ * @param[in]      b             Input tensor info containing the Matrix B.
+ * @param[in]      c             Input tensor info containing the Matrix C. Can be nullptr.
+ * @param[in]      d             Output tensor info.
+ * @param[in]      info          GEMM meta-data
+ * @param[in]      make_fallback Function configuring a new assembly GEMM with the current content of @p cfg.
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage, typename FallbackFactory>
+void select_tuned_kernel(arm_gemm::GemmConfig     &cfg,
+                         const arm_gemm::GemmArgs &args,
+                         const OutputStage        &os,
+                         const char               *output_stage,
+                         const ITensorInfo        *a,
+                         const ITensorInfo        *b,
+                         const ITensorInfo        *c,
+                         const ITensorInfo        *d,
+                         const AsmGemmInfo        &info,
+                         const FallbackFactory    &make_fallback)
+{
+    CPPGemmTuner *tuner = CPPRuntimeContext::get().gemm_tuner();
+    // The layout of the weights of fixed format kernels has already been agreed with the caller
+    if (tuner == nullptr || info.fixed_format)
+    {
+        return;
+    }
+
+    const std::string gemm_id = gemm_tuner_id(a, b, d, args, output_stage);
+    const auto        kernels =
+        arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+
+    std::string kernel_name;
+    if (tuner->find_kernel(gemm_id, kernel_name))
+    {
+        for (const auto &kernel : kernels)
+        {
+            if (kernel_name == kernel.name)
+            {
+                cfg.method = kernel.method;
+                cfg.filter = kernel.name;
+                return;
+            }
+        }
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned kernel %s does not support GEMM %s", kernel_name.c_str(),
+                                                  gemm_id.c_str());
+        return;
+    }
+
+    if (!tuner->tune_new_gemms() || kernels.empty())
+    {
+        return;
+    }
+
+    const arm_gemm::KernelDescription *best_kernel = nullptr;
+    std::chrono::nanoseconds           best_time   = std::chrono::nanoseconds::max();
+    for (const auto &kernel : kernels)
+    {
+        cfg.method = kernel.method;
+        cfg.filter = kernel.name;
+
+        auto fallback = make_fallback();
+        if (!fallback->is_configured())
+        {
+            continue;
+        }
+        const std::chrono::nanoseconds time = benchmark_fallback(*fallback, a, b, c, d);
+        if (time < best_time)
+        {
+            best_kernel = &kernel;
+            best_time   = time;
+        }
+    }
+
+    if (best_kernel == nullptr)
+    {
+        cfg.method = arm_gemm::GemmMethod::DEFAULT;
+        cfg.filter = "";
+        return;
+    }
+
+    cfg.method = best_kernel->method;
+    cfg.filter = best_kernel->name;
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned kernel of GEMM %s: %s", gemm_id.c_str(), best_kernel->name.c_str());
+    tuner->add_kernel(gemm_id, best_kernel->name);
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
 void create_arm_gemm(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &arm_gemm,
                      const ITensorInfo                                   *a,
@@ -838,9 +1073,15 @@ void create_arm_gemm(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &arm_ge
                             info.fixed_format, fast_mode, info.accumulate, &cfg);
 
     // Create arm_gemm fallback
-    auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput>>();
-    fallback->configure(a, b, c, d, args, info);
-    arm_gemm = std::move(fallback);
+    const auto make_fallback = [&]()
+    {
+        auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput>>();
+        fallback->configure(a, b, c, d, args, info);
+        return fallback;
+    };
+    select_tuned_kernel<TypeInput, TypeWeight, TypeOutput>(cfg, args, arm_gemm::Nothing(), "none", a, b, c, d, info,
+                                                           make_fallback);
+    arm_gemm = make_fallback();
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
@@ -863,17 +1104,22 @@ void create_arm_gemm_dequant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback>
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
-    // Create arm_gemm fallback
-    auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput, arm_gemm::DequantizeFloat>>();
-
     // Configure requantization info
     const GEMMLowpOutputStageInfo os_info = info.output_stage;
 
     arm_gemm::DequantizeFloat gemm_dequant_info{};
     gemm_dequant_info = arm_gemm::DequantizeFloat(d->quantization_info().uniform().scale);
 
-    fallback->configure(a, b, c, d, args, info, gemm_dequant_info);
-    arm_gemm = std::move(fallback);
+    // Create arm_gemm fallback
+    const auto make_fallback = [&]()
+    {
+        auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput, arm_gemm::DequantizeFloat>>();
+        fallback->configure(a, b, c, d, args, info, gemm_dequant_info);
+        return fallback;
+    };
+    select_tuned_kernel<TypeInput, TypeWeight, TypeOutput>(cfg, args, gemm_dequant_info, "dequant", a, b, c, d, info,
+                                                           make_fallback);
+    arm_gemm = make_fallback();
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
@@ -895,8 +1141,7 @@ void create_arm_gemm_quant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
-    // Create arm_gemm fallback
-    auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput, arm_gemm::Requantize32>>();
+    using FallbackType = Fallback<TypeInput, TypeWeight, TypeOutput, arm_gemm::Requantize32>;
 
     // Configure requantization info
     const int32_t                 negation = info.negated_offsets ? 1 : -1;
@@ -904,22 +1149,42 @@ void create_arm_gemm_quant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &
     const int32_t                 b_offset = -b->quantization_info().uniform().offset * negation;
     const GEMMLowpOutputStageInfo os_info  = info.output_stage;
 
-    arm_gemm::Requantize32 gemm_requant_info{};
-    if (os_info.gemmlowp_shifts.size() > 1)
+    // The per-channel requantization data is owned by the fallback
+    const auto make_requant_info = [&](FallbackType &fallback)
     {
-        const auto requantize_data =
-            fallback->set_requantize_data(os_info.gemmlowp_shifts, os_info.gemmlowp_multipliers);
-        gemm_requant_info = arm_gemm::Requantize32(
-            nullptr, 0, a_offset, b_offset, os_info.gemmlowp_offset,
-            (std::get<0>(requantize_data)) ? std::get<1>(requantize_data) : nullptr, std::get<2>(requantize_data),
-            std::get<3>(requantize_data), os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
-    }
-    else
+        arm_gemm::Requantize32 gemm_requant_info{};
+        if (os_info.gemmlowp_shifts.size() > 1)
+        {
+            const auto requantize_data =
+                fallback.set_requantize_data(os_info.gemmlowp_shifts, os_info.gemmlowp_multipliers);
+            gemm_requant_info = arm_gemm::Requantize32(
+                nullptr, 0, a_offset, b_offset, os_info.gemmlowp_offset,
+                (std::get<0>(requantize_data)) ? std::get<1>(requantize_data) : nullptr, std::get<2>(requantize_data),
+                std::get<3>(requantize_data), os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
+        }
+        else
+        {
+            gemm_requant_info = arm_gemm::Requantize32(nullptr, 0, a_offset, b_offset, os_info.gemmlowp_offset,
+                                                       -os_info.gemmlowp_shift, os_info.gemmlowp_multiplier,
+                                                       os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
+        }
+        return gemm_requant_info;
+    };
+
+    // Create arm_gemm fallback
+    auto                         fallback          = std::make_unique<FallbackType>();
+    const arm_gemm::Requantize32 gemm_requant_info = make_requant_info(*fallback);
+
+    const auto make_fallback = [&]()
     {
-        gemm_requant_info =
-            arm_gemm::Requantize32(nullptr, 0, a_offset, b_offset, os_info.gemmlowp_offset, -os_info.gemmlowp_shift,
-                                   os_info.gemmlowp_multiplier, os_info.gemmlowp_min_bound, os_info.gemmlowp_max_bound);
-    }
+        auto candidate = std::make_unique<FallbackType>();
+        candidate->configure(a, b, c, d, args, info, make_requant_info(*candidate));
+        return candidate;
+    };
+    select_tuned_kernel<TypeInput, TypeWeight, TypeOutput>(cfg, args, gemm_requant_info,
+                                                           gemm_requant_info.per_channel_requant ? "requant_per_channel"
+                                                                                                 : "requant",
+                                                           a, b, c, d, info, make_fallback);
 
     // Configure fallback
     fallback->configure(a, b, c, d, args, info, gemm_requant_info);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUPARALLELREGION_H
+#define ACL_SRC_CPU_UTILS_CPUPARALLELREGION_H
+
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Scoped parallel region on the CPU scheduler
+ *
+ * To be declared at the top of the run() method of operators scheduling several kernels back to back so that the
+ * scheduler keeps its worker threads awake between them. See @ref IScheduler::begin_parallel_region.
+ */
+class CpuParallelRegion
+{
+public:
+    /** Open a parallel region on the current CPU scheduler */
+    CpuParallelRegion() : _scheduler(NEScheduler::get())
+    {
+        _scheduler.begin_parallel_region();
+    }
+    /** Close the parallel region */
+    ~CpuParallelRegion()
+    {
+        _scheduler.end_parallel_region();
+    }
+    /** Prevent instances of this class from being copied */
+    CpuParallelRegion(const CpuParallelRegion &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuParallelRegion &operator=(const CpuParallelRegion &) = delete;
+
+private:
+    IScheduler &_scheduler;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUPARALLELREGION_H
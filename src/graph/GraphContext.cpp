@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,13 +25,38 @@
 
 #include "arm_compute/graph.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
 namespace graph
 {
-GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers()
+namespace
+{
+/** Logs the memory planned by a memory manager
+ *
+ * @param[in] mm        Populated memory manager
+ * @param[in] num_pools Number of pools of the memory manager
+ * @param[in] name      Name of the memory managed
+ */
+void log_memory_footprint(IMemoryManager &mm, size_t num_pools, const char *name)
+{
+    const auto *lifetime_mgr = dynamic_cast<const OffsetLifetimeManager *>(mm.lifetime_manager());
+    ARM_COMPUTE_UNUSED(lifetime_mgr, num_pools, name);
+    if (lifetime_mgr != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(name << " : " << num_pools << " x " << lifetime_mgr->info().size
+                                        << " bytes (peak usage " << lifetime_mgr->peak_size() << " bytes)"
+                                        << std::endl);
+    }
+}
+} // namespace
+
+GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers(), _cpp_runtime_ctx()
 {
 }
 
@@ -98,6 +123,11 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
     return _weights_managers;
 }
 
+CPPRuntimeContext &GraphContext::cpp_runtime_ctx()
+{
+    return _cpp_runtime_ctx;
+}
+
 void GraphContext::finalize()
 {
     const size_t num_pools = 1;
@@ -105,15 +135,21 @@ void GraphContext::finalize()
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
 
-        // Finalize intra layer memory manager
+        // Finalize intra layer memory manager, functions of concurrent CPU branches or pipeline stages need a pool each
         if (mm_obj.second.intra_mm != nullptr)
         {
-            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
+            const size_t num_intra_pools =
+                (mm_obj.first == Target::NEON)
+                    ? std::max<size_t>({num_pools, _config.num_parallel_branches, _config.num_pipeline_stages})
+                    : num_pools;
+            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_intra_pools);
+            log_memory_footprint(*mm_obj.second.intra_mm, num_intra_pools, "Function workspaces");
         }
         // Finalize cross layer memory manager
         if (mm_obj.second.cross_mm != nullptr)
         {
             mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, num_pools);
+            log_memory_footprint(*mm_obj.second.cross_mm, num_pools, "Transition buffers");
         }
     }
 }
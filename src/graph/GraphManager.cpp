@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,7 +25,9 @@
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
+#include "arm_compute/graph/detail/DynamicBatchExecutor.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/PipelineExecutor.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Logger.h"
@@ -56,6 +58,13 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply IR mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::IR);
 
+    // Lower the batch to a chunk of samples when the batch is set at execution time
+    std::shared_ptr<detail::DynamicBatchExecutor> batch_executor = nullptr;
+    if (ctx.config().batch_chunk_size > 0)
+    {
+        batch_executor = detail::lower_batch_size(graph, ctx.config().batch_chunk_size);
+    }
+
     // Force target to all graph construct
     Target forced_target = target;
 
@@ -76,10 +85,15 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
         ARM_COMPUTE_LOG_GRAPH_INFO("Switching target from " << target << " to " << forced_target << std::endl);
     }
     force_target_to_graph(graph, forced_target);
+    ARM_COMPUTE_ERROR_ON_MSG(batch_executor != nullptr && forced_target != Target::NEON,
+                             "Setting the batch at execution time is only supported on the CPU backend!");
 
     // Setup backend context
     setup_requested_backend_context(ctx, forced_target);
 
+    // The CPU functions are configured and prepared with the tuners and caches of the graph
+    CPPRuntimeContextScope runtime_scope(&ctx.cpp_runtime_ctx());
+
     // Configure all tensors
     detail::configure_all_tensors(graph);
 
@@ -96,6 +110,16 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Stream the inferences through the pipeline stages or execute the independent tasks concurrently
+    detail::configure_pipeline_stages(workload);
+    ARM_COMPUTE_ERROR_ON_MSG(batch_executor != nullptr && workload.pipeline_executor != nullptr,
+                             "Cannot set the batch of a pipelined graph at execution time!");
+    workload.batch_executor = std::move(batch_executor);
+    if (workload.pipeline_executor == nullptr)
+    {
+        detail::configure_task_dependencies(workload, topological_sorted_nodes, ctx.config().num_parallel_branches);
+    }
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -104,7 +128,8 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     detail::prepare_all_tasks(workload);
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if (ctx.config().use_transition_memory_manager)
+    // The stages of a pipeline work on different inferences at the same time and cannot share transition buffers
+    if (ctx.config().use_transition_memory_manager && workload.pipeline_executor == nullptr)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -129,6 +154,23 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    ARM_COMPUTE_ERROR_ON(it->second.ctx == nullptr);
+    CPPRuntimeContextScope runtime_scope(&it->second.ctx->cpp_runtime_ctx());
+
+    // Pipelined workloads stream the inferences until an accessor stops them
+    if (it->second.pipeline_executor != nullptr)
+    {
+        it->second.pipeline_executor->run(it->second);
+        return;
+    }
+
+    // Workloads with a batch set at execution time run it in chunks
+    if (it->second.batch_executor != nullptr)
+    {
+        it->second.batch_executor->run(it->second);
+        return;
+    }
+
     while (true)
     {
         // Call input accessors
@@ -148,6 +190,16 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+void GraphManager::set_batch_size(Graph &graph, unsigned int batch_size)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_ERROR_ON_MSG(it->second.batch_executor == nullptr,
+                             "Graph was not finalized with a batch chunk size, its batch cannot change!");
+
+    it->second.batch_executor->set_batch_size(batch_size);
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
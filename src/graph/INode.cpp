@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018,2021,2023 Arm Limited.
+ * Copyright (c) 2018,2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,7 +36,8 @@ namespace graph
 // clang-format off
 INode::INode()
     : _graph(nullptr), _id(EmptyNodeID), _common_params({ "", Target::UNSPECIFIED}),
-      _outputs(), _input_edges(), _output_edges(), _assigned_target(Target::UNSPECIFIED)
+      _outputs(), _input_edges(), _output_edges(), _assigned_target(Target::UNSPECIFIED),
+      _pipeline_stage(0)
 {
 }
 // clang-format on
@@ -73,6 +74,11 @@ void INode::set_assigned_target(Target target)
     _assigned_target = target;
 }
 
+void INode::set_pipeline_stage(unsigned int stage)
+{
+    _pipeline_stage = stage;
+}
+
 void INode::set_output_tensor(TensorID tid, size_t idx)
 {
     if (tid != NullTensorID && (idx < _outputs.size()) && (_graph->tensor(tid) != nullptr))
@@ -199,5 +205,10 @@ Target INode::assigned_target() const
 {
     return _assigned_target;
 }
+
+unsigned int INode::pipeline_stage() const
+{
+    return _pipeline_stage;
+}
 } // namespace graph
 } // namespace arm_compute
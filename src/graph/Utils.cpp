@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,7 +73,6 @@ void force_target_to_graph(Graph &g, Target target)
 
 PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
 {
-    ARM_COMPUTE_UNUSED(target);
     PassManager pm;
 
     // Passes that mutate graph IR
@@ -94,14 +93,27 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
-    pm.append(std::make_unique<NodeFusionMutator>());
+    if (cfg.plan_data_layout || cfg.plan_data_type)
+    {
+        pm.append(std::make_unique<LayoutTypePlanningMutator>(target, cfg.plan_data_layout, cfg.plan_data_type));
+    }
+    if (cfg.fold_quantization)
+    {
+        pm.append(std::make_unique<QuantizationFoldingMutator>());
+    }
+    pm.append(std::make_unique<NodeFusionMutator>(cfg.fuse_f16_elementwise_chains));
     pm.append(std::make_unique<GroupedConvolutionMutator>());
+    if (cfg.num_pipeline_stages > 1)
+    {
+        pm.append(std::make_unique<PipelineStageMutator>(cfg.num_pipeline_stages));
+    }
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
     // Passes that mutate backend information
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
-    pm.append(std::make_unique<NodeExecutionMethodMutator>());
+    pm.append(std::make_unique<NodeExecutionMethodMutator>(cfg.tune_convolution_method ||
+                                                           !cfg.convolution_tuner_file.empty()));
 
     return pm;
 }
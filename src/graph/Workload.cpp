@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,19 +23,83 @@
  */
 #include "arm_compute/graph/Workload.h"
 
+#include "arm_compute/core/utils/DataTypeUtils.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/nodes/PrintLayerNode.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
 
 #include "support/Cast.h"
 
+#include <array>
+#include <sstream>
+#include <string>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Name of a node in the profiler, its type if it has no name */
+const char *profiled_name(const INode &node)
+{
+    if (!node.name().empty())
+    {
+        return node.name().c_str();
+    }
+    static const std::array<std::string, static_cast<size_t>(NodeType::Dummy) + 1> type_names = []()
+    {
+        std::array<std::string, static_cast<size_t>(NodeType::Dummy) + 1> names{};
+        for (size_t type = 0; type < names.size(); ++type)
+        {
+            std::ostringstream ss;
+            ss << static_cast<NodeType>(type);
+            names[type] = ss.str();
+        }
+        return names;
+    }();
+    return type_names[static_cast<size_t>(node.type())].c_str();
+}
+
+/** Bytes of the input and output tensors of a node */
+size_t tensors_size(const INode &node)
+{
+    size_t bytes = 0;
+    auto   add   = [&](const Tensor *tensor)
+    {
+        if (tensor != nullptr)
+        {
+            bytes += tensor->desc().shape.total_size() * data_size_from_type(tensor->desc().data_type);
+        }
+    };
+    for (size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        add(node.input(idx));
+    }
+    for (size_t idx = 0; idx < node.num_outputs(); ++idx)
+    {
+        add(node.output(idx));
+    }
+    return bytes;
+}
+} // namespace
+
 void ExecutionTask::operator()()
 {
+    // The nodes are profiled along with the kernels when a profiler is set on the runtime context
+    CPPProfiler *profiler = CPPRuntimeContext::get().profiler();
+    if (profiler == nullptr || node == nullptr)
+    {
+        TaskExecutor::get().execute_function(*this);
+        return;
+    }
+
+    const auto start = CPPProfiler::Clock::now();
     TaskExecutor::get().execute_function(*this);
+    profiler->add_event(profiled_name(*node), "node", start, CPPProfiler::Clock::now(), tensors_size(*node));
 }
 
 void execute_task(ExecutionTask &task)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -243,6 +243,8 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BoundingBoxTransformLayer:
             return detail::create_bounding_box_transform_layer<CLBoundingBoxTransform, CLTargetInfo>(
                 *polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<CLCast, CLTargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<CLChannelShuffleLayer, CLTargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
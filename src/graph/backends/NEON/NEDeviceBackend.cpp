@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,16 +43,36 @@
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register CPU backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
-NEDeviceBackend::NEDeviceBackend() : _allocator()
+NEDeviceBackend::NEDeviceBackend()
+    : _allocator(),
+      _weights_cache(nullptr),
+      _weights_cache_file(),
+      _num_loaded_weights(0),
+      _shared_weights_mgr(),
+      _conv_tuner(nullptr),
+      _conv_tuner_file(),
+      _profiler(nullptr),
+      _profiling_file()
 {
 }
 
@@ -63,8 +83,36 @@ void NEDeviceBackend::initialize_backend()
 
 void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 {
-    //Nothing to do
-    ARM_COMPUTE_UNUSED(ctx);
+    ctx.cpp_runtime_ctx().set_weights_cache(nullptr);
+    ctx.cpp_runtime_ctx().set_convolution_tuner(nullptr);
+    ctx.cpp_runtime_ctx().set_profiler(nullptr);
+
+    // Save the weights prepared since the cache was loaded
+    if (_weights_cache != nullptr)
+    {
+        if (_weights_cache->num_weights() > _num_loaded_weights)
+        {
+            _weights_cache->save_to_file(_weights_cache_file);
+        }
+        _weights_cache.reset();
+    }
+
+    // Save the convolution methods measured during the configuration of the graphs
+    if (_conv_tuner != nullptr)
+    {
+        if (_conv_tuner->tune_new_convolutions())
+        {
+            _conv_tuner->save_to_file(_conv_tuner_file);
+        }
+        _conv_tuner.reset();
+    }
+
+    // Save the trace of the executions of the graphs
+    if (_profiler != nullptr)
+    {
+        _profiler->save_to_file(_profiling_file);
+        _profiler.reset();
+    }
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
@@ -97,6 +145,53 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
+
+    // Setup prepared weights cache
+    if (!ctx.config().weights_cache_file.empty())
+    {
+        if (_weights_cache == nullptr)
+        {
+            _weights_cache      = std::make_unique<CPPWeightsCache>();
+            _weights_cache_file = ctx.config().weights_cache_file;
+
+            // Load the weights prepared by a previous run if available
+            if (file_exists(_weights_cache_file))
+            {
+                _weights_cache->load_from_file(_weights_cache_file);
+            }
+            _num_loaded_weights = _weights_cache->num_weights();
+        }
+        ctx.cpp_runtime_ctx().set_weights_cache(_weights_cache.get());
+    }
+
+    // Setup convolution method tuner
+    const bool tune_convolutions = ctx.config().tune_convolution_method;
+    if (tune_convolutions || !ctx.config().convolution_tuner_file.empty())
+    {
+        if (_conv_tuner == nullptr)
+        {
+            _conv_tuner      = std::make_unique<CPPConvolutionTuner>(tune_convolutions);
+            _conv_tuner_file = ctx.config().convolution_tuner_file;
+
+            // Reuse the methods measured by a previous run if available
+            if (!_conv_tuner_file.empty() && file_exists(_conv_tuner_file))
+            {
+                _conv_tuner->load_from_file(_conv_tuner_file);
+            }
+        }
+        ctx.cpp_runtime_ctx().set_convolution_tuner(_conv_tuner.get());
+    }
+
+    // Setup profiler
+    if (!ctx.config().profiling_file.empty())
+    {
+        if (_profiler == nullptr)
+        {
+            _profiler       = std::make_unique<CPPProfiler>();
+            _profiling_file = ctx.config().profiling_file;
+        }
+        ctx.cpp_runtime_ctx().set_profiler(_profiler.get());
+    }
 }
 
 bool NEDeviceBackend::is_backend_supported()
@@ -170,6 +265,7 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
 std::shared_ptr<arm_compute::IWeightsManager> NEDeviceBackend::create_weights_manager()
 {
     auto weights_mgr = std::make_shared<IWeightsManager>();
+    weights_mgr->share_transformed_weights_with(_shared_weights_mgr);
     return weights_mgr;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,13 @@ struct NEFusedLayerTypes
     using FuseBatchNormalization    = NEFuseBatchNormalization;
 };
 
+/** Function and tensor types to be used inside a fused convolution/batch normalization layer accumulating a residual */
+struct NEFusedResidualLayerTypes
+{
+    using ConvolutionLayer       = NEGEMMConvolutionLayer;
+    using FuseBatchNormalization = NEFuseBatchNormalization;
+};
+
 namespace detail
 {
 template <>
@@ -134,12 +141,21 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(
                 *polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<NECast, NETargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
-            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if (conv_node->has_residual_input())
+            {
+                return detail::create_convolution_layer_with_residual<NEGEMMConv2d, NEGEMMConvolutionLayer,
+                                                                      NETargetInfo>(*conv_node, ctx);
+            }
+            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*conv_node, ctx);
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -174,12 +190,23 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(
                 *polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            auto *fused_node = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+            if (fused_node->has_residual_input())
+            {
+                return detail::create_fused_convolution_batch_normalization_layer_with_residual<
+                    NEFusedResidualLayerTypes, NETargetInfo>(*fused_node, ctx);
+            }
             return detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(
-                *polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx);
+                *fused_node, ctx);
+        }
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedElementwiseLayer:
+            return detail::create_fused_elementwise_layer<NEFusedElementwise, NETargetInfo>(
+                *polymorphic_downcast<FusedElementwiseLayerNode *>(node));
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
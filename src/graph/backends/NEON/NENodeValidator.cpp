@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,13 +70,22 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : BoundingBoxTransformLayer");
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<NECast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<NEChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if (conv_node->has_residual_input())
+            {
+                return detail::validate_convolution_layer_with_residual<NEGEMMConv2d, NEGEMMConvolutionLayer>(
+                    *conv_node);
+            }
             return detail::validate_convolution_layer<NEConvolutionLayer, NEDirectConvolutionLayer,
-                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node));
+                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(*conv_node);
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::validate_depth_to_space_layer<NEDepthToSpaceLayer>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -92,6 +101,16 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<NEDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            auto *fused_node = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+            if (fused_node->has_residual_input())
+            {
+                return detail::validate_fused_convolution_batch_normalization_layer_with_residual<
+                    NEGEMMConvolutionLayer>(*fused_node);
+            }
+            return Status{};
+        }
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : GenerateProposalsLayer");
@@ -133,6 +152,9 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::UnaryEltwiseLayer:
             return detail::validate_unary_eltwise_layer<NEUnaryEltwiseLayerFunctions>(
                 *polymorphic_downcast<UnaryEltwiseLayerNode *>(node));
+        case NodeType::FusedElementwiseLayer:
+            return detail::validate_fused_elementwise_layer<NEFusedElementwise>(
+                *polymorphic_downcast<FusedElementwiseLayerNode *>(node));
         default:
             return Status{};
     }
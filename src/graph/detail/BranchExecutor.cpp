@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/BranchExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Creates the scheduler of a branch
+ *
+ * @param[in] num_threads Number of threads of the branch, including the thread running the branch
+ *
+ * @return The scheduler of the branch
+ */
+std::unique_ptr<IScheduler> create_branch_scheduler(unsigned int num_threads)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if (num_threads > 1)
+    {
+        auto scheduler = std::make_unique<CPPScheduler>();
+        scheduler->set_num_threads(num_threads);
+        return scheduler;
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(num_threads);
+    return std::make_unique<SingleThreadScheduler>();
+}
+} // namespace
+
+struct BranchExecutor::Impl
+{
+    /** Runs a task on the given scheduler
+     *
+     * @param[in] scheduler Scheduler to install on the calling thread, nullptr to keep the current one
+     * @param[in] task      Task to run
+     *
+     * @return The exception thrown by the task if any
+     */
+    std::exception_ptr run_task(IScheduler *scheduler, ExecutionTask &task)
+    {
+        std::exception_ptr exception = nullptr;
+        if (scheduler != nullptr)
+        {
+            Scheduler::set_thread_scheduler(scheduler);
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            task();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        if (scheduler != nullptr)
+        {
+            Scheduler::set_thread_scheduler(nullptr);
+        }
+        return exception;
+    }
+
+    /** Runs the ready tasks on a branch until all the tasks have completed or one of them has failed
+     *
+     * @param[in] branch Index of the branch, branch 0 runs on the calling thread
+     */
+    void run_branch(unsigned int branch)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            ready_cv.wait(lock, [&] { return !ready.empty() || num_remaining == 0 || last_exception != nullptr; });
+            if (num_remaining == 0 || last_exception != nullptr)
+            {
+                return;
+            }
+
+            const unsigned int task_idx = ready.front();
+            ready.pop_front();
+            ++num_running;
+
+            // A task running alone can't be joined by another one before it completes, so it gets the whole
+            // thread pool. Otherwise the threads are shared between the tasks running or about to run.
+            const unsigned int num_concurrent = std::min<unsigned int>(num_running + ready.size(), schedulers.size());
+            IScheduler        *scheduler      = (branch == 0) ? nullptr : caller_scheduler;
+            lock.unlock();
+
+            if (num_concurrent > 1)
+            {
+                // Only the thread of the branch uses its schedulers
+                const unsigned int share            = std::max(1U, num_threads / num_concurrent);
+                auto              &branch_scheduler = schedulers[branch][share];
+                if (branch_scheduler == nullptr)
+                {
+                    branch_scheduler = create_branch_scheduler(share);
+                }
+                scheduler = branch_scheduler.get();
+            }
+
+            std::exception_ptr exception = run_task(scheduler, (*tasks)[task_idx]);
+
+            lock.lock();
+            --num_running;
+            --num_remaining;
+            const size_t num_ready = ready.size();
+            if (exception != nullptr)
+            {
+                last_exception = exception;
+            }
+            else
+            {
+                for (auto &dependent : (*dependents)[task_idx])
+                {
+                    if (--num_pending_dependencies[dependent] == 0)
+                    {
+                        ready.push_back(dependent);
+                    }
+                }
+            }
+
+            // This branch takes the next ready task itself, the other branches are only woken up for the others
+            if (num_remaining == 0 || last_exception != nullptr || ready.size() > num_ready + 1)
+            {
+                ready_cv.notify_all();
+            }
+        }
+    }
+
+    /** Main loop of the worker thread of a branch
+     *
+     * @param[in] branch Index of the branch, branch 0 runs on the calling thread
+     */
+    void worker_loop(unsigned int branch)
+    {
+        unsigned int last_generation = 0;
+        while (true)
+        {
+            CPPRuntimeContext *context = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_cv.wait(lock, [&] { return stop || generation != last_generation; });
+                if (stop)
+                {
+                    return;
+                }
+                last_generation = generation;
+                context         = runtime_ctx;
+            }
+
+            {
+                // The tasks run with the runtime context of the thread running the graph
+                CPPRuntimeContextScope runtime_scope(context);
+                run_branch(branch);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--num_active_workers == 0)
+            {
+                done_cv.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::map<unsigned int, std::unique_ptr<IScheduler>>> schedulers{};
+    std::vector<std::thread>                                         workers{};
+    unsigned int                                                     num_threads{1};
+    std::vector<ExecutionTask>                                      *tasks{nullptr};
+    const std::vector<std::vector<unsigned int>>                    *dependents{nullptr};
+    std::vector<unsigned int>                                        num_pending_dependencies{};
+    std::deque<unsigned int>                                         ready{};
+    IScheduler                                                      *caller_scheduler{nullptr};
+    CPPRuntimeContext                                               *runtime_ctx{nullptr};
+    std::mutex                                                       mutex{};
+    std::condition_variable                                          work_cv{};
+    std::condition_variable                                          ready_cv{};
+    std::condition_variable                                          done_cv{};
+    std::exception_ptr                                               last_exception{nullptr};
+    unsigned int                                                     generation{0};
+    unsigned int                                                     num_running{0};
+    unsigned int                                                     num_remaining{0};
+    unsigned int                                                     num_active_workers{0};
+    bool                                                             stop{false};
+};
+
+BranchExecutor::BranchExecutor(unsigned int num_branches, unsigned int num_threads) : _impl(std::make_unique<Impl>())
+{
+    ARM_COMPUTE_ERROR_ON(num_branches == 0);
+
+    // Every branch runs on its own thread, which is also the first thread of its schedulers. A branch has a
+    // scheduler for each share of the threads it ran a task with, created on first use.
+    _impl->num_threads = std::max(1U, num_threads);
+    _impl->schedulers.resize(num_branches);
+    for (unsigned int branch = 1; branch < num_branches; ++branch)
+    {
+        _impl->workers.emplace_back(&Impl::worker_loop, _impl.get(), branch);
+    }
+}
+
+BranchExecutor::~BranchExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->stop = true;
+    }
+    _impl->work_cv.notify_all();
+    for (auto &worker : _impl->workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int BranchExecutor::num_branches() const
+{
+    return _impl->schedulers.size();
+}
+
+void BranchExecutor::run(std::vector<ExecutionTask> &tasks, const std::vector<std::vector<unsigned int>> &dependents)
+{
+    ARM_COMPUTE_ERROR_ON(dependents.size() != tasks.size());
+    if (tasks.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->tasks      = &tasks;
+        _impl->dependents = &dependents;
+        _impl->num_pending_dependencies.assign(tasks.size(), 0);
+        for (auto &task_dependents : dependents)
+        {
+            for (auto &dependent : task_dependents)
+            {
+                ++_impl->num_pending_dependencies[dependent];
+            }
+        }
+        _impl->ready.clear();
+        for (unsigned int i = 0; i < tasks.size(); ++i)
+        {
+            if (_impl->num_pending_dependencies[i] == 0)
+            {
+                _impl->ready.push_back(i);
+            }
+        }
+        _impl->caller_scheduler   = &Scheduler::get();
+        _impl->runtime_ctx        = CPPRuntimeContext::thread_context();
+        _impl->num_running        = 0;
+        _impl->num_remaining      = tasks.size();
+        _impl->num_active_workers = _impl->workers.size();
+        _impl->last_exception     = nullptr;
+        ++_impl->generation;
+    }
+    _impl->work_cv.notify_all();
+
+    _impl->run_branch(0);
+
+    std::unique_lock<std::mutex> lock(_impl->mutex);
+    _impl->done_cv.wait(lock, [&] { return _impl->num_active_workers == 0; });
+    std::exception_ptr exception = _impl->last_exception;
+    lock.unlock();
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
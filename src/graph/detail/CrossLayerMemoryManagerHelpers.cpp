@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -180,16 +180,84 @@ void count_input_handles_per_target(const TaskHandles &task_handles, TargetHandl
     }
 }
 
+/** Finds, for each position in the execution order, the tasks completed before the task at this position starts
+ *
+ * Tasks executed in order complete before all the following ones. Tasks executed as soon as their dependencies
+ * complete are only guaranteed to complete before the tasks depending on them, directly or not.
+ *
+ * @param[in] num_tasks  Number of tasks of the workload
+ * @param[in] dependents Indices of the tasks waiting for each task, empty if the tasks are executed in order
+ *
+ * @return For each position, and the end of the execution, whether each task has completed before any of the
+ *         tasks from this position starts
+ */
+std::vector<std::vector<bool>> find_completed_tasks(size_t                                        num_tasks,
+                                                    const std::vector<std::vector<unsigned int>> &dependents)
+{
+    std::vector<std::vector<bool>> completed(num_tasks + 1, std::vector<bool>(num_tasks, true));
+    if (dependents.empty())
+    {
+        for (size_t position = 0; position < num_tasks; ++position)
+        {
+            std::fill(completed[position].begin() + position, completed[position].end(), false);
+        }
+        return completed;
+    }
+
+    // Tasks each task depends on, directly or not
+    std::vector<std::vector<bool>> ancestors(num_tasks, std::vector<bool>(num_tasks, false));
+    for (size_t task = 0; task < num_tasks; ++task)
+    {
+        for (auto &dependent : dependents[task])
+        {
+            ARM_COMPUTE_ERROR_ON(dependent <= task);
+            ancestors[dependent][task] = true;
+            for (size_t ancestor = 0; ancestor < task; ++ancestor)
+            {
+                if (ancestors[task][ancestor])
+                {
+                    ancestors[dependent][ancestor] = true;
+                }
+            }
+        }
+    }
+
+    for (size_t position = num_tasks; position-- > 0;)
+    {
+        for (size_t task = 0; task < num_tasks; ++task)
+        {
+            completed[position][task] = completed[position + 1][task] && ancestors[position][task];
+        }
+    }
+    return completed;
+}
+
 /** Calculates the lifetime of each tensor handle
+ *
+ * The lifetime of a handle ends once all the tasks reading it are guaranteed to have completed, so that the tasks
+ * running concurrently with its last reader don't reuse its memory.
  *
  * @param[in, out] tasks_handles Tensor handles for each task
+ * @param[in]      completed     Tasks completed before the task at each position starts, see @ref find_completed_tasks
  * @param[in]      hc            Data structure that keeps the handles reference count
  */
-void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc)
+void configure_handle_lifetime(std::vector<TaskHandles>             &tasks_handles,
+                               const std::vector<std::vector<bool>> &completed,
+                               const HandleCounter                  &hc)
 {
     // Identify max number of tensors in flight
     HandleCounter tensors_in_flight;
 
+    // Tasks reading each handle
+    std::map<ITensorHandle *, std::vector<unsigned int>> readers;
+    for (unsigned int task_idx = 0; task_idx < tasks_handles.size(); ++task_idx)
+    {
+        for (auto &input_handle : tasks_handles[task_idx].input_handles)
+        {
+            readers[input_handle.first].push_back(task_idx);
+        }
+    }
+
     // Acquires the given handles and sets them as in flight if they aren't already
     auto acquire = [&](std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> &handles)
     {
@@ -209,14 +277,38 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         }
     };
 
-    for (auto &task_handle : tasks_handles)
+    // Ends the lifetime of the handles no longer read whose readers have completed before the given position
+    std::vector<ITensorHandle *> unread_handles;
+    auto                         release = [&](size_t position)
+    {
+        auto handle_it = unread_handles.begin();
+        while (handle_it != unread_handles.end())
+        {
+            const auto &handle_readers = readers[*handle_it];
+            if (std::all_of(handle_readers.begin(), handle_readers.end(),
+                            [&](unsigned int reader) { return completed[position][reader]; }))
+            {
+                // End of allocation's lifetime
+                (*handle_it)->allocate();
+                handle_it = unread_handles.erase(handle_it);
+            }
+            else
+            {
+                ++handle_it;
+            }
+        }
+    };
+
+    for (size_t task_idx = 0; task_idx < tasks_handles.size(); ++task_idx)
     {
+        release(task_idx);
+
         // Marking all the input and output tensors of the task as in flight
-        acquire(task_handle.input_handles);
-        acquire(task_handle.output_handles);
+        acquire(tasks_handles[task_idx].input_handles);
+        acquire(tasks_handles[task_idx].output_handles);
 
         // Releasing the input tensors
-        for (auto &input_handle : task_handle.input_handles)
+        for (auto &input_handle : tasks_handles[task_idx].input_handles)
         {
             ITensorHandle *ihandle = input_handle.first;
             ARM_COMPUTE_ERROR_ON(ihandle == nullptr);
@@ -226,11 +318,11 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
             {
                 // Remove tensor for tensors in flight
                 tensors_in_flight.erase(ihandle);
-                // End of allocation's lifetime
-                ihandle->allocate();
+                unread_handles.push_back(ihandle);
             }
         }
     }
+    release(tasks_handles.size());
 }
 } // namespace
 
@@ -252,6 +344,9 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         count_input_handles_per_target(tasks_handles.back(), target_handle_count);
     }
 
+    // The tasks run concurrently when the dependencies between them have been configured
+    const std::vector<std::vector<bool>> completed = find_completed_tasks(workload.tasks.size(), workload.dependents);
+
     // Setup memory managers
     for (auto &hc : target_handle_count)
     {
@@ -261,7 +356,7 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
             if (mm_ctx->cross_mm != nullptr && mm_ctx->cross_group != nullptr)
             {
                 // Manage and allocate tensors
-                configure_handle_lifetime(tasks_handles, hc.second);
+                configure_handle_lifetime(tasks_handles, completed, hc.second);
             }
         }
     }
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/DynamicBatchExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstring>
+#include <map>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Tensor holding the first samples of the storage of a batched tensor */
+class BatchView final : public ITensor
+{
+public:
+    /** Looks at the first samples of a storage
+     *
+     * @param[in] storage   Storage holding the maximum batch
+     * @param[in] dimension Dimension holding the samples
+     * @param[in] size      Elements along the batch dimension
+     */
+    void reset(arm_compute::Tensor &storage, unsigned int dimension, size_t size)
+    {
+        const TensorInfo &info  = storage.allocator()->info();
+        TensorShape       shape = info.tensor_shape();
+        shape.set(dimension, size, false);
+
+        // Keep the strides of the storage, the samples past the batch are skipped
+        _info = info;
+        _info.init(shape, info.num_channels(), info.data_type(), info.strides_in_bytes(),
+                   info.offset_first_element_in_bytes(), info.total_size());
+        _buffer = storage.buffer();
+    }
+
+    // Inherited methods overridden:
+    ITensorInfo *info() const override
+    {
+        return &_info;
+    }
+    ITensorInfo *info() override
+    {
+        return &_info;
+    }
+    uint8_t *buffer() const override
+    {
+        return _buffer;
+    }
+
+private:
+    mutable TensorInfo _info{};
+    uint8_t           *_buffer{nullptr};
+};
+
+/** Storage of the maximum batch of an input or output */
+struct BatchedStorage
+{
+    BatchedTensor       tensor{};
+    arm_compute::Tensor storage{};
+    BatchView           view{};
+};
+
+/** Copies a chunk of samples between the storage of a batched tensor and the tensor of the graph
+ *
+ * @param[in, out] storage    Storage of the batched tensor
+ * @param[in, out] tensor     Tensor of the graph holding a chunk
+ * @param[in]      to_storage Copy the tensor of the graph to the storage, the other way round otherwise
+ * @param[in]      offset     Offset of the chunk in the storage along the batch dimension
+ */
+void copy_chunk(BatchedStorage &storage, ITensor &tensor, bool to_storage, size_t offset)
+{
+    const ITensorInfo &info      = *tensor.info();
+    const size_t       row_size  = info.dimension(0) * info.element_size();
+    const unsigned int dimension = storage.tensor.dimension;
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            Coordinates storage_id = id;
+                            storage_id.set(dimension, id[dimension] + offset);
+
+                            uint8_t *chunk_ptr   = tensor.ptr_to_element(id);
+                            uint8_t *storage_ptr = storage.storage.ptr_to_element(storage_id);
+                            if (to_storage)
+                            {
+                                std::memcpy(storage_ptr, chunk_ptr, row_size);
+                            }
+                            else
+                            {
+                                std::memcpy(chunk_ptr, storage_ptr, row_size);
+                            }
+                        });
+}
+
+/** Calls the accessors of batched tensors on the samples of the batch
+ *
+ * @return True if all the accessors are valid
+ */
+bool call_batched_accessors(Graph &g, std::vector<std::unique_ptr<BatchedStorage>> &tensors, bool is_input)
+{
+    bool is_valid = true;
+    for (auto &t : tensors)
+    {
+        INode           *node     = g.node(t->tensor.node_id);
+        Tensor          *tensor   = is_input ? node->output(0) : node->input(0);
+        ITensorAccessor *accessor = tensor != nullptr ? tensor->accessor() : nullptr;
+        is_valid                  = is_valid && accessor != nullptr && accessor->access_tensor(t->view);
+    }
+    return is_valid;
+}
+
+/** Replaces a node by another one of the same type
+ *
+ * @return ID of the new node
+ */
+NodeID replace_node(Graph &g, NodeID old_id, NodeID new_id)
+{
+    INode *old_node = g.node(old_id);
+    INode *new_node = g.node(new_id);
+    new_node->set_common_node_parameters(old_node->common_node_params());
+
+    std::vector<std::pair<size_t, NodeIdxPair>> producers;
+    for (size_t idx = 0; idx < old_node->num_inputs(); ++idx)
+    {
+        const Edge *edge = g.edge(old_node->input_edge_id(idx));
+        if (edge != nullptr)
+        {
+            producers.push_back({idx, {edge->producer_id(), edge->producer_idx()}});
+        }
+    }
+    std::vector<std::pair<size_t, NodeIdxPair>> consumers;
+    for (auto &edge_id : old_node->output_edges())
+    {
+        const Edge *edge = g.edge(edge_id);
+        consumers.push_back({edge->producer_idx(), {edge->consumer_id(), edge->consumer_idx()}});
+    }
+    for (size_t idx = 0; idx < old_node->num_outputs(); ++idx)
+    {
+        new_node->output(idx)->set_accessor(old_node->output(idx)->extract_accessor());
+    }
+
+    g.remove_node(old_id);
+    for (auto &producer : producers)
+    {
+        g.add_connection(producer.second.node_id, producer.second.index, new_id, producer.first);
+    }
+    for (auto &consumer : consumers)
+    {
+        g.add_connection(new_id, consumer.first, consumer.second.node_id, consumer.second.index);
+    }
+    return new_id;
+}
+
+/** Checks whether a node combines the samples of a batch */
+bool mixes_samples(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConcatenateLayer:
+            return static_cast<const ConcatenateLayerNode &>(node).concatenation_axis() ==
+                   DataLayoutDimension::BATCHES;
+        case NodeType::DetectionOutputLayer:
+        case NodeType::DetectionPostProcessLayer:
+        case NodeType::StackLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+} // namespace
+
+struct DynamicBatchExecutor::Impl
+{
+    std::vector<std::unique_ptr<BatchedStorage>> inputs{};
+    std::vector<std::unique_ptr<BatchedStorage>> outputs{};
+    unsigned int                                 max_batch_size{0};
+    unsigned int                                 chunk_size{0};
+    unsigned int                                 batch_size{0};
+};
+
+DynamicBatchExecutor::DynamicBatchExecutor(std::vector<BatchedTensor> inputs,
+                                           std::vector<BatchedTensor> outputs,
+                                           unsigned int               max_batch_size,
+                                           unsigned int               chunk_size)
+    : _impl(std::make_unique<Impl>())
+{
+    ARM_COMPUTE_ERROR_ON(chunk_size == 0 || chunk_size > max_batch_size);
+
+    _impl->max_batch_size = max_batch_size;
+    _impl->chunk_size     = chunk_size;
+
+    // The storage is rounded up to whole chunks, the last chunk of a batch is run in full
+    const size_t num_samples = ceil_to_multiple(max_batch_size, chunk_size);
+    auto         add_storage = [&](std::vector<std::unique_ptr<BatchedStorage>> &storages, const BatchedTensor &tensor)
+    {
+        auto storage    = std::make_unique<BatchedStorage>();
+        storage->tensor = tensor;
+
+        TensorShape shape = tensor.desc.shape;
+        shape.set(tensor.dimension, num_samples * tensor.sample_size, false);
+        TensorInfo info(shape, 1, tensor.desc.data_type, tensor.desc.quant_info);
+        info.set_data_layout(tensor.desc.layout);
+        storage->storage.allocator()->init(info);
+        storage->storage.allocator()->allocate();
+
+        storages.push_back(std::move(storage));
+    };
+    for (auto &input : inputs)
+    {
+        add_storage(_impl->inputs, input);
+    }
+    for (auto &output : outputs)
+    {
+        add_storage(_impl->outputs, output);
+    }
+
+    set_batch_size(max_batch_size);
+}
+
+DynamicBatchExecutor::~DynamicBatchExecutor() = default;
+
+unsigned int DynamicBatchExecutor::max_batch_size() const
+{
+    return _impl->max_batch_size;
+}
+
+unsigned int DynamicBatchExecutor::batch_size() const
+{
+    return _impl->batch_size;
+}
+
+void DynamicBatchExecutor::set_batch_size(unsigned int batch_size)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(batch_size == 0 || batch_size > _impl->max_batch_size,
+                             "The batch must be between 1 and the batch the graph was built with!");
+
+    _impl->batch_size = batch_size;
+    for (auto *storages : {&_impl->inputs, &_impl->outputs})
+    {
+        for (auto &t : *storages)
+        {
+            t->view.reset(t->storage, t->tensor.dimension, batch_size * t->tensor.sample_size);
+        }
+    }
+}
+
+void DynamicBatchExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    Graph &g = *workload.graph;
+
+    const unsigned int num_chunks = DIV_CEIL(_impl->batch_size, _impl->chunk_size);
+    while (true)
+    {
+        if (!call_batched_accessors(g, _impl->inputs, true))
+        {
+            return;
+        }
+
+        for (unsigned int chunk = 0; chunk < num_chunks; ++chunk)
+        {
+            for (auto &input : _impl->inputs)
+            {
+                ITensor &tensor = g.node(input->tensor.node_id)->output(0)->handle()->tensor();
+                copy_chunk(*input, tensor, false, chunk * _impl->chunk_size * input->tensor.sample_size);
+            }
+
+            call_all_tasks(workload);
+
+            for (auto &output : _impl->outputs)
+            {
+                ITensor &tensor = g.node(output->tensor.node_id)->input(0)->handle()->tensor();
+                copy_chunk(*output, tensor, true, chunk * _impl->chunk_size * output->tensor.sample_size);
+            }
+        }
+
+        const bool is_valid = call_batched_accessors(g, _impl->outputs, false);
+        sync_backends();
+        if (!is_valid)
+        {
+            return;
+        }
+    }
+}
+
+std::shared_ptr<DynamicBatchExecutor> lower_batch_size(Graph &g, unsigned int chunk_size)
+{
+    ARM_COMPUTE_ERROR_ON(chunk_size == 0);
+
+    const std::vector<NodeID> input_ids  = g.nodes(NodeType::Input);
+    const std::vector<NodeID> output_ids = g.nodes(NodeType::Output);
+    if (input_ids.empty())
+    {
+        return nullptr;
+    }
+
+    unsigned int max_batch_size = 0;
+    for (auto &id : input_ids)
+    {
+        const unsigned int batch =
+            get_dimension_size(g.node(id)->output(0)->desc(), DataLayoutDimension::BATCHES);
+        if (max_batch_size != 0 && batch != max_batch_size)
+        {
+            ARM_COMPUTE_ERROR("The inputs of the graph have different batches!");
+        }
+        max_batch_size = batch;
+    }
+    if (max_batch_size <= 1)
+    {
+        ARM_COMPUTE_ERROR("Cannot set the batch at execution time of a graph built with a batch of 1!");
+    }
+    chunk_size = std::min(chunk_size, max_batch_size);
+
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && mixes_samples(*node))
+        {
+            ARM_COMPUTE_ERROR("Cannot run a graph combining the samples of its batch over chunks of the batch!");
+        }
+    }
+
+    // Remember the shapes the outputs and the reshapes expect for the maximum batch
+    std::map<NodeID, TensorDescriptor> output_descs;
+    for (auto &id : output_ids)
+    {
+        const Tensor *tensor = g.node(id)->input(0);
+        ARM_COMPUTE_ERROR_ON(tensor == nullptr);
+        output_descs.emplace(id, tensor->desc());
+    }
+    std::map<NodeID, size_t> reshape_sizes;
+    for (auto &id : g.nodes(NodeType::ReshapeLayer))
+    {
+        reshape_sizes.emplace(id, g.node(id)->input(0)->desc().shape.total_size());
+    }
+
+    std::vector<BatchedTensor> inputs;
+    for (auto &id : input_ids)
+    {
+        const TensorDescriptor desc = g.node(id)->output(0)->desc();
+        const auto dimension = static_cast<unsigned int>(get_dimension_idx(desc.layout, DataLayoutDimension::BATCHES));
+
+        TensorDescriptor chunk_desc = desc;
+        chunk_desc.shape.set(dimension, chunk_size, false);
+
+        const NodeID new_id = replace_node(g, id, g.add_node<InputNode>(chunk_desc));
+        inputs.push_back(BatchedTensor{new_id, desc, dimension, 1});
+    }
+
+    // The reshapes of batched tensors have their outermost dimension scaled to the chunk
+    for (auto &id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        auto reshape = reshape_sizes.find(id);
+        if (reshape != reshape_sizes.end() && node->input(0)->desc().shape.total_size() != reshape->second)
+        {
+            TensorShape        shape     = node->output(0)->desc().shape;
+            const unsigned int dimension = shape.num_dimensions() - 1;
+            if (shape[dimension] % max_batch_size != 0)
+            {
+                ARM_COMPUTE_ERROR("Cannot find the batch in the outermost dimension of a reshape!");
+            }
+            shape.set(dimension, shape[dimension] / max_batch_size * chunk_size, false);
+            replace_node(g, id, g.add_node<ReshapeLayerNode>(shape));
+            continue;
+        }
+        node->forward_descriptors();
+    }
+
+    // Every output holds the samples along a single dimension
+    std::vector<BatchedTensor> outputs;
+    for (auto &id : output_ids)
+    {
+        const TensorDescriptor &desc       = output_descs.at(id);
+        const TensorShape      &chunk_shape = g.node(id)->input(0)->desc().shape;
+
+        int dimension = -1;
+        for (unsigned int d = 0; d < TensorShape::num_max_dimensions; ++d)
+        {
+            if (desc.shape[d] != chunk_shape[d])
+            {
+                if (dimension != -1)
+                {
+                    ARM_COMPUTE_ERROR("An output holds the samples along several dimensions!");
+                }
+                dimension = d;
+            }
+        }
+        if (dimension == -1 && chunk_size == max_batch_size)
+        {
+            dimension = desc.shape.num_dimensions() - 1;
+        }
+        if (dimension == -1 || desc.shape[dimension] % max_batch_size != 0 ||
+            desc.shape[dimension] / max_batch_size * chunk_size != chunk_shape[dimension])
+        {
+            ARM_COMPUTE_ERROR("An output does not hold the samples of the batch!");
+        }
+        const auto sample_size = static_cast<unsigned int>(desc.shape[dimension] / max_batch_size);
+        outputs.push_back(BatchedTensor{id, desc, static_cast<unsigned int>(dimension), sample_size});
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Lowered a batch of " << max_batch_size << " samples to chunks of " << chunk_size
+                                                        << std::endl);
+    return std::make_shared<DynamicBatchExecutor>(std::move(inputs), std::move(outputs), max_batch_size, chunk_size);
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
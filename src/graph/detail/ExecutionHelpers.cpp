@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,11 +24,16 @@
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/BranchExecutor.h"
+#include "arm_compute/graph/detail/PipelineExecutor.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -229,6 +234,122 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+void configure_task_dependencies(ExecutionWorkload         &workload,
+                                 const std::vector<NodeID> &node_order,
+                                 unsigned int               num_branches)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    Graph &g = *workload.graph;
+
+    // Only the CPU backend can share the threads of its scheduler between concurrent tasks
+    const bool cpu_only = std::all_of(std::begin(workload.tasks), std::end(workload.tasks),
+                                      [](const ExecutionTask &task)
+                                      { return task.node->assigned_target() == Target::NEON; });
+    if (num_branches < 2 || !cpu_only)
+    {
+        return;
+    }
+
+    std::vector<int> node_task(g.nodes().size(), -1);
+    for (unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        node_task[workload.tasks[i].node->id()] = i;
+    }
+
+    // The tasks a node waits for are the tasks of its producers, nodes without a task (e.g. concatenations of
+    // sub-tensors) forward the tasks of their own producers.
+    std::vector<std::vector<unsigned int>> node_sources(g.nodes().size());
+    std::vector<std::vector<unsigned int>> dependents(workload.tasks.size());
+    std::vector<unsigned int>              num_dependencies(workload.tasks.size(), 0);
+    for (auto &node_id : node_order)
+    {
+        const INode *node = g.node(node_id);
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        std::vector<unsigned int> sources;
+        for (auto &edge_id : node->input_edges())
+        {
+            const Edge *edge = g.edge(edge_id);
+            if (edge != nullptr && edge->producer() != nullptr)
+            {
+                const auto &producer_sources = node_sources[edge->producer_id()];
+                sources.insert(sources.end(), producer_sources.begin(), producer_sources.end());
+            }
+        }
+        std::sort(sources.begin(), sources.end());
+        sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+
+        const int task_idx = node_task[node_id];
+        if (task_idx >= 0)
+        {
+            for (auto &source : sources)
+            {
+                ARM_COMPUTE_ERROR_ON(source >= static_cast<unsigned int>(task_idx));
+                dependents[source].push_back(task_idx);
+            }
+            num_dependencies[task_idx] = sources.size();
+            node_sources[node_id]      = {static_cast<unsigned int>(task_idx)};
+        }
+        else
+        {
+            node_sources[node_id] = std::move(sources);
+        }
+    }
+
+    // The tasks form a single chain if none of them has two dependents and only one has no dependency
+    const bool has_fork = std::any_of(std::begin(dependents), std::end(dependents),
+                                      [](const std::vector<unsigned int> &task_dependents)
+                                      { return task_dependents.size() > 1; });
+    const auto num_roots = std::count(std::begin(num_dependencies), std::end(num_dependencies), 0U);
+    if (!has_fork && num_roots < 2)
+    {
+        return;
+    }
+
+    workload.dependents      = std::move(dependents);
+    workload.branch_executor = std::make_shared<BranchExecutor>(num_branches, Scheduler::get().num_threads());
+}
+
+void configure_pipeline_stages(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    unsigned int num_stages = 1;
+    for (auto &task : workload.tasks)
+    {
+        num_stages = std::max(num_stages, task.node->pipeline_stage() + 1);
+    }
+    if (num_stages < 2)
+    {
+        return;
+    }
+
+    std::vector<PipelineStage> stages(num_stages);
+    for (unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        const INode       *node  = workload.tasks[i].node;
+        const unsigned int stage = node->pipeline_stage();
+
+        // Only the copies inserted by the mutator read the tensors of a previous stage
+        bool is_stage_input = false;
+        for (auto &edge_id : node->input_edges())
+        {
+            const Edge *edge = workload.graph->edge(edge_id);
+            if (edge != nullptr && edge->producer() != nullptr && edge->producer()->type() != NodeType::Const &&
+                edge->producer()->pipeline_stage() < stage)
+            {
+                is_stage_input = true;
+            }
+        }
+        (is_stage_input ? stages[stage].input_tasks : stages[stage].tasks).push_back(i);
+    }
+
+    workload.pipeline_executor = std::make_shared<PipelineExecutor>(std::move(stages), Scheduler::get().num_threads());
+}
+
 void call_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
@@ -243,9 +364,16 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for (auto &task : workload.tasks)
+    if (workload.branch_executor != nullptr)
     {
-        task();
+        workload.branch_executor->run(workload.tasks, workload.dependents);
+    }
+    else
+    {
+        for (auto &task : workload.tasks)
+        {
+            task();
+        }
     }
 
     // Release memory for the transition buffers
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/PipelineExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** State of the tensors exchanged between two consecutive stages */
+enum class BoundaryState
+{
+    Empty, /**< The next stage has copied the tensors, they can be overwritten */
+    Full,  /**< The tensors of an inference are waiting to be copied by the next stage */
+    End    /**< There are no more inferences */
+};
+
+/** Creates the scheduler of a stage
+ *
+ * @note Must be called from the thread running the stage, which is pinned with the threads of the scheduler
+ *
+ * @param[in] num_threads Number of threads of the stage, including the thread running the stage
+ * @param[in] first_core  Index of the first core of the stage
+ *
+ * @return The scheduler of the stage
+ */
+std::unique_ptr<IScheduler> create_stage_scheduler(unsigned int num_threads, unsigned int first_core)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    auto scheduler = std::make_unique<CPPScheduler>();
+    scheduler->set_num_threads_with_affinity(num_threads, [first_core](int idx, int num_cores)
+                                             { return (static_cast<int>(first_core) + idx) % std::max(num_cores, 1); });
+    return scheduler;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(num_threads, first_core);
+    return std::make_unique<SingleThreadScheduler>();
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+} // namespace
+
+struct PipelineExecutor::Impl
+{
+    /** Runs a list of tasks of the workload
+     *
+     * @param[in] task_ids Indices of the tasks to run
+     */
+    void run_tasks(const std::vector<unsigned int> &task_ids)
+    {
+        for (auto &task_id : task_ids)
+        {
+            workload->tasks[task_id]();
+        }
+    }
+
+    /** Updates the state of a boundary and wakes up the stages waiting on it
+     *
+     * @param[in] boundary Index of the boundary, between the stages @p boundary and @p boundary + 1
+     * @param[in] state    New state of the boundary
+     */
+    void set_boundary(unsigned int boundary, BoundaryState state)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            boundaries[boundary] = state;
+        }
+        boundary_cv.notify_all();
+    }
+
+    /** Streams the inferences through a stage until the end of the execution
+     *
+     * @param[in] stage Index of the stage
+     */
+    void run_stage(unsigned int stage)
+    {
+        const bool first = (stage == 0);
+        const bool last  = (stage == boundaries.size());
+
+        while (true)
+        {
+            {
+                // Wait for an inference from the previous stage and for the next stage to have copied the previous one
+                std::unique_lock<std::mutex> lock(mutex);
+                boundary_cv.wait(lock,
+                                 [&]
+                                 {
+                                     return stop || ((first || boundaries[stage - 1] != BoundaryState::Empty) &&
+                                                     (last || boundaries[stage] == BoundaryState::Empty));
+                                 });
+                if (stop)
+                {
+                    return;
+                }
+                if (!first && boundaries[stage - 1] == BoundaryState::End)
+                {
+                    if (!last)
+                    {
+                        boundaries[stage] = BoundaryState::End;
+                    }
+                    lock.unlock();
+                    boundary_cv.notify_all();
+                    return;
+                }
+            }
+
+            if (first && !call_all_input_node_accessors(*workload))
+            {
+                set_boundary(stage, BoundaryState::End);
+                return;
+            }
+
+            run_tasks(stages[stage].input_tasks);
+            if (!first)
+            {
+                set_boundary(stage - 1, BoundaryState::Empty);
+            }
+
+            run_tasks(stages[stage].tasks);
+            if (!last)
+            {
+                set_boundary(stage, BoundaryState::Full);
+            }
+            else if (!call_all_output_node_accessors(*workload))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                boundary_cv.notify_all();
+                return;
+            }
+        }
+    }
+
+    /** Main loop of the thread of a stage
+     *
+     * @param[in] stage             Index of the stage
+     * @param[in] threads_per_stage Number of threads of each stage
+     */
+    void worker_loop(unsigned int stage, unsigned int threads_per_stage)
+    {
+        schedulers[stage] = create_stage_scheduler(threads_per_stage, stage * threads_per_stage);
+        Scheduler::set_thread_scheduler(schedulers[stage].get());
+
+        unsigned int last_generation = 0;
+        while (true)
+        {
+            CPPRuntimeContext *context = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_cv.wait(lock, [&] { return shutdown || generation != last_generation; });
+                if (shutdown)
+                {
+                    break;
+                }
+                last_generation = generation;
+                context         = runtime_ctx;
+            }
+
+            // The stages run with the runtime context of the thread running the graph
+            CPPRuntimeContextScope runtime_scope(context);
+            std::exception_ptr     exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                run_stage(stage);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (exception != nullptr)
+                {
+                    // Unblock the other stages
+                    last_exception = exception;
+                    stop           = true;
+                    boundary_cv.notify_all();
+                }
+                if (--pending == 0)
+                {
+                    done_cv.notify_one();
+                }
+            }
+        }
+
+        Scheduler::set_thread_scheduler(nullptr);
+        schedulers[stage].reset();
+    }
+
+    std::vector<PipelineStage>               stages{};
+    std::vector<std::unique_ptr<IScheduler>> schedulers{};
+    std::vector<std::thread>                 workers{};
+    std::vector<BoundaryState>               boundaries{};
+    ExecutionWorkload                       *workload{nullptr};
+    CPPRuntimeContext                       *runtime_ctx{nullptr};
+    std::mutex                               mutex{};
+    std::condition_variable                  work_cv{};
+    std::condition_variable                  boundary_cv{};
+    std::condition_variable                  done_cv{};
+    std::exception_ptr                       last_exception{nullptr};
+    unsigned int                             generation{0};
+    unsigned int                             pending{0};
+    bool                                     stop{false};
+    bool                                     shutdown{false};
+};
+
+PipelineExecutor::PipelineExecutor(std::vector<PipelineStage> stages, unsigned int num_threads)
+    : _impl(std::make_unique<Impl>())
+{
+    ARM_COMPUTE_ERROR_ON(stages.size() < 2);
+
+    const unsigned int num_stages        = stages.size();
+    const unsigned int threads_per_stage = std::max(1U, num_threads / num_stages);
+
+    _impl->stages = std::move(stages);
+    _impl->schedulers.resize(num_stages);
+    _impl->boundaries.resize(num_stages - 1, BoundaryState::Empty);
+    for (unsigned int stage = 0; stage < num_stages; ++stage)
+    {
+        _impl->workers.emplace_back(&Impl::worker_loop, _impl.get(), stage, threads_per_stage);
+    }
+}
+
+PipelineExecutor::~PipelineExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->shutdown = true;
+    }
+    _impl->work_cv.notify_all();
+    for (auto &worker : _impl->workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int PipelineExecutor::num_stages() const
+{
+    return _impl->stages.size();
+}
+
+void PipelineExecutor::run(ExecutionWorkload &workload)
+{
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        std::fill(_impl->boundaries.begin(), _impl->boundaries.end(), BoundaryState::Empty);
+        _impl->workload       = &workload;
+        _impl->runtime_ctx    = CPPRuntimeContext::thread_context();
+        _impl->pending        = _impl->workers.size();
+        _impl->last_exception = nullptr;
+        _impl->stop           = false;
+        ++_impl->generation;
+    }
+    _impl->work_cv.notify_all();
+
+    std::unique_lock<std::mutex> lock(_impl->mutex);
+    _impl->done_cv.wait(lock, [&] { return _impl->pending == 0; });
+    std::exception_ptr exception = _impl->last_exception;
+    lock.unlock();
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,11 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::set_batch_size(unsigned int batch_size)
+{
+    _manager.set_batch_size(_g, batch_size);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,9 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
 #include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
 #include "arm_compute/graph/nodes/FusedDepthwiseConvolutionBatchNormalizationNode.h"
 
 #include "support/Cast.h"
@@ -77,6 +79,32 @@ bool output_edges_are_separate_tensors(Graph &g, const Edge *input_edge)
                        });
 }
 
+// Check if the output of the node is the residual input of a convolution. Such a convolution accumulates into the
+// very same tensor, so re-binding the output of the node would break the aliasing.
+bool output_is_residual_input(Graph &g, const INode &node)
+{
+    const auto output_edges = node.output_edges();
+    return std::any_of(output_edges.begin(), output_edges.end(),
+                       [&](const EdgeID &edge_id)
+                       {
+                           const Edge *edge = g.edge(edge_id);
+                           if (edge == nullptr || edge->consumer() == nullptr)
+                           {
+                               return false;
+                           }
+                           switch (edge->consumer()->type())
+                           {
+                               case NodeType::ConvolutionLayer:
+                                   return edge->consumer_idx() == ConvolutionLayerNode::residual_input_idx;
+                               case NodeType::FusedConvolutionBatchNormalizationLayer:
+                                   return edge->consumer_idx() ==
+                                          FusedConvolutionBatchNormalizationNode::residual_input_idx;
+                               default:
+                                   return false;
+                           }
+                       });
+}
+
 // If do in-place calculation, then need to use the new output and inherit original output's accessor
 void set_new_output_and_inherit_accessor(std::unique_ptr<INode> &node, Tensor *orig_output, Tensor *new_output)
 {
@@ -239,7 +267,8 @@ void InPlaceOperationMutator::mutate(Graph &g)
             Edge *input_edge = node->input_edge(0);
 
             // Check if parent has a single output if yes then force in place calculation else not
-            if ((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
+            if ((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge) &&
+                !output_is_residual_input(g, *node))
             {
                 if (node->type() == NodeType::EltwiseLayer)
                 {
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/LayoutTypePlanningMutator.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Data layout and data type a node runs in, or a tensor is stored in */
+struct PlanConfig
+{
+    DataLayout layout;
+    DataType   data_type;
+    bool       fast_math;
+};
+
+// Cost model, in cycles of a single core running F32 NHWC code
+constexpr float mac_cost     = 1.f / 16.f; // Multiply-accumulate of the layers with weights
+constexpr float element_cost = 1.f / 4.f;  // Output element of the other layers
+constexpr float permute_cost = 1.f;        // Element moved by a permutation
+constexpr float cast_cost    = 0.5f;       // Element converted by a cast
+
+bool has_weights(NodeType type)
+{
+    return type == NodeType::ConvolutionLayer || type == NodeType::DepthwiseConvolutionLayer ||
+           type == NodeType::FullyConnectedLayer;
+}
+
+/** Relative cost of running a node in a data layout */
+float layout_factor(NodeType type, DataLayout layout)
+{
+    if (layout == DataLayout::NHWC)
+    {
+        return 1.f;
+    }
+
+    switch (type)
+    {
+        case NodeType::ConvolutionLayer:
+            // im2col and col2im around the matrix multiplication
+            return 1.25f;
+        case NodeType::DepthwiseConvolutionLayer:
+            // The optimized depthwise kernels only process NHWC
+            return 2.f;
+        case NodeType::PoolingLayer:
+            // The channels are contiguous in NHWC and processed in vectors
+            return 1.5f;
+        default:
+            return 1.f;
+    }
+}
+
+/** Relative cost of running a node in a data type */
+float type_factor(const PlanConfig &config)
+{
+    if (config.data_type == DataType::F16)
+    {
+        // Twice the lanes per vector and half the memory traffic
+        return 0.5f;
+    }
+    if (config.fast_math)
+    {
+        // BF16 matrix multiplications, including the conversion of the operands
+        return 0.6f;
+    }
+    return 1.f;
+}
+
+float node_cost(const INode &node, const PlanConfig &config)
+{
+    const float work = static_cast<float>(estimate_node_cost(node)) *
+                       (has_weights(node.type()) ? mac_cost : element_cost);
+    return work * layout_factor(node.type(), config.layout) * type_factor(config);
+}
+
+bool is_spatial(const TensorDescriptor &desc)
+{
+    return desc.shape.num_dimensions() >= 3 && (desc.layout == DataLayout::NCHW || desc.layout == DataLayout::NHWC);
+}
+
+/** Check if an input is a constant that only feeds the node, it can then be recreated in any layout and data type
+ * instead of being converted at every run
+ */
+bool is_private_const(const Edge &edge)
+{
+    const INode *producer = edge.producer();
+    return producer != nullptr && producer->type() == NodeType::Const && producer->output_edges().size() == 1;
+}
+
+/** Check if the node computes the same result in NCHW and NHWC given its inputs in that layout */
+bool is_layout_agnostic(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+            if (polymorphic_downcast<const ConvolutionLayerNode *>(&node)->num_groups() != 1)
+            {
+                return false;
+            }
+            break;
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::PoolingLayer:
+            break;
+        default:
+            return false;
+    }
+
+    const Tensor *output = node.output(0);
+    if (output == nullptr || !is_spatial(output->desc()))
+    {
+        return false;
+    }
+
+    // The tensors the node does not own have to be permuted, element-wise nodes must not broadcast them
+    for (size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if (edge != nullptr && !is_private_const(*edge) &&
+            (!is_spatial(edge->tensor()->desc()) ||
+             (node.type() == NodeType::EltwiseLayer && edge->tensor()->desc().shape != output->desc().shape)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Check if the node can run in F16 and BF16 fast math instead of F32 */
+bool is_type_plannable(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::FullyConnectedLayer:
+        case NodeType::PoolingLayer:
+            break;
+        default:
+            return false;
+    }
+
+    for (size_t idx = 0; idx < node.num_outputs(); ++idx)
+    {
+        const Tensor *output = node.output(idx);
+        if (output == nullptr || output->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+    }
+    for (size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if (edge != nullptr && edge->tensor()->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Check if the constant inputs of the node allow to plan it
+ *
+ * The weights are transformed once when the backend functions are prepared, so they have to be recreated in the
+ * planned configuration rather than converted by a node running at every inference.
+ */
+bool has_private_parameters(const INode &node)
+{
+    if (!has_weights(node.type()) && node.type() != NodeType::BatchNormalizationLayer)
+    {
+        return true;
+    }
+    for (size_t idx = 1; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if (edge != nullptr && !is_private_const(*edge))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FastMathHint fast_math_hint(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+            return polymorphic_downcast<const ConvolutionLayerNode *>(&node)->fast_math_hint();
+        case NodeType::FullyConnectedLayer:
+            return polymorphic_downcast<const FullyConnectedLayerNode *>(&node)->fast_math_hint();
+        default:
+            return FastMathHint::Disabled;
+    }
+}
+
+void set_fast_math_hint(INode &node, FastMathHint hint)
+{
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        polymorphic_downcast<ConvolutionLayerNode *>(&node)->set_fast_math_hint(hint);
+    }
+    else if (node.type() == NodeType::FullyConnectedLayer)
+    {
+        polymorphic_downcast<FullyConnectedLayerNode *>(&node)->set_fast_math_hint(hint);
+    }
+}
+
+PermutationVector permutation_to(DataLayout layout)
+{
+    return (layout == DataLayout::NHWC) ? PermutationVector(2U, 0U, 1U) : PermutationVector(1U, 2U, 0U);
+}
+
+/** Configuration an input of a node has to be converted to */
+PlanConfig required_input_config(const TensorDescriptor &input, const PlanConfig &node_config)
+{
+    return PlanConfig{is_spatial(input) ? node_config.layout : input.layout, node_config.data_type, false};
+}
+
+bool needs_permute(const TensorDescriptor &input, const PlanConfig &from, const PlanConfig &to)
+{
+    return is_spatial(input) && from.layout != to.layout;
+}
+
+float conversion_cost(const Edge &edge, const PlanConfig &from, const PlanConfig &to)
+{
+    if (is_private_const(edge))
+    {
+        return 0.f;
+    }
+
+    const TensorDescriptor &desc     = edge.tensor()->desc();
+    const float             elements = static_cast<float>(desc.shape.total_size());
+    float                   cost     = 0.f;
+    if (needs_permute(desc, from, to))
+    {
+        cost += elements * permute_cost;
+    }
+    if (from.data_type != to.data_type)
+    {
+        cost += elements * cast_cost;
+    }
+    return cost;
+}
+
+/** Replaces a constant by a constant in another configuration, the accessor is expected to convert the data */
+void replace_const(Graph &g, const Edge &edge, const PlanConfig &config)
+{
+    INode       *old_const    = edge.producer();
+    const NodeID consumer_id  = edge.consumer_id();
+    const size_t consumer_idx = edge.consumer_idx();
+
+    TensorDescriptor desc = edge.tensor()->desc();
+    if (needs_permute(desc, PlanConfig{desc.layout, desc.data_type, false}, config))
+    {
+        permute(desc.shape, permutation_to(config.layout));
+    }
+    desc.layout    = config.layout;
+    desc.data_type = config.data_type;
+
+    const NodeID new_const_id = g.add_node<ConstNode>(desc);
+    INode       *new_const    = g.node(new_const_id);
+    new_const->set_common_node_parameters(old_const->common_node_params());
+    new_const->output(0)->set_accessor(old_const->output(0)->extract_accessor());
+
+    g.remove_node(old_const->id());
+    g.add_connection(new_const_id, 0, consumer_id, consumer_idx);
+}
+
+/** Adds the nodes converting an output to another configuration
+ *
+ * @return The output of the last conversion
+ */
+NodeIdxPair add_conversion(
+    Graph &g, NodeIdxPair source, const TensorDescriptor &desc, const PlanConfig &from, const PlanConfig &to)
+{
+    const NodeParams params = g.node(source.node_id)->common_node_params();
+
+    auto add_node = [&](NodeID nid, const std::string &suffix)
+    {
+        g.node(nid)->set_common_node_parameters(NodeParams{params.name + suffix, params.target});
+        g.add_connection(source.node_id, source.index, nid, 0);
+        source = NodeIdxPair{nid, 0};
+    };
+    auto add_cast = [&]()
+    { add_node(g.add_node<CastLayerNode>(to.data_type), "_to_" + string_from_data_type(to.data_type)); };
+    auto add_permute = [&]()
+    {
+        add_node(g.add_node<PermuteLayerNode>(permutation_to(to.layout), to.layout),
+                 "_to_" + string_from_data_layout(to.layout));
+    };
+
+    // Narrow before permuting and widen after, so that the permutation moves the smaller elements
+    const bool needs_cast   = from.data_type != to.data_type;
+    const bool narrow_first = needs_cast && data_size_from_type(to.data_type) < data_size_from_type(from.data_type);
+    if (narrow_first)
+    {
+        add_cast();
+    }
+    if (needs_permute(desc, from, to))
+    {
+        add_permute();
+    }
+    if (needs_cast && !narrow_first)
+    {
+        add_cast();
+    }
+    return source;
+}
+} // namespace
+
+LayoutTypePlanningMutator::LayoutTypePlanningMutator(Target target, bool plan_layout, bool plan_data_type)
+    : _target(target), _plan_layout(plan_layout), _plan_data_type(plan_data_type)
+{
+}
+
+const char *LayoutTypePlanningMutator::name()
+{
+    return "LayoutTypePlanningMutator";
+}
+
+IGraphMutator::MutationType LayoutTypePlanningMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void LayoutTypePlanningMutator::mutate(Graph &g)
+{
+    // The precision of the backend functions is only known for the CPU
+    const bool plan_fp16 = _plan_data_type && _target == Target::NEON && CPUInfo::get().has_fp16();
+    const bool plan_bf16 = _plan_data_type && _target == Target::NEON && CPUInfo::get().has_bf16();
+    if (!_plan_layout && !plan_fp16 && !plan_bf16)
+    {
+        return;
+    }
+
+    const std::vector<NodeID> node_order = dfs(g);
+
+    // Planned configuration of the tensors and of the nodes, the nodes that are not planned keep the configuration
+    // of the descriptors they were created with
+    std::vector<PlanConfig> tensor_config(g.tensors().size(),
+                                          PlanConfig{DataLayout::UNKNOWN, DataType::UNKNOWN, false});
+    for (const auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr)
+        {
+            tensor_config[tensor->id()] = PlanConfig{tensor->desc().layout, tensor->desc().data_type, false};
+        }
+    }
+    std::map<NodeID, PlanConfig> node_config;
+
+    for (const auto &node_id : node_order)
+    {
+        const INode *node = g.node(node_id);
+        if (node == nullptr || node->num_outputs() == 0 || node->output(0) == nullptr || !has_private_parameters(*node))
+        {
+            continue;
+        }
+
+        const TensorDescriptor &output_desc = node->output(0)->desc();
+        const bool              fast_math   = fast_math_hint(*node) == FastMathHint::Enabled;
+        const PlanConfig        original{output_desc.layout, output_desc.data_type, fast_math};
+
+        const bool plan_layout = _plan_layout && is_layout_agnostic(*node);
+        const bool plan_type   = (plan_fp16 || plan_bf16) && is_type_plannable(*node);
+        if (!plan_layout && !plan_type)
+        {
+            continue;
+        }
+
+        std::vector<PlanConfig> candidates;
+        for (const auto layout : {original.layout, (original.layout == DataLayout::NCHW) ? DataLayout::NHWC
+                                                                                         : DataLayout::NCHW})
+        {
+            if (layout != original.layout && !plan_layout)
+            {
+                break;
+            }
+            candidates.push_back(PlanConfig{layout, original.data_type, fast_math});
+            if (plan_type && plan_fp16)
+            {
+                candidates.push_back(PlanConfig{layout, DataType::F16, fast_math});
+            }
+            if (plan_type && plan_bf16 && !fast_math &&
+                (node->type() == NodeType::ConvolutionLayer || node->type() == NodeType::FullyConnectedLayer))
+            {
+                candidates.push_back(PlanConfig{layout, original.data_type, true});
+            }
+        }
+
+        // Pick the cheapest configuration including the conversion of the inputs, the original one on a tie
+        float      best_cost = 0.f;
+        PlanConfig best      = original;
+        for (size_t c = 0; c < candidates.size(); ++c)
+        {
+            float cost = node_cost(*node, candidates[c]);
+            for (size_t idx = 0; idx < node->num_inputs(); ++idx)
+            {
+                const Edge *edge = node->input_edge(idx);
+                if (edge != nullptr)
+                {
+                    cost += conversion_cost(*edge, tensor_config[edge->tensor_id()],
+                                            required_input_config(edge->tensor()->desc(), candidates[c]));
+                }
+            }
+            if (c == 0 || cost < best_cost)
+            {
+                best_cost = cost;
+                best      = candidates[c];
+            }
+        }
+
+        node_config[node_id] = best;
+        for (size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            tensor_config[node->output_id(idx)] = PlanConfig{best.layout, best.data_type, false};
+        }
+    }
+
+    // Convert the inputs whose planned configuration differs from the one of their consumer. The conversions of the
+    // same output are shared between its consumers.
+    std::map<std::tuple<NodeID, size_t, DataLayout, DataType>, NodeIdxPair> conversions;
+    unsigned int                                                            num_planned = 0;
+    for (const auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr || node->type() == NodeType::Const || node->type() == NodeType::Input)
+        {
+            continue;
+        }
+
+        const auto planned = node_config.find(node_id);
+        for (size_t idx = 0; idx < node->num_inputs(); ++idx)
+        {
+            const Edge *edge = node->input_edge(idx);
+            if (edge == nullptr || edge->tensor_id() >= tensor_config.size())
+            {
+                continue;
+            }
+
+            const TensorDescriptor &desc = edge->tensor()->desc();
+            const PlanConfig        from = tensor_config[edge->tensor_id()];
+            const PlanConfig        to   = (planned != node_config.end())
+                                               ? required_input_config(desc, planned->second)
+                                               : PlanConfig{desc.layout, desc.data_type, false};
+            if (!needs_permute(desc, from, to) && from.data_type == to.data_type)
+            {
+                continue;
+            }
+
+            if (is_private_const(*edge))
+            {
+                replace_const(g, *edge, to);
+                continue;
+            }
+
+            const NodeIdxPair source{edge->producer_id(), edge->producer_idx()};
+            const auto        key = std::make_tuple(source.node_id, source.index, to.layout, to.data_type);
+            auto              it  = conversions.find(key);
+            if (it == conversions.end())
+            {
+                it = conversions.emplace(key, add_conversion(g, source, desc, from, to)).first;
+            }
+
+            Tensor *original_output = edge->tensor();
+            g.remove_connection(edge->id());
+            g.add_connection(it->second.node_id, it->second.index, node_id, idx);
+
+            // The output accessors read the converted tensor
+            if (node->type() == NodeType::Output && original_output->accessor() != nullptr)
+            {
+                g.node(it->second.node_id)->output(it->second.index)->set_accessor(original_output->extract_accessor());
+            }
+        }
+
+        if (planned != node_config.end())
+        {
+            set_fast_math_hint(*node, planned->second.fast_math ? FastMathHint::Enabled : FastMathHint::Disabled);
+            ++num_planned;
+        }
+    }
+
+    // Propagate the planned configurations through the descriptors
+    for (const auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr)
+        {
+            node->forward_descriptors();
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Planned the data layout and data type of " << num_planned << " nodes"
+                                                                              << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,10 @@
  */
 #include "src/graph/mutators/MutatorUtils.h"
 
+#include "arm_compute/graph/Tensor.h"
+
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -48,5 +52,45 @@ bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &
 
     return false;
 }
+
+uint64_t estimate_node_cost(const INode &node)
+{
+    uint64_t output_elements = 0;
+    for (size_t idx = 0; idx < node.num_outputs(); ++idx)
+    {
+        const Tensor *output = node.output(idx);
+        if (output != nullptr)
+        {
+            output_elements += output->desc().shape.total_size();
+        }
+    }
+
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        case NodeType::FullyConnectedLayer:
+        {
+            const Tensor *weights = node.input(1);
+            const Tensor *output  = node.output(0);
+            if (weights == nullptr || output == nullptr)
+            {
+                break;
+            }
+
+            // Every output element accumulates the weights of its output channel
+            const size_t num_channels = (node.type() == NodeType::FullyConnectedLayer)
+                                            ? output->desc().shape[0]
+                                            : get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL);
+            return output_elements * (weights->desc().shape.total_size() / std::max<size_t>(num_channels, 1));
+        }
+        default:
+            break;
+    }
+    return output_elements;
+}
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,11 @@
 #ifndef ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 #define ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 
+#include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 namespace graph
@@ -36,6 +39,14 @@ namespace graph
  * @param[in] padding_list List of padding pairs
  */
 bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &padding_list);
+
+/** Estimates the cost of a node
+ *
+ * @param[in] node Node to estimate the cost of
+ *
+ * @return The number of multiply-accumulates of the layers with weights, the number of output elements otherwise
+ */
+uint64_t estimate_node_cost(const INode &node);
 } // namespace graph
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,6 +68,11 @@ void set_default_on_invalid_method(Graph &g, NodeType node_type, Setter &&setter
 }
 } // namespace
 
+NodeExecutionMethodMutator::NodeExecutionMethodMutator(bool use_convolution_tuner)
+    : _use_convolution_tuner(use_convolution_tuner)
+{
+}
+
 const char *NodeExecutionMethodMutator::name()
 {
     return "NodeExecutionMethodMutator";
@@ -80,6 +85,23 @@ IGraphMutator::MutationType NodeExecutionMethodMutator::type() const
 
 void NodeExecutionMethodMutator::mutate(Graph &g)
 {
+    // The CPU convolutions with the default method are the ones measured by the convolution tuner
+    if (_use_convolution_tuner)
+    {
+        for (auto &node_id : g.nodes(NodeType::ConvolutionLayer))
+        {
+            auto *node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(node_id));
+            if (node != nullptr && node->assigned_target() == Target::NEON &&
+                node->convolution_method() != ConvolutionMethod::Default)
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Reset ConvolutionLayer method of node with ID : "
+                                           << node->id() << " and Name: " << node->name() << " for tuning"
+                                           << std::endl);
+                node->set_convolution_method(ConvolutionMethod::Default);
+            }
+        }
+    }
+
     // Convolution Layer
     set_default_on_invalid_method(g, NodeType::ConvolutionLayer,
                                   [](INode *n)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 
 #include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphBuilder.h"
 #include "arm_compute/graph/Logger.h"
@@ -34,7 +36,9 @@
 #include "src/graph/mutators/MutatorUtils.h"
 #include "support/Cast.h"
 
+#include <algorithm>
 #include <list>
+#include <map>
 #include <set>
 
 namespace arm_compute
@@ -364,8 +368,401 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
         }
     }
 }
+/** Check if all the nodes reading a tensor, except through a given edge, are ancestors of a node
+ *
+ * @param[in] g         Graph the tensor belongs to.
+ * @param[in] tensor    Tensor to check the readers of.
+ * @param[in] skip_edge Edge reading the tensor to ignore.
+ * @param[in] node      Node the readers must be ancestors of.
+ *
+ * @return True if every other reader of @p tensor runs before @p node
+ */
+bool other_readers_are_ancestors(Graph &g, const Tensor &tensor, EdgeID skip_edge, const INode &node)
+{
+    const std::set<EdgeID> bound_edges = tensor.bound_edges();
+    if (bound_edges.size() == 1)
+    {
+        return true;
+    }
+
+    // Collect the ancestors of the node
+    std::set<NodeID>    ancestors;
+    std::vector<NodeID> to_visit{node.id()};
+    while (!to_visit.empty())
+    {
+        const INode *visited = g.node(to_visit.back());
+        to_visit.pop_back();
+        for (const auto &input_edge_id : visited->input_edges())
+        {
+            const Edge *input_edge = g.edge(input_edge_id);
+            if (input_edge != nullptr && ancestors.insert(input_edge->producer_id()).second)
+            {
+                to_visit.push_back(input_edge->producer_id());
+            }
+        }
+    }
+
+    return std::all_of(bound_edges.begin(), bound_edges.end(),
+                       [&](const EdgeID &edge_id)
+                       {
+                           const Edge *edge = g.edge(edge_id);
+                           return edge_id == skip_edge || edge == nullptr || ancestors.count(edge->consumer_id()) != 0;
+                       });
+}
+
+/** Fold an addition of a residual tensor, and the activation following it if any, into the convolution feeding it
+ *
+ * @tparam N Convolution node type, either @ref ConvolutionLayerNode or @ref FusedConvolutionBatchNormalizationNode
+ *
+ * @param[in] g                           Graph to mutate.
+ * @param[in] add_node                    Addition node to fold.
+ * @param[in] conv_edge                   Edge from the convolution to @p add_node.
+ * @param[in] residual_edge               Edge from the residual to @p add_node.
+ * @param[in] supported_fused_activations Activations the convolution can fuse.
+ *
+ * @return True if the addition was folded into the convolution
+ */
+template <typename N>
+bool fuse_residual_addition_into_convolution(Graph                      &g,
+                                             EltwiseLayerNode           *add_node,
+                                             const Edge                 *conv_edge,
+                                             const Edge                 *residual_edge,
+                                             const std::set<Activation> &supported_fused_activations)
+{
+    auto   *conv_node   = arm_compute::utils::cast::polymorphic_downcast<N *>(conv_edge->producer());
+    Tensor *conv_output = conv_node->output(0);
+    Tensor *residual    = residual_edge->tensor();
+
+    // The convolution accumulates into the residual through the GEMM, which only supports NHWC with an
+    // activation applied after the accumulation
+    const ConvolutionMethod method = conv_node->convolution_method();
+    const bool              conv_can_accumulate =
+        conv_node->output_edges().size() == 1 && conv_output->accessor() == nullptr &&
+        !conv_node->fused_activation().enabled() && !conv_node->has_residual_input() && conv_node->num_groups() == 1 &&
+        conv_output->desc().layout == DataLayout::NHWC &&
+        (method == ConvolutionMethod::Default || method == ConvolutionMethod::GEMM);
+
+    // The residual is overwritten by the result, so any other node reading it must run before the convolution
+    const bool residual_can_be_overwritten =
+        residual->accessor() == nullptr && residual->desc().shape == conv_output->desc().shape &&
+        residual->desc().data_type == conv_output->desc().data_type &&
+        residual->desc().layout == conv_output->desc().layout &&
+        other_readers_are_ancestors(g, *residual, residual_edge->id(), *conv_node);
+
+    if (!conv_can_accumulate || !residual_can_be_overwritten)
+    {
+        return false;
+    }
+
+    // Fold the activation following the addition, if any
+    INode              *tail_node = add_node;
+    ActivationLayerInfo fused_act{};
+    if (add_node->output_edges().size() == 1 && add_node->output(0)->accessor() == nullptr)
+    {
+        INode *consumer = g.edge(*add_node->output_edges().begin())->consumer();
+        if (consumer != nullptr && consumer->type() == NodeType::ActivationLayer &&
+            consumer->assigned_target() == Target::NEON)
+        {
+            const ActivationLayerInfo act_info =
+                arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(consumer)->activation_info();
+            if (supported_fused_activations.count(act_info.activation()) != 0)
+            {
+                tail_node = consumer;
+                fused_act = act_info;
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing residual addition node with ID : "
+                                  << add_node->id() << " into convolution node with ID : " << conv_node->id()
+                                  << std::endl);
+
+    const NodeID             conv_id         = conv_node->id();
+    const NodeID             add_id          = add_node->id();
+    const NodeID             tail_id         = tail_node->id();
+    const NodeIdxPair        residual_source = {residual_edge->producer_id(), residual_edge->producer_idx()};
+    std::vector<NodeIdxPair> tail_consumers  = get_driving_nodes(*tail_node);
+    auto                     tail_accessor   = tail_node->output(0)->extract_accessor();
+
+    if (tail_id != add_id)
+    {
+        g.remove_node(tail_id);
+    }
+    g.remove_node(add_id);
+
+    // Feed the residual to the convolution and write the result in place of it
+    conv_node->enable_residual_input();
+    conv_node->set_fused_activation(fused_act);
+    g.add_connection(residual_source.node_id, residual_source.index, conv_id, N::residual_input_idx);
+    conv_node->set_output_tensor(residual->id(), 0);
+
+    for (auto &consumer : tail_consumers)
+    {
+        g.add_connection(conv_id, 0, consumer.node_id, consumer.index);
+    }
+    residual->set_accessor(std::move(tail_accessor));
+    return true;
+}
+
+void fuse_convolution_with_residual_addition(Graph &g, const std::set<Activation> &supported_fused_activations)
+{
+    for (unsigned int i = 0; i < g.nodes().size(); ++i)
+    {
+        auto *node = g.node(i);
+        if (node == nullptr || node->type() != NodeType::EltwiseLayer || node->assigned_target() != Target::NEON)
+        {
+            continue;
+        }
+
+        auto *add_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(node);
+        if (add_node->eltwise_operation() != EltwiseOperation::Add || add_node->fused_activation().enabled() ||
+            add_node->output(0) == nullptr || !is_data_type_float(add_node->output(0)->desc().data_type))
+        {
+            continue;
+        }
+
+        for (size_t conv_idx = 0; conv_idx < 2; ++conv_idx)
+        {
+            const Edge *conv_edge     = add_node->input_edge(conv_idx);
+            const Edge *residual_edge = add_node->input_edge(1 - conv_idx);
+            if (conv_edge == nullptr || residual_edge == nullptr || conv_edge->producer() == nullptr ||
+                residual_edge->producer() == nullptr)
+            {
+                continue;
+            }
+
+            bool fused = false;
+            switch (conv_edge->producer()->type())
+            {
+                case NodeType::ConvolutionLayer:
+                    fused = fuse_residual_addition_into_convolution<ConvolutionLayerNode>(
+                        g, add_node, conv_edge, residual_edge, supported_fused_activations);
+                    break;
+                case NodeType::FusedConvolutionBatchNormalizationLayer:
+                    fused = fuse_residual_addition_into_convolution<FusedConvolutionBatchNormalizationNode>(
+                        g, add_node, conv_edge, residual_edge, supported_fused_activations);
+                    break;
+                default:
+                    break;
+            }
+            if (fused)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/** Append the chain steps equivalent to an element-wise or activation node
+ *
+ * @param[in]     node                  Node to translate.
+ * @param[in]     running_idx           Input of @p node reading the running result of the chain.
+ * @param[in]     operand               Chain input feeding the other input of binary nodes.
+ * @param[in]     supported_activations Activations the fused chain can evaluate.
+ * @param[in,out] chain                 Chain to extend.
+ *
+ * @return True if the node could be expressed as chain steps
+ */
+bool append_chain_steps(const INode                &node,
+                        size_t                      running_idx,
+                        size_t                      operand,
+                        const std::set<Activation> &supported_activations,
+                        ElementwiseChainInfo       &chain)
+{
+    ActivationLayerInfo fused_act_info{};
+    switch (node.type())
+    {
+        case NodeType::EltwiseLayer:
+        {
+            const auto &eltwise_node = *arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            const std::map<EltwiseOperation, ElementwiseChainOperation> ops = {
+                {EltwiseOperation::Add, ElementwiseChainOperation::ADD},
+                {EltwiseOperation::Sub, ElementwiseChainOperation::SUB},
+                {EltwiseOperation::Mul, ElementwiseChainOperation::MUL},
+                {EltwiseOperation::Div, ElementwiseChainOperation::DIV},
+                {EltwiseOperation::Max, ElementwiseChainOperation::MAX},
+                {EltwiseOperation::Min, ElementwiseChainOperation::MIN}};
+            chain.emplace_back(ops.at(eltwise_node.eltwise_operation()), operand, running_idx == 1);
+            fused_act_info = eltwise_node.fused_activation();
+            break;
+        }
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const auto desc = arm_compute::utils::cast::polymorphic_downcast<const UnaryEltwiseLayerNode *>(&node)
+                                  ->eltwise_descriptor();
+            if (desc.op != UnaryEltwiseOperation::Exp)
+            {
+                return false;
+            }
+            chain.emplace_back(ElementwiseChainOperation::EXP);
+            fused_act_info = desc.fused_activation;
+            break;
+        }
+        case NodeType::ActivationLayer:
+            fused_act_info =
+                arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)->activation_info();
+            if (!fused_act_info.enabled())
+            {
+                chain.emplace_back(ActivationLayerInfo(Activation::IDENTITY));
+            }
+            break;
+        default:
+            return false;
+    }
+
+    if (fused_act_info.enabled())
+    {
+        if (supported_activations.count(fused_act_info.activation()) == 0)
+        {
+            return false;
+        }
+        chain.emplace_back(fused_act_info);
+    }
+    return true;
+}
+
+void fuse_elementwise_chains(Graph &g, const std::set<Activation> &supported_activations, bool fuse_f16)
+{
+    // Only floating point chains running on the CPU are fused; quantized element-wise nodes requantize every step.
+    // The fused chains keep their intermediate results in F32, which changes the results of F16 chains: those are only
+    // fused on request.
+    auto is_chainable = [fuse_f16](const INode &node)
+    {
+        const bool is_elementwise = node.type() == NodeType::EltwiseLayer ||
+                                    node.type() == NodeType::UnaryEltwiseLayer ||
+                                    node.type() == NodeType::ActivationLayer;
+        if (!is_elementwise || node.assigned_target() != Target::NEON || node.output(0) == nullptr)
+        {
+            return false;
+        }
+        const DataType data_type = node.output(0)->desc().data_type;
+        return data_type == DataType::F32 || (fuse_f16 && data_type == DataType::F16);
+    };
+
+    std::set<NodeID> fused_nodes;
+    for (const NodeID head_id : dfs(g))
+    {
+        INode *head = g.node(head_id);
+        if (head == nullptr || fused_nodes.count(head_id) != 0 || !is_chainable(*head))
+        {
+            continue;
+        }
+
+        // Chain inputs, identified by the node and output index producing them
+        std::vector<NodeIdxPair> inputs;
+        auto                     add_input = [&inputs](const Edge *edge)
+        {
+            const NodeIdxPair input{edge->producer_id(), edge->producer_idx()};
+            const auto        it = std::find_if(inputs.begin(), inputs.end(), [&](const NodeIdxPair &in)
+                                                { return in.node_id == input.node_id && in.index == input.index; });
+            if (it != inputs.end())
+            {
+                return static_cast<size_t>(std::distance(inputs.begin(), it));
+            }
+            inputs.push_back(input);
+            return inputs.size() - 1;
+        };
+
+        // The head seeds the running result with its first input
+        if (std::any_of(head->input_edges().begin(), head->input_edges().end(),
+                        [&g](EdgeID eid) { return g.edge(eid) == nullptr; }))
+        {
+            continue;
+        }
+        ElementwiseChainInfo chain;
+        add_input(head->input_edge(0));
+        const size_t head_operand = head->num_inputs() > 1 ? add_input(head->input_edge(1)) : 0;
+        if (!append_chain_steps(*head, 0, head_operand, supported_activations, chain))
+        {
+            continue;
+        }
+
+        // Extend the chain through single consumers whose intermediate results are not observed
+        std::vector<INode *> chain_nodes{head};
+        INode               *tail = head;
+        while (tail->output_edges().size() == 1 && tail->output(0)->accessor() == nullptr)
+        {
+            const Edge *edge = g.edge(*tail->output_edges().begin());
+            INode      *next = edge->consumer();
+            if (next == nullptr || fused_nodes.count(next->id()) != 0 || !is_chainable(*next) ||
+                next->output(0)->desc().data_type != tail->output(0)->desc().data_type)
+            {
+                break;
+            }
+
+            // The other input of a binary node becomes a chain input, unless the chain already reads it
+            const size_t running_idx = edge->consumer_idx();
+            const Edge  *other_edge  = next->num_inputs() > 1 ? next->input_edge(1 - running_idx) : nullptr;
+            if (next->num_inputs() > 1 && other_edge == nullptr)
+            {
+                break;
+            }
+            const size_t num_inputs = inputs.size();
+            const size_t num_steps  = chain.size();
+            const size_t operand    = other_edge != nullptr ? add_input(other_edge) : 0;
+            if (inputs.size() > max_elementwise_chain_inputs ||
+                !append_chain_steps(*next, running_idx, operand, supported_activations, chain))
+            {
+                inputs.resize(num_inputs);
+                chain.resize(num_steps);
+                break;
+            }
+            chain_nodes.push_back(next);
+            tail = next;
+        }
+
+        if (chain_nodes.size() < 2)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing chain of " << chain_nodes.size()
+                                                         << " element-wise nodes starting at node with ID : " << head_id
+                                                         << std::endl);
+
+        const Target assigned_target = head->assigned_target();
+        const NodeID tail_id         = tail->id();
+        std::string  fused_name      = head->name();
+        for (size_t i = 1; i < chain_nodes.size(); ++i)
+        {
+            fused_name += "+" + chain_nodes[i]->name();
+        }
+
+        const NodeID fused_id =
+            g.add_node<FusedElementwiseLayerNode>(static_cast<unsigned int>(inputs.size()), std::move(chain));
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            g.add_connection(inputs[i].node_id, inputs[i].index, fused_id, i);
+        }
+
+        INode *fused_node = g.node(fused_id);
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{fused_name, assigned_target});
+
+        // Remove the chain, handing the consumers and accessor of its result over to the fused node
+        std::vector<NodeID> chain_ids;
+        for (INode *n : chain_nodes)
+        {
+            chain_ids.push_back(n->id());
+        }
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, tail, true);
+        for (const NodeID id : chain_ids)
+        {
+            fused_nodes.insert(id);
+            if (id != tail_id)
+            {
+                g.remove_node(id);
+            }
+        }
+    }
+}
 } // namespace detail
 
+NodeFusionMutator::NodeFusionMutator(bool fuse_f16_elementwise_chains)
+    : _fuse_f16_elementwise_chains(fuse_f16_elementwise_chains)
+{
+}
+
 const char *NodeFusionMutator::name()
 {
     return "NodeFusionMutator";
@@ -386,6 +783,14 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
         Activation::SQUARE,     Activation::TANH};
 
+    // Activations supported by fused element-wise chains
+    const std::set<Activation> supported_chain_activations = {
+        Activation::ABS,        Activation::BOUNDED_RELU, Activation::ELU,
+        Activation::HARD_SWISH, Activation::IDENTITY,     Activation::LEAKY_RELU,
+        Activation::LINEAR,     Activation::LOGISTIC,     Activation::LU_BOUNDED_RELU,
+        Activation::RELU,       Activation::SQUARE,       Activation::SWISH,
+        Activation::TANH};
+
     // Preconditions
     auto empty_prec     = [](INode &) { return true; };
     auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
@@ -423,6 +828,10 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Residual additions are folded into the convolutions before the remaining element-wise nodes are chained
+    detail::fuse_convolution_with_residual_addition(g, supported_fused_activations);
+    // Element-wise chains are fused last, so that activations are first fused into the layers producing them
+    detail::fuse_elementwise_chains(g, supported_chain_activations, _fuse_f16_elementwise_chains);
 }
 } // namespace graph
 } // namespace arm_compute
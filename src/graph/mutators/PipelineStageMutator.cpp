@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PipelineStageMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/StringSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Adds a node copying the output of a node at the beginning of a pipeline stage
+ *
+ * @param[in, out] g      Graph to add the copy to
+ * @param[in]      source Output to copy
+ * @param[in]      name   Name of the copied node
+ * @param[in]      stage  Pipeline stage of the copy
+ *
+ * @return The ID of the copy
+ */
+NodeID add_stage_copy(Graph &g, NodeIdxPair source, const std::string &name, unsigned int stage)
+{
+    const TensorShape shape = g.node(source.node_id)->output(source.index)->desc().shape;
+
+    // An identity reshape is a plain copy on the CPU backend
+    const NodeID copy_id = g.add_node<ReshapeLayerNode>(shape);
+    INode       *copy    = g.node(copy_id);
+    copy->set_common_node_parameters(NodeParams{name + "_stage" + support::cpp11::to_string(stage), Target::NEON});
+    copy->set_assigned_target(Target::NEON);
+    copy->set_pipeline_stage(stage);
+
+    // Connecting the source forwards its descriptor to the output of the copy
+    g.add_connection(source.node_id, source.index, copy_id, 0);
+    configure_tensor(copy->output(0));
+
+    return copy_id;
+}
+} // namespace
+
+PipelineStageMutator::PipelineStageMutator(unsigned int num_stages) : _num_stages(num_stages)
+{
+}
+
+const char *PipelineStageMutator::name()
+{
+    return "PipelineStageMutator";
+}
+
+IGraphMutator::MutationType PipelineStageMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void PipelineStageMutator::mutate(Graph &g)
+{
+    // Only the CPU backend streams inferences through pipeline stages
+    const bool cpu_only = std::all_of(g.nodes().begin(), g.nodes().end(),
+                                      [](const std::unique_ptr<INode> &node)
+                                      { return node == nullptr || node->assigned_target() == Target::NEON; });
+    if (_num_stages < 2 || !cpu_only)
+    {
+        return;
+    }
+
+    const std::vector<NodeID> node_order = dfs(g);
+
+    // Estimate the cost of the nodes performing computations
+    std::vector<uint64_t> node_cost(g.nodes().size(), 0);
+    uint64_t              total_cost        = 0;
+    unsigned int          num_compute_nodes = 0;
+    for (auto &node_id : node_order)
+    {
+        const INode *node = g.node(node_id);
+        if (node != nullptr && node->type() != NodeType::Input && node->type() != NodeType::Output &&
+            node->type() != NodeType::Const)
+        {
+            node_cost[node_id] = std::max<uint64_t>(estimate_node_cost(*node), 1);
+            total_cost += node_cost[node_id];
+            ++num_compute_nodes;
+        }
+    }
+
+    const unsigned int num_stages = std::min(_num_stages, num_compute_nodes);
+    if (num_stages < 2)
+    {
+        return;
+    }
+
+    // Split the topological order in contiguous stages of similar cost, the inputs are filled by the first stage
+    // and the outputs read by the last one
+    uint64_t     cost  = 0;
+    unsigned int stage = 0;
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        switch (node->type())
+        {
+            case NodeType::Input:
+            case NodeType::Const:
+                node->set_pipeline_stage(0);
+                break;
+            case NodeType::Output:
+                node->set_pipeline_stage(num_stages - 1);
+                break;
+            default:
+                node->set_pipeline_stage(stage);
+                cost += node_cost[node_id];
+                if (stage + 1 < num_stages && cost * num_stages >= total_cost * (stage + 1))
+                {
+                    ++stage;
+                }
+                break;
+        }
+    }
+
+    // Carry the tensors consumed in a later stage through a copy in each of the following stages. Constant tensors
+    // are never written during the execution and are shared by all stages.
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID node_id = 0; node_id < num_nodes; ++node_id)
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr || node->type() == NodeType::Const)
+        {
+            continue;
+        }
+
+        const unsigned int producer_stage = node->pipeline_stage();
+        for (size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            std::vector<NodeIdxPair> stage_outputs(num_stages, NodeIdxPair{EmptyNodeID, 0});
+            stage_outputs[producer_stage] = NodeIdxPair{node_id, idx};
+
+            const std::set<EdgeID> output_edges = node->output_edges();
+            for (auto &edge_id : output_edges)
+            {
+                const Edge *edge = g.edge(edge_id);
+                if (edge == nullptr || edge->producer_idx() != idx)
+                {
+                    continue;
+                }
+
+                const NodeID       consumer_id    = edge->consumer_id();
+                const size_t       consumer_idx   = edge->consumer_idx();
+                const unsigned int consumer_stage = edge->consumer()->pipeline_stage();
+                if (consumer_stage <= producer_stage)
+                {
+                    continue;
+                }
+
+                for (unsigned int s = producer_stage + 1; s <= consumer_stage; ++s)
+                {
+                    if (stage_outputs[s].node_id == EmptyNodeID)
+                    {
+                        stage_outputs[s] = NodeIdxPair{add_stage_copy(g, stage_outputs[s - 1], node->name(), s), 0};
+                    }
+                }
+
+                g.remove_connection(edge_id);
+                g.add_connection(stage_outputs[consumer_stage].node_id, 0, consumer_id, consumer_idx);
+
+                // The output accessors read the copy delivered to the last stage
+                if (g.node(consumer_id)->type() == NodeType::Output)
+                {
+                    g.node(stage_outputs[consumer_stage].node_id)
+                        ->output(0)
+                        ->set_accessor(node->output(idx)->extract_accessor());
+                }
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Split graph in " << num_stages << " pipeline stages" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
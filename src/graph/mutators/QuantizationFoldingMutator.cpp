@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/QuantizationFoldingMutator.h"
+
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks whether a node gives the same result on the quantized values of its input as on the real ones
+ *
+ * Monotonic activations, max pooling and reshapes commute with the affine quantization. An activation setting the
+ * quantization of its output requantizes it, so it can't be moved across a quantization.
+ */
+bool is_quantization_transparent(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ActivationLayer:
+        {
+            const auto *act_node = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node);
+            if (!act_node->output_quantization_info().empty())
+            {
+                return false;
+            }
+            const auto act = act_node->activation_info().activation();
+            return act == ActivationLayerInfo::ActivationFunction::RELU ||
+                   act == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+                   act == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+        }
+        case NodeType::PoolingLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node)
+                       ->pooling_info()
+                       .pool_type == PoolingType::MAX;
+        case NodeType::FlattenLayer:
+        case NodeType::ReshapeLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Checks whether the CPU requantization and the transparent nodes support a quantized tensor of a given type
+ *
+ * The symmetric types can be dequantized but not requantized, and the activations only support some of their
+ * functions, so their round trips are kept.
+ */
+bool is_foldable_round_trip(DataType src_data_type, DataType dst_data_type)
+{
+    const bool src_supported = src_data_type == DataType::QASYMM8 || src_data_type == DataType::QASYMM8_SIGNED;
+    const bool dst_supported = dst_data_type == DataType::QASYMM8 || dst_data_type == DataType::QASYMM8_SIGNED ||
+                               dst_data_type == DataType::QASYMM16;
+    return src_supported && dst_supported;
+}
+
+/** Returns the only consumer of a node, nullptr if its output is read by anything else */
+INode *single_consumer(Graph &g, const INode &node)
+{
+    if (node.num_outputs() != 1 || node.output_edges().size() != 1 || node.output(0) == nullptr ||
+        node.output(0)->accessor() != nullptr)
+    {
+        return nullptr;
+    }
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    return edge != nullptr ? edge->consumer() : nullptr;
+}
+
+/** Updates the descriptors of a chain of single consumers, up to a given node */
+void forward_chain(Graph &g, INode *first, const INode *last)
+{
+    for (INode *node = first; node != nullptr; node = single_consumer(g, *node))
+    {
+        node->forward_descriptors();
+        if (node == last)
+        {
+            break;
+        }
+    }
+}
+
+/** Removes a node with a single input, feeding its input to its consumers
+ *
+ * @return The first consumer of the removed node, nullptr if none
+ */
+INode *bypass_node(Graph &g, INode *node)
+{
+    const Edge *input_edge = node->input_edge(0);
+    ARM_COMPUTE_ERROR_ON(input_edge == nullptr);
+
+    const NodeIdxPair        source    = {input_edge->producer_id(), input_edge->producer_idx()};
+    std::vector<NodeIdxPair> consumers = get_driving_nodes(*node);
+    auto                     accessor  = node->output(0)->extract_accessor();
+
+    g.remove_node(node->id());
+    for (auto &consumer : consumers)
+    {
+        g.add_connection(source.node_id, source.index, consumer.node_id, consumer.index);
+    }
+    if (accessor != nullptr)
+    {
+        g.node(source.node_id)->output(source.index)->set_accessor(std::move(accessor));
+    }
+    return consumers.empty() ? nullptr : g.node(consumers.front().node_id);
+}
+
+/** Removes a quantization which leaves the quantization of its input unchanged
+ *
+ * @return True if the node was removed
+ */
+bool remove_identity_quantization(Graph &g, INode *quant)
+{
+    const Edge *input_edge = quant->input_edge(0);
+    if (input_edge == nullptr || input_edge->tensor() == nullptr)
+    {
+        return false;
+    }
+    const TensorDescriptor &src = input_edge->tensor()->desc();
+    const TensorDescriptor &dst = quant->output(0)->desc();
+    if (src.data_type != dst.data_type || src.quant_info != dst.quant_info)
+    {
+        return false;
+    }
+
+    // The accessor of the output can only be moved to the input if it has none
+    if (quant->output(0)->accessor() != nullptr && input_edge->tensor()->accessor() != nullptr)
+    {
+        return false;
+    }
+    bypass_node(g, quant);
+    return true;
+}
+
+/** Replaces the dequantizations followed by a quantization by a requantization
+ *
+ * @return Number of removed nodes
+ */
+unsigned int fold_round_trips(Graph &g)
+{
+    unsigned int num_removed = 0;
+
+    const std::vector<NodeID> dequant_ids = g.nodes(NodeType::DequantizationLayer);
+    for (auto &id : dequant_ids)
+    {
+        INode *dequant = g.node(id);
+        if (dequant == nullptr || dequant->input_edge(0) == nullptr)
+        {
+            continue;
+        }
+
+        // Look for a quantization at the end of the float nodes reading the dequantized tensor
+        INode *quant = single_consumer(g, *dequant);
+        while (quant != nullptr && is_quantization_transparent(*quant))
+        {
+            quant = single_consumer(g, *quant);
+        }
+        if (quant == nullptr || quant->type() != NodeType::QuantizationLayer || dequant->input(0) == nullptr ||
+            quant->output(0) == nullptr ||
+            !is_foldable_round_trip(dequant->input(0)->desc().data_type, quant->output(0)->desc().data_type))
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding dequantization node with ID : "
+                                      << id << " into quantization node with ID : " << quant->id() << std::endl);
+
+        // The nodes in between now run on the quantized tensor and the quantization requantizes it
+        forward_chain(g, bypass_node(g, dequant), quant);
+        ++num_removed;
+        if (remove_identity_quantization(g, quant))
+        {
+            ++num_removed;
+        }
+    }
+    return num_removed;
+}
+
+/** Folds the requantizations of the outputs of the layers with an output stage into the layers
+ *
+ * @return Number of removed nodes
+ */
+unsigned int fold_requantizations(Graph &g)
+{
+    unsigned int num_removed = 0;
+
+    const std::vector<NodeID> quant_ids = g.nodes(NodeType::QuantizationLayer);
+    for (auto &id : quant_ids)
+    {
+        INode *quant = g.node(id);
+        if (quant == nullptr || quant->input_edge(0) == nullptr || quant->input(0) == nullptr ||
+            !is_data_type_quantized_asymmetric(quant->input(0)->desc().data_type))
+        {
+            continue;
+        }
+        if (remove_identity_quantization(g, quant))
+        {
+            ++num_removed;
+            continue;
+        }
+
+        // Walk back through the nodes which keep the quantization of their input
+        INode *producer = quant->input_edge(0)->producer();
+        while (producer != nullptr && is_quantization_transparent(*producer) &&
+               single_consumer(g, *producer) != nullptr && producer->input_edge(0) != nullptr)
+        {
+            producer = producer->input_edge(0)->producer();
+        }
+        if (producer == nullptr || single_consumer(g, *producer) == nullptr ||
+            producer->output(0)->desc().data_type != quant->output(0)->desc().data_type)
+        {
+            continue;
+        }
+
+        const QuantizationInfo out_quant_info = quant->output(0)->desc().quant_info;
+        switch (producer->type())
+        {
+            case NodeType::ConvolutionLayer:
+                arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(producer)
+                    ->set_output_quantization_info(out_quant_info);
+                break;
+            case NodeType::DepthwiseConvolutionLayer:
+                arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(producer)
+                    ->set_output_quantization_info(out_quant_info);
+                break;
+            case NodeType::FullyConnectedLayer:
+                arm_compute::utils::cast::polymorphic_downcast<FullyConnectedLayerNode *>(producer)
+                    ->set_output_quantization_info(out_quant_info);
+                break;
+            default:
+                continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding quantization node with ID : "
+                                      << id << " into the output stage of node with ID : " << producer->id()
+                                      << std::endl);
+
+        // The layer now produces the requantized tensor, which the nodes up to the quantization propagate
+        forward_chain(g, producer, quant);
+        const bool removed = remove_identity_quantization(g, quant);
+        ARM_COMPUTE_ERROR_ON(!removed);
+        ARM_COMPUTE_UNUSED(removed);
+        ++num_removed;
+    }
+    return num_removed;
+}
+} // namespace
+
+const char *QuantizationFoldingMutator::name()
+{
+    return "QuantizationFoldingMutator";
+}
+
+IGraphMutator::MutationType QuantizationFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void QuantizationFoldingMutator::mutate(Graph &g)
+{
+    const unsigned int num_removed = fold_round_trips(g) + fold_requantizations(g);
+    if (num_removed == 0)
+    {
+        return;
+    }
+
+    // Propagate the quantization of the folded tensors through the descriptors
+    for (const auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr)
+        {
+            node->forward_descriptors();
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removed " << num_removed << " quantization nodes" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,11 @@ ActivationLayerInfo ActivationLayerNode::activation_info() const
     return _info;
 }
 
+QuantizationInfo ActivationLayerNode::output_quantization_info() const
+{
+    return _out_quant_info;
+}
+
 bool ActivationLayerNode::forward_descriptors()
 {
     if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
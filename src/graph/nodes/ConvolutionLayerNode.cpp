@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,21 @@ void ConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
     _info = info;
 }
 
+void ConvolutionLayerNode::set_output_quantization_info(QuantizationInfo out_quant_info)
+{
+    _out_quant_info = std::move(out_quant_info);
+}
+
+void ConvolutionLayerNode::enable_residual_input()
+{
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool ConvolutionLayerNode::has_residual_input() const
+{
+    return _input_edges.size() > residual_input_idx;
+}
+
 TensorDescriptor ConvolutionLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                  const TensorDescriptor &weights_descriptor,
                                                                  const PadStrideInfo    &info)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,16 @@ void FusedConvolutionBatchNormalizationNode::set_fused_activation(ActivationLaye
     _fused_activation = fused_activation;
 }
 
+void FusedConvolutionBatchNormalizationNode::enable_residual_input()
+{
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool FusedConvolutionBatchNormalizationNode::has_residual_input() const
+{
+    return _input_edges.size() > residual_input_idx;
+}
+
 TensorDescriptor FusedConvolutionBatchNormalizationNode::compute_output_descriptor(
     const TensorDescriptor &input_descriptor, const TensorDescriptor &weights_descriptor, const PadStrideInfo &info)
 {
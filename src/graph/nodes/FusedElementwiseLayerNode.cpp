@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedElementwiseLayerNode.h"
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedElementwiseLayerNode::FusedElementwiseLayerNode(unsigned int num_inputs, ElementwiseChainInfo chain)
+    : _chain(std::move(chain))
+{
+    _input_edges.resize(num_inputs, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+const ElementwiseChainInfo &FusedElementwiseLayerNode::chain() const
+{
+    return _chain;
+}
+
+bool FusedElementwiseLayerNode::forward_descriptors()
+{
+    const bool are_all_inputs_set = std::all_of(std::begin(_input_edges), std::end(_input_edges),
+                                                [](const EdgeID &eid) { return eid != EmptyEdgeID; });
+    if (are_all_inputs_set && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedElementwiseLayerNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+
+    const Tensor *src0 = input(0);
+    ARM_COMPUTE_ERROR_ON(src0 == nullptr);
+
+    auto        output_info = src0->desc();
+    TensorShape out_shape   = output_info.shape;
+    for (size_t i = 1; i < num_inputs(); ++i)
+    {
+        const Tensor *src = input(i);
+        ARM_COMPUTE_ERROR_ON(src == nullptr);
+        out_shape = TensorShape::broadcast_shape(out_shape, src->desc().shape);
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+
+    output_info.set_shape(out_shape);
+    return output_info;
+}
+
+NodeType FusedElementwiseLayerNode::type() const
+{
+    return NodeType::FusedElementwiseLayer;
+}
+
+void FusedElementwiseLayerNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
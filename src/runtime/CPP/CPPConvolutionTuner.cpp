@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPConvolutionTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include "support/Mutex.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace
+{
+/** Header line of the convolution tuner files */
+constexpr const char *convolution_file_header = "convolution;method";
+
+/** Name of the methods in the convolution tuner files */
+const std::pair<ConvolutionMethod, const char *> method_names[] = {
+    {ConvolutionMethod::GEMM, "gemm"},
+    {ConvolutionMethod::GEMM_CONV2D, "gemm_conv2d"},
+    {ConvolutionMethod::DIRECT, "direct"},
+    {ConvolutionMethod::INDIRECT, "indirect"},
+    {ConvolutionMethod::WINOGRAD, "winograd"},
+    {ConvolutionMethod::FFT, "fft"},
+};
+
+const char *method_to_string(ConvolutionMethod method)
+{
+    for (const auto &m : method_names)
+    {
+        if (m.first == method)
+        {
+            return m.second;
+        }
+    }
+    ARM_COMPUTE_ERROR("Unknown convolution method");
+}
+
+bool method_from_string(const std::string &name, ConvolutionMethod &method)
+{
+    for (const auto &m : method_names)
+    {
+        if (name == m.second)
+        {
+            method = m.first;
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+struct CPPConvolutionTuner::Impl
+{
+    std::unordered_map<std::string, ConvolutionMethod> _method_table{};
+    bool                                                _tune_new_convolutions{true};
+    mutable arm_compute::Mutex                          _mtx{};
+};
+
+CPPConvolutionTuner::CPPConvolutionTuner(bool tune_new_convolutions) : _impl(std::make_unique<Impl>())
+{
+    _impl->_tune_new_convolutions = tune_new_convolutions;
+}
+
+CPPConvolutionTuner::~CPPConvolutionTuner() = default;
+
+void CPPConvolutionTuner::set_tune_new_convolutions(bool tune_new_convolutions)
+{
+    _impl->_tune_new_convolutions = tune_new_convolutions;
+}
+
+bool CPPConvolutionTuner::tune_new_convolutions() const
+{
+    return _impl->_tune_new_convolutions;
+}
+
+void CPPConvolutionTuner::add_method(const std::string &conv_id, ConvolutionMethod method)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    _impl->_method_table[conv_id] = method;
+}
+
+bool CPPConvolutionTuner::find_method(const std::string &conv_id, ConvolutionMethod &method) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    const auto                                  it = _impl->_method_table.find(conv_id);
+    if (it == _impl->_method_table.end())
+    {
+        return false;
+    }
+    method = it->second;
+    return true;
+}
+
+const std::unordered_map<std::string, ConvolutionMethod> &CPPConvolutionTuner::method_table() const
+{
+    return _impl->_method_table;
+}
+
+void CPPConvolutionTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    bool        header_line = true;
+    while (!std::getline(fs, line).fail())
+    {
+        if (header_line)
+        {
+            header_line = false;
+            if (line == convolution_file_header)
+            {
+                continue;
+            }
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // The convolution identifiers contain ';' so the method is the last field
+        const size_t      pos = line.rfind(';');
+        ConvolutionMethod method{};
+        if (pos == std::string::npos || pos == 0 || !method_from_string(line.substr(pos + 1), method))
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        add_method(line.substr(0, pos), method);
+    }
+    fs.close();
+}
+
+bool CPPConvolutionTuner::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    if (_impl->_method_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs << convolution_file_header << std::endl;
+    for (auto const &conv_data : _impl->_method_table)
+    {
+        fs << conv_data.first << ";" << method_to_string(conv_data.second) << std::endl;
+    }
+    fs.close();
+    return true;
+}
+} // namespace arm_compute
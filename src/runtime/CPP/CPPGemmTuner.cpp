@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPGemmTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include "support/Mutex.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace
+{
+/** Header line of the GEMM tuner files */
+constexpr const char *gemm_file_header = "gemm;kernel";
+} // namespace
+
+struct CPPGemmTuner::Impl
+{
+    std::unordered_map<std::string, std::string> _kernel_table{};
+    bool                                         _tune_new_gemms{true};
+    mutable arm_compute::Mutex                   _mtx{};
+};
+
+CPPGemmTuner::CPPGemmTuner(bool tune_new_gemms) : _impl(std::make_unique<Impl>())
+{
+    _impl->_tune_new_gemms = tune_new_gemms;
+}
+
+CPPGemmTuner::~CPPGemmTuner() = default;
+
+void CPPGemmTuner::set_tune_new_gemms(bool tune_new_gemms)
+{
+    _impl->_tune_new_gemms = tune_new_gemms;
+}
+
+bool CPPGemmTuner::tune_new_gemms() const
+{
+    return _impl->_tune_new_gemms;
+}
+
+void CPPGemmTuner::add_kernel(const std::string &gemm_id, const std::string &kernel_name)
+{
+    ARM_COMPUTE_ERROR_ON(kernel_name.empty());
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    _impl->_kernel_table[gemm_id] = kernel_name;
+}
+
+bool CPPGemmTuner::find_kernel(const std::string &gemm_id, std::string &kernel_name) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    const auto                                  it = _impl->_kernel_table.find(gemm_id);
+    if (it == _impl->_kernel_table.end())
+    {
+        return false;
+    }
+    kernel_name = it->second;
+    return true;
+}
+
+const std::unordered_map<std::string, std::string> &CPPGemmTuner::kernel_table() const
+{
+    return _impl->_kernel_table;
+}
+
+void CPPGemmTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    bool        header_line = true;
+    while (!std::getline(fs, line).fail())
+    {
+        if (header_line)
+        {
+            header_line = false;
+            if (line == gemm_file_header)
+            {
+                continue;
+            }
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // The GEMM identifiers contain ';' so the kernel name is the last field
+        const size_t pos = line.rfind(';');
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        add_kernel(line.substr(0, pos), line.substr(pos + 1));
+    }
+    fs.close();
+}
+
+bool CPPGemmTuner::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    if (_impl->_kernel_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs << gemm_file_header << std::endl;
+    for (auto const &gemm_data : _impl->_kernel_table)
+    {
+        fs << gemm_data.first << ";" << gemm_data.second << std::endl;
+    }
+    fs.close();
+    return true;
+}
+} // namespace arm_compute
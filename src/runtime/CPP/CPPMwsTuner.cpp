@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPMwsTuner.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+#include "support/Mutex.h"
+#include "support/StringSupport.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace
+{
+/** Header line of the MWS files */
+constexpr const char *mws_file_header = "mws";
+} // namespace
+
+struct CPPMwsTuner::Impl
+{
+    std::unordered_map<std::string, std::size_t> _mws_table{};
+    std::atomic<bool>                            _tune_new_kernels{true};
+    mutable arm_compute::Mutex                   _mtx{};
+};
+
+CPPMwsTuner::CPPMwsTuner(bool tune_new_kernels) : _impl(std::make_unique<Impl>())
+{
+    _impl->_tune_new_kernels = tune_new_kernels;
+}
+
+CPPMwsTuner::~CPPMwsTuner() = default;
+
+void CPPMwsTuner::set_tune_new_kernels(bool tune_new_kernels)
+{
+    _impl->_tune_new_kernels = tune_new_kernels;
+}
+
+bool CPPMwsTuner::tune_new_kernels() const
+{
+    return _impl->_tune_new_kernels;
+}
+
+void CPPMwsTuner::add_mws(const std::string &kernel_id, std::size_t mws)
+{
+    ARM_COMPUTE_ERROR_ON(mws == 0);
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    _impl->_mws_table[kernel_id] = mws;
+}
+
+bool CPPMwsTuner::find_mws(const std::string &kernel_id, std::size_t &mws) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    const auto                                  it = _impl->_mws_table.find(kernel_id);
+    if (it == _impl->_mws_table.end())
+    {
+        return false;
+    }
+    mws = it->second;
+    return true;
+}
+
+std::unordered_map<std::string, std::size_t> CPPMwsTuner::mws_table() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    return _impl->_mws_table;
+}
+
+void CPPMwsTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    bool        header_line = true;
+    while (!std::getline(fs, line).fail())
+    {
+        if (header_line)
+        {
+            header_line = false;
+            if (line == mws_file_header)
+            {
+                continue;
+            }
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // Kernel names may contain ';' so the MWS is the last field
+        const size_t pos = line.rfind(';');
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        const std::size_t mws = support::cpp11::stoul(line.substr(pos + 1));
+        if (mws == 0)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        add_mws(line.substr(0, pos), mws);
+    }
+    fs.close();
+}
+
+bool CPPMwsTuner::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    if (_impl->_mws_table.empty() || filename.empty())
+    {
+        return false;
+    }
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs << mws_file_header << std::endl;
+    for (auto const &kernel_data : _impl->_mws_table)
+    {
+        fs << kernel_data.first << ";" << kernel_data.second << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+std::string CPPMwsTuner::kernel_id(const ICPPKernel &kernel,
+                                   const CPUInfo    &cpu_info,
+                                   unsigned int      num_threads,
+                                   const Window     &window)
+{
+    std::string id = kernel.name();
+    id += ";";
+    id += cpuinfo::cpu_model_to_string(cpu_info.get_cpu_model());
+    id += ";";
+    id += support::cpp11::to_string(num_threads);
+    id += ";";
+
+    // The best split depends on the amount of work, so kernels are tuned per shape of their window
+    size_t num_dimensions = Coordinates::num_max_dimensions;
+    while (num_dimensions > 1 && window.num_iterations(num_dimensions - 1) == 1)
+    {
+        --num_dimensions;
+    }
+    for (size_t d = 0; d < num_dimensions; ++d)
+    {
+        id += (d == 0) ? "" : "x";
+        id += support::cpp11::to_string(window.num_iterations(d));
+    }
+    return id;
+}
+} // namespace arm_compute
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+
+#include "arm_compute/core/Error.h"
+
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace arm_compute
+{
+namespace
+{
+/** Source of the identifiers telling the profilers apart in the caches of the threads */
+std::atomic<uint64_t> next_profiler_id{1};
+
+/** Write a string as a JSON string literal */
+void write_json_string(std::ostream &os, const char *str)
+{
+    os << '"';
+    for (; *str != '\0'; ++str)
+    {
+        const char c = *str;
+        switch (c)
+        {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                // Drop the other control characters
+                if (static_cast<unsigned char>(c) >= 0x20)
+                {
+                    os << c;
+                }
+                break;
+        }
+    }
+    os << '"';
+}
+
+/** Events recorded by a thread, in a ring buffer keeping the last ones */
+struct ThreadEvents
+{
+    ThreadEvents(unsigned int thread_idx, size_t max_events) : thread(thread_idx), events(max_events)
+    {
+    }
+    const unsigned int              thread;
+    std::vector<CPPProfiler::Event> events;
+    size_t                          next{0};
+    size_t                          count{0};
+    size_t                          dropped{0};
+    /** Names passed by the thread mapped to their copies owned by the profiler, only accessed by the thread */
+    std::unordered_map<const char *, const char *> names{};
+    /** Only contended when the events are read while the thread records */
+    arm_compute::Mutex mtx{};
+};
+
+/** Last profiler a thread recorded an event for, with its events */
+struct CachedThreadEvents
+{
+    uint64_t      profiler_id{0};
+    ThreadEvents *events{nullptr};
+};
+thread_local CachedThreadEvents cached_thread_events{};
+} // namespace
+
+struct CPPProfiler::Impl
+{
+    explicit Impl(size_t max_events) : _max_events_per_thread(max_events)
+    {
+    }
+
+    /** Get the events of the calling thread, which are created on its first event */
+    ThreadEvents &thread_events()
+    {
+        if (cached_thread_events.profiler_id != _id)
+        {
+            arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+            auto &events = _threads[std::this_thread::get_id()];
+            if (events == nullptr)
+            {
+                events = std::make_unique<ThreadEvents>(_threads.size() - 1, _max_events_per_thread);
+            }
+            cached_thread_events = CachedThreadEvents{_id, events.get()};
+        }
+        return *cached_thread_events.events;
+    }
+
+    /** Get the copy owned by the profiler of a name passed by a thread */
+    const char *intern(ThreadEvents &events, const char *name)
+    {
+        // The pointer can be reused for a different name once the string it pointed to is destroyed
+        const auto it = events.names.find(name);
+        if (it != events.names.end() && std::strcmp(it->second, name) == 0)
+        {
+            return it->second;
+        }
+        const char *interned = nullptr;
+        {
+            arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+            interned = _names.emplace(name).first->c_str();
+        }
+        events.names[name] = interned;
+        return interned;
+    }
+
+    const uint64_t                                                      _id{next_profiler_id++};
+    const size_t                                                        _max_events_per_thread;
+    const Clock::time_point                                             _origin{Clock::now()};
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadEvents>> _threads{};
+    std::unordered_set<std::string>                                     _names{};
+    mutable arm_compute::Mutex                                          _mtx{};
+};
+
+CPPProfiler::CPPProfiler(size_t max_events_per_thread) : _impl(std::make_unique<Impl>(max_events_per_thread))
+{
+    ARM_COMPUTE_ERROR_ON(max_events_per_thread == 0);
+}
+
+CPPProfiler::~CPPProfiler() = default;
+
+void CPPProfiler::add_event(const char       *name,
+                            const char       *category,
+                            Clock::time_point start,
+                            Clock::time_point end,
+                            std::size_t       bytes,
+                            unsigned int      num_threads,
+                            float             utilisation)
+{
+    using us = std::chrono::duration<double, std::micro>;
+
+    ThreadEvents &thread_events = _impl->thread_events();
+
+    Event event;
+    event.name        = _impl->intern(thread_events, name);
+    event.category    = _impl->intern(thread_events, category);
+    event.thread      = thread_events.thread;
+    event.start_us    = us(start - _impl->_origin).count();
+    event.duration_us = us(end - start).count();
+    event.bytes       = bytes;
+    event.num_threads = num_threads;
+    event.utilisation = utilisation;
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(thread_events.mtx);
+    const size_t                                max_events = thread_events.events.size();
+    if (max_events == 0)
+    {
+        ++thread_events.dropped;
+        return;
+    }
+    thread_events.events[thread_events.next] = event;
+    thread_events.next                       = (thread_events.next + 1) % max_events;
+    if (thread_events.count < max_events)
+    {
+        ++thread_events.count;
+    }
+    else
+    {
+        ++thread_events.dropped;
+    }
+}
+
+std::vector<CPPProfiler::Event> CPPProfiler::events() const
+{
+    std::vector<Event> events;
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    for (const auto &thread : _impl->_threads)
+    {
+        ThreadEvents                               &thread_events = *thread.second;
+        arm_compute::lock_guard<arm_compute::Mutex> thread_lock(thread_events.mtx);
+
+        // The oldest event is overwritten next once the buffer is full
+        const size_t max_events = thread_events.events.size();
+        const size_t first      = thread_events.count < max_events ? 0 : thread_events.next;
+        for (size_t i = 0; i < thread_events.count; ++i)
+        {
+            events.push_back(thread_events.events[(first + i) % max_events]);
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event &lhs, const Event &rhs) { return lhs.start_us < rhs.start_us; });
+    return events;
+}
+
+std::size_t CPPProfiler::num_dropped_events() const
+{
+    size_t dropped = 0;
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    for (const auto &thread : _impl->_threads)
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> thread_lock(thread.second->mtx);
+        dropped += thread.second->dropped;
+    }
+    return dropped;
+}
+
+void CPPProfiler::clear()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    for (const auto &thread : _impl->_threads)
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> thread_lock(thread.second->mtx);
+        thread.second->next    = 0;
+        thread.second->count   = 0;
+        thread.second->dropped = 0;
+    }
+}
+
+bool CPPProfiler::save_to_file(const std::string &filename) const
+{
+    if (filename.empty())
+    {
+        return false;
+    }
+    const std::vector<Event> events = this->events();
+
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs << std::fixed << std::setprecision(3);
+
+    // Complete events of the Chrome trace event format, timestamps in microseconds
+    fs << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const Event &event = events[i];
+        fs << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(fs, event.name);
+        fs << ",\"cat\":";
+        write_json_string(fs, event.category);
+        fs << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread << ",\"ts\":" << event.start_us
+           << ",\"dur\":" << event.duration_us << ",\"args\":{\"bytes\":" << event.bytes
+           << ",\"threads\":" << event.num_threads << ",\"utilisation\":" << event.utilisation << "}}";
+    }
+    fs << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    fs.close();
+    return true;
+}
+} // namespace arm_compute
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+
+namespace arm_compute
+{
+namespace
+{
+thread_local CPPRuntimeContext *current_context = nullptr;
+} // namespace
+
+void CPPRuntimeContext::set_mws_tuner(CPPMwsTuner *tuner)
+{
+    _mws_tuner = tuner;
+}
+
+CPPMwsTuner *CPPRuntimeContext::mws_tuner() const
+{
+    return _mws_tuner;
+}
+
+void CPPRuntimeContext::set_gemm_tuner(CPPGemmTuner *tuner)
+{
+    _gemm_tuner = tuner;
+}
+
+CPPGemmTuner *CPPRuntimeContext::gemm_tuner() const
+{
+    return _gemm_tuner;
+}
+
+void CPPRuntimeContext::set_convolution_tuner(CPPConvolutionTuner *tuner)
+{
+    _convolution_tuner = tuner;
+}
+
+CPPConvolutionTuner *CPPRuntimeContext::convolution_tuner() const
+{
+    return _convolution_tuner;
+}
+
+void CPPRuntimeContext::set_weights_cache(CPPWeightsCache *cache)
+{
+    _weights_cache = cache;
+}
+
+CPPWeightsCache *CPPRuntimeContext::weights_cache() const
+{
+    return _weights_cache;
+}
+
+void CPPRuntimeContext::set_profiler(CPPProfiler *profiler)
+{
+    _profiler = profiler;
+}
+
+CPPProfiler *CPPRuntimeContext::profiler() const
+{
+    return _profiler;
+}
+
+const CPPRuntimeContext &CPPRuntimeContext::get()
+{
+    static const CPPRuntimeContext empty_context{};
+    return current_context != nullptr ? *current_context : empty_context;
+}
+
+CPPRuntimeContext *CPPRuntimeContext::thread_context()
+{
+    return current_context;
+}
+
+void CPPRuntimeContext::set_thread_context(CPPRuntimeContext *ctx)
+{
+    current_context = ctx;
+}
+
+CPPRuntimeContextScope::CPPRuntimeContextScope(CPPRuntimeContext *ctx) : _previous(CPPRuntimeContext::thread_context())
+{
+    CPPRuntimeContext::set_thread_context(ctx);
+}
+
+CPPRuntimeContextScope::~CPPRuntimeContextScope()
+{
+    CPPRuntimeContext::set_thread_context(_previous);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include "src/runtime/SchedulerUtils.h"
 #include "support/Mutex.h"
 
 #include <atomic>
@@ -92,24 +93,28 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
     } while (feeder.get_next(workload_index));
 }
 
-/** Set thread affinity. Pin current thread to a particular core
- *
- * @param[in] core_id ID of the core to which the current thread is pinned
- */
-void set_thread_affinity(int core_id)
+/** Hint the core that the current thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#endif /* defined(__GNUC__) */
+}
+
+/** State of the parallel regions of a scheduler shared with its threads */
+struct ParallelRegion
 {
-    if (core_id < 0)
+    /** Whether idle threads should spin instead of sleeping */
+    bool spinning() const
     {
-        return;
+        return _depth.load(std::memory_order_relaxed) > 0 && !_oversubscribed.load(std::memory_order_relaxed);
     }
 
-#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(core_id, &set);
-    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
-#endif /* !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
-}
+    std::atomic<unsigned int> _depth{0};
+    std::atomic<bool>         _oversubscribed{false};
+};
 
 /** There are currently 2 scheduling modes supported by CPPScheduler
  *
@@ -146,8 +151,9 @@ public:
      * Thread will be pinned to a given core id if value is non-negative
      *
      * @param[in] core_pin Core id to pin the thread on. If negative no thread pinning will take place
+     * @param[in] region   Parallel region state of the scheduler owning the thread
      */
-    explicit Thread(int core_pin = -1);
+    Thread(int core_pin, const ParallelRegion *region);
 
     Thread(const Thread &)            = delete;
     Thread &operator=(const Thread &) = delete;
@@ -176,6 +182,9 @@ public:
     /** Function ran by the worker thread. */
     void worker_thread();
 
+    /** Wait until the worker thread is requested to start executing workloads. */
+    void wait_for_work();
+
     /** Set the scheduling strategy to be linear */
     void set_linear_mode()
     {
@@ -199,16 +208,20 @@ private:
     ThreadFeeder                      *_feeder{nullptr};
     std::mutex                         _m{};
     std::condition_variable            _cv{};
-    bool                               _wait_for_work{false};
-    bool                               _job_complete{true};
+    std::condition_variable            _done_cv{};
+    std::atomic<bool>                  _wait_for_work{false};
+    std::atomic<bool>                  _job_complete{true};
+    std::atomic<bool>                  _worker_parked{false};
+    std::atomic<bool>                  _waiter_parked{false};
     std::exception_ptr                 _current_exception{nullptr};
     int                                _core_pin{-1};
+    const ParallelRegion              *_region{nullptr};
     std::list<Thread>                 *_thread_pool{nullptr};
     unsigned int                       _wake_beg{0};
     unsigned int                       _wake_end{0};
 };
 
-Thread::Thread(int core_pin) : _core_pin(core_pin)
+Thread::Thread(int core_pin, const ParallelRegion *region) : _core_pin(core_pin), _region(region)
 {
     _thread = std::thread(&Thread::worker_thread, this);
 }
@@ -234,32 +247,61 @@ void Thread::set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFe
 
 void Thread::start()
 {
+    _job_complete.store(false, std::memory_order_relaxed);
+    _wait_for_work.store(true);
+    // A spinning worker picks the work up by itself: only a parked one needs to be notified
+    if (_worker_parked.load())
     {
-        std::lock_guard<std::mutex> lock(_m);
-        _wait_for_work = true;
-        _job_complete  = false;
+        // Acquiring the mutex guarantees the worker is either already waiting or will see the new work
+        {
+            std::lock_guard<std::mutex> lock(_m);
+        }
+        _cv.notify_one();
     }
-    _cv.notify_one();
 }
 
 std::exception_ptr Thread::wait()
 {
+    while (!_job_complete.load(std::memory_order_acquire))
     {
+        if (_region->spinning())
+        {
+            cpu_relax();
+            continue;
+        }
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        _waiter_parked.store(true);
+        _done_cv.wait(lock, [&] { return _job_complete.load(); });
+        _waiter_parked.store(false);
     }
     return _current_exception;
 }
 
+void Thread::wait_for_work()
+{
+    // Inside a parallel region the worker polls for work, outside of it it sleeps until start() is called
+    while (!_wait_for_work.load(std::memory_order_acquire))
+    {
+        if (_region->spinning())
+        {
+            cpu_relax();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(_m);
+        _worker_parked.store(true);
+        _cv.wait(lock, [&] { return _wait_for_work.load(); });
+        _worker_parked.store(false);
+    }
+    _wait_for_work.store(false, std::memory_order_relaxed);
+}
+
 void Thread::worker_thread()
 {
-    set_thread_affinity(_core_pin);
+    scheduler_utils::set_thread_affinity(_core_pin);
 
     while (true)
     {
-        std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
-        _wait_for_work = false;
+        wait_for_work();
 
         _current_exception = nullptr;
 
@@ -294,10 +336,15 @@ void Thread::worker_thread()
             _current_exception = std::current_exception();
         }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        _workloads    = nullptr;
-        _job_complete = true;
-        lock.unlock();
-        _cv.notify_one();
+        _workloads = nullptr;
+        _job_complete.store(true);
+        if (_waiter_parked.load())
+        {
+            {
+                std::lock_guard<std::mutex> lock(_m);
+            }
+            _done_cv.notify_one();
+        }
     }
 }
 } //namespace
@@ -316,9 +363,10 @@ struct CPPScheduler::Impl final
         Linear,
         Fanout
     };
-    explicit Impl(unsigned int thread_hint)
-        : _num_threads(thread_hint), _threads(_num_threads - 1), _mode(Mode::Linear), _wake_fanout(0U)
+    explicit Impl(unsigned int thread_hint) : _num_threads(thread_hint), _mode(Mode::Linear), _wake_fanout(0U)
     {
+        resize_threads(_num_threads - 1);
+        update_oversubscription();
         const auto mode_env_v = utility::tolower(utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_MODE"));
         if (mode_env_v == "linear")
         {
@@ -336,7 +384,8 @@ struct CPPScheduler::Impl final
     void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
-        _threads.resize(_num_threads - 1);
+        resize_threads(_num_threads - 1);
+        update_oversubscription();
         auto_switch_mode(_num_threads);
     }
     void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
@@ -344,16 +393,34 @@ struct CPPScheduler::Impl final
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
 
         // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        scheduler_utils::set_thread_affinity(func(0, thread_hint));
 
         // Set affinity on worked threads
         _threads.clear();
         for (auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            _threads.emplace_back(func(i, thread_hint), &_region);
         }
+        update_oversubscription();
         auto_switch_mode(_num_threads);
     }
+    void resize_threads(unsigned int num_threads)
+    {
+        while (_threads.size() > num_threads)
+        {
+            _threads.pop_back();
+        }
+        while (_threads.size() < num_threads)
+        {
+            _threads.emplace_back(-1, &_region);
+        }
+    }
+    void update_oversubscription()
+    {
+        // Spinning threads would steal the cores from the busy ones when there are more threads than cores
+        const unsigned int num_cores = std::thread::hardware_concurrency();
+        _region._oversubscribed.store(num_cores != 0 && _num_threads > num_cores, std::memory_order_relaxed);
+    }
     void auto_switch_mode(unsigned int num_threads_to_use)
     {
         // If the environment variable is set to any of the modes, it overwrites the mode selected over num_threads_to_use
@@ -416,7 +483,8 @@ struct CPPScheduler::Impl final
     void run_workloads(std::vector<IScheduler::Workload> &workloads);
 
     unsigned int       _num_threads;
-    std::list<Thread>  _threads;
+    ParallelRegion     _region{};
+    std::list<Thread>  _threads{};
     arm_compute::Mutex _run_workloads_mutex{};
     Mode               _mode{Mode::Linear};
     ModeToggle         _forced_mode{ModeToggle::None};
@@ -457,6 +525,18 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+void CPPScheduler::begin_parallel_region()
+{
+    // Threads parked before the region are woken up by the first dispatch then keep spinning between dispatches
+    _impl->_region._depth.fetch_add(1);
+}
+
+void CPPScheduler::end_parallel_region()
+{
+    ARM_COMPUTE_ERROR_ON(_impl->_region._depth.load() == 0);
+    _impl->_region._depth.fetch_sub(1);
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace
+{
+/** Header line of the weights cache files */
+constexpr const char *weights_file_header = "weights_cache 1";
+
+/** Hash a buffer a 64-bit word at a time
+ *
+ * @param[in] hash Hash of the previous buffers.
+ * @param[in] data Buffer to hash.
+ * @param[in] size Size in bytes of the buffer.
+ *
+ * @return The updated hash.
+ */
+uint64_t hash_bytes(uint64_t hash, const uint8_t *data, size_t size)
+{
+    constexpr uint64_t prime = 0x100000001b3ULL;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * prime;
+    }
+    return hash;
+}
+
+/** Hash the content of a tensor, skipping its padding */
+uint64_t hash_tensor(const ITensor &tensor)
+{
+    constexpr uint64_t offset_basis = 0xcbf29ce484222325ULL;
+
+    const ITensorInfo &info = *tensor.info();
+    if (!info.has_padding())
+    {
+        return hash_bytes(offset_basis, tensor.buffer() + info.offset_first_element_in_bytes(), info.total_size());
+    }
+
+    uint64_t hash = offset_basis;
+    Window   win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator     it(&tensor, win);
+    const size_t row_size = info.dimension(0) * info.element_size();
+    execute_window_loop(
+        win, [&](const Coordinates &) { hash = hash_bytes(hash, it.ptr(), row_size); }, it);
+    return hash;
+}
+} // namespace
+
+struct CPPWeightsCache::Impl
+{
+    /** Prepared weights, either held in memory or stored in a cache file */
+    struct Entry
+    {
+        std::vector<uint8_t> data{};
+        std::string          filename{};
+        std::streamoff       offset{0};
+        size_t               size{0};
+    };
+
+    std::map<std::string, Entry> _weights{};
+    bool                         _store_new_weights{true};
+    mutable arm_compute::Mutex   _mtx{};
+};
+
+CPPWeightsCache::CPPWeightsCache(bool store_new_weights) : _impl(std::make_unique<Impl>())
+{
+    _impl->_store_new_weights = store_new_weights;
+}
+
+CPPWeightsCache::~CPPWeightsCache() = default;
+
+void CPPWeightsCache::set_store_new_weights(bool store_new_weights)
+{
+    _impl->_store_new_weights = store_new_weights;
+}
+
+bool CPPWeightsCache::store_new_weights() const
+{
+    return _impl->_store_new_weights;
+}
+
+std::string CPPWeightsCache::weights_id(const std::string                 &kernel_name,
+                                        const std::string                 &config,
+                                        const std::vector<const ITensor *> &weights,
+                                        const CPUInfo                     &cpu_info)
+{
+    std::stringstream ss;
+    ss << kernel_name << ";" << config;
+    for (const ITensor *tensor : weights)
+    {
+        if (tensor == nullptr)
+        {
+            continue;
+        }
+        const ITensorInfo &info = *tensor->info();
+        ss << ";" << string_from_data_type(info.data_type());
+        for (size_t d = 0; d < info.num_dimensions(); ++d)
+        {
+            ss << (d == 0 ? ";" : "x") << info.dimension(d);
+        }
+        ss << ";" << std::hex << hash_tensor(*tensor) << std::dec;
+    }
+    ss << ";" << cpuinfo::cpu_model_to_string(cpu_info.get_cpu_model()) << ";" << cpu_info.has_fp16()
+       << cpu_info.has_bf16() << cpu_info.has_dotprod() << cpu_info.has_i8mm() << cpu_info.has_sve()
+       << cpu_info.has_sve2() << cpu_info.has_sme2() << ";"
+       << (cpu_info.has_sme2() ? cpu_info.get_sme2_vector_length_in_bits() : 0);
+    return ss.str();
+}
+
+void CPPWeightsCache::add_weights(const std::string &weights_id, const void *data, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(data == nullptr || size == 0);
+    ARM_COMPUTE_ERROR_ON(weights_id.find('\n') != std::string::npos);
+
+    Impl::Entry entry;
+    entry.data.resize(size);
+    entry.size = size;
+    std::memcpy(entry.data.data(), data, size);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    _impl->_weights[weights_id] = std::move(entry);
+}
+
+bool CPPWeightsCache::find_weights(const std::string &weights_id, void *data, size_t size) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    const auto                                  it = _impl->_weights.find(weights_id);
+    if (it == _impl->_weights.end() || it->second.size != size)
+    {
+        return false;
+    }
+
+    const Impl::Entry &entry = it->second;
+    if (!entry.data.empty())
+    {
+        std::memcpy(data, entry.data.data(), size);
+        return true;
+    }
+
+    std::ifstream fs(entry.filename, std::ios::in | std::ios::binary);
+    fs.seekg(entry.offset);
+    fs.read(reinterpret_cast<char *>(data), size);
+    if (!fs)
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Failed to read cached weights from %s", entry.filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+size_t CPPWeightsCache::num_weights() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    return _impl->_weights.size();
+}
+
+void CPPWeightsCache::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in | std::ios::binary);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    fs.seekg(0, std::ios::end);
+    const std::streamoff file_size = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+
+    std::string line;
+    if (std::getline(fs, line).fail() || line != weights_file_header)
+    {
+        ARM_COMPUTE_ERROR_VAR("%s is not a weights cache file", filename.c_str());
+    }
+
+    // Only index the entries, their content is read when they are looked up
+    std::string weights_id;
+    while (!std::getline(fs, weights_id).fail())
+    {
+        if (weights_id.empty() || std::getline(fs, line).fail())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed entry '%s' in %s", weights_id.c_str(), filename.c_str());
+        }
+        char                    *end  = nullptr;
+        const unsigned long long size = std::strtoull(line.c_str(), &end, 10);
+
+        Impl::Entry entry;
+        entry.filename = filename;
+        entry.offset   = fs.tellg();
+        entry.size     = static_cast<size_t>(size);
+        if (size == 0 || *end != '\0' || entry.offset + static_cast<std::streamoff>(size) > file_size)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed entry '%s' in %s", weights_id.c_str(), filename.c_str());
+        }
+        fs.seekg(entry.offset + static_cast<std::streamoff>(size));
+
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+        _impl->_weights[weights_id] = std::move(entry);
+    }
+    fs.close();
+}
+
+bool CPPWeightsCache::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_mtx);
+    if (_impl->_weights.empty() || filename.empty())
+    {
+        return false;
+    }
+
+    // The entries may be read from the file being overwritten: write a temporary file and rename it when complete
+    const std::string              tmp_filename = filename + ".tmp";
+    std::map<std::string, int64_t> offsets;
+    std::ofstream                  fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(tmp_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fs << weights_file_header << "\n";
+    for (auto const &weights : _impl->_weights)
+    {
+        const Impl::Entry &entry = weights.second;
+        fs << weights.first << "\n" << entry.size << "\n";
+        offsets[weights.first] = fs.tellp();
+        if (!entry.data.empty())
+        {
+            fs.write(reinterpret_cast<const char *>(entry.data.data()), entry.size);
+            continue;
+        }
+
+        std::ifstream src;
+        src.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        src.open(entry.filename, std::ios::in | std::ios::binary);
+        src.seekg(entry.offset);
+        std::vector<char> chunk(std::min<size_t>(entry.size, 1024 * 1024));
+        for (size_t copied = 0; copied < entry.size; copied += chunk.size())
+        {
+            const size_t chunk_size = std::min(chunk.size(), entry.size - copied);
+            src.read(chunk.data(), chunk_size);
+            fs.write(chunk.data(), chunk_size);
+        }
+    }
+    fs.close();
+
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to rename '%s' (%s [%d])", tmp_filename.c_str(), strerror(errno), errno);
+    }
+
+    // Read the entries which are not held in memory from the new file from now on
+    for (auto &weights : _impl->_weights)
+    {
+        if (weights.second.data.empty())
+        {
+            weights.second.filename = filename;
+            weights.second.offset   = offsets[weights.first];
+        }
+    }
+    return true;
+}
+} // namespace arm_compute
@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "src/runtime/SchedulerUtils.h"
+#include "support/Mutex.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Default number of polling iterations an idle worker performs before parking */
+constexpr unsigned int default_spin_count = 1U << 16;
+/** Number of polling iterations the main thread performs before yielding while waiting for the workers */
+constexpr unsigned int main_thread_spin_count = 1U << 12;
+
+/** Hint the core that the current thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#endif /* defined(__GNUC__) */
+}
+
+/** Lock-free queue of workload indices
+ *
+ * The queue holds a contiguous range [begin, end) packed in a single 64-bit word so that both ends can be
+ * updated with one compare-and-swap: the owner pops from the front while thieves steal from the back.
+ */
+class RangeQueue
+{
+public:
+    /** Replace the content of the queue
+     *
+     * @note Must only be called when the queue is empty or no other thread accesses it.
+     *
+     * @param[in] begin First index of the range
+     * @param[in] end   End of the range (non-inclusive)
+     */
+    void reset(unsigned int begin, unsigned int end)
+    {
+        _range.store(pack(begin, end), std::memory_order_release);
+    }
+    /** Pop the first index of the range
+     *
+     * @param[out] index Popped index if there is one.
+     *
+     * @return False if the queue was empty and index wasn't set.
+     */
+    bool pop_front(unsigned int &index)
+    {
+        uint64_t range = _range.load(std::memory_order_acquire);
+        while (begin_of(range) < end_of(range))
+        {
+            if (_range.compare_exchange_weak(range, pack(begin_of(range) + 1, end_of(range)),
+                                             std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                index = begin_of(range);
+                return true;
+            }
+        }
+        return false;
+    }
+    /** Steal the back half of the range
+     *
+     * @param[out] begin First stolen index
+     * @param[out] end   End of the stolen range (non-inclusive)
+     *
+     * @return False if the queue was empty and nothing was stolen.
+     */
+    bool steal_back(unsigned int &begin, unsigned int &end)
+    {
+        uint64_t range = _range.load(std::memory_order_acquire);
+        while (begin_of(range) < end_of(range))
+        {
+            const unsigned int num_stolen = (end_of(range) - begin_of(range) + 1) / 2;
+            const unsigned int split      = end_of(range) - num_stolen;
+            if (_range.compare_exchange_weak(range, pack(begin_of(range), split), std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+            {
+                begin = split;
+                end   = end_of(range);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t pack(unsigned int begin, unsigned int end)
+    {
+        return (static_cast<uint64_t>(end) << 32) | begin;
+    }
+    static unsigned int begin_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range & 0xFFFFFFFFU);
+    }
+    static unsigned int end_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range >> 32);
+    }
+
+    std::atomic<uint64_t> _range{0};
+    // Keep each queue on its own cache line to avoid false sharing between owners
+    char _pad[64 - sizeof(std::atomic<uint64_t>)]{};
+};
+
+/** A job is published as a single word: the generation in the upper half and the number of threads in the lower one.
+ *
+ * Reading both from the same word guarantees a worker never mixes up the thread count of two different runs.
+ * A thread count of 0 requests the workers to exit.
+ */
+uint64_t make_job(uint32_t generation, unsigned int num_threads)
+{
+    return (static_cast<uint64_t>(generation) << 32) | num_threads;
+}
+uint32_t job_generation(uint64_t job)
+{
+    return static_cast<uint32_t>(job >> 32);
+}
+unsigned int job_num_threads(uint64_t job)
+{
+    return static_cast<unsigned int>(job & 0xFFFFFFFFU);
+}
+} // namespace
+
+struct CPPWorkStealingScheduler::Impl final
+{
+    explicit Impl(unsigned int thread_hint) : _spin_count(default_spin_count)
+    {
+        const auto spin_env_v = utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_SPIN_COUNT");
+        if (!spin_env_v.empty())
+        {
+            _spin_count = static_cast<unsigned int>(std::strtoul(spin_env_v.c_str(), nullptr, 10));
+        }
+        start_workers(thread_hint, nullptr, thread_hint);
+    }
+    ~Impl()
+    {
+        stop_workers();
+    }
+
+    void start_workers(unsigned int num_threads, const BindFunc &func, unsigned int thread_hint)
+    {
+        _num_threads = num_threads;
+        // Spinning threads would steal the cores from the busy ones when there are more threads than cores
+        const unsigned int num_cores = std::thread::hardware_concurrency();
+        _oversubscribed              = num_cores != 0 && _num_threads > num_cores;
+        _queues      = std::vector<RangeQueue>(_num_threads);
+        _exceptions  = std::vector<std::exception_ptr>(_num_threads);
+        for (unsigned int t = 0; t < _num_threads - 1; ++t)
+        {
+            // Thread 0 is the main thread when binding, the workers are bound starting from 1
+            const int core_pin = func ? func(t + 1, thread_hint) : -1;
+            _threads.emplace_back(&Impl::worker_thread, this, t, core_pin, _generation);
+        }
+    }
+
+    void stop_workers()
+    {
+        publish(0);
+        for (auto &thread : _threads)
+        {
+            thread.join();
+        }
+        _threads.clear();
+    }
+
+    /** Wake up the parked workers if any
+     *
+     * @note The caller must have updated the state the workers wait on beforehand.
+     */
+    void wake_parked_workers()
+    {
+        if (_num_parked.load() > 0)
+        {
+            // Acquiring the mutex guarantees a worker is either already waiting or will see the new state
+            {
+                std::lock_guard<std::mutex> lock(_park_mutex);
+            }
+            _park_cv.notify_all();
+        }
+    }
+
+    /** Publish a new job to the workers and wake up the parked ones */
+    void publish(unsigned int num_threads)
+    {
+        _job.store(make_job(++_generation, num_threads));
+        wake_parked_workers();
+    }
+
+    bool in_parallel_region() const
+    {
+        return !_oversubscribed && _region_depth.load() > 0;
+    }
+
+    /** Spin then park until a job newer than @p generation is published
+     *
+     * Workers keep spinning for as long as a parallel region is open.
+     */
+    uint64_t wait_for_job(uint32_t generation)
+    {
+        while (true)
+        {
+            const unsigned int spin_count = _oversubscribed ? 0U : _spin_count.load(std::memory_order_relaxed);
+            for (unsigned int i = 0; i < spin_count || in_parallel_region(); ++i)
+            {
+                const uint64_t job = _job.load(std::memory_order_acquire);
+                if (job_generation(job) != generation)
+                {
+                    return job;
+                }
+                cpu_relax();
+            }
+
+            std::unique_lock<std::mutex> lock(_park_mutex);
+            uint64_t                     job = 0;
+            _num_parked.fetch_add(1);
+            _park_cv.wait(lock,
+                          [&]
+                          {
+                              job = _job.load();
+                              return job_generation(job) != generation || in_parallel_region();
+                          });
+            _num_parked.fetch_sub(1);
+            if (job_generation(job) != generation)
+            {
+                return job;
+            }
+            // Woken up by the opening of a parallel region: go back to spinning
+        }
+    }
+
+    void worker_thread(unsigned int thread_id, int core_pin, uint32_t generation)
+    {
+        scheduler_utils::set_thread_affinity(core_pin);
+
+        while (true)
+        {
+            const uint64_t     job         = wait_for_job(generation);
+            const unsigned int num_threads = job_num_threads(job);
+            generation                     = job_generation(job);
+
+            if (num_threads == 0)
+            {
+                return;
+            }
+            // The last thread id is taken by the main thread
+            if (thread_id >= num_threads - 1)
+            {
+                continue;
+            }
+
+            ThreadInfo info = _info;
+            info.thread_id  = thread_id;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                process_workloads(info);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch (...)
+            {
+                _exceptions[thread_id] = std::current_exception();
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            _pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /** Drain the thread's own queue then steal from its peers until all the queues are empty */
+    void process_workloads(const ThreadInfo &info)
+    {
+        const unsigned int thread_id = info.thread_id;
+        unsigned int       index     = 0;
+        do
+        {
+            while (_queues[thread_id].pop_front(index))
+            {
+                ARM_COMPUTE_ERROR_ON(index >= _workloads->size());
+                (*_workloads)[index](info);
+            }
+        } while (steal(thread_id, info.num_threads));
+    }
+
+    bool steal(unsigned int thief, unsigned int num_threads)
+    {
+        unsigned int begin = 0;
+        unsigned int end   = 0;
+        for (unsigned int i = 1; i < num_threads; ++i)
+        {
+            const unsigned int victim = (thief + i) % num_threads;
+            if (_queues[victim].steal_back(begin, end))
+            {
+                // The thief's queue is empty at this point so nobody else can be updating it
+                _queues[thief].reset(begin, end);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    unsigned int                       _num_threads{0};
+    bool                               _oversubscribed{false};
+    std::atomic<unsigned int>          _spin_count;
+    std::vector<std::thread>           _threads{};
+    std::vector<RangeQueue>            _queues{};
+    std::vector<std::exception_ptr>    _exceptions{};
+    std::vector<IScheduler::Workload> *_workloads{nullptr};
+    ThreadInfo                         _info{};
+    uint32_t                           _generation{0};
+    std::atomic<uint64_t>              _job{0};
+    std::atomic<unsigned int>          _pending{0};
+    std::atomic<unsigned int>          _num_parked{0};
+    std::atomic<unsigned int>          _region_depth{0};
+    std::mutex                         _park_mutex{};
+    std::condition_variable            _park_cv{};
+    arm_compute::Mutex                 _run_workloads_mutex{};
+};
+
+CPPWorkStealingScheduler::CPPWorkStealingScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
+{
+}
+
+CPPWorkStealingScheduler::~CPPWorkStealingScheduler() = default;
+
+void CPPWorkStealingScheduler::set_spin_count(unsigned int spin_count)
+{
+    _impl->_spin_count.store(spin_count, std::memory_order_relaxed);
+}
+
+void CPPWorkStealingScheduler::begin_parallel_region()
+{
+    if (_impl->_region_depth.fetch_add(1) == 0)
+    {
+        // Wake the pool up now so that the first kernel of the region doesn't pay for it
+        _impl->wake_parked_workers();
+    }
+}
+
+void CPPWorkStealingScheduler::end_parallel_region()
+{
+    ARM_COMPUTE_ERROR_ON(_impl->_region_depth.load() == 0);
+    _impl->_region_depth.fetch_sub(1);
+}
+
+void CPPWorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    _impl->stop_workers();
+    _impl->start_workers(num_threads == 0 ? num_threads_hint() : num_threads, nullptr, num_threads_hint());
+}
+
+void CPPWorkStealingScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    const unsigned int                          thread_hint = num_threads_hint();
+
+    // Set affinity on main thread
+    scheduler_utils::set_thread_affinity(func(0, thread_hint));
+
+    _impl->stop_workers();
+    _impl->start_workers(num_threads == 0 ? thread_hint : num_threads, func, thread_hint);
+}
+
+unsigned int CPPWorkStealingScheduler::num_threads() const
+{
+    return _impl->_num_threads;
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPWorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    const unsigned int num_workloads      = static_cast<unsigned int>(workloads.size());
+    const unsigned int num_threads_to_use = std::min(_impl->_num_threads, num_workloads);
+    if (num_threads_to_use < 1)
+    {
+        return;
+    }
+
+    // Give each thread a contiguous range of workloads, the idle ones will steal from the busy ones
+    for (unsigned int t = 0; t < num_threads_to_use; ++t)
+    {
+        _impl->_queues[t].reset(t * num_workloads / num_threads_to_use, (t + 1) * num_workloads / num_threads_to_use);
+    }
+    for (unsigned int t = 0; t < num_threads_to_use - 1; ++t)
+    {
+        _impl->_exceptions[t] = nullptr;
+    }
+    _impl->_workloads        = &workloads;
+    _impl->_info.cpu_info    = &cpu_info();
+    _impl->_info.num_threads = num_threads_to_use;
+    _impl->_pending.store(num_threads_to_use - 1, std::memory_order_relaxed);
+
+    if (num_threads_to_use > 1)
+    {
+        _impl->publish(num_threads_to_use);
+    }
+
+    ThreadInfo info                   = _impl->_info;
+    info.thread_id                    = num_threads_to_use - 1; // Set main thread's thread_id
+    std::exception_ptr last_exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif                                       /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _impl->process_workloads(info); // Main thread processes workloads
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        last_exception = std::current_exception();
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    // Wait for the workers: they are expected to finish shortly after the main thread so spin before yielding
+    unsigned int spins = 0;
+    while (_impl->_pending.load(std::memory_order_acquire) != 0)
+    {
+        if (!_impl->_oversubscribed && spins < main_thread_spin_count)
+        {
+            ++spins;
+            cpu_relax();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    _impl->_workloads = nullptr;
+
+    for (unsigned int t = 0; t < num_threads_to_use - 1; ++t)
+    {
+        if (_impl->_exceptions[t])
+        {
+            last_exception = _impl->_exceptions[t];
+        }
+    }
+    if (last_exception)
+    {
+        std::rethrow_exception(last_exception);
+    }
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPWorkStealingScheduler::schedule_op(ICPPKernel  *kernel,
+                                           const Hints &hints,
+                                           const Window &window,
+                                           ITensorPack  &tensors)
+{
+    schedule_common(kernel, hints, window, tensors);
+}
+
+void CPPWorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+} // namespace arm_compute
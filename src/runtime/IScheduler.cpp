@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,20 +25,166 @@
 
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/CPP/CPPMwsTuner.h"
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+
 namespace arm_compute
 {
+namespace
+{
+/** Number of windows to split the dimension into, before taking the minimum workload size into account */
+unsigned int initial_num_windows(const IScheduler::Hints &hints, unsigned int num_iterations, unsigned int num_threads)
+{
+    switch (hints.strategy())
+    {
+        case IScheduler::StrategyHint::STATIC:
+            return num_threads;
+        case IScheduler::StrategyHint::DYNAMIC:
+        {
+            const unsigned int granule_threshold =
+                (hints.threshold() <= 0) ? num_threads : static_cast<unsigned int>(hints.threshold());
+            // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
+            return num_iterations > granule_threshold ? granule_threshold : num_iterations;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unknown strategy");
+    }
+}
+
+/** Bytes of the source and destination tensors of a pack */
+std::size_t tensors_size(const ITensorPack &tensors)
+{
+    std::size_t bytes = 0;
+    for (int id = ACL_SRC_0; id <= ACL_DST_END; id = (id == ACL_SRC_END) ? ACL_DST_0 : id + 1)
+    {
+        const ITensor *tensor = tensors.get_const_tensor(id);
+        if (tensor != nullptr)
+        {
+            bytes += tensor->info()->total_size();
+        }
+    }
+    return bytes;
+}
+
+/** Copies of the tensors of a pack, to run a kernel on without touching the original tensors */
+class ScratchPack
+{
+public:
+    explicit ScratchPack(const ITensorPack &tensors)
+    {
+        // In-place kernels use the same tensor in several slots, so do their copies
+        std::map<const ITensor *, ITensor *> copies;
+        for (int id : tensors.ids())
+        {
+            const ITensor *tensor = tensors.get_const_tensor(id);
+            if (tensor == nullptr)
+            {
+                continue;
+            }
+            auto it = copies.find(tensor);
+            if (it == copies.end())
+            {
+                _tensors.emplace_back(std::make_unique<Tensor>());
+                Tensor &copy = *_tensors.back();
+                copy.allocator()->init(TensorInfo(*tensor->info()));
+                copy.allocator()->allocate();
+                // The whole buffer is copied, so the offset and strides of the info also hold for views
+                if (tensor->buffer() != nullptr)
+                {
+                    std::memcpy(copy.buffer(), tensor->buffer(), tensor->info()->total_size());
+                }
+                else
+                {
+                    std::memset(copy.buffer(), 0, tensor->info()->total_size());
+                }
+                it = copies.emplace(tensor, &copy).first;
+            }
+            _pack.add_tensor(id, it->second);
+        }
+    }
+
+    ITensorPack &pack()
+    {
+        return _pack;
+    }
+
+private:
+    std::vector<std::unique_ptr<Tensor>> _tensors{};
+    ITensorPack                          _pack{};
+};
+
+/** Nanoseconds elapsed since a time point */
+int64_t elapsed_ns(CPPProfiler::Clock::time_point start, CPPProfiler::Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+} // namespace
+
+/** Sub-windows and workloads of a kernel, computed once and reused for as long as the dispatch parameters don't change
+ *
+ * The plan is attached to the kernel, so it lives as long as the kernel and is only rebuilt when the kernel is
+ * reconfigured or dispatched differently.
+ */
+struct IScheduler::DispatchPlan : public ICPPKernel::SchedulerState
+{
+    /** Check whether the plan was built for the given dispatch parameters */
+    bool matches(const Hints &hints, const Window &window, unsigned int num_threads, const CPPMwsTuner *mws_tuner) const
+    {
+        return _built && _split_dimension == hints.split_dimension() && _strategy == hints.strategy() &&
+               _threshold == hints.threshold() && _num_threads == num_threads && _mws_tuner == mws_tuner &&
+               _window == window;
+    }
+
+    /** Record a workload of the current run in the profiler */
+    void record_workload(CPPProfiler::Clock::time_point start)
+    {
+        const auto end = CPPProfiler::Clock::now();
+        _busy_ns += elapsed_ns(start, end);
+        _profiler->add_event(_kernel->name(), "workload", start, end);
+    }
+
+    ICPPKernel        *_kernel{nullptr};
+    bool               _built{false};
+    Window             _window{};
+    unsigned int       _split_dimension{0};
+    StrategyHint       _strategy{StrategyHint::STATIC};
+    int                _threshold{0};
+    unsigned int       _num_threads{0};
+    const CPPMwsTuner *_mws_tuner{nullptr};
+
+    std::vector<Window>               _windows{};
+    std::vector<Window>               _thread_locators{};
+    std::vector<IScheduler::Workload> _workloads{};
+    ITensorPack                      *_tensors{nullptr};
+    CPPProfiler                      *_profiler{nullptr};
+    std::atomic<int64_t>              _busy_ns{0};
+    /** Set while a dispatch uses the plan, a concurrent dispatch of the same kernel then uses a plan of its own */
+    std::atomic_flag _in_use = ATOMIC_FLAG_INIT;
+};
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
     _num_threads_hint = cpuinfo::num_threads_hint();
 }
 
+IScheduler::~IScheduler() = default;
+
 CPUInfo &IScheduler::cpu_info()
 {
     return CPUInfo::get();
@@ -55,22 +201,36 @@ unsigned int IScheduler::num_threads_hint() const
     return _num_threads_hint;
 }
 
-void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
-{
-    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 #ifndef BARE_METAL
-    const Window &max_window = window;
+void IScheduler::build_dispatch_plan(DispatchPlan &plan, ICPPKernel *kernel, const Hints &hints, const Window &window)
+{
+    const unsigned int max_threads = this->num_threads();
+
+    plan._kernel          = kernel;
+    plan._window          = window;
+    plan._split_dimension = hints.split_dimension();
+    plan._strategy        = hints.strategy();
+    plan._threshold       = hints.threshold();
+    plan._num_threads     = max_threads;
+    plan._mws_tuner       = CPPRuntimeContext::get().mws_tuner();
+    plan._windows.clear();
+    plan._thread_locators.clear();
+    plan._workloads.clear();
+
+    // The workloads only capture the plan and their index so they don't allocate and stay valid across runs:
+    // the tensors of the current run are read from the plan.
+    DispatchPlan *p = &plan;
     if (hints.split_dimension() == IScheduler::split_dimensions_all)
     {
         /*
          * if the split dim is size_t max then this signals we should parallelise over
          * all dimensions
          */
-        const std::size_t m = max_window.num_iterations(Window::DimX);
-        const std::size_t n = max_window.num_iterations(Window::DimY);
+        const std::size_t m = window.num_iterations(Window::DimX);
+        const std::size_t n = window.num_iterations(Window::DimY);
 
         const unsigned int num_iterations = m * n;
-        const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
+        const unsigned int num_threads    = std::min(num_iterations, max_threads);
 
         //in c++17 this can be swapped for   auto [ m_threads, n_threads ] = split_2d(...
         unsigned m_threads, n_threads;
@@ -84,40 +244,94 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             n_threads = std::min<unsigned int>(n, n_threads);
         }
 
-        std::vector<IScheduler::Workload> workloads;
         for (unsigned int ni = 0; ni != n_threads; ++ni)
         {
             for (unsigned int mi = 0; mi != m_threads; ++mi)
             {
-                workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel, &tensors](const ThreadInfo &info)
-                    {
-                        //narrow the window to our mi-ni workload
-                        Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                         .split_window(Window::DimY, ni, n_threads);
-
-                        win.validate();
-
-                        Window thread_locator;
-                        thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                        thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                //narrow the window to our mi-ni workload
+                Window win =
+                    window.split_window(Window::DimX, mi, m_threads).split_window(Window::DimY, ni, n_threads);
+                win.validate();
 
-                        thread_locator.validate();
+                Window thread_locator;
+                thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
+                thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                thread_locator.validate();
 
-                        if (tensors.empty())
+                const std::size_t t = p->_windows.size();
+                p->_windows.push_back(win);
+                p->_thread_locators.push_back(thread_locator);
+                p->_workloads.push_back(
+                    [p, t](const ThreadInfo &info)
+                    {
+                        const auto start =
+                            p->_profiler != nullptr ? CPPProfiler::Clock::now() : CPPProfiler::Clock::time_point{};
+                        if (p->_tensors->empty())
                         {
-                            kernel->run_nd(win, info, thread_locator);
+                            p->_kernel->run_nd(p->_windows[t], info, p->_thread_locators[t]);
                         }
                         else
                         {
-                            kernel->run_op(tensors, win, info);
+                            p->_kernel->run_op(*p->_tensors, p->_windows[t], info);
+                        }
+                        if (p->_profiler != nullptr)
+                        {
+                            p->record_workload(start);
                         }
                     });
             }
         }
-        run_workloads(workloads);
     }
     else
+    {
+        const unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+        const unsigned int num_threads    = std::min(num_iterations, max_threads);
+
+        // Make sure the smallest window is larger than minimum workload size
+        const unsigned int num_windows = adjust_num_of_windows(
+            window, hints.split_dimension(), initial_num_windows(hints, num_iterations, num_threads), *kernel, cpu_info());
+
+        p->_windows.resize(num_windows);
+        p->_workloads.resize(num_windows);
+        for (unsigned int t = 0; t < num_windows; ++t)
+        {
+            p->_windows[t] = window.split_window(hints.split_dimension(), t, num_windows);
+            p->_windows[t].validate();
+
+            p->_workloads[t] = [p, t](const ThreadInfo &info)
+            {
+                const auto start =
+                    p->_profiler != nullptr ? CPPProfiler::Clock::now() : CPPProfiler::Clock::time_point{};
+                if (p->_tensors->empty())
+                {
+                    p->_kernel->run(p->_windows[t], info);
+                }
+                else
+                {
+                    p->_kernel->run_op(*p->_tensors, p->_windows[t], info);
+                }
+                if (p->_profiler != nullptr)
+                {
+                    p->record_workload(start);
+                }
+            };
+        }
+    }
+
+    plan._built = true;
+}
+#endif /* !BARE_METAL */
+
+void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+#ifndef BARE_METAL
+    const CPPRuntimeContext &runtime_ctx = CPPRuntimeContext::get();
+    CPPProfiler             *profiler    = runtime_ctx.profiler();
+    CPPMwsTuner             *mws_tuner   = runtime_ctx.mws_tuner();
+
+    const Window &max_window = window;
+    if (hints.split_dimension() != IScheduler::split_dimensions_all)
     {
         const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
         const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
@@ -129,6 +343,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 
         if (!kernel->is_parallelisable() || num_threads == 1)
         {
+            const auto start = profiler != nullptr ? CPPProfiler::Clock::now() : CPPProfiler::Clock::time_point{};
             ThreadInfo info;
             info.cpu_info = &cpu_info();
             if (tensors.empty())
@@ -139,50 +354,68 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             {
                 kernel->run_op(tensors, max_window, info);
             }
-        }
-        else
-        {
-            unsigned int num_windows = 0;
-            switch (hints.strategy())
+            if (profiler != nullptr)
             {
-                case StrategyHint::STATIC:
-                    num_windows = num_threads;
-                    break;
-                case StrategyHint::DYNAMIC:
-                {
-                    const unsigned int granule_threshold =
-                        (hints.threshold() <= 0) ? num_threads : static_cast<unsigned int>(hints.threshold());
-                    // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
-                    num_windows = num_iterations > granule_threshold ? granule_threshold : num_iterations;
-                    break;
-                }
-                default:
-                    ARM_COMPUTE_ERROR("Unknown strategy");
+                profiler->add_event(kernel->name(), "kernel", start, CPPProfiler::Clock::now(), tensors_size(tensors));
             }
-            // Make sure the smallest window is larger than minimum workload size
-            num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
+            return;
+        }
+    }
 
-            std::vector<IScheduler::Workload> workloads(num_windows);
-            for (unsigned int t = 0; t < num_windows; ++t)
-            {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-                {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                    win.validate();
+    auto *plan = static_cast<DispatchPlan *>(kernel->scheduler_state());
+    if (plan == nullptr)
+    {
+        plan = static_cast<DispatchPlan *>(kernel->attach_scheduler_state(std::make_unique<DispatchPlan>()));
+    }
 
-                    if (tensors.empty())
-                    {
-                        kernel->run(win, info);
-                    }
-                    else
-                    {
-                        kernel->run_op(tensors, win, info);
-                    }
-                };
-            }
-            run_workloads(workloads);
+    // A kernel dispatched by several threads at once only reuses its plan in one of them, without waiting
+    std::unique_ptr<DispatchPlan> concurrent_plan{nullptr};
+    if (plan->_in_use.test_and_set(std::memory_order_acquire))
+    {
+        concurrent_plan = std::make_unique<DispatchPlan>();
+        plan            = concurrent_plan.get();
+        plan->_in_use.test_and_set(std::memory_order_relaxed);
+    }
+    struct PlanRelease
+    {
+        ~PlanRelease()
+        {
+            plan->_tensors  = nullptr;
+            plan->_profiler = nullptr;
+            plan->_in_use.clear(std::memory_order_release);
+        }
+        DispatchPlan *plan;
+    } release{plan};
+
+    if (!plan->matches(hints, max_window, this->num_threads(), mws_tuner))
+    {
+        // Kernels are tuned once, when their plan is prepared, rather than on every dispatch
+        if (mws_tuner != nullptr && mws_tuner->tune_new_kernels() &&
+            hints.split_dimension() != IScheduler::split_dimensions_all)
+        {
+            tune_mws(*mws_tuner, kernel, hints, max_window, tensors);
         }
+        build_dispatch_plan(*plan, kernel, hints, max_window);
+    }
+
+    plan->_tensors  = &tensors;
+    plan->_profiler = profiler;
+    if (profiler == nullptr)
+    {
+        run_workloads(plan->_workloads);
+    }
+    else
+    {
+        plan->_busy_ns   = 0;
+        const auto start = CPPProfiler::Clock::now();
+        run_workloads(plan->_workloads);
+        const auto end = CPPProfiler::Clock::now();
+
+        // Share of the wall time of the kernel the threads spent running its workloads
+        const unsigned int threads     = std::min<unsigned int>(plan->_workloads.size(), this->num_threads());
+        const int64_t      wall_ns     = elapsed_ns(start, end) * threads;
+        const float        utilisation = wall_ns > 0 ? static_cast<float>(plan->_busy_ns) / wall_ns : 1.f;
+        profiler->add_event(kernel->name(), "kernel", start, end, tensors_size(tensors), threads, utilisation);
     }
 #else  /* !BARE_METAL */
     ARM_COMPUTE_UNUSED(kernel, hints, window, tensors);
@@ -191,8 +424,106 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
-    ARM_COMPUTE_UNUSED(tag);
-    run_workloads(workloads);
+    CPPProfiler *profiler = CPPRuntimeContext::get().profiler();
+    if (profiler == nullptr)
+    {
+        run_workloads(workloads);
+        return;
+    }
+
+    const char           *name = tag != nullptr ? tag : "Unknown";
+    std::atomic<int64_t>  busy_ns{0};
+    std::vector<Workload> timed_workloads(workloads.size());
+    for (size_t i = 0; i < workloads.size(); ++i)
+    {
+        timed_workloads[i] = [&, i](const ThreadInfo &info)
+        {
+            const auto start = CPPProfiler::Clock::now();
+            workloads[i](info);
+            const auto end = CPPProfiler::Clock::now();
+            busy_ns += elapsed_ns(start, end);
+            profiler->add_event(name, "workload", start, end);
+        };
+    }
+
+    const auto start = CPPProfiler::Clock::now();
+    run_workloads(timed_workloads);
+    const auto end = CPPProfiler::Clock::now();
+
+    const unsigned int threads = std::min<unsigned int>(workloads.size(), this->num_threads());
+    const int64_t      wall_ns = elapsed_ns(start, end) * threads;
+    profiler->add_event(name, "kernel", start, end, 0, threads,
+                        wall_ns > 0 ? static_cast<float>(busy_ns) / wall_ns : 1.f);
+}
+
+#ifndef BARE_METAL
+void IScheduler::tune_mws(
+    CPPMwsTuner &tuner, ICPPKernel *kernel, const Hints &hints, const Window &window, const ITensorPack &tensors)
+{
+    // Kernels without a pack are bound to their tensors, which can't be swapped for scratch ones
+    if (tensors.empty())
+    {
+        return;
+    }
+    const std::string kernel_id = CPPMwsTuner::kernel_id(*kernel, cpu_info(), num_threads(), window);
+    std::size_t       mws       = 0;
+    if (tuner.find_mws(kernel_id, mws))
+    {
+        return;
+    }
+
+    // Accumulating and in-place kernels would corrupt the tensors of the actual run if they were run on them
+    ScratchPack  scratch(tensors);
+    ITensorPack &scratch_tensors = scratch.pack();
+
+    const unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+    const unsigned int max_windows =
+        initial_num_windows(hints, num_iterations, std::min(num_iterations, this->num_threads()));
+
+    // Time the kernel split in max_windows, max_windows / 2, ..., 1 windows and keep the fastest split
+    constexpr unsigned int num_repetitions = 3;
+    unsigned int           best_windows    = max_windows;
+    auto                   best_time       = std::chrono::steady_clock::duration::max();
+    for (unsigned int num_windows = max_windows; num_windows > 0; num_windows /= 2)
+    {
+        std::vector<IScheduler::Workload> workloads(num_windows);
+        for (unsigned int t = 0; t < num_windows; ++t)
+        {
+            workloads[t] = [&, t](const ThreadInfo &info)
+            {
+                const Window win = window.split_window(hints.split_dimension(), t, num_windows);
+                kernel->run_op(scratch_tensors, win, info);
+            };
+        }
+
+        // The first run warms the caches up and is not timed
+        run_workloads(workloads);
+        auto time = std::chrono::steady_clock::duration::max();
+        for (unsigned int i = 0; i < num_repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run_workloads(workloads);
+            time = std::min(time, std::chrono::steady_clock::now() - start);
+        }
+        if (time < best_time)
+        {
+            best_time    = time;
+            best_windows = num_windows;
+        }
+    }
+
+    mws = std::max(1U, num_iterations / best_windows);
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned minimum workload size of %s: %zu", kernel_id.c_str(), mws);
+    tuner.add_mws(kernel_id, mws);
+}
+#endif /* !BARE_METAL */
+
+void IScheduler::begin_parallel_region()
+{
+}
+
+void IScheduler::end_parallel_region()
+{
 }
 
 std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
@@ -217,10 +548,17 @@ std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
             split_dimension, recommended_split_dim);
     }
 
+    const CPPMwsTuner *mws_tuner = CPPRuntimeContext::get().mws_tuner();
+    std::size_t        tuned_mws = 0;
+    const bool         has_tuned_mws =
+        mws_tuner != nullptr &&
+        mws_tuner->find_mws(CPPMwsTuner::kernel_id(kernel, cpu_info, num_threads(), window), tuned_mws);
+
     for (auto t = init_num_windows; t > 0; --t) // Trying the highest number of windows ,init_num_windows, first
     {
+        const std::size_t mws = has_tuned_mws ? tuned_mws : kernel.get_mws(cpu_info, t);
         // Try splitting the workload into t, subject to each subworkload size <= mws.
-        if ((window.num_iterations(split_dimension) / kernel.get_mws(cpu_info, t)) >= t)
+        if ((window.num_iterations(split_dimension) / mws) >= t)
         {
             if (t != init_num_windows)
             {
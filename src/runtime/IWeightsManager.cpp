@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,24 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
+
+#include "support/Mutex.h"
+
 namespace arm_compute
 {
-IWeightsManager::IWeightsManager() : _managed_weights(), _managed_counter(), _managed_weights_parents()
+struct IWeightsManager::SharedWeightsRegistry
+{
+    std::map<std::string, std::weak_ptr<SharedWeights>> weights{};
+    arm_compute::Mutex                                  mtx{};
+};
+
+IWeightsManager::IWeightsManager()
+    : _managed_weights(),
+      _managed_counter(),
+      _managed_weights_parents(),
+      _shared_weights(std::make_shared<SharedWeightsRegistry>())
 {
 }
 
@@ -174,4 +189,35 @@ void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 
     _managed_counter[weights].is_unused = true;
 }
+
+std::string IWeightsManager::transform_id(const std::string &uid, const std::vector<const ITensor *> &weights)
+{
+    return CPPWeightsCache::weights_id(uid, "", weights, CPUInfo::get());
+}
+
+std::shared_ptr<const IWeightsManager::SharedWeights>
+IWeightsManager::share(const std::string &transform_id, std::shared_ptr<SharedWeights> weights)
+{
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_shared_weights->mtx);
+
+    auto &registered = _shared_weights->weights[transform_id];
+    if (auto shared = registered.lock())
+    {
+        return shared;
+    }
+
+    // Forget the transformations whose functions have all been destroyed
+    for (auto it = _shared_weights->weights.begin(); it != _shared_weights->weights.end();)
+    {
+        it = (it->second.expired() && it->first != transform_id) ? _shared_weights->weights.erase(it) : std::next(it);
+    }
+    registered = weights;
+    return weights;
+}
+
+void IWeightsManager::share_transformed_weights_with(const IWeightsManager &other)
+{
+    _shared_weights = other._shared_weights;
+}
 } // namespace arm_compute
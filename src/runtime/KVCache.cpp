@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KVCache.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape cache_shape(const ITensorInfo &info, size_t num_tokens)
+{
+    // Built from the constructor, which keeps the other dimensions when the number of tokens is 0
+    return TensorShape(info.dimension(0), num_tokens, info.dimension(2), info.dimension(3));
+}
+
+void copy_tokens(const ITensor *src, Tensor &dst, size_t first_token)
+{
+    const ITensorInfo *src_info  = src->info();
+    const size_t       row_bytes = src_info->dimension(0) * src_info->element_size();
+
+    for (size_t b = 0; b < src_info->dimension(3); ++b)
+    {
+        for (size_t h = 0; h < src_info->dimension(2); ++h)
+        {
+            for (size_t t = 0; t < src_info->dimension(1); ++t)
+            {
+                const Coordinates src_id(0, t, h, b);
+                const Coordinates dst_id(0, first_token + t, h, b);
+                std::memcpy(dst.ptr_to_element(dst_id), src->ptr_to_element(src_id), row_bytes);
+            }
+        }
+    }
+}
+} // namespace
+
+KVCache::KVCache()
+    : _key_info(), _value_info(), _key_storage(), _value_storage(), _key(), _value(), _length(0), _capacity(0)
+{
+}
+
+void KVCache::init(const ITensorInfo &key_info, const ITensorInfo &value_info, size_t capacity)
+{
+    ARM_COMPUTE_ERROR_ON(key_info.num_dimensions() > 4 || value_info.num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(key_info.data_type() != value_info.data_type());
+    ARM_COMPUTE_ERROR_ON_MSG(key_info.dimension(2) != value_info.dimension(2) ||
+                                 key_info.dimension(3) != value_info.dimension(3),
+                             "The keys and values must have the same heads and batches");
+
+    _key_info   = TensorInfo(cache_shape(key_info, 1), 1, key_info.data_type(), key_info.quantization_info());
+    _value_info = TensorInfo(cache_shape(value_info, 1), 1, value_info.data_type(), value_info.quantization_info());
+    _length     = 0;
+    _capacity   = 0;
+
+    reserve(std::max<size_t>(capacity, 1));
+}
+
+void KVCache::append(const ITensor *key, const ITensor *value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(key, value);
+    ARM_COMPUTE_ERROR_ON_MSG(_capacity == 0, "The cache is not initialized");
+    ARM_COMPUTE_ERROR_ON(key->info()->data_type() != _key_info.data_type() ||
+                         value->info()->data_type() != _value_info.data_type());
+    ARM_COMPUTE_ERROR_ON(cache_shape(*key->info(), 1) != _key_info.tensor_shape() ||
+                         cache_shape(*value->info(), 1) != _value_info.tensor_shape());
+    ARM_COMPUTE_ERROR_ON_MSG(key->info()->dimension(1) != value->info()->dimension(1),
+                             "There must be as many keys as values");
+
+    const size_t num_tokens = key->info()->dimension(1);
+    if (_length + num_tokens > _capacity)
+    {
+        // Doubling keeps the cost of the copies amortized over the appends
+        reserve(std::max(_length + num_tokens, 2 * _capacity));
+    }
+
+    copy_tokens(key, _key_storage, _length);
+    copy_tokens(value, _value_storage, _length);
+    _length += num_tokens;
+
+    update_views();
+}
+
+void KVCache::reserve(size_t capacity)
+{
+    if (capacity <= _capacity)
+    {
+        return;
+    }
+
+    const auto grow = [this, capacity](Tensor &storage, const TensorInfo &info)
+    {
+        Tensor new_storage;
+        new_storage.allocator()->init(
+            TensorInfo(cache_shape(info, capacity), 1, info.data_type(), info.quantization_info()));
+        new_storage.allocator()->allocate();
+
+        // The storage is dense, so the tokens of a head are contiguous
+        if (_length > 0)
+        {
+            const size_t num_planes  = info.dimension(2) * info.dimension(3);
+            const size_t old_stride  = storage.info()->strides_in_bytes()[2];
+            const size_t new_stride  = new_storage.info()->strides_in_bytes()[2];
+            const size_t valid_bytes = _length * storage.info()->strides_in_bytes()[1];
+            for (size_t p = 0; p < num_planes; ++p)
+            {
+                std::memcpy(new_storage.buffer() + p * new_stride, storage.buffer() + p * old_stride, valid_bytes);
+            }
+        }
+
+        storage = std::move(new_storage);
+    };
+
+    grow(_key_storage, _key_info);
+    grow(_value_storage, _value_info);
+    _capacity = capacity;
+
+    update_views();
+}
+
+void KVCache::clear()
+{
+    _length = 0;
+    update_views();
+}
+
+size_t KVCache::length() const
+{
+    return _length;
+}
+
+size_t KVCache::capacity() const
+{
+    return _capacity;
+}
+
+ITensor *KVCache::key()
+{
+    return &_key;
+}
+
+ITensor *KVCache::value()
+{
+    return &_value;
+}
+
+void KVCache::update_views()
+{
+    const auto update = [this](Tensor &view, Tensor &storage)
+    {
+        const ITensorInfo *storage_info = storage.info();
+
+        // The view keeps the strides of the storage, only its number of tokens differs
+        TensorInfo info;
+        info.init(cache_shape(*storage_info, _length), 1, storage_info->data_type(),
+                  storage_info->strides_in_bytes(), storage_info->offset_first_element_in_bytes(),
+                  storage_info->total_size());
+        info.set_quantization_info(storage_info->quantization_info());
+
+        ITensorInfo::TensorDimsState dims_state = info.tensor_dims_state();
+        dims_state[1]                           = ITensorInfo::get_dynamic_state_value();
+        info.set_tensor_dims_state(dims_state);
+
+        view.allocator()->init(info);
+        view.allocator()->import_memory(storage.buffer());
+    };
+
+    update(_key, _key_storage);
+    update(_value, _value_storage);
+}
+} // namespace arm_compute
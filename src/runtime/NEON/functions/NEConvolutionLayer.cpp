@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,6 +82,9 @@ void NEConvolutionLayer::configure(ITensor                   *input,
                            enable_fast_math, num_groups);
 
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
+    cpu::CpuConv2d::tune_convolution_method(input->info(), weights->info(),
+                                            ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
+                                            weights_info, dilation, act_info, enable_fast_math);
     switch (cpu::CpuConv2d::get_convolution_method(input->info(), weights->info(), output->info(), conv_info,
                                                    weights_info, dilation, act_info, enable_fast_math))
     {
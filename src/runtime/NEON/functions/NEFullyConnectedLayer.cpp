@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,8 @@
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuFullyConnected.h"
 
+#include <sstream>
+
 namespace arm_compute
 {
 using namespace arm_compute::experimental;
@@ -44,11 +46,15 @@ struct NEFullyConnectedLayer::Impl
     std::unique_ptr<cpu::CpuFullyConnected> op{nullptr};
 
     const ITensor *original_weights{nullptr};
+    const ITensor *original_biases{nullptr};
 
     ITensorPack                      run_pack{};
     WorkspaceData<Tensor>            workspace{};
     experimental::MemoryRequirements aux_mem_req{};
 
+    std::string                                           weights_transform_uid{};
+    std::shared_ptr<const IWeightsManager::SharedWeights> shared_weights{nullptr};
+
     bool is_prepared{false};
     bool dynamic_weights{false};
 };
@@ -79,6 +85,7 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
 
     _impl->op               = std::make_unique<cpu::CpuFullyConnected>();
     _impl->original_weights = weights;
+    _impl->original_biases  = biases;
     _impl->is_prepared      = false;
 
     _impl->op->configure(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(),
@@ -96,6 +103,19 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
 
     _impl->dynamic_weights = !weights->info()->are_values_constant() && fc_info.transpose_weights &&
                              !fc_info.are_weights_reshaped && !fc_info.retain_internal_weights;
+
+    if (_impl->weights_manager != nullptr)
+    {
+        std::stringstream config;
+        config << fc_info.transpose_weights << ";" << fc_info.are_weights_reshaped << ";"
+               << fc_info.retain_internal_weights << ";" << fc_info.enable_fast_math << ";"
+               << static_cast<int>(fc_info.weights_trained_layout) << ";"
+               << static_cast<int>(weights_info.weight_format());
+        _impl->weights_transform_uid = weights_transform_uid(
+            "NEFullyConnectedLayer",
+            {input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info()},
+            _impl->aux_mem_req, config.str());
+    }
 }
 
 Status NEFullyConnectedLayer::has_opt_impl(arm_compute::WeightFormat     &expected_weight_format,
@@ -143,6 +163,17 @@ void NEFullyConnectedLayer::prepare()
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
         _impl->is_prepared = true;
 
+        // Reuse the reshaped weights of an identical function if there is one
+        const bool are_biases_constant =
+            _impl->original_biases == nullptr || _impl->original_biases->info()->are_values_constant();
+        if (_impl->weights_manager != nullptr && !_impl->dynamic_weights && are_biases_constant)
+        {
+            const std::vector<const ITensor *> weights{_impl->original_weights, _impl->original_biases};
+            _impl->shared_weights = share_persistent_tensors<Tensor>(
+                *_impl->weights_manager, IWeightsManager::transform_id(_impl->weights_transform_uid, weights),
+                _impl->workspace, _impl->run_pack, _impl->run_pack);
+        }
+
         // Handle weights managed infrastructure
         if (_impl->weights_manager != nullptr && _impl->weights_manager->are_weights_managed(_impl->original_weights))
         {
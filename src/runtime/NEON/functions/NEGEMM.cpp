@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,8 @@
 #include "src/cpu/operators/CpuDynamicGemm.h"
 #include "src/cpu/operators/CpuGemm.h"
 
+#include <sstream>
+
 using namespace arm_compute::experimental;
 
 namespace arm_compute
@@ -91,13 +93,18 @@ struct NEGEMM::Impl
     std::unique_ptr<cpu::ICpuOperator> op{nullptr};
 
     const ITensor *original_b{nullptr};
+    const ITensor *original_c{nullptr};
     bool           is_prepared{false};
     bool           is_dynamic{false};
+    bool           reshape_b_only_on_first_run{false};
 
     ITensorPack                      run_pack{};
     ITensorPack                      prep_pack{};
     WorkspaceData<Tensor>            workspace{};
     experimental::MemoryRequirements aux_mem_req{};
+
+    std::string                                           weights_transform_uid{};
+    std::shared_ptr<const IWeightsManager::SharedWeights> shared_weights{nullptr};
 };
 
 NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
@@ -133,9 +140,11 @@ void NEGEMM::configure(const ITensor  *a,
     }
 
     // Check if we need to reshape the matrix B only on the first run
-    _impl->is_prepared = false;
-    _impl->original_b  = b;
-    _impl->op          = std::make_unique<cpu::CpuGemm>();
+    _impl->is_prepared                 = false;
+    _impl->original_b                  = b;
+    _impl->original_c                  = c;
+    _impl->reshape_b_only_on_first_run = gemm_info.reshape_b_only_on_first_run();
+    _impl->op                          = std::make_unique<cpu::CpuGemm>();
 
     _impl->op = make_and_config_op(a->info(), b->info(), (c != nullptr) ? c->info() : nullptr, d->info(), alpha, beta,
                                    gemm_info);
@@ -154,6 +163,16 @@ void NEGEMM::configure(const ITensor  *a,
     }
     _impl->workspace = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
                                                 _impl->prep_pack, /* allocate_now */ false);
+
+    if (_impl->weights_manager != nullptr && !_impl->is_dynamic)
+    {
+        std::stringstream config;
+        config << alpha << ";" << beta << ";" << gemm_info.fast_math() << ";" << gemm_info.fixed_format() << ";"
+               << static_cast<int>(gemm_info.weight_format()) << ";" << gemm_info.accumulate();
+        _impl->weights_transform_uid =
+            weights_transform_uid("NEGEMM", {a->info(), b->info(), (c != nullptr) ? c->info() : nullptr, d->info()},
+                                  _impl->aux_mem_req, config.str());
+    }
 }
 
 Status NEGEMM::validate(const ITensorInfo *a,
@@ -231,6 +250,18 @@ void NEGEMM::prepare()
 
         // Release temporary tensors that are only used in prepare stage
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+        // Reuse the reshaped B of an identical function if there is one
+        const bool is_c_constant =
+            _impl->original_c == nullptr || _impl->original_c->info()->are_values_constant();
+        if (_impl->weights_manager != nullptr && _impl->reshape_b_only_on_first_run && is_c_constant &&
+            _impl->original_b->info()->are_values_constant())
+        {
+            const std::vector<const ITensor *> weights{_impl->original_b, _impl->original_c};
+            _impl->shared_weights = share_persistent_tensors<Tensor>(
+                *_impl->weights_manager, IWeightsManager::transform_id(_impl->weights_transform_uid, weights),
+                _impl->workspace, _impl->run_pack, _impl->prep_pack);
+        }
         _impl->is_prepared = true;
     }
 }
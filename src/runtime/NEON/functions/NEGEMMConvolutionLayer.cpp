@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,8 @@
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 
+#include <sstream>
+
 using namespace arm_compute::experimental;
 
 namespace arm_compute
@@ -38,6 +40,7 @@ namespace arm_compute
 struct NEGEMMConvolutionLayer::Impl
 {
     const ITensor                      *weights{nullptr};
+    const ITensor                      *biases{nullptr};
     std::unique_ptr<cpu::CpuGemmConv2d> op{nullptr};
     ITensorPack                         run_pack{};
     MemoryGroup                         memory_group{};
@@ -45,6 +48,9 @@ struct NEGEMMConvolutionLayer::Impl
     MemoryRequirements                  aux_mem_req{};
     WorkspaceData<Tensor>               workspace_tensors{};
     bool                                is_prepared{false};
+
+    std::string                                           weights_transform_uid{};
+    std::shared_ptr<const IWeightsManager::SharedWeights> shared_weights{nullptr};
 };
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager,
@@ -65,15 +71,17 @@ void NEGEMMConvolutionLayer::configure(const ITensor             *input,
                                        const Size2D              &dilation,
                                        const ActivationLayerInfo &act_info,
                                        bool                       enable_fast_math,
-                                       unsigned int               num_groups)
+                                       unsigned int               num_groups,
+                                       bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
     _impl->is_prepared = false;
     _impl->weights     = weights;
+    _impl->biases      = biases;
     _impl->op          = std::make_unique<cpu::CpuGemmConv2d>();
     _impl->op->configure(input->info(), weights->info(), (biases != nullptr ? biases->info() : nullptr), output->info(),
-                         conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups);
+                         conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups, accumulate);
 
     _impl->run_pack          = {{TensorType::ACL_SRC_0, input},
                                 {TensorType::ACL_SRC_1, weights},
@@ -82,6 +90,20 @@ void NEGEMMConvolutionLayer::configure(const ITensor             *input,
     _impl->aux_mem_req       = _impl->op->workspace();
     _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
                                                         _impl->run_pack, /* allocate_now */ false);
+
+    if (_impl->weights_manager != nullptr)
+    {
+        std::stringstream config;
+        config << conv_info.stride().first << "x" << conv_info.stride().second << ";" << conv_info.pad_left() << ","
+               << conv_info.pad_right() << "," << conv_info.pad_top() << "," << conv_info.pad_bottom() << ";"
+               << dilation.x() << "x" << dilation.y() << ";" << static_cast<int>(act_info.activation()) << ","
+               << act_info.a() << "," << act_info.b() << ";" << enable_fast_math << ";" << num_groups << ";"
+               << static_cast<int>(weights_info.weight_format());
+        _impl->weights_transform_uid = weights_transform_uid(
+            "NEGEMMConvolutionLayer",
+            {input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info()},
+            _impl->aux_mem_req, config.str());
+    }
 }
 
 Status NEGEMMConvolutionLayer::validate(const ITensorInfo         *input,
@@ -93,11 +115,12 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo         *input,
                                         const Size2D              &dilation,
                                         const ActivationLayerInfo &act_info,
                                         bool                       enable_fast_math,
-                                        unsigned int               num_groups)
+                                        unsigned int               num_groups,
+                                        bool                       accumulate)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
     return cpu::CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
-                                        enable_fast_math, num_groups);
+                                        enable_fast_math, num_groups, accumulate);
 }
 
 Status NEGEMMConvolutionLayer::has_opt_impl(arm_compute::WeightFormat &expected_weight_format,
@@ -136,6 +159,16 @@ void NEGEMMConvolutionLayer::prepare()
 
         // Release temporary tensors that are only used in prepare stage
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
+
+        // Reuse the reshaped weights of an identical function if there is one
+        const bool are_biases_constant = _impl->biases == nullptr || _impl->biases->info()->are_values_constant();
+        if (_impl->weights_manager != nullptr && _impl->weights->info()->are_values_constant() && are_biases_constant)
+        {
+            const std::vector<const ITensor *> weights{_impl->weights, _impl->biases};
+            _impl->shared_weights = share_persistent_tensors<Tensor>(
+                *_impl->weights_manager, IWeightsManager::transform_id(_impl->weights_transform_uid, weights),
+                _impl->workspace_tensors, _impl->run_pack, _impl->run_pack);
+        }
         _impl->is_prepared = true;
     }
 }
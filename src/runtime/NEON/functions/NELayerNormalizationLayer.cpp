@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELayerNormalizationLayer.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuLayerNormalization.h"
+
+namespace arm_compute
+{
+struct NELayerNormalizationLayer::Impl
+{
+    std::unique_ptr<cpu::CpuLayerNormalization> op{nullptr};
+    ITensorPack                                 run_pack{};
+};
+
+NELayerNormalizationLayer::NELayerNormalizationLayer() : _impl(std::make_unique<Impl>())
+{
+}
+
+NELayerNormalizationLayer::~NELayerNormalizationLayer() = default;
+
+void NELayerNormalizationLayer::configure(const ITensor                *input,
+                                          const ITensor                *residual,
+                                          const ITensor                *gamma,
+                                          const ITensor                *beta,
+                                          ITensor                      *add_output,
+                                          ITensor                      *output,
+                                          const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_LOG_PARAMS(input, residual, gamma, beta, add_output, output);
+
+    _impl->op = std::make_unique<cpu::CpuLayerNormalization>();
+    _impl->op->configure(input->info(), residual != nullptr ? residual->info() : nullptr,
+                         gamma != nullptr ? gamma->info() : nullptr, beta != nullptr ? beta->info() : nullptr,
+                         add_output != nullptr ? add_output->info() : nullptr, output->info(), info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, input},      {TensorType::ACL_SRC_1, residual},
+                       {TensorType::ACL_SRC_2, gamma},      {TensorType::ACL_SRC_3, beta},
+                       {TensorType::ACL_DST_0, add_output}, {TensorType::ACL_DST_1, output}};
+}
+
+Status NELayerNormalizationLayer::validate(const ITensorInfo            *input,
+                                           const ITensorInfo            *residual,
+                                           const ITensorInfo            *gamma,
+                                           const ITensorInfo            *beta,
+                                           const ITensorInfo            *add_output,
+                                           const ITensorInfo            *output,
+                                           const LayerNormalizationInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, residual, gamma, beta, add_output, output);
+    return cpu::CpuLayerNormalization::validate(input, residual, gamma, beta, add_output, output, info);
+}
+
+void NELayerNormalizationLayer::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -42,8 +43,40 @@ size_t align_offset(size_t offset, size_t alignment)
     const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
     return (remainder != 0U) ? offset + (alignment - remainder) : offset;
 }
+
+/** Object placed in the blob during the planning */
+struct Allocation
+{
+    void  *id;     /**< Object id */
+    size_t start;  /**< Event starting the lifetime of the object */
+    size_t end;    /**< Event ending the lifetime of the object */
+    size_t size;   /**< Size of the object */
+    size_t offset; /**< Offset of the object in the blob */
+};
+
+/** Returns the largest amount of memory used at the same time by a list of objects */
+size_t peak_usage(const std::vector<Allocation> &allocations)
+{
+    std::vector<std::pair<size_t, long long>> events;
+    events.reserve(2 * allocations.size());
+    for (auto &allocation : allocations)
+    {
+        events.emplace_back(allocation.start, static_cast<long long>(allocation.size));
+        events.emplace_back(allocation.end, -static_cast<long long>(allocation.size));
+    }
+    std::sort(std::begin(events), std::end(events));
+
+    long long usage = 0;
+    long long peak  = 0;
+    for (auto &event : events)
+    {
+        usage += event.second;
+        peak = std::max(peak, usage);
+    }
+    return static_cast<size_t>(peak);
+}
 } // namespace
-OffsetLifetimeManager::OffsetLifetimeManager() : _blob(0)
+OffsetLifetimeManager::OffsetLifetimeManager() : _blob(0), _peak_size(0), _clock(0), _lifetimes()
 {
 }
 
@@ -52,6 +85,25 @@ const OffsetLifetimeManager::info_type &OffsetLifetimeManager::info() const
     return _blob;
 }
 
+size_t OffsetLifetimeManager::peak_size() const
+{
+    return _peak_size;
+}
+
+void OffsetLifetimeManager::start_lifetime(void *obj)
+{
+    ISimpleLifetimeManager::start_lifetime(obj);
+    _lifetimes[obj] = std::make_pair(_clock, _clock);
+    ++_clock;
+}
+
+void OffsetLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    // Record the event first as ending the last lifetime of the group updates the mappings
+    _lifetimes[obj].second = _clock++;
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
 std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allocator)
 {
     ARM_COMPUTE_ERROR_ON(allocator == nullptr);
@@ -68,7 +120,7 @@ void OffsetLifetimeManager::update_blobs_and_mappings()
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
-    // Update blob size
+    // Size of the plan reusing whole blobs
     size_t max_aggregated_size = 0;
     std::for_each(std::begin(_free_blobs), std::end(_free_blobs),
                   [&](const Blob &b)
@@ -78,22 +130,81 @@ void OffsetLifetimeManager::update_blobs_and_mappings()
                   });
     max_aggregated_size += _free_blobs.size() * _blob.alignment;
     _blob.owners = std::max(_blob.owners, _free_blobs.size());
-    _blob.size   = std::max(_blob.size, max_aggregated_size);
+
+    // Plan the offsets over the lifetimes of the objects, from the largest to the smallest one
+    std::vector<Allocation> allocations;
+    allocations.reserve(_active_elements.size());
+    for (auto &active_element : _active_elements)
+    {
+        ARM_COMPUTE_ERROR_ON(_lifetimes.find(active_element.first) == std::end(_lifetimes));
+        const std::pair<size_t, size_t> &lifetime = _lifetimes[active_element.first];
+        allocations.push_back(
+            Allocation{active_element.first, lifetime.first, lifetime.second, active_element.second.size, 0});
+    }
+    std::sort(std::begin(allocations), std::end(allocations),
+              [](const Allocation &a, const Allocation &b)
+              { return (a.size != b.size) ? a.size > b.size : a.start < b.start; });
+
+    size_t                    planned_size = 0;
+    std::vector<Allocation *> placed; // Sorted by offset
+    for (auto &allocation : allocations)
+    {
+        // Pick the tightest gap between the objects alive at the same time, or the end of the last one
+        size_t offset      = 0;
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        for (const Allocation *other : placed)
+        {
+            if (other->start > allocation.end || allocation.start > other->end)
+            {
+                continue;
+            }
+            if (other->offset >= offset + allocation.size && other->offset - offset < best_gap)
+            {
+                best_gap    = other->offset - offset;
+                best_offset = offset;
+            }
+            offset = std::max(offset, align_offset(other->offset + other->size, _blob.alignment));
+        }
+        allocation.offset = (best_offset != std::numeric_limits<size_t>::max()) ? best_offset : offset;
+        planned_size      = std::max(planned_size, allocation.offset + allocation.size);
+
+        placed.insert(std::upper_bound(std::begin(placed), std::end(placed), &allocation,
+                                       [](const Allocation *a, const Allocation *b) { return a->offset < b->offset; }),
+                      &allocation);
+    }
+    _peak_size = std::max(_peak_size, peak_usage(allocations));
 
     // Calculate group mappings
-    auto  &group_mappings = _active_group->mappings();
-    size_t offset         = 0;
-    for (auto &free_blob : _free_blobs)
+    auto &group_mappings = _active_group->mappings();
+    if (planned_size <= max_aggregated_size)
+    {
+        _blob.size = std::max(_blob.size, planned_size);
+        for (auto &allocation : allocations)
+        {
+            group_mappings[_active_elements[allocation.id].handle] = allocation.offset;
+        }
+    }
+    else
     {
-        for (auto &bound_element_id : free_blob.bound_elements)
+        _blob.size    = std::max(_blob.size, max_aggregated_size);
+        size_t offset = 0;
+        for (auto &free_blob : _free_blobs)
         {
-            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
-            Element &bound_element               = _active_elements[bound_element_id];
-            group_mappings[bound_element.handle] = offset;
+            for (auto &bound_element_id : free_blob.bound_elements)
+            {
+                ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+                Element &bound_element               = _active_elements[bound_element_id];
+                group_mappings[bound_element.handle] = offset;
+            }
+            offset += free_blob.max_size;
+            offset = align_offset(offset, _blob.alignment);
+            ARM_COMPUTE_ERROR_ON(offset > _blob.size);
         }
-        offset += free_blob.max_size;
-        offset = align_offset(offset, _blob.alignment);
-        ARM_COMPUTE_ERROR_ON(offset > _blob.size);
     }
+
+    // Reset the lifetimes for the next group
+    _lifetimes.clear();
+    _clock = 0;
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -53,6 +54,8 @@ std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 std::shared_ptr<IScheduler> thread_local Scheduler::_custom_scheduler = nullptr;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
 
+thread_local IScheduler *Scheduler::_thread_scheduler = nullptr;
+
 namespace
 {
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
@@ -61,6 +64,8 @@ std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
     m[Scheduler::Type::ST] = std::make_unique<SingleThreadScheduler>();
 #if defined(ARM_COMPUTE_CPP_SCHEDULER)
     m[Scheduler::Type::CPP] = std::make_unique<CPPScheduler>();
+    // The work-stealing scheduler spins its own thread pool, so it is only constructed when it is selected
+    m[Scheduler::Type::CPP_WORK_STEALING] = nullptr;
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER)
 #if defined(ARM_COMPUTE_OPENMP_SCHEDULER)
     m[Scheduler::Type::OMP] = std::make_unique<OMPScheduler>();
@@ -68,6 +73,19 @@ std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 
     return m;
 }
+
+std::unique_ptr<IScheduler> create_deferred(Scheduler::Type t)
+{
+    switch (t)
+    {
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+        case Scheduler::Type::CPP_WORK_STEALING:
+            return std::make_unique<CPPWorkStealingScheduler>();
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER)
+        default:
+            ARM_COMPUTE_ERROR("Invalid Scheduler type");
+    }
+}
 } // namespace
 
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> Scheduler::_schedulers{};
@@ -97,6 +115,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if (_thread_scheduler != nullptr)
+    {
+        return *_thread_scheduler;
+    }
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -119,6 +142,10 @@ IScheduler &Scheduler::get()
         auto it = _schedulers.find(_scheduler_type);
         if (it != _schedulers.end())
         {
+            if (it->second == nullptr)
+            {
+                it->second = create_deferred(_scheduler_type);
+            }
             return *it->second;
         }
         else
@@ -133,3 +160,8 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    _thread_scheduler = scheduler;
+}
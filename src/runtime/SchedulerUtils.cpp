@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,9 @@
 #include "arm_compute/core/Error.h"
 
 #include <cmath>
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+#include <sched.h>
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
 
 namespace arm_compute
 {
@@ -77,6 +80,21 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return {1, std::min<unsigned>(n, max_threads)};
     }
 }
+
+void set_thread_affinity(int core_id)
+{
+    if (core_id < 0)
+    {
+        return;
+    }
+
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core_id, &set);
+    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
+#endif /* !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+}
 #endif /* #ifndef BARE_METAL */
 } // namespace scheduler_utils
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,12 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Set thread affinity. Pin current thread to a particular core
+ *
+ * @param[in] core_id ID of the core to which the current thread is pinned. If negative no pinning takes place.
+ */
+void set_thread_affinity(int core_id);
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,10 +41,12 @@ static const std::string information =
 
 const std::string &string_from_scheduler_type(Scheduler::Type t)
 {
-    static std::map<Scheduler::Type, const std::string> scheduler_type_map = {{Scheduler::Type::ST, "Single Thread"},
-                                                                              {Scheduler::Type::CPP, "C++11 Threads"},
-                                                                              {Scheduler::Type::OMP, "OpenMP Threads"},
-                                                                              {Scheduler::Type::CUSTOM, "Custom"}};
+    static std::map<Scheduler::Type, const std::string> scheduler_type_map = {
+        {Scheduler::Type::ST, "Single Thread"},
+        {Scheduler::Type::CPP, "C++11 Threads"},
+        {Scheduler::Type::OMP, "OpenMP Threads"},
+        {Scheduler::Type::CUSTOM, "Custom"},
+        {Scheduler::Type::CPP_WORK_STEALING, "C++11 Work Stealing Threads"}};
 
     return scheduler_type_map[t];
 }
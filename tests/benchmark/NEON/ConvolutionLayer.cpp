@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/ConvolutionLayerFixture.h"
+#include "tests/datasets/DirectConvolutionLayerDataset.h"
+#include "tests/datasets/LargeConvolutionLayerDataset.h"
+#include "tests/datasets/SmallConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/alexnet/AlexNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/googlenet/inceptionv1/GoogLeNetInceptionV1ConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/googlenet/inceptionv4/GoogLeNetInceptionV4ConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/mobilenet/MobileNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/squeezenet/SqueezeNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/vgg/vgg16/VGG16ConvolutionLayerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)
+});
+
+const auto data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+    DataType::QASYMM8,
+    DataType::QASYMM8_SIGNED
+});
+
+const auto float_data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+});
+
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+using NEGEMMConvolutionLayerFixture     = ConvolutionLayerFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+using NEConvolutionLayerFixture         = ConvolutionLayerFixture<Tensor, NEConvolutionLayer, Accessor>;
+using NEWinogradConvolutionLayerFixture = WinogradConvolutionLayerFixture<Tensor, NEWinogradConvolutionLayer, Accessor>;
+using NEDirectConvolutionLayerFixture   = DirectConvolutionLayerFixture<Tensor, NEDirectConvolutionLayer, Accessor>;
+using NEGEMMConv2dFixture               = GEMMConv2dFixture<Tensor, NEGEMMConv2d, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionLayer)
+
+TEST_SUITE(GEMM)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallConvolutionLayerDataset(), ActivationFunctionsDataset, data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeConvolutionLayerDataset(), ActivationFunctionsDataset, data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::AlexNetConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types, data_layouts,
+                                        framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16ConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::VGG16ConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types, data_layouts,
+                                        framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1ConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV4ConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::GoogLeNetInceptionV4ConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::MobileNetConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)), data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::SqueezeNetConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+
+TEST_SUITE(NIGHTLY)
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::AlexNetConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types, data_layouts,
+                                        framework::dataset::make("Batches", { 4, 8 })));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16ConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::VGG16ConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types, data_layouts,
+                                        framework::dataset::make("Batches", { 4, 8 })));
+TEST_SUITE_END() // NIGHTLY
+TEST_SUITE_END() // GEMM
+
+TEST_SUITE(Auto)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeConvolutionLayerDataset(), ActivationFunctionsDataset, data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1ConvolutionLayer, NEConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+TEST_SUITE_END() // Auto
+
+TEST_SUITE(Winograd)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(), ActivationFunctionsDataset, float_data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(), ActivationFunctionsDataset, float_data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetWinogradLayer, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::AlexNetWinogradLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types, data_layouts,
+                                        framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1WinogradLayer, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::GoogLeNetInceptionV1WinogradLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV4WinogradLayer, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::GoogLeNetInceptionV4WinogradLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetWinogradLayer, NEWinogradConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::SqueezeNetWinogradLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+TEST_SUITE_END() // Winograd
+
+TEST_SUITE(Direct)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::DirectConvolutionLayerDataset(), ActivationFunctionsDataset, float_data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetDirectConvolutionLayer, NEDirectConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::AlexNetDirectConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16DirectConvolutionLayer, NEDirectConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::VGG16DirectConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)), float_data_types,
+                                        data_layouts, framework::dataset::make("Batches", 1)));
+TEST_SUITE_END() // Direct
+
+// The indirect/direct GEMM convolution only supports NHWC
+TEST_SUITE(GEMMConv2d)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConv2dFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallConvolutionLayerDataset(), ActivationFunctionsDataset, data_types, framework::dataset::make("DataLayout", DataLayout::NHWC), framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMConv2dFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeConvolutionLayerDataset(), ActivationFunctionsDataset, data_types, framework::dataset::make("DataLayout", DataLayout::NHWC), framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetConvolutionLayer, NEGEMMConv2dFixture, framework::DatasetMode::ALL,
+                                combine(datasets::MobileNetConvolutionLayerDataset(), framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)), data_types,
+                                        framework::dataset::make("DataLayout", DataLayout::NHWC), framework::dataset::make("Batches", 1)));
+TEST_SUITE_END() // GEMMConv2d
+
+TEST_SUITE_END() // ConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/DepthwiseConvolutionLayerFixture.h"
+#include "tests/datasets/DepthwiseConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/mobilenet/MobileNetDepthwiseConvolutionLayerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+    DataType::QASYMM8,
+    DataType::QASYMM8_SIGNED
+});
+
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+using NEDepthwiseConvolutionLayerFixture = DepthwiseConvolutionLayerFixture<Tensor, NEDepthwiseConvolutionLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseConvolutionLayer)
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallDepthwiseConvolutionLayerDataset(), data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall3x3, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallOptimizedDepthwiseConvolutionLayerDataset3x3(), data_types, framework::dataset::make("DataLayout", DataLayout::NHWC), framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeDepthwiseConvolutionLayerDataset(), data_types, data_layouts, framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge3x3, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeOptimizedDepthwiseConvolutionLayerDataset3x3(), data_types, framework::dataset::make("DataLayout", DataLayout::NHWC), framework::dataset::make("Batches", 1)));
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetDepthwiseConvolutionLayer, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::ALL,
+                                combine(datasets::MobileNetDepthwiseConvolutionLayerDataset(), data_types, data_layouts, framework::dataset::make("Batches", 1)));
+
+TEST_SUITE(NIGHTLY)
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetDepthwiseConvolutionLayer, NEDepthwiseConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::MobileNetDepthwiseConvolutionLayerDataset(), data_types, data_layouts, framework::dataset::make("Batches", { 4, 8 })));
+TEST_SUITE_END() // NIGHTLY
+
+TEST_SUITE_END() // DepthwiseConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
+#include "arm_compute/runtime/NEON/functions/NEElementwiseOperations.h"
+#include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/ElementwiseOperationsFixture.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+    DataType::QASYMM8,
+    DataType::QASYMM8_SIGNED
+});
+
+const auto float_data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+});
+
+const auto small_shapes = zip(datasets::SmallShapes(), datasets::SmallShapes());
+const auto large_shapes = zip(datasets::LargeShapes(), datasets::LargeShapes());
+} // namespace
+
+using NEArithmeticAdditionFixture      = ArithmeticOperationsFixture<Tensor, NEArithmeticAddition, Accessor>;
+using NEArithmeticSubtractionFixture   = ArithmeticOperationsFixture<Tensor, NEArithmeticSubtraction, Accessor>;
+using NEPixelWiseMultiplicationFixture = PixelWiseMultiplicationFixture<Tensor, NEPixelWiseMultiplication, Accessor>;
+using NEElementwiseMaxFixture          = ElementwiseOperationsFixture<Tensor, NEElementwiseMax, Accessor>;
+using NEElementwiseMinFixture          = ElementwiseOperationsFixture<Tensor, NEElementwiseMin, Accessor>;
+using NEElementwiseDivisionFixture     = ElementwiseOperationsFixture<Tensor, NEElementwiseDivision, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Elementwise)
+
+TEST_SUITE(ArithmeticAddition)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEArithmeticAdditionFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmallBroadcast, NEArithmeticAdditionFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallShapesBroadcast(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEArithmeticAdditionFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLargeBroadcast, NEArithmeticAdditionFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LargeShapesBroadcast(), data_types));
+TEST_SUITE_END() // ArithmeticAddition
+
+TEST_SUITE(ArithmeticSubtraction)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEArithmeticSubtractionFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEArithmeticSubtractionFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, data_types));
+TEST_SUITE_END() // ArithmeticSubtraction
+
+TEST_SUITE(PixelWiseMultiplication)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEPixelWiseMultiplicationFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmallBroadcast, NEPixelWiseMultiplicationFixture, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallShapesBroadcast(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEPixelWiseMultiplicationFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLargeBroadcast, NEPixelWiseMultiplicationFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LargeShapesBroadcast(), data_types));
+TEST_SUITE_END() // PixelWiseMultiplication
+
+TEST_SUITE(ElementwiseMax)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseMaxFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEElementwiseMaxFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, data_types));
+TEST_SUITE_END() // ElementwiseMax
+
+TEST_SUITE(ElementwiseMin)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseMinFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEElementwiseMinFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, data_types));
+TEST_SUITE_END() // ElementwiseMin
+
+TEST_SUITE(ElementwiseDivision)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseDivisionFixture, framework::DatasetMode::PRECOMMIT, combine(small_shapes, float_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEElementwiseDivisionFixture, framework::DatasetMode::NIGHTLY, combine(large_shapes, float_data_types));
+TEST_SUITE_END() // ElementwiseDivision
+
+TEST_SUITE_END() // Elementwise
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEMatMul.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/MatMulFixture.h"
+#include "tests/datasets/LargeMatMulDataset.h"
+#include "tests/datasets/SmallMatMulDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto float_data_types = framework::dataset::make("DataType",
+{
+    DataType::F32,
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    DataType::F16,
+#endif // ARM_COMPUTE_ENABLE_FP16
+});
+
+const auto quantized_data_types = framework::dataset::make("DataType", { DataType::QASYMM8, DataType::QASYMM8_SIGNED });
+
+const auto transpose_a = framework::dataset::make("TransposeA", { false, true });
+const auto transpose_b = framework::dataset::make("TransposeB", { false, true });
+} // namespace
+
+using NEMatMulFixture = MatMulFixture<Tensor, NEMatMul, Accessor, CpuMatMulSettings>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(MatMul)
+
+TEST_SUITE(Float)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEMatMulFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallMatMulDataset(), transpose_a, transpose_b, float_data_types, framework::dataset::make("FastMath", false)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEMatMulFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeMatMulDataset(), transpose_a, transpose_b, float_data_types, framework::dataset::make("FastMath", false)));
+#ifdef ARM_COMPUTE_ENABLE_BF16
+// F32 inputs computed with BF16 kernels
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLargeFastMath, NEMatMulFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeMatMulDataset(), transpose_a, transpose_b, framework::dataset::make("DataType", DataType::F32), framework::dataset::make("FastMath", true)));
+#endif // ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEMatMulFixture, framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallMatMulDataset(), transpose_a, transpose_b, quantized_data_types, framework::dataset::make("FastMath", false)));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEMatMulFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeMatMulDataset(), transpose_a, transpose_b, quantized_data_types, framework::dataset::make("FastMath", false)));
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // MatMul
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
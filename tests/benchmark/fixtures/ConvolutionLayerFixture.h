@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Common setup for the convolution benchmark fixtures.
+ *
+ * Shapes are given in NCHW order as in the convolution datasets and are permuted when a NHWC layout is requested.
+ */
+template <typename TensorType, typename Accessor>
+class ConvolutionLayerBaseFixture : public framework::Fixture
+{
+public:
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+protected:
+    void create_tensors(TensorShape src_shape, TensorShape weights_shape, const TensorShape &biases_shape, TensorShape dst_shape, DataType data_type, DataLayout data_layout, int batches)
+    {
+        // Scale the batch dimension of the source and destination shapes
+        src_shape.set(3 /* batch */, src_shape[3] * batches);
+        dst_shape.set(3 /* batch */, dst_shape[3] * batches);
+
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        const bool             is_quantized   = is_data_type_quantized_asymmetric(data_type);
+        const DataType         bias_data_type = is_quantized ? DataType::S32 : data_type;
+        const QuantizationInfo qinfo          = is_quantized ? QuantizationInfo(2.f / 255.f, 10) : QuantizationInfo();
+
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, data_layout);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo, data_layout);
+        biases  = create_tensor<TensorType>(biases_shape, bias_data_type, 1, QuantizationInfo(), data_layout);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, data_layout);
+    }
+
+    void allocate_and_fill()
+    {
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(biases), 2);
+    }
+
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+};
+
+/** Fixture for functions exposing the generic convolution interface (e.g. NEConvolutionLayer, NEGEMMConvolutionLayer) */
+template <typename TensorType, typename Function, typename Accessor>
+class ConvolutionLayerFixture : public ConvolutionLayerBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info,
+               DataType data_type, DataLayout data_layout, int batches)
+    {
+        this->create_tensors(src_shape, weights_shape, biases_shape, dst_shape, data_type, data_layout, batches);
+        conv_layer.configure(&this->src, &this->weights, &this->biases, &this->dst, info, WeightsInfo(), dilation, act_info);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+private:
+    Function conv_layer{};
+};
+
+/** Fixture for the Winograd convolution function */
+template <typename TensorType, typename Function, typename Accessor>
+class WinogradConvolutionLayerFixture : public ConvolutionLayerBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info,
+               DataType data_type, DataLayout data_layout, int batches)
+    {
+        ARM_COMPUTE_UNUSED(dilation);
+        this->create_tensors(src_shape, weights_shape, biases_shape, dst_shape, data_type, data_layout, batches);
+        conv_layer.configure(&this->src, &this->weights, &this->biases, &this->dst, info, act_info, true /* enable_fast_math */);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+private:
+    Function conv_layer{};
+};
+
+/** Fixture for the direct convolution function */
+template <typename TensorType, typename Function, typename Accessor>
+class DirectConvolutionLayerFixture : public ConvolutionLayerBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info,
+               DataType data_type, DataLayout data_layout, int batches)
+    {
+        ARM_COMPUTE_UNUSED(dilation);
+        this->create_tensors(src_shape, weights_shape, biases_shape, dst_shape, data_type, data_layout, batches);
+        conv_layer.configure(&this->src, &this->weights, &this->biases, &this->dst, info, act_info);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+private:
+    Function conv_layer{};
+};
+
+/** Fixture for the indirect/direct GEMM convolution function configured through @ref Conv2dInfo */
+template <typename TensorType, typename Function, typename Accessor>
+class GEMMConv2dFixture : public ConvolutionLayerBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info,
+               DataType data_type, DataLayout data_layout, int batches)
+    {
+        this->create_tensors(src_shape, weights_shape, biases_shape, dst_shape, data_type, data_layout, batches);
+        conv_layer.configure(&this->src, &this->weights, &this->biases, &this->dst, Conv2dInfo(info, dilation, act_info, false /* enable_fast_math */, 1 /* num_groups */));
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+private:
+    Function conv_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
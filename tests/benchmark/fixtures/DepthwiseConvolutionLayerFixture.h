@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture that can be used for NEON and CL */
+template <typename TensorType, typename Function, typename Accessor>
+class DepthwiseConvolutionLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape src_shape, Size2D kernel_size, PadStrideInfo info, Size2D dilation, DataType data_type, DataLayout data_layout, int batches)
+    {
+        // Scale the batch dimension of the source shape
+        src_shape.set(3 /* batch */, src_shape[3] * batches);
+
+        // Compute the weights, biases and destination shapes in NCHW first
+        TensorShape           weights_shape(kernel_size.width, kernel_size.height);
+        const TensorInfo      src_info(src_shape, 1, data_type);
+        const TensorInfo      weights_info(weights_shape, 1, data_type);
+        const ConvolutionInfo conv_info{ info, 1 /* depth_multiplier */, ActivationLayerInfo(), dilation };
+        TensorShape           dst_shape = misc::shape_calculator::compute_depthwise_convolution_shape(src_info, weights_info, conv_info);
+        weights_shape.set(2, dst_shape.z());
+        const TensorShape biases_shape(weights_shape[2]);
+
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        const bool             is_quantized   = is_data_type_quantized_asymmetric(data_type);
+        const DataType         bias_data_type = is_quantized ? DataType::S32 : data_type;
+        const QuantizationInfo qinfo          = is_quantized ? QuantizationInfo(2.f / 255.f, 10) : QuantizationInfo();
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, data_layout);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo, data_layout);
+        biases  = create_tensor<TensorType>(biases_shape, bias_data_type, 1, QuantizationInfo(), data_layout);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, data_layout);
+
+        // Create and configure function
+        depth_conv.configure(&src, &weights, &biases, &dst, info, 1 /* depth_multiplier */, ActivationLayerInfo(), dilation);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(biases), 2);
+    }
+
+    void run()
+    {
+        depth_conv.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   depth_conv{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_DEPTHWISECONVOLUTIONLAYERFIXTURE_H
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Common setup for the binary elementwise benchmark fixtures. Broadcasting is supported through the input shapes. */
+template <typename TensorType, typename Accessor>
+class ElementwiseOperationsBaseFixture : public framework::Fixture
+{
+public:
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src1.allocator()->free();
+        src2.allocator()->free();
+        dst.allocator()->free();
+    }
+
+protected:
+    void create_tensors(const TensorShape &shape0, const TensorShape &shape1, DataType data_type)
+    {
+        const QuantizationInfo qinfo = is_data_type_quantized_asymmetric(data_type) ? QuantizationInfo(2.f / 255.f, 10) : QuantizationInfo();
+
+        src1 = create_tensor<TensorType>(shape0, data_type, 1, qinfo);
+        src2 = create_tensor<TensorType>(shape1, data_type, 1, qinfo);
+        dst  = create_tensor<TensorType>(TensorShape::broadcast_shape(shape0, shape1), data_type, 1, qinfo);
+    }
+
+    void allocate_and_fill()
+    {
+        src1.allocator()->allocate();
+        src2.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src1), 0);
+        library->fill_tensor_uniform(Accessor(src2), 1);
+    }
+
+    TensorType src1{};
+    TensorType src2{};
+    TensorType dst{};
+};
+
+/** Fixture for the arithmetic addition and subtraction functions */
+template <typename TensorType, typename Function, typename Accessor>
+class ArithmeticOperationsFixture : public ElementwiseOperationsBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type)
+    {
+        this->create_tensors(shape0, shape1, data_type);
+        func.configure(&this->src1, &this->src2, &this->dst, ConvertPolicy::SATURATE);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        func.run();
+    }
+
+private:
+    Function func{};
+};
+
+/** Fixture for the pixel-wise multiplication function */
+template <typename TensorType, typename Function, typename Accessor>
+class PixelWiseMultiplicationFixture : public ElementwiseOperationsBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type)
+    {
+        this->create_tensors(shape0, shape1, data_type);
+        func.configure(&this->src1, &this->src2, &this->dst, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        func.run();
+    }
+
+private:
+    Function func{};
+};
+
+/** Fixture for the generic elementwise functions (max, min, division, squared difference, power) */
+template <typename TensorType, typename Function, typename Accessor>
+class ElementwiseOperationsFixture : public ElementwiseOperationsBaseFixture<TensorType, Accessor>
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type)
+    {
+        this->create_tensors(shape0, shape1, data_type);
+        func.configure(&this->src1, &this->src2, &this->dst);
+        this->allocate_and_fill();
+    }
+
+    void run()
+    {
+        func.run();
+    }
+
+private:
+    Function func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
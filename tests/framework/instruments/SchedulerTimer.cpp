@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -120,6 +120,16 @@ public:
         _kernels.push_back(std::move(info));
     }
 
+    void begin_parallel_region() override
+    {
+        _real_scheduler.begin_parallel_region();
+    }
+
+    void end_parallel_region() override
+    {
+        _real_scheduler.end_parallel_region();
+    }
+
 protected:
     void run_workloads(std::vector<Workload> &workloads) override
     {
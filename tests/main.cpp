@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,9 @@
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "utils/TypePrinter.h"
 #endif /* ARM_COMPUTE_CL */
+#include "arm_compute/runtime/CPP/CPPGemmTuner.h"
+#include "arm_compute/runtime/CPP/CPPMwsTuner.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
 #include "arm_compute/runtime/Scheduler.h"
 #include "src/common/cpuinfo/CpuModel.h"
 
@@ -85,13 +88,11 @@ extern std::unique_ptr<ParametersLibrary> parameters;
 
 namespace
 {
-#ifdef ARM_COMPUTE_CL
 bool file_exists(const std::string &filename)
 {
     std::ifstream file(filename);
     return file.good();
 }
-#endif /* ARM_COMPUTE_CL */
 } //namespace
 
 int main(int argc, char **argv)
@@ -151,6 +152,14 @@ int main(int argc, char **argv)
 #endif /* ARM_COMPUTE_CL */
     auto threads = parser.add_option<utils::SimpleOption<int>>("threads", 1);
     threads->set_help("Number of threads to use");
+    auto enable_mws_tuner = parser.add_option<utils::ToggleOption>("enable-mws-tuner");
+    enable_mws_tuner->set_help("Enable CPU minimum workload size tuner");
+    auto mws_tuner_file = parser.add_option<utils::SimpleOption<std::string>>("mws-tuner-file", "");
+    mws_tuner_file->set_help("File to load/save CPU minimum workload sizes");
+    auto enable_gemm_tuner = parser.add_option<utils::ToggleOption>("enable-gemm-tuner");
+    enable_gemm_tuner->set_help("Enable CPU GEMM kernel tuner");
+    auto gemm_tuner_file = parser.add_option<utils::SimpleOption<std::string>>("gemm-tuner-file", "");
+    gemm_tuner_file->set_help("File to load/save CPU GEMM kernels");
     auto cooldown_sec = parser.add_option<utils::SimpleOption<float>>("delay", -1.f);
     cooldown_sec->set_help("Delay to add between test executions in seconds");
     auto configure_only = parser.add_option<utils::ToggleOption>("configure-only", false);
@@ -174,6 +183,32 @@ int main(int argc, char **argv)
         // Setup CPU Scheduler
         Scheduler::get().set_num_threads(threads->value());
 
+        // The tuners are installed on the thread running the tests through a CPU runtime context
+        CPPRuntimeContext      cpp_runtime_ctx;
+        CPPRuntimeContextScope cpp_runtime_scope(&cpp_runtime_ctx);
+
+        CPPMwsTuner mws_tuner(enable_mws_tuner->is_set() && enable_mws_tuner->value());
+        if(enable_mws_tuner->is_set() || !mws_tuner_file->value().empty())
+        {
+            // If that's the first tuning run then the file won't exist yet
+            if(!mws_tuner_file->value().empty() && (!mws_tuner.tune_new_kernels() || file_exists(mws_tuner_file->value())))
+            {
+                mws_tuner.load_from_file(mws_tuner_file->value());
+            }
+            cpp_runtime_ctx.set_mws_tuner(&mws_tuner);
+        }
+
+        CPPGemmTuner gemm_tuner(enable_gemm_tuner->is_set() && enable_gemm_tuner->value());
+        if(enable_gemm_tuner->is_set() || !gemm_tuner_file->value().empty())
+        {
+            // If that's the first tuning run then the file won't exist yet
+            if(!gemm_tuner_file->value().empty() && (!gemm_tuner.tune_new_gemms() || file_exists(gemm_tuner_file->value())))
+            {
+                gemm_tuner.load_from_file(gemm_tuner_file->value());
+            }
+            cpp_runtime_ctx.set_gemm_tuner(&gemm_tuner);
+        }
+
         // Create CPU context
         auto cpu_ctx = std::make_unique<RuntimeContext>();
         cpu_ctx->set_scheduler(&Scheduler::get());
@@ -354,6 +389,18 @@ int main(int argc, char **argv)
             }
         }
 
+        if(mws_tuner.tune_new_kernels() && mws_tuner_file->is_set())
+        {
+            mws_tuner.save_to_file(mws_tuner_file->value());
+        }
+        cpp_runtime_ctx.set_mws_tuner(nullptr);
+
+        if(gemm_tuner.tune_new_gemms() && gemm_tuner_file->is_set())
+        {
+            gemm_tuner.save_to_file(gemm_tuner_file->value());
+        }
+        cpp_runtime_ctx.set_gemm_tuner(nullptr);
+
 #ifdef ARM_COMPUTE_CL
         if(opencl_is_available())
         {
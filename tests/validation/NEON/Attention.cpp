@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/KVCache.h"
+#include "arm_compute/runtime/NEON/functions/NEAttention.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/AttentionFixture.h"
+#include "tests/validation/reference/Attention.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.0001f); /**< Tolerance for floating point tests */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const AbsoluteTolerance<half> tolerance_fp16(half(0.01f)); /**< Tolerance for 16-bit floating point tests */
+#endif // ARM_COMPUTE_ENABLE_FP16
+
+/** Query shapes [D, Sq, H, B] and number of keys, covering partial query and key tiles and single query decoding */
+const auto SmallAttentionShapes = zip(make("QueryShape", { TensorShape(16U, 1U, 2U, 1U),
+                                                           TensorShape(8U, 7U, 3U, 1U),
+                                                           TensorShape(32U, 9U, 1U, 2U),
+                                                           TensorShape(5U, 4U, 2U, 2U),
+                                                           TensorShape(64U, 13U, 2U, 1U) }),
+                                      make("NumKeys", { 70U, 7U, 75U, 4U, 130U }));
+
+const auto LargeAttentionShapes = zip(make("QueryShape", { TensorShape(64U, 128U, 8U, 1U),
+                                                           TensorShape(128U, 1U, 16U, 2U) }),
+                                      make("NumKeys", { 128U, 1024U }));
+
+/** Masks, with and without broadcast along the heads */
+const auto MaskDataset = zip(make("HasMask", { false, true, true }),
+                             make("BroadcastMask", { false, false, true }));
+
+/** Copy the first tokens of keys or values of shape [size, tokens, heads] */
+SimpleTensor<float> first_tokens(const SimpleTensor<float> &src, unsigned int num_tokens)
+{
+    TensorShape shape = src.shape();
+    shape.set(1, num_tokens);
+
+    SimpleTensor<float> dst{ shape, src.data_type() };
+    for(int i = 0; i < dst.num_elements(); ++i)
+    {
+        dst[i] = src[coord2index(src.shape(), index2coord(shape, i))];
+    }
+    return dst;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Attention)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("QueryInfo", { TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::S32), // Unsupported data type
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Mismatching data types
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Mismatching query and key sizes
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Mismatching number of keys and values
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Mismatching heads
+                                   TensorInfo(TensorShape(16U, 8U, 2U), 1, DataType::F32), // Causal with fewer keys than queries
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Mask not broadcastable
+                                   TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32), // Wrong output shape
+                                 }),
+               make("KeyInfo", { TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::S32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F16),
+                                 TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 3U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(16U, 6U, 2U), 1, DataType::F32),
+                               }),
+               make("ValueInfo", { TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::S32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 5U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                 }),
+               make("MaskInfo", { TensorInfo(),
+                                  TensorInfo(TensorShape(6U, 4U), 1, DataType::F32),
+                                  TensorInfo(),
+                                  TensorInfo(),
+                                  TensorInfo(),
+                                  TensorInfo(),
+                                  TensorInfo(),
+                                  TensorInfo(),
+                                  TensorInfo(TensorShape(6U, 4U, 3U), 1, DataType::F32),
+                                  TensorInfo(),
+                                }),
+               make("OutputInfo", { TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::S32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 8U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 4U, 2U), 1, DataType::F32),
+                                  }),
+               make("IsCausal", { true, false, false, false, false, false, false, true, false, false }),
+               make("Expected", { true, true, false, false, false, false, false, false, false, false })),
+               query_info, key_info, value_info, mask_info, output_info, is_causal, expected)
+{
+    const bool has_mask = mask_info.total_size() > 0;
+
+    const Status status = NEAttention::validate(&query_info.clone()->set_is_resizable(false),
+                                                &key_info.clone()->set_is_resizable(false),
+                                                &value_info.clone()->set_is_resizable(false),
+                                                has_mask ? &mask_info.clone()->set_is_resizable(false) : nullptr,
+                                                &output_info.clone()->set_is_resizable(false),
+                                                AttentionInfo().is_causal(is_causal));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEAttentionFixture = AttentionValidationFixture<Tensor, Accessor, NEAttention, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAttentionFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallAttentionShapes,
+                               make("ValueSize", { 8U, 17U }),
+                               MaskDataset,
+                               make("IsCausal", { false, true }),
+                               make("Scale", { 0.f, 0.5f }),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEAttentionFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(LargeAttentionShapes,
+                               make("ValueSize", { 64U }),
+                               MaskDataset,
+                               make("IsCausal", { false, true }),
+                               make("Scale", { 0.f }),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_CASE(KVCacheDecoding, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int head_size  = 16;
+    constexpr unsigned int value_size = 8;
+    constexpr unsigned int num_heads  = 2;
+    constexpr unsigned int num_prompt = 5;
+    // Enough tokens to grow the cache several times and cover more than one tile of keys
+    constexpr unsigned int num_tokens = 80;
+
+    const TensorShape keys_shape(head_size, num_tokens, num_heads);
+    const TensorShape values_shape(value_size, num_tokens, num_heads);
+    const TensorShape query_shape(head_size, 1U, num_heads);
+
+    Tensor keys   = create_tensor<Tensor>(keys_shape, DataType::F32);
+    Tensor values = create_tensor<Tensor>(values_shape, DataType::F32);
+    Tensor query  = create_tensor<Tensor>(query_shape, DataType::F32);
+    Tensor dst{};
+
+    KVCache cache;
+    cache.init(*keys.info(), *values.info(), 8);
+
+    const AttentionInfo info = AttentionInfo().is_causal(true);
+    ARM_COMPUTE_EXPECT(bool(NEAttention::validate(query.info(), cache.key()->info(), cache.value()->info(), nullptr,
+                                                  dst.info(), info)),
+                       framework::LogLevel::ERRORS);
+
+    // Configured once on the views of the cache, whatever its length
+    NEAttention attention;
+    attention.configure(&query, cache.key(), cache.value(), nullptr, &dst, info);
+
+    keys.allocator()->allocate();
+    values.allocator()->allocate();
+    query.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    SimpleTensor<float> ref_keys{ keys_shape, DataType::F32 };
+    SimpleTensor<float> ref_values{ values_shape, DataType::F32 };
+    library->fill_tensor_uniform(Accessor(keys), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(values), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(ref_keys, 0, -1.f, 1.f);
+    library->fill_tensor_uniform(ref_values, 1, -1.f, 1.f);
+
+    SubTensor prompt_keys(&keys, TensorShape(head_size, num_prompt, num_heads), Coordinates(0, 0, 0));
+    SubTensor prompt_values(&values, TensorShape(value_size, num_prompt, num_heads), Coordinates(0, 0, 0));
+    cache.append(&prompt_keys, &prompt_values);
+
+    for(unsigned int token = num_prompt; token < num_tokens; ++token)
+    {
+        SubTensor step_keys(&keys, TensorShape(head_size, 1U, num_heads), Coordinates(0, token, 0));
+        SubTensor step_values(&values, TensorShape(value_size, 1U, num_heads), Coordinates(0, token, 0));
+        cache.append(&step_keys, &step_values);
+
+        library->fill_tensor_uniform(Accessor(query), 2 + token, -1.f, 1.f);
+        attention.run();
+
+        SimpleTensor<float> ref_query{ query_shape, DataType::F32 };
+        library->fill_tensor_uniform(ref_query, 2 + token, -1.f, 1.f);
+        const SimpleTensor<float> reference = reference::attention<float>(ref_query, first_tokens(ref_keys, token + 1),
+                                                                          first_tokens(ref_values, token + 1), SimpleTensor<float>{},
+                                                                          1.f / std::sqrt(static_cast<float>(head_size)), true);
+
+        // Validate output
+        validate(Accessor(dst), reference, tolerance_fp32);
+    }
+
+    ARM_COMPUTE_EXPECT(cache.length() == num_tokens, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.capacity() >= num_tokens && cache.capacity() < 2 * num_tokens, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAttentionFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallAttentionShapes,
+                               make("ValueSize", { 8U, 17U }),
+                               MaskDataset,
+                               make("IsCausal", { false, true }),
+                               make("Scale", { 0.f }),
+                               make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // Attention
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // __aarch64__
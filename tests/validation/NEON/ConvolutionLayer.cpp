@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1263,6 +1263,55 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for accumulating the convolution into the destination in @ref NEGEMMConvolutionLayer.
+ *
+ * Checks performed in order:
+ * - Accumulation is rejected for NCHW, where the GEMM does not write straight to the destination
+ * - The destination holds act(dst + conv(src) + bias) after a run
+ */
+TEST_CASE(Accumulate, framework::DatasetMode::ALL)
+{
+    const auto src_info    = TensorInfo(TensorShape(2U, 4U, 3U), 1, DataType::F32, DataLayout::NHWC);
+    const auto weight_info = TensorInfo(TensorShape(2U, 1U, 1U, 3U), 1, DataType::F32, DataLayout::NHWC);
+    const auto bias_info   = TensorInfo(TensorShape(3U), 1, DataType::F32, DataLayout::NHWC);
+    const auto dst_info    = TensorInfo(TensorShape(3U, 4U, 3U), 1, DataType::F32, DataLayout::NHWC);
+    const auto conv_info   = PadStrideInfo(1, 1, 0, 0);
+    const auto act_info    = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU);
+
+    const auto src_info_nchw    = TensorInfo(TensorShape(4U, 3U, 2U), 1, DataType::F32, DataLayout::NCHW);
+    const auto weight_info_nchw = TensorInfo(TensorShape(1U, 1U, 2U, 3U), 1, DataType::F32, DataLayout::NCHW);
+    const auto dst_info_nchw    = TensorInfo(TensorShape(4U, 3U, 3U), 1, DataType::F32, DataLayout::NCHW);
+    ARM_COMPUTE_EXPECT(!bool(NEGEMMConvolutionLayer::validate(&src_info_nchw, &weight_info_nchw, &bias_info, &dst_info_nchw, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                              act_info, false /* enable_fast_math */, 1U, true /* accumulate */)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEGEMMConvolutionLayer::validate(&src_info, &weight_info, &bias_info, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                             act_info, false /* enable_fast_math */, 1U, true /* accumulate */)),
+                       framework::LogLevel::ERRORS);
+
+    auto src    = create_tensor<Tensor>(src_info);
+    auto weight = create_tensor<Tensor>(weight_info);
+    auto bias   = create_tensor<Tensor>(bias_info);
+    auto dst    = create_tensor<Tensor>(dst_info);
+
+    NEGEMMConvolutionLayer conv;
+    conv.configure(&src, &weight, &bias, &dst, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, false /* enable_fast_math */, 1U, true /* accumulate */);
+    src.allocator()->allocate();
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_value(Accessor(src), 1.f);
+    library->fill_tensor_value(Accessor(weight), 2.f);
+    library->fill_tensor_value(Accessor(bias), 3.f);
+    library->fill_tensor_value(Accessor(dst), -5.f);
+    conv.run();
+
+    // relu(-5 + (2 * 1 * 2) + 3) = 2
+    for(size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(dst.buffer())[i] == 2.f, framework::LogLevel::ERRORS);
+    }
+}
+
 TEST_SUITE(Float)
 #if defined(ARM_COMPUTE_ENABLE_BF16)
 TEST_SUITE(BFLOAT16)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,12 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/validation/reference/MatMulQsi4.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
 
 namespace arm_compute
 {
@@ -99,6 +105,179 @@ const auto ActivationFunctionsQuantizedDataset = make("ActivationInfo",
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f),
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f),
 });
+
+#ifdef __aarch64__
+/** Run @ref NEFullyConnectedLayer with 4-bit weights and compare it against a reference that quantizes the input rows the same way as the kernel run on this CPU
+ *
+ * @param[in] src_shape Shape of the input
+ * @param[in] dst_shape Shape of the output
+ * @param[in] block_len Number of input values sharing a weights scale, 0 for per channel weights
+ * @param[in] act_info  Fused activation
+ */
+void validate_fc_qsi4(const TensorShape &src_shape, const TensorShape &dst_shape, unsigned int block_len, const ActivationLayerInfo &act_info)
+{
+    const unsigned int n          = dst_shape[0];
+    const unsigned int m          = dst_shape.total_size_upper(1);
+    const unsigned int k          = src_shape.total_size() / m;
+    const unsigned int num_blocks = block_len == 0 ? 1 : k / block_len;
+    const DataType     weights_dt = block_len == 0 ? DataType::QSYMM4_PER_CHANNEL : DataType::QSYMM4_PER_BLOCK;
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> float_dist(-1.f, 1.f);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 0.05f);
+    std::uniform_int_distribution<int>    weights_dist(-8, 7);
+
+    std::vector<float> src_values(m * k);
+    std::vector<float> bias_values(n);
+    std::vector<float> scales(n * num_blocks);
+    std::vector<int>   weights_values(n * k);
+    std::generate(src_values.begin(), src_values.end(), [&]() { return float_dist(gen); });
+    std::generate(bias_values.begin(), bias_values.end(), [&]() { return float_dist(gen); });
+    std::generate(scales.begin(), scales.end(), [&]() { return scale_dist(gen); });
+    std::generate(weights_values.begin(), weights_values.end(), [&]() { return weights_dist(gen); });
+
+    // Two values per byte, the even one in the low nibble
+    const unsigned int   weights_row = (k + 1) / 2;
+    std::vector<uint8_t> weights_bytes(n * weights_row, 0);
+    for(unsigned int c = 0; c < n; ++c)
+    {
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            weights_bytes[c * weights_row + i / 2] |= (static_cast<uint8_t>(weights_values[c * k + i]) & 0xF) << ((i % 2) * 4);
+        }
+    }
+
+    Tensor src     = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor weights = create_tensor<Tensor>(TensorShape(weights_row, n), weights_dt, 1, QuantizationInfo(scales));
+    Tensor bias    = create_tensor<Tensor>(TensorShape(n), DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.activation_info = act_info;
+
+    NEFullyConnectedLayer fc;
+    fc.configure(&src, &weights, &bias, &dst, fc_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+    std::memcpy(src.buffer(), src_values.data(), src_values.size() * sizeof(float));
+    std::memcpy(weights.buffer(), weights_bytes.data(), weights_bytes.size());
+    std::memcpy(bias.buffer(), bias_values.data(), bias_values.size() * sizeof(float));
+
+    fc.run();
+
+    SimpleTensor<float> src_ref{ src_shape, DataType::F32 };
+    std::copy(src_values.begin(), src_values.end(), src_ref.data());
+    const SimpleTensor<float> expected = reference::matmul_qsi4(src_ref, weights_values, scales, bias_values, dst_shape, block_len, CPUInfo::get().has_dotprod());
+
+    const float *dst_ptr = reinterpret_cast<const float *>(dst.buffer());
+    const float  min     = act_info.enabled() ? (act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU ? act_info.b() : 0.f) : -INFINITY;
+    const float  max     = act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU ? act_info.a() : INFINITY;
+    for(unsigned int i = 0; i < m * n; ++i)
+    {
+        const float clamped = std::min(std::max(expected[i], min), max);
+        ARM_COMPUTE_EXPECT(std::fabs(dst_ptr[i] - clamped) <= 1e-4f + 1e-4f * std::fabs(clamped), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Run @ref NEFullyConnectedLayer with QSYMM8_PER_CHANNEL weights and compare it against a reference that quantizes the input rows the same way
+ *
+ * @param[in] src_shape         Shape of the input
+ * @param[in] dst_shape         Shape of the output
+ * @param[in] transpose_weights Whether the weights are in their original [K, N] shape rather than [N, K]
+ * @param[in] act_info          Fused activation
+ */
+void validate_fc_qsi8(const TensorShape &src_shape, const TensorShape &dst_shape, bool transpose_weights, const ActivationLayerInfo &act_info)
+{
+    const unsigned int n = dst_shape[0];
+    const unsigned int m = dst_shape.total_size_upper(1);
+    const unsigned int k = src_shape.total_size() / m;
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> float_dist(-1.f, 1.f);
+    std::uniform_real_distribution<float> scale_dist(0.001f, 0.005f);
+    std::uniform_int_distribution<int>    weights_dist(-127, 127);
+
+    std::vector<float>  src_values(m * k);
+    std::vector<float>  bias_values(n);
+    std::vector<float>  scales(n);
+    std::vector<int8_t> weights_values(n * k);
+    std::generate(src_values.begin(), src_values.end(), [&]() { return float_dist(gen); });
+    std::generate(bias_values.begin(), bias_values.end(), [&]() { return float_dist(gen); });
+    std::generate(scales.begin(), scales.end(), [&]() { return scale_dist(gen); });
+    std::generate(weights_values.begin(), weights_values.end(), [&]() { return static_cast<int8_t>(weights_dist(gen)); });
+
+    // weights_values holds the values of each output channel contiguously
+    std::vector<int8_t> weights_bytes(weights_values);
+    if(!transpose_weights)
+    {
+        for(unsigned int c = 0; c < n; ++c)
+        {
+            for(unsigned int i = 0; i < k; ++i)
+            {
+                weights_bytes[i * n + c] = weights_values[c * k + i];
+            }
+        }
+    }
+
+    const TensorShape weights_shape = transpose_weights ? TensorShape(k, n) : TensorShape(n, k);
+    Tensor            src           = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor            weights       = create_tensor<Tensor>(weights_shape, DataType::QSYMM8_PER_CHANNEL, 1, QuantizationInfo(scales));
+    Tensor            bias          = create_tensor<Tensor>(TensorShape(n), DataType::F32);
+    Tensor            dst           = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.activation_info   = act_info;
+    fc_info.transpose_weights = transpose_weights;
+
+    NEFullyConnectedLayer fc;
+    fc.configure(&src, &weights, &bias, &dst, fc_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+    std::memcpy(src.buffer(), src_values.data(), src_values.size() * sizeof(float));
+    std::memcpy(weights.buffer(), weights_bytes.data(), weights_bytes.size());
+    std::memcpy(bias.buffer(), bias_values.data(), bias_values.size() * sizeof(float));
+
+    fc.run();
+
+    const float *dst_ptr = reinterpret_cast<const float *>(dst.buffer());
+    const float  min     = act_info.enabled() ? (act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU ? act_info.b() : 0.f) : -INFINITY;
+    const float  max     = act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU ? act_info.a() : INFINITY;
+    for(unsigned int y = 0; y < m; ++y)
+    {
+        // Asymmetric quantization of the row over a range containing zero
+        const float *row  = src_values.data() + y * k;
+        float        rmin = 0.f;
+        float        rmax = 0.f;
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            rmin = std::min(rmin, row[i]);
+            rmax = std::max(rmax, row[i]);
+        }
+        const float   row_scale = (rmax - rmin) / 255.f;
+        const float   inv_scale = row_scale > 0.f ? 1.f / row_scale : 0.f;
+        const int32_t offset    = static_cast<int32_t>(std::min(127.f, std::max(-128.f, std::round(-128.f - rmin * inv_scale))));
+
+        for(unsigned int c = 0; c < n; ++c)
+        {
+            int32_t acc = 0;
+            for(unsigned int i = 0; i < k; ++i)
+            {
+                const int32_t src_q = std::min(127, std::max(-128, static_cast<int32_t>(std::nearbyint(row[i] * inv_scale)) + offset));
+                acc += (src_q - offset) * weights_values[c * k + i];
+            }
+            float expected = bias_values[c] + static_cast<float>(acc) * row_scale * scales[c];
+            expected       = std::min(std::max(expected, min), max);
+            ARM_COMPUTE_EXPECT(std::fabs(dst_ptr[y * n + c] - expected) <= 1e-4f + 1e-4f * std::fabs(expected), framework::LogLevel::ERRORS);
+        }
+    }
+}
+#endif // __aarch64__
 } // namespace
 
 TEST_SUITE(NEON)
@@ -562,6 +741,94 @@ FIXTURE_DATA_TEST_CASE(RunDynamicWeights, NEFullyConnectedLayerDynamicWeightsFix
 {
 }
 TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE(QSYMM4)
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("WeightsInfo", { TensorInfo(TensorShape(16U, 8U), 1, DataType::QSYMM4_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::QSYMM4_PER_BLOCK, QuantizationInfo(std::vector<float>(16U, 0.1f))),
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::QSYMM4_PER_BLOCK, QuantizationInfo(std::vector<float>(24U, 0.1f))),  // Blocks not dividing K
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::QSYMM4_PER_BLOCK, QuantizationInfo(std::vector<float>(32U, 0.1f))),  // Blocks shorter than 32
+                          TensorInfo(TensorShape(8U, 8U), 1, DataType::QSYMM4_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),   // K mismatch
+                          TensorInfo(TensorShape(16U, 8U), 1, DataType::QSYMM4_PER_CHANNEL, QuantizationInfo(std::vector<float>(4U, 0.1f))),  // Missing scales
+    }),
+    make("InputInfo", { TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+    }),
+    make("Expected", { true, true, false, false, false, false })),
+    weights_info, input_info, expected)
+{
+    const TensorInfo bias_info(TensorShape(8U), 1, DataType::F32);
+    const TensorInfo output_info(TensorShape(8U, 3U), 1, DataType::F32);
+    const Status     status = NEFullyConnectedLayer::validate(&input_info, &weights_info, &bias_info, &output_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+#ifdef __aarch64__
+TEST_CASE(RunPerChannel, framework::DatasetMode::PRECOMMIT)
+{
+    validate_fc_qsi4(TensorShape(37U, 5U), TensorShape(19U, 5U), 0, ActivationLayerInfo());
+    validate_fc_qsi4(TensorShape(4U, 4U, 4U), TensorShape(9U), 0, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+}
+TEST_CASE(RunPerBlock, framework::DatasetMode::PRECOMMIT)
+{
+    validate_fc_qsi4(TensorShape(128U, 3U), TensorShape(17U, 3U), 32, ActivationLayerInfo());
+    validate_fc_qsi4(TensorShape(128U), TensorShape(8U), 64, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f));
+}
+#endif // __aarch64__
+TEST_SUITE_END() // QSYMM4
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("WeightsInfo", { TensorInfo(TensorShape(31U, 8U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),
+                          TensorInfo(TensorShape(8U, 31U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),
+                          TensorInfo(TensorShape(31U, 8U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(1U, 0.1f))),
+                          TensorInfo(TensorShape(8U, 31U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),  // Weights not in the expected layout
+                          TensorInfo(TensorShape(31U, 8U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(4U, 0.1f))),  // Missing scales
+                          TensorInfo(TensorShape(31U, 8U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8U, 0.1f))),  // Quantized input
+    }),
+    make("InputInfo", { TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U, 3U), 1, DataType::QASYMM8_SIGNED),
+    }),
+    make("TransposeWeights", { true, false, true, true, true, true }),
+    make("Expected", { true, true, true, false, false, false })),
+    weights_info, input_info, transpose_weights, expected)
+{
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.transpose_weights = transpose_weights;
+
+    const TensorInfo bias_info(TensorShape(8U), 1, DataType::F32);
+    const TensorInfo output_info(TensorShape(8U, 3U), 1, input_info.data_type());
+    const Status     status = NEFullyConnectedLayer::validate(&input_info, &weights_info, &bias_info, &output_info, fc_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+#ifdef __aarch64__
+TEST_CASE(RunTransposedWeights, framework::DatasetMode::PRECOMMIT)
+{
+    validate_fc_qsi8(TensorShape(37U, 5U), TensorShape(19U, 5U), true, ActivationLayerInfo());
+    validate_fc_qsi8(TensorShape(4U, 4U, 4U), TensorShape(9U), true, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+}
+TEST_CASE(RunReshapedWeights, framework::DatasetMode::PRECOMMIT)
+{
+    validate_fc_qsi8(TensorShape(128U, 3U), TensorShape(17U, 3U), false, ActivationLayerInfo());
+    validate_fc_qsi8(TensorShape(100U), TensorShape(8U), false, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f));
+}
+#endif // __aarch64__
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
 TEST_SUITE_END() // Quantized
 TEST_SUITE_END() // FullyConnectedLayer
 TEST_SUITE_END() // NEON
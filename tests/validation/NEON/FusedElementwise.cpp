@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEFusedElementwise.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedElementwiseFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const RelativeTolerance<float> tolerance_fp32(0.0001f);     /**< Tolerance for floating point tests */
+constexpr float               abs_tolerance_fp32 = 0.0001f; /**< Absolute tolerance for values close to zero */
+const RelativeTolerance<half> tolerance_fp16(half(0.01f));  /**< Tolerance for 16-bit floating point tests */
+constexpr float               tolerance_num_fp16 = 0.01f;   /**< Tolerance number for 16-bit floating point tests */
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::IDENTITY),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LEAKY_RELU, 0.1f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::HARD_SWISH)
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedElementwise)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+               framework::dataset::make("Input0Info", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::U8),     // Unsupported data type
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),    // Missing operand
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),    // Mismatching data types
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),    // Shapes not broadcast compatible
+                                                      }),
+               framework::dataset::make("Input1Info", { TensorInfo(TensorShape(27U, 1U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(27U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::U8),
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),
+                                                        TensorInfo(TensorShape(26U, 13U, 2U), 1, DataType::F32),
+                                                      })),
+               framework::dataset::make("OperandIndex", { 1U, 1U, 1U, 2U, 1U, 1U })),
+               framework::dataset::make("Expected", { true, true, false, false, false, false })),
+               input0_info, input1_info, operand, expected)
+{
+    const ElementwiseChainInfo chain =
+    {
+        ElementwiseChainStep(ElementwiseChainOperation::MUL, operand),
+        ElementwiseChainStep(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+    };
+    TensorInfo output_info;
+    const bool is_valid = bool(NEFusedElementwise::validate({ &input0_info.clone()->set_is_resizable(false), &input1_info.clone()->set_is_resizable(false) },
+                                                            &output_info, chain));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEFusedElementwiseFixture = FusedElementwiseValidationFixture<Tensor, Accessor, NEFusedElementwise, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallShapesBroadcast(),
+                                                                                                                      framework::dataset::make("DataType", DataType::F32)),
+                                                                                                              ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32, 0.f, abs_tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunLarge, NEFusedElementwiseFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeShapesBroadcast(),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                                            ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32, 0.f, abs_tolerance_fp32);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallShapesBroadcast(),
+                                                                                                                     framework::dataset::make("DataType", DataType::F16)),
+                                                                                                             ActivationFunctionsDataset))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16, tolerance_num_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedElementwise
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // __aarch64__
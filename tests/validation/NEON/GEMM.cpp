@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,7 @@ using framework::dataset::make;
 namespace
 {
 constexpr AbsoluteTolerance<float> tolerance_f(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+constexpr AbsoluteTolerance<int8_t> tolerance_quant(1); /**< Tolerance value for comparing reference's output against implementation's output for quantized data types */
 #ifdef ARM_COMPUTE_ENABLE_FP16
 RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.2)); /**< Relative tolerance value for comparing reference's output against implementation's output for FP16 data types */
 const AbsoluteTolerance<float>      abs_tolerance_f16(0.2f);      /**< Absolute tolerance value for comparing reference's output against implementation's output for FP16 data types */
@@ -352,6 +353,9 @@ using NEDynamicGEMMFixture = GEMMDynamicValidationFixture<Tensor, Accessor, NEGE
 // Runs twice to exercise code paths with buffer reuse.
 template <typename T>
 using NEDynamicGEMMFixtureRunTwice = GEMMDynamicValidationFixture<Tensor, Accessor, NEGEMM, T, false, false, false, false, false, true>;
+
+using NEDynamicGEMMBF16Fixture      = GEMMDynamicBF16ValidationFixture<Tensor, Accessor, NEGEMM>;
+using NEDynamicGEMMQuantizedFixture = GEMMDynamicQuantizedValidationFixture<Tensor, Accessor, NEGEMM>;
 #endif // __aarch64__
 
 template <typename T>
@@ -442,6 +446,29 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<half>, framework::DatasetMode::NI
     }
 }
 
+#if defined(__aarch64__)
+TEST_SUITE(DynamicShape)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDynamicGEMMFixture<half>, framework::DatasetMode::PRECOMMIT,
+        combine(
+            datasets::SmallGEMMVectorBiasDataset(),
+            make("ReshapeWeights", { true, false }),
+            make("DataType", DataType::F16),
+            make("ConstantRHS", false)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // DynamicShape
+#endif // __aarch64__
+
 TEST_SUITE(BATCHED_MATMUL)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEBatchedMatMulFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallBatchedMatMulDataset(),
                                                                                                                   make("ReshapeWeights", { false })),
@@ -526,6 +553,53 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, combine(
     bool validity = valid_data_type && valid_null_c && valid_alpha && valid_beta && valid_dynamic_ab && valid_dynamic_d && valid_reshape_first_run;
     ARM_COMPUTE_EXPECT((validity == bool(status)), framework::LogLevel::ERRORS);
 }
+DATA_TEST_CASE(ValidateDataTypes, framework::DatasetMode::ALL, zip(
+    make("A", { TensorInfo(TensorShape(13U, 4U), 1, DataType::BFLOAT16),
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::BFLOAT16),
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.5f, 3)),
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.5f, 3)),
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.5f, 3)),  // Asymmetric b
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.5f, 3)),  // Wrong bias data type
+                TensorInfo(TensorShape(13U, 4U), 1, DataType::QASYMM8),                                    // Unsupported data type
+    }),
+    make("B", { TensorInfo(TensorShape(21U, 13U), 1, DataType::BFLOAT16),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::BFLOAT16),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.25f, 0)),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(21U, 0.25f))),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.25f, 2)),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.25f, 0)),
+                TensorInfo(TensorShape(21U, 13U), 1, DataType::QASYMM8),
+    }),
+    make("C", { TensorInfo(TensorShape(21U), 1, DataType::F32),
+                TensorInfo(TensorShape(21U), 1, DataType::BFLOAT16),                                       // Output must be F32
+                TensorInfo(TensorShape(21U), 1, DataType::S32),
+                TensorInfo(TensorShape(21U), 1, DataType::S32),
+                TensorInfo(TensorShape(21U), 1, DataType::S32),
+                TensorInfo(TensorShape(21U), 1, DataType::F32),
+                TensorInfo(TensorShape(21U), 1, DataType::S32),
+    }),
+    make("D", { TensorInfo(TensorShape(21U, 4U), 1, DataType::F32),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::BFLOAT16),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(1.f, -2)),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(1.f, -2)),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(1.f, -2)),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(1.f, -2)),
+                TensorInfo(TensorShape(21U, 4U), 1, DataType::QASYMM8),
+    }),
+    make("Expected", { true, false, true, true, false, false, false })),
+    a_info, b_info, c_info, d_info, expected)
+{
+    TensorInfo a = a_info;
+    TensorInfo b = b_info;
+    TensorInfo c = c_info;
+    TensorInfo d = d_info;
+    a.set_dynamic(true);
+    a.set_are_values_constant(false);
+    d.set_dynamic(true);
+
+    const Status status = cpu::CpuDynamicGemm::validate(&a, &b, &c, &d, 1.f, 1.f, GEMMInfo(false, false, true));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDynamicGEMMFixture<float>, framework::DatasetMode::PRECOMMIT,
         combine(
             datasets::SmallGEMMVectorBiasDataset(),
@@ -588,7 +662,57 @@ TEST_SUITE_END() // ACCUMULATE
 
 TEST_SUITE_END() // FP32
 
+#if defined(__aarch64__)
+TEST_SUITE(BF16)
+TEST_SUITE(DynamicShape)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDynamicGEMMBF16Fixture, framework::DatasetMode::PRECOMMIT,
+        combine(
+            datasets::SmallGEMMVectorBiasDataset(),
+            make("ConstantRHS", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEDynamicGEMMBF16Fixture, framework::DatasetMode::NIGHTLY,
+        combine(
+            datasets::LargeGEMMVectorBiasDataset(),
+            make("ConstantRHS", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+TEST_SUITE_END() // DynamicShape
+TEST_SUITE_END() // BF16
+#endif // __aarch64__
+
 TEST_SUITE_END() // Float
+
+#if defined(__aarch64__)
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8_SIGNED)
+TEST_SUITE(DynamicShape)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDynamicGEMMQuantizedFixture, framework::DatasetMode::PRECOMMIT,
+        combine(
+            datasets::SmallGEMMVectorBiasDataset(),
+            make("WeightsDataType", { DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL }),
+            make("ConstantRHS", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEDynamicGEMMQuantizedFixture, framework::DatasetMode::NIGHTLY,
+        combine(
+            datasets::LargeGEMMVectorBiasDataset(),
+            make("WeightsDataType", { DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL }),
+            make("ConstantRHS", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // DynamicShape
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+#endif // __aarch64__
 TEST_SUITE_END() // GEMM
 TEST_SUITE_END() // NEON
 } // namespace validation
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELayerNormalizationLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/LayerNormalizationFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.0001f); /**< Tolerance for floating point tests */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+const AbsoluteTolerance<half> tolerance_fp16(half(0.02f)); /**< Tolerance for 16-bit floating point tests */
+#endif // ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_bf16(0.05f); /**< Tolerance for bfloat16 tests */
+
+/** Row lengths with and without a vector tail, single rows and several outer dimensions */
+const auto SmallLayerNormShapes = make("Shape", { TensorShape(1U, 5U),
+                                                  TensorShape(8U, 1U),
+                                                  TensorShape(37U, 3U, 2U),
+                                                  TensorShape(128U, 4U),
+                                                  TensorShape(13U, 7U, 3U, 2U) });
+
+const auto LargeLayerNormShapes = make("Shape", { TensorShape(768U, 128U, 2U),
+                                                  TensorShape(4096U, 64U) });
+
+/** Residual addition, with the sum written to its own tensor or to the residual */
+const auto ResidualDataset = zip(make("HasResidual", { false, true, true, true }),
+                                 make("HasAddOutput", { false, false, true, true }),
+                                 make("InPlace", { false, false, false, true }));
+
+/** Affine transform, with gamma only, beta only, both or none */
+const auto AffineDataset = zip(make("HasGamma", { false, true, false, true }),
+                               make("HasBeta", { false, false, true, true }));
+
+const auto TypeDataset = make("Type", { LayerNormalizationType::LayerNorm, LayerNormalizationType::RMSNorm });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LayerNormalizationLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::BFLOAT16),
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::S32), // Unsupported data type
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32), // Mismatching residual shape
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32), // Mismatching gamma size
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32), // Sum without residual
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32), // Mismatching output data type
+                                   TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32), // Negative epsilon
+                                 }),
+               make("ResidualInfo", { TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                      TensorInfo(),
+                                      TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::BFLOAT16),
+                                      TensorInfo(),
+                                      TensorInfo(TensorShape(32U, 4U), 1, DataType::F32),
+                                      TensorInfo(),
+                                      TensorInfo(),
+                                      TensorInfo(),
+                                      TensorInfo(),
+                                    }),
+               make("GammaInfo", { TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(),
+                                   TensorInfo(TensorShape(32U), 1, DataType::BFLOAT16),
+                                   TensorInfo(),
+                                   TensorInfo(),
+                                   TensorInfo(TensorShape(16U), 1, DataType::F32),
+                                   TensorInfo(),
+                                   TensorInfo(),
+                                   TensorInfo(),
+                                 }),
+               make("AddOutputInfo", { TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                       TensorInfo(),
+                                       TensorInfo(),
+                                       TensorInfo(),
+                                       TensorInfo(),
+                                       TensorInfo(),
+                                       TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                       TensorInfo(),
+                                       TensorInfo(),
+                                     }),
+               make("OutputInfo", { TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::BFLOAT16),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::S32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F16),
+                                    TensorInfo(TensorShape(32U, 4U, 2U), 1, DataType::F32),
+                                  }),
+               make("Epsilon", { 1e-5f, 1e-5f, 1e-6f, 1e-5f, 1e-5f, 1e-5f, 1e-5f, 1e-5f, -1.f }),
+               make("Expected", { true, true, true, false, false, false, false, false, false })),
+               input_info, residual_info, gamma_info, add_output_info, output_info, epsilon, expected)
+{
+    const auto optional = [](const TensorInfo &info) -> const ITensorInfo *
+    {
+        return info.total_size() > 0 ? &info : nullptr;
+    };
+
+    const Status status = NELayerNormalizationLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                              optional(residual_info),
+                                                              optional(gamma_info),
+                                                              nullptr,
+                                                              optional(add_output_info),
+                                                              &output_info.clone()->set_is_resizable(false),
+                                                              LayerNormalizationInfo(LayerNormalizationType::RMSNorm, epsilon));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NELayerNormalizationLayerFixture = LayerNormalizationValidationFixture<Tensor, Accessor, NELayerNormalizationLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELayerNormalizationLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormShapes,
+                               ResidualDataset,
+                               AffineDataset,
+                               TypeDataset,
+                               make("Epsilon", { 1e-5f }),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+    if(_has_add_output)
+    {
+        validate(Accessor(_target_add_output), _reference_add_output);
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELayerNormalizationLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(LargeLayerNormShapes,
+                               ResidualDataset,
+                               make("HasGamma", { true }),
+                               make("HasBeta", { true }),
+                               TypeDataset,
+                               make("Epsilon", { 1e-6f }),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+    if(_has_add_output)
+    {
+        validate(Accessor(_target_add_output), _reference_add_output);
+    }
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELayerNormalizationLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormShapes,
+                               ResidualDataset,
+                               make("HasGamma", { true }),
+                               make("HasBeta", { true }),
+                               TypeDataset,
+                               make("Epsilon", { 1e-5f }),
+                               make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+        if(_has_add_output)
+        {
+            validate(Accessor(_target_add_output), _reference_add_output);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+// The BF16 values are converted with integer instructions, so no BF16 support is required
+TEST_SUITE(BF16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELayerNormalizationLayerFixture<bfloat16>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallLayerNormShapes,
+                               ResidualDataset,
+                               make("HasGamma", { true }),
+                               make("HasBeta", { true }),
+                               TypeDataset,
+                               make("Epsilon", { 1e-5f }),
+                               make("DataType", DataType::BFLOAT16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_bf16);
+    if(_has_add_output)
+    {
+        validate(Accessor(_target_add_output), _reference_add_output);
+    }
+}
+TEST_SUITE_END() // BF16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // LayerNormalizationLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // __aarch64__
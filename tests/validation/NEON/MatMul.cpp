@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,8 +31,13 @@
 #include "tests/framework/Macros.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/validation/fixtures/MatMulFixture.h"
+#include "tests/validation/reference/MatMulQsi4.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
+#include <cstring>
+#include <random>
+
 namespace arm_compute
 {
 namespace test
@@ -41,6 +46,73 @@ namespace validation
 {
 using framework::dataset::make;
 
+#ifdef __aarch64__
+namespace
+{
+/** Run @ref NEMatMul with 4-bit transposed rhs and compare it against a reference that quantizes the lhs rows the same way as the kernel run on this CPU
+ *
+ * @param[in] m         Number of rows of lhs
+ * @param[in] n         Number of output channels
+ * @param[in] k         Number of values of each row of lhs
+ * @param[in] block_len Number of values of K sharing a scale of rhs, 0 for per channel rhs
+ * @param[in] act_info  Fused activation
+ */
+void validate_matmul_qsi4(unsigned int m, unsigned int n, unsigned int k, unsigned int block_len, const ActivationLayerInfo &act_info)
+{
+    const unsigned int num_blocks = block_len == 0 ? 1 : k / block_len;
+    const DataType     rhs_dt     = block_len == 0 ? DataType::QSYMM4_PER_CHANNEL : DataType::QSYMM4_PER_BLOCK;
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> float_dist(-1.f, 1.f);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 0.05f);
+    std::uniform_int_distribution<int>    rhs_dist(-8, 7);
+
+    SimpleTensor<float> lhs_ref{ TensorShape(k, m), DataType::F32 };
+    std::vector<float>  scales(n * num_blocks);
+    std::vector<int>    rhs_values(n * k);
+    std::generate(lhs_ref.data(), lhs_ref.data() + lhs_ref.num_elements(), [&]() { return float_dist(gen); });
+    std::generate(scales.begin(), scales.end(), [&]() { return scale_dist(gen); });
+    std::generate(rhs_values.begin(), rhs_values.end(), [&]() { return rhs_dist(gen); });
+
+    Tensor lhs = create_tensor<Tensor>(TensorShape(k, m), DataType::F32);
+    Tensor rhs = create_tensor<Tensor>(TensorShape((k + 1) / 2, n), rhs_dt, 1, QuantizationInfo(scales));
+    Tensor dst = create_tensor<Tensor>(TensorShape(n, m), DataType::F32);
+    lhs.info()->set_are_values_constant(false);
+
+    NEMatMul matmul;
+    matmul.configure(&lhs, &rhs, &dst, MatMulInfo().adj_rhs(true), CpuMatMulSettings(), act_info);
+
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // Two values per byte, the even one in the low nibble
+    const unsigned int   rhs_row = (k + 1) / 2;
+    std::vector<uint8_t> rhs_bytes(n * rhs_row, 0);
+    for(unsigned int c = 0; c < n; ++c)
+    {
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            rhs_bytes[c * rhs_row + i / 2] |= (static_cast<uint8_t>(rhs_values[c * k + i]) & 0xF) << ((i % 2) * 4);
+        }
+    }
+    std::memcpy(lhs.buffer(), lhs_ref.data(), lhs_ref.num_elements() * sizeof(float));
+    std::memcpy(rhs.buffer(), rhs_bytes.data(), rhs_bytes.size());
+
+    // The second run reuses the weights packed by the first one
+    matmul.run();
+    matmul.run();
+
+    SimpleTensor<float> expected = reference::matmul_qsi4(lhs_ref, rhs_values, scales, {}, TensorShape(n, m), block_len, CPUInfo::get().has_dotprod());
+    if(act_info.enabled())
+    {
+        expected = reference::activation_layer(expected, act_info);
+    }
+    validate(Accessor(dst), expected, RelativeTolerance<float>(1e-4f), 0.f, 1e-4f);
+}
+} // namespace
+#endif // __aarch64__
+
 TEST_SUITE(NEON)
 TEST_SUITE(MatMul)
 
@@ -537,6 +609,25 @@ make("OutQInfo", {QuantizationInfo(1.f, 1)})))
 
 TEST_SUITE_END() // QASYMM8_SIGNED
 
+TEST_SUITE(QSYMM4)
+
+TEST_CASE(RunPerChannel, framework::DatasetMode::PRECOMMIT)
+{
+    validate_matmul_qsi4(5U, 19U, 37U, 0U, ActivationLayerInfo());
+    validate_matmul_qsi4(1U, 9U, 64U, 0U, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    validate_matmul_qsi4(20U, 8U, 128U, 0U, ActivationLayerInfo());
+}
+
+TEST_CASE(RunPerBlock, framework::DatasetMode::PRECOMMIT)
+{
+    validate_matmul_qsi4(3U, 17U, 128U, 32U, ActivationLayerInfo());
+    validate_matmul_qsi4(1U, 21U, 256U, 128U, ActivationLayerInfo());
+    validate_matmul_qsi4(9U, 8U, 128U, 64U,
+                         ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f));
+}
+
+TEST_SUITE_END() // QSYMM4
+
 TEST_SUITE_END() // Quantized
 #endif           // __aarch64__
 
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/BranchExecutor.h"
+
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Events of the tasks of a run */
+struct TaskEvents
+{
+    std::mutex              mutex{};
+    std::condition_variable cv{};
+    std::vector<int>        started{};
+    std::vector<int>        completed{};
+    unsigned int            num_waiting{ 0 };
+};
+
+/** Function recording its start and completion, and optionally waiting for other functions to start first */
+class RecordFunction final : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] events      Events of the run
+     * @param[in] id          Identifier of the function
+     * @param[in] num_waiting (Optional) Number of functions, including this one, to wait for before completing
+     * @param[in] fail        (Optional) Throw instead of completing
+     */
+    RecordFunction(TaskEvents &events, int id, unsigned int num_waiting = 0, bool fail = false)
+        : _events(events), _id(id), _num_waiting(num_waiting), _fail(fail)
+    {
+    }
+
+    void run() override
+    {
+        std::unique_lock<std::mutex> lock(_events.mutex);
+        _events.started.push_back(_id);
+        if(_num_waiting > 0)
+        {
+            // The wait only succeeds if the functions run concurrently
+            ++_events.num_waiting;
+            _events.cv.notify_all();
+            _events.cv.wait_for(lock, std::chrono::seconds(10), [&] { return _events.num_waiting >= _num_waiting; });
+        }
+        if(_fail)
+        {
+            throw std::runtime_error("Task failure");
+        }
+        _events.completed.push_back(_id);
+    }
+
+private:
+    TaskEvents  &_events;
+    int          _id;
+    unsigned int _num_waiting;
+    bool         _fail;
+};
+
+/** Returns the position of an identifier in a list of events, -1 if missing */
+int event_position(const std::vector<int> &events, int id)
+{
+    const auto it = std::find(events.begin(), events.end(), id);
+    return (it == events.end()) ? -1 : static_cast<int>(std::distance(events.begin(), it));
+}
+
+/** Build Input -> Convolution -> (Convolution -> ReLU | Convolution -> Convolution) -> Concatenate -> Fully connected
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[out]     outputs List the output of every inference is appended to
+ */
+void build_branches(graph::frontend::Stream &stream, std::vector<std::vector<float>> &outputs)
+{
+    using namespace arm_compute::graph;
+    using namespace arm_compute::graph::frontend;
+
+    const TensorDescriptor desc(TensorShape(8U, 8U, 3U, 1U), DataType::F32);
+
+    stream << Target::NEON
+           << InputLayer(desc, std::make_unique<helper::CoordinateFillAccessor>())
+           << ConvolutionLayer(1U, 1U, 8U, std::make_unique<helper::CoordinateFillAccessor>(1U, 1U),
+                               std::make_unique<helper::CoordinateFillAccessor>(1U, 2U), PadStrideInfo(1, 1, 0, 0));
+
+    SubStream branch_a(stream);
+    branch_a << ConvolutionLayer(3U, 3U, 4U, std::make_unique<helper::CoordinateFillAccessor>(1U, 3U),
+                                 std::make_unique<helper::CoordinateFillAccessor>(1U, 4U), PadStrideInfo(1, 1, 1, 1))
+             << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    SubStream branch_b(stream);
+    branch_b << ConvolutionLayer(1U, 1U, 4U, std::make_unique<helper::CoordinateFillAccessor>(1U, 5U),
+                                 std::make_unique<helper::CoordinateFillAccessor>(1U, 6U), PadStrideInfo(1, 1, 0, 0))
+             << ConvolutionLayer(3U, 3U, 4U, std::make_unique<helper::CoordinateFillAccessor>(1U, 7U),
+                                 std::make_unique<helper::CoordinateFillAccessor>(1U, 8U), PadStrideInfo(1, 1, 1, 1));
+
+    stream << ConcatLayer(std::move(branch_a), std::move(branch_b))
+           << FullyConnectedLayer(5U, std::make_unique<helper::CoordinateFillAccessor>(1U, 9U),
+                                  std::make_unique<helper::CoordinateFillAccessor>(1U, 10U))
+           << OutputLayer(std::make_unique<helper::CaptureAccessor>(outputs));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(BranchExecutor)
+
+TEST_CASE(TaskDependencies, framework::DatasetMode::ALL)
+{
+    using namespace arm_compute::graph;
+
+    // Input -> act0 -> (act1 | act2 -> act3) -> Concatenate -> act4 -> Output, the concatenation has no task
+    Graph                     g;
+    const NodeParams          params{ "", Target::NEON };
+    const TensorDescriptor    desc(TensorShape(4U, 4U, 2U), DataType::F32);
+    const ActivationLayerInfo relu(ActivationLayerInfo::ActivationFunction::RELU);
+
+    const NodeID input  = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID act0   = GraphBuilder::add_activation_node(g, params, { input, 0 }, relu);
+    const NodeID act1   = GraphBuilder::add_activation_node(g, params, { act0, 0 }, relu);
+    const NodeID act2   = GraphBuilder::add_activation_node(g, params, { act0, 0 }, relu);
+    const NodeID act3   = GraphBuilder::add_activation_node(g, params, { act2, 0 }, relu);
+    const NodeID concat = GraphBuilder::add_concatenate_node(
+        g, params, { { act1, 0 }, { act3, 0 } }, descriptors::ConcatLayerDescriptor(DataLayoutDimension::CHANNEL));
+    const NodeID act4   = GraphBuilder::add_activation_node(g, params, { concat, 0 }, relu);
+    GraphBuilder::add_output_node(g, params, { act4, 0 });
+
+    ExecutionWorkload workload;
+    workload.graph = &g;
+
+    const std::vector<NodeID> node_order = dfs(g);
+    std::vector<int>          node_task(g.nodes().size(), -1);
+    for(auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        node->set_assigned_target(Target::NEON);
+        if(node->type() == NodeType::ActivationLayer)
+        {
+            node_task[node_id] = workload.tasks.size();
+            workload.tasks.emplace_back(nullptr, node);
+        }
+    }
+
+    // A single branch keeps the sequential execution
+    graph::detail::configure_task_dependencies(workload, node_order, 1U);
+    ARM_COMPUTE_EXPECT(workload.dependents.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.branch_executor == nullptr, framework::LogLevel::ERRORS);
+
+    graph::detail::configure_task_dependencies(workload, node_order, 2U);
+    ARM_COMPUTE_ASSERT(workload.dependents.size() == workload.tasks.size());
+    ARM_COMPUTE_EXPECT(workload.branch_executor != nullptr, framework::LogLevel::ERRORS);
+
+    const auto dependents_of = [&](NodeID node_id)
+    {
+        std::vector<NodeID> nodes;
+        for(auto &task_idx : workload.dependents[node_task[node_id]])
+        {
+            nodes.push_back(workload.tasks[task_idx].node->id());
+        }
+        std::sort(nodes.begin(), nodes.end());
+        return nodes;
+    };
+    ARM_COMPUTE_EXPECT((dependents_of(act0) == std::vector<NodeID>{ act1, act2 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((dependents_of(act1) == std::vector<NodeID>{ act4 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((dependents_of(act2) == std::vector<NodeID>{ act3 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((dependents_of(act3) == std::vector<NodeID>{ act4 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dependents_of(act4).empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ChainIsSequential, framework::DatasetMode::ALL)
+{
+    using namespace arm_compute::graph;
+
+    Graph                     g;
+    const NodeParams          params{ "", Target::NEON };
+    const ActivationLayerInfo relu(ActivationLayerInfo::ActivationFunction::RELU);
+
+    const NodeID input = GraphBuilder::add_input_node(g, params, TensorDescriptor(TensorShape(4U, 4U), DataType::F32));
+    const NodeID act0  = GraphBuilder::add_activation_node(g, params, { input, 0 }, relu);
+    const NodeID act1  = GraphBuilder::add_activation_node(g, params, { act0, 0 }, relu);
+    GraphBuilder::add_output_node(g, params, { act1, 0 });
+
+    ExecutionWorkload workload;
+    workload.graph = &g;
+
+    const std::vector<NodeID> node_order = dfs(g);
+    for(auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        node->set_assigned_target(Target::NEON);
+        if(node->type() == NodeType::ActivationLayer)
+        {
+            workload.tasks.emplace_back(nullptr, node);
+        }
+    }
+
+    graph::detail::configure_task_dependencies(workload, node_order, 2U);
+    ARM_COMPUTE_EXPECT(workload.dependents.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.branch_executor == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunIndependentTasksConcurrently, framework::DatasetMode::ALL)
+{
+    // 0 -> (1 | 2) -> 3, the tasks 1 and 2 only complete once both have started
+    TaskEvents                        events;
+    std::vector<graph::ExecutionTask> tasks;
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 0), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 1, 2U), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 2, 2U), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 3), nullptr);
+    const std::vector<std::vector<unsigned int>> dependents{ { 1U, 2U }, { 3U }, { 3U }, {} };
+
+    graph::detail::BranchExecutor executor(2U, 2U);
+    executor.run(tasks, dependents);
+
+    ARM_COMPUTE_ASSERT(events.completed.size() == tasks.size());
+    ARM_COMPUTE_EXPECT(events.num_waiting == 2U, framework::LogLevel::ERRORS);
+    for(unsigned int task = 0; task < dependents.size(); ++task)
+    {
+        for(auto &dependent : dependents[task])
+        {
+            ARM_COMPUTE_EXPECT(event_position(events.completed, task) < event_position(events.started, dependent),
+                               framework::LogLevel::ERRORS);
+        }
+    }
+    // The branches started before either of them completed
+    ARM_COMPUTE_EXPECT(event_position(events.started, 2) < event_position(events.completed, 1),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(event_position(events.started, 1) < event_position(events.completed, 2),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(StopOnFailure, framework::DatasetMode::ALL)
+{
+    // 0 -> (1 | 2) -> 3, the task 1 fails
+    TaskEvents                        events;
+    std::vector<graph::ExecutionTask> tasks;
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 0), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 1, 0U, true), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 2), nullptr);
+    tasks.emplace_back(std::make_unique<RecordFunction>(events, 3), nullptr);
+    const std::vector<std::vector<unsigned int>> dependents{ { 1U, 2U }, { 3U }, { 3U }, {} };
+
+    graph::detail::BranchExecutor executor(2U, 2U);
+    ARM_COMPUTE_EXPECT_THROW(executor.run(tasks, dependents), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(event_position(events.started, 3) == -1, framework::LogLevel::ERRORS);
+
+    // The executor can run the tasks again once they succeed
+    events.started.clear();
+    events.completed.clear();
+    tasks[1] = graph::ExecutionTask(std::make_unique<RecordFunction>(events, 1), nullptr);
+    executor.run(tasks, dependents);
+    ARM_COMPUTE_EXPECT(events.completed.size() == tasks.size(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(MatchSequentialExecution, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    constexpr unsigned int num_runs = 3;
+
+    std::vector<std::vector<float>> expected;
+    graph::frontend::Stream         sequential_stream(0, "sequential_branches");
+    build_branches(sequential_stream, expected);
+    sequential_stream.finalize(graph::Target::NEON, graph::GraphConfig{});
+
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(1, "concurrent_branches");
+    build_branches(stream, outputs);
+    graph::GraphConfig config{};
+    config.num_parallel_branches = 2;
+    stream.finalize(graph::Target::NEON, config);
+
+    for(unsigned int run = 0; run < num_runs; ++run)
+    {
+        sequential_stream.run();
+        stream.run();
+    }
+
+    ARM_COMPUTE_ASSERT(expected.size() == num_runs);
+    ARM_COMPUTE_ASSERT(outputs.size() == num_runs);
+    for(unsigned int run = 0; run < num_runs; ++run)
+    {
+        ARM_COMPUTE_ASSERT(outputs[run].size() == expected[run].size());
+        for(size_t i = 0; i < expected[run].size(); ++i)
+        {
+            const float tolerance = 1e-4f * std::max(1.f, std::abs(expected[run][i]));
+            ARM_COMPUTE_EXPECT(std::abs(outputs[run][i] - expected[run][i]) <= tolerance, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE_END() // BranchExecutor
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
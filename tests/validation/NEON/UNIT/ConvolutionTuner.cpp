@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPConvolutionTuner.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.0001f); /**< Absolute tolerance for the values close to zero */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ConvolutionTuner)
+
+TEST_CASE(AddMethod, framework::DatasetMode::ALL)
+{
+    CPPConvolutionTuner tuner(false);
+    ConvolutionMethod   method{};
+
+    ARM_COMPUTE_EXPECT(!tuner.find_method("conv", method), framework::LogLevel::ERRORS);
+    tuner.add_method("conv", ConvolutionMethod::WINOGRAD);
+    ARM_COMPUTE_EXPECT(tuner.find_method("conv", method), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(method == ConvolutionMethod::WINOGRAD, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TuneNewConvolution, framework::DatasetMode::ALL)
+{
+    const TensorShape   src_shape(13U, 11U, 16U);
+    const TensorShape   weights_shape(3U, 3U, 16U, 8U);
+    const TensorShape   bias_shape(8U);
+    const TensorShape   dst_shape(13U, 11U, 8U);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    CPPConvolutionTuner tuner;
+    CPPRuntimeContext   runtime_ctx;
+    runtime_ctx.set_convolution_tuner(&tuner);
+    CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+
+    // The convolution is tuned, with its bias, while being configured
+    Tensor             src     = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor             weights = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor             bias    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor             dst     = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+    // Validating the convolution or querying its method doesn't benchmark it
+    ARM_COMPUTE_EXPECT(bool(NEConvolutionLayer::validate(src.info(), weights.info(), bias.info(), dst.info(), conv_info)),
+                       framework::LogLevel::ERRORS);
+    NEConvolutionLayer::get_convolution_method(src.info(), weights.info(), dst.info(), conv_info);
+    ARM_COMPUTE_EXPECT(tuner.method_table().empty(), framework::LogLevel::ERRORS);
+
+    NEConvolutionLayer conv;
+    conv.configure(&src, &weights, &bias, &dst, conv_info);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+
+    // Identical convolutions use the method of the table, even if the heuristics would pick another one
+    tuner.set_tune_new_convolutions(false);
+    tuner.add_method(tuner.method_table().begin()->first, ConvolutionMethod::GEMM);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(src.info(), weights.info(), dst.info(), conv_info) ==
+                           ConvolutionMethod::GEMM,
+                       framework::LogLevel::ERRORS);
+
+    Tensor             src2     = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor             weights2 = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor             bias2    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor             dst2     = create_tensor<Tensor>(dst_shape, DataType::F32);
+    NEConvolutionLayer conv2;
+    conv2.configure(&src2, &weights2, &bias2, &dst2, conv_info);
+    ARM_COMPUTE_EXPECT(tuner.method_table().size() == 1, framework::LogLevel::ERRORS);
+    runtime_ctx.set_convolution_tuner(nullptr);
+
+    src2.allocator()->allocate();
+    weights2.allocator()->allocate();
+    bias2.allocator()->allocate();
+    dst2.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    library->fill(Accessor(src2), distribution, 0);
+    library->fill(Accessor(weights2), distribution, 1);
+    library->fill(Accessor(bias2), distribution, 2);
+    conv2.run();
+
+    SimpleTensor<float> src_ref{ src_shape, DataType::F32 };
+    SimpleTensor<float> weights_ref{ weights_shape, DataType::F32 };
+    SimpleTensor<float> bias_ref{ bias_shape, DataType::F32 };
+    library->fill(src_ref, distribution, 0);
+    library->fill(weights_ref, distribution, 1);
+    library->fill(bias_ref, distribution, 2);
+
+    validate(Accessor(dst2), reference::convolution_layer<float>(src_ref, weights_ref, bias_ref, dst_shape, conv_info),
+             tolerance_f32, 0.f, abs_tolerance_f32);
+}
+
+TEST_SUITE_END() // ConvolutionTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int max_batch_size = 4; /**< Batch the streams are built with */
+
+/** Build Convolution -> ReLU -> Fully connected on a batch of samples
+ *
+ * @param[in, out] stream     Stream to build the graph in
+ * @param[out]     outputs    List the output of every inference is appended to
+ * @param[in]      batch_size (Optional) Batch of the input
+ */
+void build_conv_fc(graph::frontend::Stream &stream, std::vector<std::vector<float>> &outputs,
+                   unsigned int batch_size = max_batch_size)
+{
+    using namespace arm_compute::graph;
+    using namespace arm_compute::graph::frontend;
+
+    const TensorDescriptor desc(TensorShape(8U, 8U, 3U, batch_size), DataType::F32);
+
+    stream << Target::NEON
+           << InputLayer(desc, std::make_unique<helper::CoordinateFillAccessor>())
+           << ConvolutionLayer(3U, 3U, 4U, std::make_unique<helper::CoordinateFillAccessor>(1U, 1U),
+                               std::make_unique<helper::CoordinateFillAccessor>(1U, 2U), PadStrideInfo(1, 1, 1, 1))
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << FullyConnectedLayer(5U, std::make_unique<helper::CoordinateFillAccessor>(1U, 3U),
+                                  std::make_unique<helper::CoordinateFillAccessor>(1U, 4U))
+           << OutputLayer(std::make_unique<helper::CaptureAccessor>(outputs));
+}
+
+/** Check that an output matches the first samples of the output of the whole batch */
+void validate_samples(const std::vector<float> &output, const std::vector<float> &expected, unsigned int batch_size)
+{
+    ARM_COMPUTE_EXPECT(output.size() == expected.size() / max_batch_size * batch_size, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(output.size(), expected.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(output[i] - expected[i]) <= 1e-4f * std::max(1.f, std::abs(expected[i])),
+                           framework::LogLevel::ERRORS);
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(DynamicBatchExecutor)
+
+TEST_CASE(RunBatchesBelowMaximum, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    // Output of the whole batch without lowering
+    std::vector<std::vector<float>> expected;
+    graph::frontend::Stream         full_stream(0, "full_batch");
+    build_conv_fc(full_stream, expected);
+    full_stream.finalize(graph::Target::NEON, graph::GraphConfig{});
+    full_stream.run();
+    ARM_COMPUTE_ASSERT(expected.size() == 1);
+
+    // Chunks of 2 samples, the batch of 3 runs a partial last chunk
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(1, "dynamic_batch");
+    build_conv_fc(stream, outputs);
+    graph::GraphConfig config{};
+    config.batch_chunk_size = 2;
+    stream.finalize(graph::Target::NEON, config);
+
+    for(unsigned int batch_size : { 1U, 3U, max_batch_size })
+    {
+        outputs.clear();
+        stream.set_batch_size(batch_size);
+        stream.run();
+        ARM_COMPUTE_ASSERT(outputs.size() == 1);
+        validate_samples(outputs[0], expected[0], batch_size);
+    }
+}
+
+TEST_CASE(RejectBatchOfOne, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(0, "single_sample");
+    build_conv_fc(stream, outputs, 1U);
+    graph::GraphConfig config{};
+    config.batch_chunk_size = 1;
+    ARM_COMPUTE_EXPECT_THROW(stream.finalize(graph::Target::NEON, config), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DynamicBatchExecutor
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPGemmTuner.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GemmTuner)
+
+TEST_CASE(AddKernel, framework::DatasetMode::ALL)
+{
+    CPPGemmTuner tuner(false);
+    std::string  kernel_name;
+
+    ARM_COMPUTE_EXPECT(!tuner.find_kernel("gemm", kernel_name), framework::LogLevel::ERRORS);
+    tuner.add_kernel("gemm", "kernel");
+    ARM_COMPUTE_EXPECT(tuner.find_kernel("gemm", kernel_name), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel_name == "kernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.kernel_table().size() == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TuneNewGemm, framework::DatasetMode::ALL)
+{
+    const TensorShape a_shape(37U, 23U);
+    const TensorShape b_shape(41U, 37U);
+    const TensorShape d_shape(41U, 23U);
+
+    CPPGemmTuner      tuner;
+    CPPRuntimeContext runtime_ctx;
+    runtime_ctx.set_gemm_tuner(&tuner);
+    CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+
+    // The GEMM is tuned while being configured
+    Tensor a = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d = create_tensor<Tensor>(d_shape, DataType::F32);
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+    ARM_COMPUTE_EXPECT(tuner.kernel_table().size() == 1, framework::LogLevel::ERRORS);
+
+    // Identical GEMMs reuse the tuned kernel
+    tuner.set_tune_new_gemms(false);
+    Tensor a2 = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b2 = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d2 = create_tensor<Tensor>(d_shape, DataType::F32);
+    NEGEMM gemm2;
+    gemm2.configure(&a2, &b2, nullptr, &d2, 1.f, 0.f);
+    ARM_COMPUTE_EXPECT(tuner.kernel_table().size() == 1, framework::LogLevel::ERRORS);
+    runtime_ctx.set_gemm_tuner(nullptr);
+
+    a2.allocator()->allocate();
+    b2.allocator()->allocate();
+    d2.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    library->fill(Accessor(a2), distribution, 0);
+    library->fill(Accessor(b2), distribution, 1);
+    gemm2.run();
+
+    SimpleTensor<float> a_ref{ a_shape, DataType::F32 };
+    SimpleTensor<float> b_ref{ b_shape, DataType::F32 };
+    SimpleTensor<float> c_ref{ d_shape, DataType::F32 };
+    library->fill(a_ref, distribution, 0);
+    library->fill(b_ref, distribution, 1);
+    library->fill_tensor_value(c_ref, 0.f);
+
+    validate(Accessor(d2), reference::gemm<float>(a_ref, b_ref, c_ref, 1.f, 0.f), tolerance_f32);
+}
+
+TEST_SUITE_END() // GemmTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
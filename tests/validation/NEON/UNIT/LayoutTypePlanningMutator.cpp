@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/LayoutTypePlanningMutator.h"
+
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Shape of the NCHW input, large enough for the NHWC convolutions to pay for the permutations */
+const TensorShape input_shape(16U, 16U, 8U, 1U);
+
+/** Build Input -> (Convolution | Convolution) -> Add -> Output in NCHW
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[out]     outputs List the output of every inference is appended to
+ */
+void build_mixed_branches(graph::frontend::Stream &stream, std::vector<std::vector<float>> &outputs)
+{
+    using namespace arm_compute::graph;
+    using namespace arm_compute::graph::frontend;
+
+    stream << Target::NEON
+           << InputLayer(TensorDescriptor(input_shape, DataType::F32),
+                         std::make_unique<helper::CoordinateFillAccessor>());
+
+    SubStream branch_a(stream);
+    branch_a << ConvolutionLayer(3U, 3U, 16U, std::make_unique<helper::CoordinateFillAccessor>(1U, 1U),
+                                 std::make_unique<helper::CoordinateFillAccessor>(1U, 2U), PadStrideInfo(1, 1, 1, 1));
+
+    SubStream branch_b(stream);
+    branch_b << ConvolutionLayer(3U, 3U, 16U, std::make_unique<helper::CoordinateFillAccessor>(1U, 3U),
+                                 std::make_unique<helper::CoordinateFillAccessor>(1U, 4U), PadStrideInfo(1, 1, 1, 1));
+
+    stream << EltwiseLayer(std::move(branch_a), std::move(branch_b), EltwiseOperation::Add)
+           << OutputLayer(std::make_unique<helper::CaptureAccessor>(outputs));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(LayoutTypePlanningMutator)
+
+TEST_CASE(ShareConversions, framework::DatasetMode::ALL)
+{
+    using namespace arm_compute::graph;
+
+    Graph               g;
+    const NodeParams    params{ "", Target::NEON };
+
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    const NodeID input  = GraphBuilder::add_input_node(g, params, TensorDescriptor(input_shape, DataType::F32));
+    const NodeID conv_a = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 16U, conv_info);
+    const NodeID conv_b = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 16U, conv_info);
+    const NodeID add    = GraphBuilder::add_elementwise_node(g, params, { conv_a, 0 }, { conv_b, 0 },
+                                                             EltwiseOperation::Add);
+    const NodeID output = GraphBuilder::add_output_node(g, params, { add, 0 });
+
+    LayoutTypePlanningMutator mutator(Target::NEON, true, false);
+    mutator.mutate(g);
+
+    // The convolutions and the addition run in NHWC
+    for(auto node_id : { conv_a, conv_b, add })
+    {
+        ARM_COMPUTE_EXPECT(g.node(node_id)->output(0)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+    }
+
+    // A single permutation of the input feeds both convolutions, another one converts the result back to NCHW
+    ARM_COMPUTE_EXPECT(helper::count_nodes(g, NodeType::PermuteLayer) == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(g.node(input)->output_edges().size() == 1);
+    const INode *to_nhwc = g.edge(*g.node(input)->output_edges().begin())->consumer();
+    ARM_COMPUTE_ASSERT(to_nhwc->type() == NodeType::PermuteLayer);
+    ARM_COMPUTE_EXPECT(to_nhwc->output_edges().size() == 2, framework::LogLevel::ERRORS);
+    for(auto &edge_id : to_nhwc->output_edges())
+    {
+        const NodeID consumer = g.edge(edge_id)->consumer_id();
+        ARM_COMPUTE_EXPECT(consumer == conv_a || consumer == conv_b, framework::LogLevel::ERRORS);
+    }
+
+    // The graph output keeps its layout
+    const INode *to_nchw = g.node(output)->input_edge(0)->producer();
+    ARM_COMPUTE_EXPECT(to_nchw->type() == NodeType::PermuteLayer, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(output)->input(0)->desc().layout == DataLayout::NCHW, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(MatchUnplannedGraph, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    std::vector<std::vector<float>> expected;
+    graph::frontend::Stream         unplanned_stream(0, "unplanned");
+    build_mixed_branches(unplanned_stream, expected);
+    unplanned_stream.finalize(graph::Target::NEON, graph::GraphConfig{});
+    unplanned_stream.run();
+
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(1, "planned");
+    build_mixed_branches(stream, outputs);
+    graph::GraphConfig config{};
+    config.plan_data_layout = true;
+    stream.finalize(graph::Target::NEON, config);
+    stream.run();
+
+    // The planned graph converts the layout of its input and output
+    ARM_COMPUTE_EXPECT(helper::count_nodes(stream.graph(), graph::NodeType::PermuteLayer) == 2,
+                       framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_ASSERT(expected.size() == 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == 1);
+    ARM_COMPUTE_ASSERT(outputs[0].size() == expected[0].size());
+
+    // The convolutions may run with a different method in each layout
+    for(size_t i = 0; i < expected[0].size(); ++i)
+    {
+        const float tolerance = 1e-3f * std::max(1.f, std::abs(expected[0][i]));
+        ARM_COMPUTE_EXPECT(std::abs(outputs[0][i] - expected[0][i]) <= tolerance, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // LayoutTypePlanningMutator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
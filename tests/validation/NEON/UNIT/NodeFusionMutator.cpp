@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/NodeFusionMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/Utils.h"
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Build the chain Add -> ReLU -> Mul of three inputs */
+void build_elementwise_chain(graph::Graph &g, DataType data_type)
+{
+    using namespace arm_compute::graph;
+
+    const NodeParams       params{ "", Target::NEON };
+    const TensorDescriptor desc(TensorShape(16U, 4U), data_type);
+
+    const NodeID in0 = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID in1 = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID in2 = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID add = GraphBuilder::add_elementwise_node(g, params, { in0, 0 }, { in1, 0 }, EltwiseOperation::Add);
+    const NodeID act = GraphBuilder::add_activation_node(g, params, { add, 0 },
+                                                         ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID mul = GraphBuilder::add_elementwise_node(g, params, { act, 0 }, { in2, 0 }, EltwiseOperation::Mul);
+    GraphBuilder::add_output_node(g, params, { mul, 0 });
+    force_target_to_graph(g, Target::NEON);
+}
+
+/** Add a convolution followed by a batch normalization and optionally a ReLU
+ *
+ * @return The ID of the last node added
+ */
+graph::NodeID add_conv_bn(graph::Graph &g, graph::NodeID input, unsigned int kernel_size, unsigned int depth, bool relu)
+{
+    using namespace arm_compute::graph;
+
+    const NodeParams params{ "", Target::NEON };
+    const unsigned int pad  = kernel_size / 2;
+    NodeID             conv = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(kernel_size, kernel_size), depth,
+                                                                 PadStrideInfo(1, 1, pad, pad));
+    NodeID last = GraphBuilder::add_batch_normalization_node(g, params, { conv, 0 }, 0.001f);
+    if(relu)
+    {
+        last = GraphBuilder::add_activation_node(g, params, { last, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    }
+    return last;
+}
+
+/** Build a ResNet bottleneck block: x + (conv1x1 -> conv3x3 -> conv1x1)(x) -> ReLU, where x is the output of a stem convolution
+ *
+ * @param[in,out] g               Graph to build the block into
+ * @param[in]     read_x_after_it Also read x from an output node, which runs after the block
+ */
+void build_residual_block(graph::Graph &g, bool read_x_after_it)
+{
+    using namespace arm_compute::graph;
+
+    const NodeParams       params{ "", Target::NEON };
+    const TensorDescriptor desc(TensorShape(8U, 4U, 4U), DataType::F32, QuantizationInfo(), DataLayout::NHWC);
+
+    const NodeID input  = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID x      = add_conv_bn(g, input, 1U, 8U, true);
+    NodeID       branch = add_conv_bn(g, x, 1U, 4U, true);
+    branch              = add_conv_bn(g, branch, 3U, 4U, true);
+    branch              = add_conv_bn(g, branch, 1U, 8U, false);
+    const NodeID add    = GraphBuilder::add_elementwise_node(g, params, { branch, 0 }, { x, 0 }, EltwiseOperation::Add);
+    const NodeID act    = GraphBuilder::add_activation_node(g, params, { add, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    GraphBuilder::add_output_node(g, params, { act, 0 });
+    if(read_x_after_it)
+    {
+        GraphBuilder::add_output_node(g, params, { x, 0 });
+    }
+    force_target_to_graph(g, Target::NEON);
+}
+
+/** Find the fused convolution batch normalization node accumulating a residual, if any */
+const graph::FusedConvolutionBatchNormalizationNode *find_residual_convolution(graph::Graph &g)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == graph::NodeType::FusedConvolutionBatchNormalizationLayer)
+        {
+            const auto *conv = arm_compute::utils::cast::polymorphic_downcast<graph::FusedConvolutionBatchNormalizationNode *>(node.get());
+            if(conv->has_residual_input())
+            {
+                return conv;
+            }
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(NodeFusionMutator)
+
+using helper::count_nodes;
+
+TEST_CASE(FuseF32ElementwiseChain, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    graph::Graph g(0, "chain");
+    build_elementwise_chain(g, DataType::F32);
+    graph::NodeFusionMutator().mutate(g);
+
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::EltwiseLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FuseF16ElementwiseChainOnRequest, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    // The fused chain computes in F32 and rounds once, so F16 chains keep their nodes by default
+    graph::Graph g(0, "chain");
+    build_elementwise_chain(g, DataType::F16);
+    graph::NodeFusionMutator().mutate(g);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::FusedElementwiseLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::EltwiseLayer) == 2, framework::LogLevel::ERRORS);
+
+    graph::Graph g_fused(1, "chain");
+    build_elementwise_chain(g_fused, DataType::F16);
+    graph::NodeFusionMutator(true /* fuse_f16_elementwise_chains */).mutate(g_fused);
+    ARM_COMPUTE_EXPECT(count_nodes(g_fused, graph::NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g_fused, graph::NodeType::EltwiseLayer) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FuseResidualAdditionIntoConvolution, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    // x is also read by the first convolution of the block, which runs before the residual is overwritten
+    graph::Graph g(0, "residual");
+    build_residual_block(g, false);
+    graph::NodeFusionMutator().mutate(g);
+
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::EltwiseLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::ActivationLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::FusedConvolutionBatchNormalizationLayer) == 4, framework::LogLevel::ERRORS);
+
+    const auto *conv = find_residual_convolution(g);
+    ARM_COMPUTE_EXPECT(conv != nullptr, framework::LogLevel::ERRORS);
+    if(conv != nullptr)
+    {
+        const auto residual_idx = graph::FusedConvolutionBatchNormalizationNode::residual_input_idx;
+        ARM_COMPUTE_EXPECT(conv->fused_activation().activation() == ActivationLayerInfo::ActivationFunction::RELU, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(conv->input(residual_idx) == conv->output(0), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(KeepResidualAdditionReadLater, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    // x is read after the block, so the convolution can't accumulate into it and the addition is left to the
+    // element-wise chain fusion
+    graph::Graph g(0, "residual");
+    build_residual_block(g, true);
+    graph::NodeFusionMutator().mutate(g);
+
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::FusedElementwiseLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_residual_convolution(g) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // NodeFusionMutator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr unsigned int num_inferences = 5; /**< Inferences streamed per run */
+
+/** Build Convolution -> ReLU -> Convolution -> ReLU -> Fully connected, filled with a new input for every inference
+ *
+ * @param[in, out] stream  Stream to build the graph in
+ * @param[out]     outputs List the output of every inference is appended to
+ */
+void build_conv_chain(graph::frontend::Stream &stream, std::vector<std::vector<float>> &outputs)
+{
+    using namespace arm_compute::graph;
+    using namespace arm_compute::graph::frontend;
+
+    const TensorDescriptor desc(TensorShape(8U, 8U, 3U, 1U), DataType::F32);
+
+    stream << Target::NEON
+           << InputLayer(desc, std::make_unique<helper::CoordinateFillAccessor>(num_inferences))
+           << ConvolutionLayer(3U, 3U, 8U, std::make_unique<helper::CoordinateFillAccessor>(1U, 1U),
+                               std::make_unique<helper::CoordinateFillAccessor>(1U, 2U), PadStrideInfo(1, 1, 1, 1))
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << ConvolutionLayer(3U, 3U, 8U, std::make_unique<helper::CoordinateFillAccessor>(1U, 3U),
+                               std::make_unique<helper::CoordinateFillAccessor>(1U, 4U), PadStrideInfo(1, 1, 1, 1))
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << FullyConnectedLayer(5U, std::make_unique<helper::CoordinateFillAccessor>(1U, 5U),
+                                  std::make_unique<helper::CoordinateFillAccessor>(1U, 6U))
+           << OutputLayer(std::make_unique<helper::CaptureAccessor>(outputs));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(PipelineExecutor)
+
+TEST_CASE(StreamInferencesThroughTwoStages, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    // Outputs of the inferences run one after the other
+    std::vector<std::vector<float>> expected;
+    graph::frontend::Stream         sequential_stream(0, "sequential");
+    build_conv_chain(sequential_stream, expected);
+    sequential_stream.finalize(graph::Target::NEON, graph::GraphConfig{});
+    sequential_stream.run();
+    ARM_COMPUTE_ASSERT(expected.size() == num_inferences);
+
+    std::vector<std::vector<float>> outputs;
+    graph::frontend::Stream         stream(1, "pipelined");
+    build_conv_chain(stream, outputs);
+    graph::GraphConfig config{};
+    config.num_pipeline_stages = 2;
+    stream.finalize(graph::Target::NEON, config);
+
+    // The graph has been split in two stages exchanging their tensors through copies
+    unsigned int num_stages = 0;
+    for(auto &node : stream.graph().nodes())
+    {
+        if(node != nullptr)
+        {
+            num_stages = std::max(num_stages, node->pipeline_stage() + 1);
+        }
+    }
+    ARM_COMPUTE_EXPECT(num_stages == 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(helper::count_nodes(stream.graph(), graph::NodeType::ReshapeLayer) > 0,
+                       framework::LogLevel::ERRORS);
+
+    // Every run streams all the inferences through the stages, in order
+    for(unsigned int run = 0; run < 2; ++run)
+    {
+        outputs.clear();
+        stream.run();
+        ARM_COMPUTE_ASSERT(outputs.size() == num_inferences);
+        for(unsigned int inference = 0; inference < num_inferences; ++inference)
+        {
+            ARM_COMPUTE_ASSERT(outputs[inference].size() == expected[inference].size());
+            for(size_t i = 0; i < expected[inference].size(); ++i)
+            {
+                const float tolerance = 1e-4f * std::max(1.f, std::abs(expected[inference][i]));
+                ARM_COMPUTE_EXPECT(std::abs(outputs[inference][i] - expected[inference][i]) <= tolerance,
+                                   framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
+TEST_SUITE_END() // PipelineExecutor
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(Profiler)
+
+TEST_CASE(RecordKernels, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(64U, 32U);
+
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape, DataType::F32);
+    NEActivationLayer act;
+    act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    library->fill(Accessor(src), distribution, 0);
+
+    CPPProfiler       profiler;
+    CPPRuntimeContext runtime_ctx;
+    runtime_ctx.set_profiler(&profiler);
+    {
+        CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+        act.run();
+    }
+
+    // The kernel reads the source and writes the destination once
+    unsigned int num_kernels = 0;
+    for(const auto &event : profiler.events())
+    {
+        if(std::string(event.category) == "kernel")
+        {
+            ++num_kernels;
+            ARM_COMPUTE_EXPECT(event.bytes == src.info()->total_size() + dst.info()->total_size(),
+                               framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(event.num_threads >= 1 && event.num_threads <= Scheduler::get().num_threads(),
+                               framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(event.duration_us >= 0. && event.utilisation >= 0.f, framework::LogLevel::ERRORS);
+        }
+    }
+    ARM_COMPUTE_EXPECT(num_kernels == 1, framework::LogLevel::ERRORS);
+
+    // No events are recorded once the context is uninstalled
+    const size_t num_events = profiler.events().size();
+    act.run();
+    ARM_COMPUTE_EXPECT(profiler.events().size() == num_events, framework::LogLevel::ERRORS);
+}
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_CASE(RecordOnAnyScheduler, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(64U, 32U);
+
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape, DataType::F32);
+    NEActivationLayer act;
+    act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // The profiler belongs to the context of the thread, not to a scheduler
+    CPPProfiler       profiler;
+    CPPRuntimeContext runtime_ctx;
+    runtime_ctx.set_profiler(&profiler);
+    CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+
+    CPPScheduler thread_scheduler;
+    thread_scheduler.set_num_threads(2);
+    Scheduler::set_thread_scheduler(&thread_scheduler);
+    act.run();
+    Scheduler::set_thread_scheduler(nullptr);
+
+    const auto events = profiler.events();
+    ARM_COMPUTE_EXPECT(std::any_of(events.begin(), events.end(), [](const CPPProfiler::Event &event)
+    {
+        return std::string(event.category) == "kernel" && event.num_threads <= 2;
+    }),
+    framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+
+TEST_CASE(SaveChromeTrace, framework::DatasetMode::ALL)
+{
+    const std::string filename = "test_profiler_trace.json";
+
+    CPPProfiler profiler;
+    const auto  start = CPPProfiler::Clock::now();
+    profiler.add_event("conv\"1\"", "node", start, start + std::chrono::microseconds(10), 1024);
+    ARM_COMPUTE_EXPECT(profiler.events().size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(profiler.save_to_file(filename));
+
+    std::ifstream     fs(filename);
+    const std::string trace((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    ARM_COMPUTE_EXPECT(trace.find("{\"traceEvents\":[") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.find("\"name\":\"conv\\\"1\\\"\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.find("\"ph\":\"X\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.find("\"dur\":10.000") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.find("\"bytes\":1024") != std::string::npos, framework::LogLevel::ERRORS);
+    fs.close();
+
+    profiler.clear();
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(KeepLastEvents, framework::DatasetMode::ALL)
+{
+    CPPProfiler profiler(4);
+    const auto  start = CPPProfiler::Clock::now();
+    for(int i = 0; i < 6; ++i)
+    {
+        // The names are copied by the profiler
+        const std::string name = "event" + std::to_string(i);
+        profiler.add_event(name.c_str(), "workload", start + std::chrono::microseconds(i), start + std::chrono::microseconds(i + 1));
+    }
+
+    // The buffer of the thread keeps the last events
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 4);
+    ARM_COMPUTE_EXPECT(profiler.num_dropped_events() == 2, framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < events.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::string(events[i].name) == "event" + std::to_string(i + 2), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(std::string(events[i].category) == "workload", framework::LogLevel::ERRORS);
+    }
+
+    profiler.clear();
+    ARM_COMPUTE_EXPECT(profiler.events().empty() && profiler.num_dropped_events() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // Profiler
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
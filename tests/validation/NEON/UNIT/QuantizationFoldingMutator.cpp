@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/QuantizationFoldingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const QuantizationInfo conv_quant_info(0.5f, 10);  /**< Quantization of the output of the convolution */
+const QuantizationInfo act_quant_info(0.25f, 5);   /**< Quantization set by the activation on its output */
+const QuantizationInfo quant_quant_info(0.125f, 0); /**< Quantization of the quantization layer */
+
+/** Build the chain Convolution -> ReLU -> Quantization on a QASYMM8 input
+ *
+ * @return The ID of the convolution node
+ */
+graph::NodeID build_conv_relu_quantize(graph::Graph &g, const QuantizationInfo &relu_out_quant_info)
+{
+    using namespace arm_compute::graph;
+
+    const NodeParams       params{ "", Target::NEON };
+    const TensorDescriptor desc(TensorShape(8U, 8U, 4U), DataType::QASYMM8, QuantizationInfo(1.f, 0));
+
+    const NodeID input = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID conv  = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 4U, PadStrideInfo(1, 1, 1, 1), 1,
+                                                            graph::ConvolutionMethod::Default, FastMathHint::Disabled, nullptr, nullptr,
+                                                            QuantizationInfo(1.f, 0), conv_quant_info);
+    const NodeID act = GraphBuilder::add_activation_node(g, params, { conv, 0 },
+                                                         ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                         relu_out_quant_info);
+    const NodeID quant = GraphBuilder::add_quantization_node(g, params, { act, 0 }, quant_quant_info);
+    GraphBuilder::add_output_node(g, params, { quant, 0 });
+    force_target_to_graph(g, Target::NEON);
+    return conv;
+}
+
+/** Build the chain Dequantization -> ReLU -> Quantization on an input of a given type */
+void build_dequantize_relu_quantize(graph::Graph &g, DataType data_type)
+{
+    using namespace arm_compute::graph;
+
+    const NodeParams       params{ "", Target::NEON };
+    const TensorDescriptor desc(TensorShape(8U, 8U, 4U), data_type, QuantizationInfo(0.5f));
+
+    const NodeID input   = GraphBuilder::add_input_node(g, params, desc);
+    const NodeID dequant = GraphBuilder::add_dequantization_node(g, params, { input, 0 });
+    const NodeID act     = GraphBuilder::add_activation_node(g, params, { dequant, 0 },
+                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID quant = GraphBuilder::add_quantization_node(g, params, { act, 0 }, quant_quant_info);
+    GraphBuilder::add_output_node(g, params, { quant, 0 });
+    force_target_to_graph(g, Target::NEON);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(QuantizationFoldingMutator)
+
+using helper::count_nodes;
+
+TEST_CASE(FoldRequantizationIntoConvolution, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    graph::Graph        g(0, "requantization");
+    const graph::NodeID conv = build_conv_relu_quantize(g, QuantizationInfo());
+    graph::QuantizationFoldingMutator().mutate(g);
+
+    // The ReLU keeps the quantization of its input, so the convolution requantizes to the quantization of the layer
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::QuantizationLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(conv)->output(0)->desc().quant_info == quant_quant_info, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(KeepRequantizationAfterActivationOutputQuantization, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    graph::Graph        g(0, "requantization");
+    const graph::NodeID conv = build_conv_relu_quantize(g, act_quant_info);
+    graph::QuantizationFoldingMutator().mutate(g);
+
+    // The ReLU requantizes its output, so the quantization can't be folded across it
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::QuantizationLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(conv)->output(0)->desc().quant_info == conv_quant_info, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FoldAsymmetricRoundTrip, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    graph::Graph g(0, "round_trip");
+    build_dequantize_relu_quantize(g, DataType::QASYMM8);
+    graph::QuantizationFoldingMutator().mutate(g);
+
+    // The ReLU runs on the quantized input, which the quantization requantizes
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::DequantizationLayer) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::QuantizationLayer) == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(KeepSymmetricRoundTrip, framework::DatasetMode::ALL)
+{
+    helper::register_neon_graph_backend();
+
+    graph::Graph g(0, "round_trip");
+    build_dequantize_relu_quantize(g, DataType::QSYMM8);
+    graph::QuantizationFoldingMutator().mutate(g);
+
+    // A QSYMM8 tensor can't be requantized, so the ReLU has to run on the dequantized values
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::DequantizationLayer) == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(count_nodes(g, graph::NodeType::QuantizationLayer) == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // QuantizationFoldingMutator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,8 +36,11 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/reference/ActivationLayer.h"
 
+#include <algorithm>
+#include <fstream>
 #include <memory>
 #include <random>
+#include <vector>
 
 namespace arm_compute
 {
@@ -256,6 +259,49 @@ TEST_CASE(ImportMemoryMappedFile, framework::DatasetMode::ALL)
     tensor.allocator()->free();
     ARM_COMPUTE_ASSERT(tensor.info()->is_resizable());
 }
+
+TEST_CASE(ImportMemoryMappedFileCopyOnWrite, framework::DatasetMode::ALL)
+{
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::RELU);
+    const TensorInfo          info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+    const size_t              total_size_in_elems = info.tensor_shape().total_size();
+
+    // Create file
+    std::vector<float> file_data(total_size_in_elems);
+    std::uniform_real_distribution<float> distribution(-5.f, 5.f);
+    std::mt19937                          gen(library->seed());
+    for(auto &value : file_data)
+    {
+        value = distribution(gen);
+    }
+    std::ofstream output_file("test_mmap_import_cow.bin", std::ios::binary | std::ios::out);
+    output_file.write(reinterpret_cast<const char *>(file_data.data()), info.total_size());
+    output_file.close();
+
+    // Import the private mapping of the file and run an in-place function on it
+    Tensor tensor;
+    tensor.allocator()->init(info);
+    NEActivationLayer act_func;
+    act_func.configure(&tensor, nullptr, act_info);
+
+    utils::mmap_io::MMappedFile mmapped_file("test_mmap_import_cow.bin", 0 /** Whole file */, 0, true);
+    ARM_COMPUTE_ASSERT(mmapped_file.is_mapped());
+    ARM_COMPUTE_ASSERT(bool(tensor.allocator()->import_memory(mmapped_file.data())));
+    act_func.run();
+
+    // The tensor sees the writes but the file is left untouched
+    const auto        *typed_ptr = reinterpret_cast<const float *>(mmapped_file.data());
+    std::vector<float> file_data_after(total_size_in_elems);
+    std::ifstream      input_file("test_mmap_import_cow.bin", std::ios::binary | std::ios::in);
+    input_file.read(reinterpret_cast<char *>(file_data_after.data()), info.total_size());
+    for(unsigned int i = 0; i < total_size_in_elems; ++i)
+    {
+        ARM_COMPUTE_EXPECT(typed_ptr[i] == std::max(file_data[i], 0.f), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(file_data_after[i] == file_data[i], framework::LogLevel::ERRORS);
+    }
+
+    tensor.allocator()->free();
+}
 #endif // !defined(_WIN64) && !defined(BARE_METAL)
 
 TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
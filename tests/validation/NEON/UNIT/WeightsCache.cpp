@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPWeightsCache.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsCache)
+
+TEST_CASE(SaveAndLoad, framework::DatasetMode::ALL)
+{
+    const std::string filename = "test_weights_cache.bin";
+
+    std::vector<uint8_t> weights0(100);
+    std::vector<uint8_t> weights1(3000);
+    std::iota(weights0.begin(), weights0.end(), 0);
+    std::iota(weights1.begin(), weights1.end(), 7);
+
+    CPPWeightsCache cache;
+    cache.add_weights("weights0", weights0.data(), weights0.size());
+    cache.add_weights("weights1", weights1.data(), weights1.size());
+    ARM_COMPUTE_ASSERT(cache.save_to_file(filename));
+
+    // The loaded weights are read from the file, which can be overwritten while saving the cache again
+    CPPWeightsCache loaded_cache(false);
+    loaded_cache.load_from_file(filename);
+    ARM_COMPUTE_ASSERT(loaded_cache.save_to_file(filename));
+    ARM_COMPUTE_EXPECT(loaded_cache.num_weights() == 2, framework::LogLevel::ERRORS);
+
+    std::vector<uint8_t> found(weights1.size());
+    ARM_COMPUTE_EXPECT(!loaded_cache.find_weights("weights2", found.data(), found.size()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!loaded_cache.find_weights("weights1", found.data(), weights0.size()),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded_cache.find_weights("weights1", found.data(), found.size()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(found == weights1, framework::LogLevel::ERRORS);
+    found.resize(weights0.size());
+    ARM_COMPUTE_EXPECT(loaded_cache.find_weights("weights0", found.data(), found.size()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(found == weights0, framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(ReusePretransposedWeights, framework::DatasetMode::ALL)
+{
+    const TensorShape a_shape(37U, 23U);
+    const TensorShape b_shape(41U, 37U);
+    const TensorShape d_shape(41U, 23U);
+
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    CPPWeightsCache   cache;
+    CPPRuntimeContext runtime_ctx;
+    runtime_ctx.set_weights_cache(&cache);
+    CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+
+    // The weights pretransposed by the first GEMM are added to the cache
+    Tensor a = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d = create_tensor<Tensor>(d_shape, DataType::F32);
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+    library->fill(Accessor(a), distribution, 0);
+    library->fill(Accessor(b), distribution, 1);
+    gemm.run();
+    const size_t num_weights = cache.num_weights();
+    ARM_COMPUTE_EXPECT(num_weights == 1, framework::LogLevel::ERRORS);
+
+    // A GEMM with the same weights copies them from the cache
+    cache.set_store_new_weights(false);
+    Tensor a2 = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b2 = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d2 = create_tensor<Tensor>(d_shape, DataType::F32);
+    NEGEMM gemm2;
+    gemm2.configure(&a2, &b2, nullptr, &d2, 1.f, 0.f);
+    a2.allocator()->allocate();
+    b2.allocator()->allocate();
+    d2.allocator()->allocate();
+    library->fill(Accessor(a2), distribution, 2);
+    library->fill(Accessor(b2), distribution, 1);
+    gemm2.run();
+    runtime_ctx.set_weights_cache(nullptr);
+    ARM_COMPUTE_EXPECT(cache.num_weights() == num_weights, framework::LogLevel::ERRORS);
+
+    SimpleTensor<float> a_ref{ a_shape, DataType::F32 };
+    SimpleTensor<float> b_ref{ b_shape, DataType::F32 };
+    SimpleTensor<float> c_ref{ d_shape, DataType::F32 };
+    library->fill(a_ref, distribution, 2);
+    library->fill(b_ref, distribution, 1);
+    library->fill_tensor_value(c_ref, 0.f);
+
+    validate(Accessor(d2), reference::gemm<float>(a_ref, b_ref, c_ref, 1.f, 0.f), tolerance_f32);
+}
+
+TEST_SUITE_END() // WeightsCache
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
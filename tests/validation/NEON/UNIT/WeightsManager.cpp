@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IWeightsManager.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <memory>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsManager)
+
+TEST_CASE(ShareTransformedWeights, framework::DatasetMode::ALL)
+{
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    Tensor w0 = create_tensor<Tensor>(TensorShape(16U, 8U), DataType::F32);
+    Tensor w1 = create_tensor<Tensor>(TensorShape(16U, 8U), DataType::F32);
+    Tensor w2 = create_tensor<Tensor>(TensorShape(16U, 8U), DataType::F32);
+    w0.allocator()->allocate();
+    w1.allocator()->allocate();
+    w2.allocator()->allocate();
+    library->fill(Accessor(w0), distribution, 0);
+    library->fill(Accessor(w1), distribution, 0);
+    library->fill(Accessor(w2), distribution, 1);
+
+    // The identifier depends on the content of the weights, not on the tensors holding them
+    const std::string id0 = IWeightsManager::transform_id("transform", { &w0 });
+    ARM_COMPUTE_EXPECT(id0 == IWeightsManager::transform_id("transform", { &w1 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(id0 != IWeightsManager::transform_id("transform", { &w2 }), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(id0 != IWeightsManager::transform_id("other_transform", { &w0 }), framework::LogLevel::ERRORS);
+
+    IWeightsManager wm;
+    IWeightsManager other_wm;
+    other_wm.share_transformed_weights_with(wm);
+
+    auto shared0 = wm.share(id0, std::make_shared<IWeightsManager::SharedWeights>());
+    auto shared1 = other_wm.share(id0, std::make_shared<IWeightsManager::SharedWeights>());
+    ARM_COMPUTE_EXPECT(shared0 == shared1, framework::LogLevel::ERRORS);
+
+    // Once released by all the functions, the weights are not shared anymore
+    auto weights = std::make_shared<IWeightsManager::SharedWeights>();
+    shared0.reset();
+    shared1.reset();
+    ARM_COMPUTE_EXPECT(wm.share(id0, weights) == weights, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SharePretransposedWeights, framework::DatasetMode::ALL)
+{
+    const TensorShape a_shape(37U, 23U);
+    const TensorShape b_shape(41U, 37U);
+    const TensorShape d_shape(41U, 23U);
+
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    IWeightsManager wm;
+
+    Tensor a  = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b  = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d  = create_tensor<Tensor>(d_shape, DataType::F32);
+    Tensor a2 = create_tensor<Tensor>(a_shape, DataType::F32);
+    Tensor b2 = create_tensor<Tensor>(b_shape, DataType::F32);
+    Tensor d2 = create_tensor<Tensor>(d_shape, DataType::F32);
+
+    auto   gemm = std::make_unique<NEGEMM>(nullptr, &wm);
+    NEGEMM gemm2(nullptr, &wm);
+    gemm->configure(&a, &b, nullptr, &d, 1.f, 0.f);
+    gemm2.configure(&a2, &b2, nullptr, &d2, 1.f, 0.f);
+
+    for(auto tensor : { &a, &b, &d, &a2, &b2, &d2 })
+    {
+        tensor->allocator()->allocate();
+    }
+    library->fill(Accessor(a), distribution, 0);
+    library->fill(Accessor(b), distribution, 1);
+    library->fill(Accessor(a2), distribution, 2);
+    library->fill(Accessor(b2), distribution, 1);
+
+    // The second GEMM uses the weights prepared by the first one, which stay alive after the first GEMM is destroyed
+    gemm->run();
+    gemm2.run();
+    gemm.reset();
+    library->fill(Accessor(a2), distribution, 3);
+    gemm2.run();
+
+    SimpleTensor<float> a_ref{ a_shape, DataType::F32 };
+    SimpleTensor<float> b_ref{ b_shape, DataType::F32 };
+    SimpleTensor<float> c_ref{ d_shape, DataType::F32 };
+    library->fill(a_ref, distribution, 3);
+    library->fill(b_ref, distribution, 1);
+    library->fill_tensor_value(c_ref, 0.f);
+
+    validate(Accessor(d2), reference::gemm<float>(a_ref, b_ref, c_ref, 1.f, 0.f), tolerance_f32);
+}
+
+TEST_SUITE_END() // WeightsManager
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
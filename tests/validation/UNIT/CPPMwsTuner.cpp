@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPMwsTuner.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+/** Kernel adding one to every element of a F32 tensor in-place */
+class AccumulatingKernel: public ICPPKernel
+{
+public:
+    void configure(unsigned int num_elements)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, num_elements));
+        ICPPKernel::configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "AccumulatingKernel";
+    }
+
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &) override
+    {
+        auto *data = reinterpret_cast<float *>(tensors.get_tensor(TensorType::ACL_SRC_DST)->buffer());
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            data[x] += 1.f;
+        }
+    }
+};
+}
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CPPMwsTuner)
+TEST_CASE(AddMws, framework::DatasetMode::ALL)
+{
+    CPPMwsTuner tuner(false);
+    size_t      mws = 0;
+
+    ARM_COMPUTE_EXPECT(!tuner.find_mws("kernel", mws), framework::LogLevel::ERRORS);
+    tuner.add_mws("kernel", 16);
+    ARM_COMPUTE_EXPECT(tuner.find_mws("kernel", mws), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mws == 16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.mws_table().size() == 1, framework::LogLevel::ERRORS);
+}
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_CASE(TuneNewKernel, framework::DatasetMode::ALL)
+{
+    CPPScheduler       scheduler;
+    CPPMwsTuner        tuner;
+    AccumulatingKernel kernel;
+    Tensor             tensor;
+
+    tensor.allocator()->init(TensorInfo(TensorShape(64U), 1, DataType::F32));
+    tensor.allocator()->allocate();
+    std::fill_n(reinterpret_cast<float *>(tensor.buffer()), 64, 0.f);
+    ITensorPack tensors{ { TensorType::ACL_SRC_DST, &tensor } };
+
+    kernel.configure(64);
+    scheduler.set_num_threads(4);
+    CPPRuntimeContext runtime_ctx;
+    runtime_ctx.set_mws_tuner(&tuner);
+    CPPRuntimeContextScope runtime_scope(&runtime_ctx);
+    scheduler.schedule_op(&kernel, CPPScheduler::Hints(0), kernel.window(), tensors);
+
+    // The kernel is tuned before its first run
+    size_t mws = 0;
+    ARM_COMPUTE_EXPECT(tuner.find_mws(CPPMwsTuner::kernel_id(kernel, scheduler.cpu_info(), 4, kernel.window()), mws), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mws >= 1 && mws <= 64, framework::LogLevel::ERRORS);
+
+    // Tuning ran on scratch tensors: the in-place kernel has been applied exactly once to the actual tensor
+    scheduler.schedule_op(&kernel, CPPScheduler::Hints(0), kernel.window(), tensors);
+    const auto *data = reinterpret_cast<const float *>(tensor.buffer());
+    ARM_COMPUTE_EXPECT(std::all_of(data, data + 64, [](float v) { return v == 2.f; }), framework::LogLevel::ERRORS);
+
+    // A different shape is tuned separately
+    kernel.configure(32);
+    scheduler.schedule_op(&kernel, CPPScheduler::Hints(0), kernel.window(), tensors);
+    ARM_COMPUTE_EXPECT(tuner.mws_table().size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(data[0] == 3.f && data[63] == 2.f, framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_SUITE_END() // CPPMwsTuner
+TEST_SUITE_END() // UNIT
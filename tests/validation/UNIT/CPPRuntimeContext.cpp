@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPRuntimeContext.h"
+
+#include "arm_compute/runtime/CPP/CPPProfiler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <thread>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CPPRuntimeContext)
+
+TEST_CASE(InstallAndRestore, framework::DatasetMode::ALL)
+{
+    CPPProfiler       profiler;
+    CPPRuntimeContext outer_ctx;
+    CPPRuntimeContext inner_ctx;
+    outer_ctx.set_profiler(&profiler);
+
+    CPPRuntimeContext *previous_ctx = CPPRuntimeContext::thread_context();
+    {
+        CPPRuntimeContextScope outer_scope(&outer_ctx);
+        ARM_COMPUTE_EXPECT(CPPRuntimeContext::get().profiler() == &profiler, framework::LogLevel::ERRORS);
+        {
+            CPPRuntimeContextScope inner_scope(&inner_ctx);
+            ARM_COMPUTE_EXPECT(CPPRuntimeContext::thread_context() == &inner_ctx, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(CPPRuntimeContext::get().profiler() == nullptr, framework::LogLevel::ERRORS);
+        }
+        ARM_COMPUTE_EXPECT(CPPRuntimeContext::thread_context() == &outer_ctx, framework::LogLevel::ERRORS);
+
+        // The context is only installed on the calling thread
+        const CPPRuntimeContext *other_thread_ctx = &outer_ctx;
+        std::thread([&other_thread_ctx]() { other_thread_ctx = CPPRuntimeContext::thread_context(); }).join();
+        ARM_COMPUTE_EXPECT(other_thread_ctx == nullptr, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(CPPRuntimeContext::thread_context() == previous_ctx, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // CPPRuntimeContext
+TEST_SUITE_END() // UNIT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,9 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
 #include <stdexcept>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -64,6 +66,38 @@ public:
     }
 
 };
+
+/** Kernel counting the number of iterations it runs on */
+class CountingKernel: public ICPPKernel
+{
+public:
+    void configure(unsigned int num_iterations)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, num_iterations));
+        ICPPKernel::configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        _count += window.num_iterations(0);
+    }
+
+    size_t get_mws(const CPUInfo &, size_t) const override
+    {
+        // Only queried when the window of the kernel is split into workloads
+        ++_num_splits;
+        return 1;
+    }
+
+    std::atomic<size_t>         _count{ 0 };
+    mutable std::atomic<size_t> _num_splits{ 0 };
+};
 }
 
 TEST_SUITE(UNIT)
@@ -86,6 +120,91 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(ReconfigureKernel, framework::DatasetMode::ALL)
+{
+    CPPScheduler   scheduler;
+    CountingKernel kernel;
+
+    scheduler.set_num_threads(4);
+
+    // Runs with the same window reuse the cached split, a new window or thread count must invalidate it
+    kernel.configure(64);
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    ARM_COMPUTE_EXPECT(kernel._count == 128, framework::LogLevel::ERRORS);
+
+    kernel._count = 0;
+    kernel.configure(10);
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    ARM_COMPUTE_EXPECT(kernel._count == 10, framework::LogLevel::ERRORS);
+
+    kernel._count = 0;
+    scheduler.set_num_threads(3);
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0, CPPScheduler::StrategyHint::DYNAMIC));
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0, CPPScheduler::StrategyHint::DYNAMIC));
+    ARM_COMPUTE_EXPECT(kernel._count == 20, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ReuseDispatchPlan, framework::DatasetMode::ALL)
+{
+    CPPScheduler   scheduler;
+    CountingKernel kernel;
+
+    scheduler.set_num_threads(4);
+    kernel.configure(64);
+
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    const size_t num_splits = kernel._num_splits;
+    ARM_COMPUTE_EXPECT(num_splits > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.scheduler_state() != nullptr, framework::LogLevel::ERRORS);
+
+    // The plan attached to the kernel is reused: the window isn't split again
+    const ICPPKernel::SchedulerState *state = kernel.scheduler_state();
+    for(int i = 0; i < 8; ++i)
+    {
+        scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    }
+    ARM_COMPUTE_EXPECT(kernel._num_splits == num_splits, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.scheduler_state() == state, framework::LogLevel::ERRORS);
+
+    // Another scheduler with the same number of threads reuses it too
+    CPPScheduler other_scheduler;
+    other_scheduler.set_num_threads(4);
+    other_scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    ARM_COMPUTE_EXPECT(kernel._num_splits == num_splits, framework::LogLevel::ERRORS);
+
+    // Reconfiguring the kernel rebuilds the plan in place
+    kernel.configure(32);
+    scheduler.schedule(&kernel, CPPScheduler::Hints(0));
+    ARM_COMPUTE_EXPECT(kernel._num_splits > num_splits, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.scheduler_state() == state, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel._count == 64 * 10 + 32, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ParallelRegion, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    std::atomic<unsigned int>         count{ 0 };
+    std::vector<IScheduler::Workload> workloads(8, [&](const ThreadInfo &)
+    {
+        ++count;
+    });
+
+    // Workers must keep picking up work inside nested regions and after they are closed
+    scheduler.begin_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.begin_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.end_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.end_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+
+    ARM_COMPUTE_EXPECT(count == 32, framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
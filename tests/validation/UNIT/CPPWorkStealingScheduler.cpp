@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+class TestException: public std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "Expected test exception";
+    }
+};
+
+class TestKernel: public ICPPKernel
+{
+public:
+    TestKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 2));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "TestKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        throw TestException();
+    }
+
+};
+}
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CPPWorkStealingScheduler)
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_CASE(RethrowException, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler scheduler;
+    CPPWorkStealingScheduler::Hints hints(0);
+    TestKernel kernel;
+
+    scheduler.set_num_threads(2);
+    try
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    catch(const TestException&)
+    {
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunEachWorkloadOnce, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    // Cover fewer, as many and more workloads than threads, with both spinning and parked workers
+    for(unsigned int spin_count : { 0U, 1000U })
+    {
+        scheduler.set_spin_count(spin_count);
+        for(unsigned int num_workloads : { 1U, 3U, 4U, 17U, 64U })
+        {
+            std::vector<std::atomic<unsigned int>> hits(num_workloads);
+            std::vector<IScheduler::Workload>      workloads(num_workloads);
+            std::atomic<bool>                      valid_thread_ids{ true };
+            for(unsigned int i = 0; i < num_workloads; ++i)
+            {
+                hits[i]      = 0;
+                workloads[i] = [&, i](const ThreadInfo & info)
+                {
+                    if(info.thread_id < 0 || info.thread_id >= info.num_threads)
+                    {
+                        valid_thread_ids = false;
+                    }
+                    ++hits[i];
+                };
+            }
+            scheduler.run_tagged_workloads(workloads, nullptr);
+
+            ARM_COMPUTE_EXPECT(valid_thread_ids, framework::LogLevel::ERRORS);
+            for(unsigned int i = 0; i < num_workloads; ++i)
+            {
+                ARM_COMPUTE_EXPECT(hits[i] == 1, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
+TEST_CASE(ParallelRegion, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler scheduler;
+    scheduler.set_num_threads(4);
+    scheduler.set_spin_count(0);
+
+    std::atomic<unsigned int>         count{ 0 };
+    std::vector<IScheduler::Workload> workloads(8, [&](const ThreadInfo &)
+    {
+        ++count;
+    });
+
+    // Workers must keep picking up work inside nested regions and after they are closed
+    scheduler.begin_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.begin_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.end_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+    scheduler.end_parallel_region();
+    scheduler.run_tagged_workloads(workloads, nullptr);
+
+    ARM_COMPUTE_EXPECT(count == 32, framework::LogLevel::ERRORS);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
+TEST_SUITE_END()
+TEST_SUITE_END()
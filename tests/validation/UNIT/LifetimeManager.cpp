@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
@@ -32,6 +33,9 @@
 #include "tests/validation/Validation.h"
 #include "utils/TypePrinter.h"
 
+#include <algorithm>
+#include <array>
+
 namespace arm_compute
 {
 namespace test
@@ -119,6 +123,86 @@ TEST_CASE(MemoryGroupRelease, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(mg.mappings().size() == 0, framework::LogLevel::ERRORS);
 }
 
+/** Validate that the offset lifetime manager places objects that are not alive at the same time at the same offset */
+TEST_CASE(OffsetPlanning, framework::DatasetMode::ALL)
+{
+    auto        lft_mgr  = std::make_shared<OffsetLifetimeManager>();
+    auto        pool_mgr = std::make_shared<PoolManager>();
+    auto        mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+    MemoryGroup mg(mm);
+
+    // Register group
+    lft_mgr->register_group(&mg);
+
+    // A large object followed by two smaller objects alive at the same time, which fit in the memory of the first one
+    MockMemoryManageable a{}, b{}, c{};
+    Memory               m_a{}, m_b{}, m_c{};
+    mg.manage(&a);
+    mg.finalize_memory(&a, m_a, 100U /* size */, 0U /* alignment */);
+    mg.manage(&b);
+    mg.manage(&c);
+    mg.finalize_memory(&b, m_b, 50U /* size */, 0U /* alignment */);
+    mg.finalize_memory(&c, m_c, 50U /* size */, 0U /* alignment */);
+
+    // Validate lifetime manager state
+    ARM_COMPUTE_EXPECT(lft_mgr->info().size == 100, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->peak_size() == 100, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mg.mappings().size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mg.mappings()[&m_a] == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mg.mappings()[&m_b] != mg.mappings()[&m_c], framework::LogLevel::ERRORS);
+
+    // The objects alive at the same time don't overlap and fit in the memory of the first one
+    const size_t offset_b = mg.mappings()[&m_b];
+    const size_t offset_c = mg.mappings()[&m_c];
+    ARM_COMPUTE_EXPECT(offset_b + 50U <= offset_c || offset_c + 50U <= offset_b, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::max(offset_b, offset_c) + 50U <= lft_mgr->info().size, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(OffsetPlanningOverlappingLifetimes, framework::DatasetMode::ALL)
+{
+    auto        lft_mgr  = std::make_shared<OffsetLifetimeManager>();
+    auto        pool_mgr = std::make_shared<PoolManager>();
+    auto        mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+    MemoryGroup mg(mm);
+
+    // Register group
+    lft_mgr->register_group(&mg);
+
+    // Chain of objects where each one is alive with the previous and the next one:
+    // t0 [0, 2], t1 [1, 4], t2 [3, 6], t3 [5, 7]
+    constexpr size_t                              num_objects = 4;
+    const std::array<size_t, num_objects>         sizes       = { { 64U, 32U, 48U, 16U } };
+    std::array<MockMemoryManageable, num_objects> objects{};
+    std::array<Memory, num_objects>               memories{};
+    mg.manage(&objects[0]);
+    mg.manage(&objects[1]);
+    mg.finalize_memory(&objects[0], memories[0], sizes[0], 0U /* alignment */);
+    mg.manage(&objects[2]);
+    mg.finalize_memory(&objects[1], memories[1], sizes[1], 0U /* alignment */);
+    mg.manage(&objects[3]);
+    mg.finalize_memory(&objects[2], memories[2], sizes[2], 0U /* alignment */);
+    mg.finalize_memory(&objects[3], memories[3], sizes[3], 0U /* alignment */);
+
+    // The arena is as large as the peak usage, reached while t0 and t1 are alive
+    const size_t expected_peak = sizes[0] + sizes[1];
+    ARM_COMPUTE_EXPECT(lft_mgr->peak_size() == expected_peak, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->info().size == expected_peak, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(mg.mappings().size() == num_objects);
+
+    // The objects with overlapping lifetimes occupy disjoint ranges of the arena
+    for(size_t i = 0; i < num_objects; ++i)
+    {
+        const size_t offset = mg.mappings()[&memories[i]];
+        ARM_COMPUTE_EXPECT(offset + sizes[i] <= lft_mgr->info().size, framework::LogLevel::ERRORS);
+        if(i + 1 < num_objects)
+        {
+            const size_t next_offset = mg.mappings()[&memories[i + 1]];
+            ARM_COMPUTE_EXPECT(offset + sizes[i] <= next_offset || next_offset + sizes[i + 1] <= offset,
+                               framework::LogLevel::ERRORS);
+        }
+    }
+}
+
 TEST_SUITE_END() // LifetimeManager
 TEST_SUITE_END()
 } // namespace validation
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_ATTENTIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_ATTENTIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/AttentionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/Attention.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class AttentionValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the fixture
+     *
+     * @param[in] query_shape    Shape of the queries [D, Sq, H, B]
+     * @param[in] num_keys       Number of keys and values, Skv
+     * @param[in] value_size     Size of the values, Dv
+     * @param[in] has_mask       True to add a mask to the query-key products
+     * @param[in] broadcast_mask True to share the mask across the heads
+     * @param[in] is_causal      True for causal attention
+     * @param[in] scale          Scale of the query-key products, 0 for the default
+     * @param[in] data_type      Data type of the tensors
+     */
+    void setup(TensorShape  query_shape,
+               unsigned int num_keys,
+               unsigned int value_size,
+               bool         has_mask,
+               bool         broadcast_mask,
+               bool         is_causal,
+               float        scale,
+               DataType     data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        query_shape.set_num_dimensions(4);
+
+        TensorShape key_shape = query_shape;
+        key_shape.set(1, num_keys);
+        TensorShape value_shape = key_shape;
+        value_shape.set(0, value_size);
+
+        TensorShape mask_shape{};
+        if(has_mask)
+        {
+            mask_shape = TensorShape(num_keys, query_shape[1], broadcast_mask ? 1U : query_shape[2], query_shape[3]);
+        }
+
+        const AttentionInfo info = AttentionInfo().scale(scale).is_causal(is_causal);
+
+        _target    = compute_target(query_shape, key_shape, value_shape, mask_shape, info, data_type);
+        _reference = compute_reference(query_shape, key_shape, value_shape, mask_shape, info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        library->fill_tensor_uniform(tensor, i, lo, hi);
+    }
+
+    TensorType compute_target(const TensorShape   &query_shape,
+                              const TensorShape   &key_shape,
+                              const TensorShape   &value_shape,
+                              const TensorShape   &mask_shape,
+                              const AttentionInfo &info,
+                              DataType             data_type)
+    {
+        const bool has_mask = mask_shape.total_size() > 0;
+
+        // Create tensors
+        TensorType query = create_tensor<TensorType>(query_shape, data_type);
+        TensorType key   = create_tensor<TensorType>(key_shape, data_type);
+        TensorType value = create_tensor<TensorType>(value_shape, data_type);
+        TensorType mask  = create_tensor<TensorType>(mask_shape, data_type);
+        TensorType dst;
+
+        // Create and configure function
+        FunctionType attention;
+        attention.configure(&query, &key, &value, has_mask ? &mask : nullptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(key.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(value.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(query), 0);
+        fill(AccessorType(key), 1);
+        fill(AccessorType(value), 2);
+
+        if(has_mask)
+        {
+            mask.allocator()->allocate();
+            fill(AccessorType(mask), 3, -4.f, 0.f);
+        }
+
+        // Compute function
+        attention.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape   &query_shape,
+                                      const TensorShape   &key_shape,
+                                      const TensorShape   &value_shape,
+                                      const TensorShape   &mask_shape,
+                                      const AttentionInfo &info,
+                                      DataType             data_type)
+    {
+        // Create reference
+        SimpleTensor<T> query{ query_shape, data_type };
+        SimpleTensor<T> key{ key_shape, data_type };
+        SimpleTensor<T> value{ value_shape, data_type };
+        SimpleTensor<T> mask{ mask_shape, data_type };
+
+        // Fill reference
+        fill(query, 0);
+        fill(key, 1);
+        fill(value, 2);
+
+        if(mask_shape.total_size() > 0)
+        {
+            fill(mask, 3, -4.f, 0.f);
+        }
+
+        const float scale = info.scale() != 0.f ? info.scale() : 1.f / std::sqrt(static_cast<float>(query_shape[0]));
+
+        return reference::attention<T>(query, key, value, mask, scale, info.is_causal());
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_ATTENTIONFIXTURE_H
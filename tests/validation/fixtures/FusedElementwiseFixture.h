@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ElementwiseOperations.h"
+#include "tests/validation/reference/ElementwiseUnary.h"
+#include "tests/validation/reference/PixelWiseMultiplication.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedElementwiseValidationFixture : public framework::Fixture
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type, ActivationLayerInfo act_info)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // The third input is a per-channel vector broadcast over every other dimension
+        const TensorShape out_shape = TensorShape::broadcast_shape(shape0, shape1);
+        const TensorShape shape2(out_shape.x());
+
+        // Every operation and the activation under test, with operands on both sides and broadcasting inputs
+        const ElementwiseChainInfo chain =
+        {
+            ElementwiseChainStep(ElementwiseChainOperation::ADD, 1),
+            ElementwiseChainStep(ElementwiseChainOperation::MUL, 2, true),
+            ElementwiseChainStep(act_info),
+            ElementwiseChainStep(ElementwiseChainOperation::SUB, 0, true),
+            ElementwiseChainStep(ElementwiseChainOperation::MAX, 1),
+            ElementwiseChainStep(ElementwiseChainOperation::DIV, 2),
+            ElementwiseChainStep(ElementwiseChainOperation::MIN, 0),
+            ElementwiseChainStep(ElementwiseChainOperation::EXP)
+        };
+
+        _target    = compute_target({ shape0, shape1, shape2 }, data_type, chain);
+        _reference = compute_reference({ shape0, shape1, shape2 }, data_type, chain);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        // The last input is used as a divisor, so it is kept away from zero
+        if(i == 2)
+        {
+            library->fill_tensor_uniform(tensor, i, 0.5f, 2.f);
+        }
+        else
+        {
+            library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+        }
+    }
+
+    TensorType compute_target(const std::vector<TensorShape> &shapes, DataType data_type, const ElementwiseChainInfo &chain)
+    {
+        // Create tensors
+        std::vector<TensorType>          srcs;
+        std::vector<const ITensor *>     src_ptrs;
+        std::vector<const ITensorInfo *> src_infos;
+        for(const auto &shape : shapes)
+        {
+            srcs.emplace_back(create_tensor<TensorType>(shape, data_type));
+        }
+        for(auto &src : srcs)
+        {
+            src_ptrs.emplace_back(&src);
+            src_infos.emplace_back(src.info());
+        }
+        TensorType dst;
+
+        // Create and configure function
+        FunctionType fused_elementwise;
+        ARM_COMPUTE_ERROR_THROW_ON(fused_elementwise.validate(src_infos, dst.info(), chain));
+        fused_elementwise.configure(src_ptrs, &dst, chain);
+
+        // Allocate tensors
+        for(auto &src : srcs)
+        {
+            src.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        }
+        dst.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        for(size_t i = 0; i < srcs.size(); ++i)
+        {
+            fill(AccessorType(srcs[i]), i);
+        }
+
+        // Compute function
+        fused_elementwise.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const std::vector<TensorShape> &shapes, DataType data_type, const ElementwiseChainInfo &chain)
+    {
+        // Create and fill reference
+        std::vector<SimpleTensor<T>> srcs;
+        for(size_t i = 0; i < shapes.size(); ++i)
+        {
+            srcs.emplace_back(shapes[i], data_type);
+            fill(srcs.back(), i);
+        }
+
+        // Evaluate the chain one operation at a time
+        SimpleTensor<T> result = srcs[0];
+        for(const auto &step : chain)
+        {
+            const SimpleTensor<T> &lhs = step.reverse ? srcs[step.operand] : result;
+            const SimpleTensor<T> &rhs = step.reverse ? result : srcs[step.operand];
+            switch(step.op)
+            {
+                case ElementwiseChainOperation::ADD:
+                    result = reference::arithmetic_operation<T>(ArithmeticOperation::ADD, lhs, rhs, data_type);
+                    break;
+                case ElementwiseChainOperation::SUB:
+                    result = reference::arithmetic_operation<T>(ArithmeticOperation::SUB, lhs, rhs, data_type);
+                    break;
+                case ElementwiseChainOperation::MUL:
+                    result = reference::pixel_wise_multiplication<T, T, T>(lhs, rhs, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_UP, data_type);
+                    break;
+                case ElementwiseChainOperation::DIV:
+                    result = reference::arithmetic_operation<T>(ArithmeticOperation::DIV, lhs, rhs, data_type);
+                    break;
+                case ElementwiseChainOperation::MAX:
+                    result = reference::arithmetic_operation<T>(ArithmeticOperation::MAX, lhs, rhs, data_type);
+                    break;
+                case ElementwiseChainOperation::MIN:
+                    result = reference::arithmetic_operation<T>(ArithmeticOperation::MIN, lhs, rhs, data_type);
+                    break;
+                case ElementwiseChainOperation::EXP:
+                {
+                    SimpleTensor<T> dst{ result.shape(), data_type };
+                    result = reference::elementwise_unary<T>(result, dst, ElementWiseUnary::EXP);
+                    break;
+                }
+                case ElementwiseChainOperation::ACTIVATION:
+                    result = reference::activation_layer(result, step.act_info);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported chain operation");
+            }
+        }
+        return result;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
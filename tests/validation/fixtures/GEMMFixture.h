@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Globals.h"
 #include "tests/IAccessor.h"
@@ -36,7 +37,10 @@
 #include "tests/validation/reference/ActivationLayer.h"
 #include "tests/validation/reference/ElementwiseOperations.h"
 #include "tests/validation/reference/GEMM.h"
+#include "tests/validation/reference/GEMMLowp.h"
 
+#include <algorithm>
+#include <limits>
 #include <random>
 
 namespace arm_compute
@@ -325,6 +329,175 @@ public:
     }
 };
 
+/** Dynamic GEMM whose data types differ between its inputs and output
+ *
+ * A is dynamic and so is B and the vector bias C unless they are constant. The target is configured with empty shapes for the dynamic tensors.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class GEMMDynamicMixedValidationFixture : public framework::Fixture
+{
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::BFLOAT16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{ -1.f, 1.f, true /* portable */ };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::S32:
+            {
+                std::uniform_int_distribution<int32_t> distribution(-1000, 1000);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    void compute_target(const TensorInfo &a_info, const TensorInfo &b_info, const TensorInfo &c_info, const TensorInfo &dst_info, bool constant_b_and_c)
+    {
+        TensorType a   = create_tensor<TensorType>(a_info);
+        TensorType b   = create_tensor<TensorType>(b_info);
+        TensorType c   = create_tensor<TensorType>(c_info);
+        _target        = create_tensor<TensorType>(dst_info);
+
+        b.info()->set_are_values_constant(constant_b_and_c);
+        c.info()->set_are_values_constant(constant_b_and_c);
+
+        a.info()->set_tensor_shape(TensorShape()).set_dynamic(true);
+        if(!constant_b_and_c)
+        {
+            b.info()->set_tensor_shape(TensorShape()).set_dynamic(true);
+            c.info()->set_tensor_shape(TensorShape()).set_dynamic(true);
+        }
+        _target.info()->set_tensor_shape(TensorShape()).set_dynamic(true);
+
+        FunctionType gemm;
+        gemm.configure(&a, &b, &c, &_target, 1.f, 1.f, GEMMInfo(false, false, constant_b_and_c));
+
+        a.info()->set_tensor_shape(a_info.tensor_shape());
+        b.info()->set_tensor_shape(b_info.tensor_shape());
+        c.info()->set_tensor_shape(c_info.tensor_shape());
+        _target.info()->set_tensor_shape(dst_info.tensor_shape());
+
+        add_padding_x({ &a, &b, &c, &_target });
+
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        _target.allocator()->allocate();
+
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill(AccessorType(c), 2);
+
+        gemm.run();
+    }
+
+    TensorType _target{};
+};
+
+/** Dynamic GEMM of BFLOAT16 A and B with a F32 vector bias and output */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class GEMMDynamicBF16ValidationFixture : protected GEMMDynamicMixedValidationFixture<TensorType, AccessorType, FunctionType>
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta, bool constant_b_and_c)
+    {
+        ARM_COMPUTE_UNUSED(alpha, beta);
+        this->compute_target(TensorInfo(shape_a, 1, DataType::BFLOAT16), TensorInfo(shape_b, 1, DataType::BFLOAT16), TensorInfo(shape_c, 1, DataType::F32),
+                             TensorInfo(output_shape, 1, DataType::F32), constant_b_and_c);
+        _reference = compute_reference(shape_a, shape_b, output_shape);
+    }
+
+protected:
+    SimpleTensor<float> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape)
+    {
+        SimpleTensor<bfloat16> a{ shape_a, DataType::BFLOAT16 };
+        SimpleTensor<bfloat16> b{ shape_b, DataType::BFLOAT16 };
+        SimpleTensor<float>    bias{ TensorShape(shape_b[0]), DataType::F32 };
+        this->fill(a, 0);
+        this->fill(b, 1);
+        this->fill(bias, 2);
+
+        // The inputs are exactly representable in F32, which accumulates the products like the target
+        SimpleTensor<float> a_f32{ shape_a, DataType::F32 };
+        SimpleTensor<float> b_f32{ shape_b, DataType::F32 };
+        SimpleTensor<float> c{ output_shape, DataType::F32 };
+        std::transform(a.data(), a.data() + a.num_elements(), a_f32.data(), [](bfloat16 v) { return float(v); });
+        std::transform(b.data(), b.data() + b.num_elements(), b_f32.data(), [](bfloat16 v) { return float(v); });
+        for(int i = 0; i < c.num_elements(); ++i)
+        {
+            c[i] = bias[i % bias.num_elements()];
+        }
+
+        return reference::gemm<float>(a_f32, b_f32, c, 1.f, 1.f);
+    }
+
+    SimpleTensor<float> _reference{};
+};
+
+/** Dynamic GEMM of QASYMM8_SIGNED A and symmetric B with a S32 vector bias, requantized to a QASYMM8_SIGNED output */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class GEMMDynamicQuantizedValidationFixture : protected GEMMDynamicMixedValidationFixture<TensorType, AccessorType, FunctionType>
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta, DataType b_data_type, bool constant_b_and_c)
+    {
+        ARM_COMPUTE_UNUSED(alpha, beta);
+        const QuantizationInfo a_qinfo(0.0125f, 5);
+        const QuantizationInfo dst_qinfo(0.05f, -3);
+        QuantizationInfo       b_qinfo(0.01f);
+        if(b_data_type == DataType::QSYMM8_PER_CHANNEL)
+        {
+            std::vector<float> scales(shape_b[0]);
+            for(size_t i = 0; i < scales.size(); ++i)
+            {
+                scales[i] = 0.005f + 0.001f * (i % 7);
+            }
+            b_qinfo = QuantizationInfo(scales);
+        }
+
+        this->compute_target(TensorInfo(shape_a, 1, DataType::QASYMM8_SIGNED, a_qinfo), TensorInfo(shape_b, 1, b_data_type, b_qinfo), TensorInfo(shape_c, 1, DataType::S32),
+                             TensorInfo(output_shape, 1, DataType::QASYMM8_SIGNED, dst_qinfo), constant_b_and_c);
+        _reference = compute_reference(shape_a, shape_b, output_shape, a_qinfo, b_data_type, b_qinfo, dst_qinfo);
+    }
+
+protected:
+    SimpleTensor<int8_t> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, const QuantizationInfo &a_qinfo,
+                                           DataType b_data_type, const QuantizationInfo &b_qinfo, const QuantizationInfo &dst_qinfo)
+    {
+        SimpleTensor<int8_t>  a{ shape_a, DataType::QASYMM8_SIGNED, 1, a_qinfo };
+        SimpleTensor<int8_t>  b{ shape_b, b_data_type, 1, b_qinfo };
+        SimpleTensor<int32_t> bias{ TensorShape(shape_b[0]), DataType::S32 };
+        this->fill(a, 0);
+        this->fill(b, 1);
+        this->fill(bias, 2);
+
+        // Same output stage as the gemmlowp functions
+        GEMMLowpOutputStageInfo output_stage{};
+        quantization::calculate_quantized_multipliers(a_qinfo, b_qinfo, dst_qinfo, output_stage);
+
+        const SimpleTensor<int32_t> acc = reference::gemmlowp_matrix_multiply_core<int32_t, int8_t, int8_t>(a, b, output_shape, -a_qinfo.uniform().offset, 0);
+        return reference::gemmlowp_quantize_down_scale_by_fixedpoint<int32_t, int8_t>(acc, bias, output_stage.gemmlowp_multipliers, output_stage.gemmlowp_shifts,
+                                                                                      dst_qinfo.uniform().offset, std::numeric_limits<int8_t>::lowest(),
+                                                                                      std::numeric_limits<int8_t>::max());
+    }
+
+    SimpleTensor<int8_t> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool disable_c = false, bool reinterpret_input_as_3d = false, bool reinterpret_output_as_3d = false, bool pretranspose_a = false, bool pretranspose_b = false, bool run_twice = false>
 class GEMMAccumulateValidationFixture : protected GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T, disable_c, reinterpret_input_as_3d, reinterpret_output_as_3d, pretranspose_a, pretranspose_b, run_twice>
 {
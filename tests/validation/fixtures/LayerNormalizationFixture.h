@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LayerNormalization.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LayerNormalizationValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the fixture
+     *
+     * @param[in] shape          Shape of the input, normalized along dimension 0
+     * @param[in] has_residual   True to add a residual to the input
+     * @param[in] has_add_output True to output the sum of the input and the residual
+     * @param[in] in_place       True to write the sum to the residual tensor
+     * @param[in] has_gamma      True to scale the normalized values
+     * @param[in] has_beta       True to offset the normalized values
+     * @param[in] type           Normalization type
+     * @param[in] epsilon        Value added to the variance
+     * @param[in] data_type      Data type of the tensors
+     */
+    void setup(TensorShape            shape,
+               bool                   has_residual,
+               bool                   has_add_output,
+               bool                   in_place,
+               bool                   has_gamma,
+               bool                   has_beta,
+               LayerNormalizationType type,
+               float                  epsilon,
+               DataType               data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const LayerNormalizationInfo info(type, epsilon);
+
+        _has_add_output = has_add_output;
+        compute_target(shape, has_residual, has_add_output, in_place, has_gamma, has_beta, info, data_type);
+        compute_reference(shape, has_residual, has_gamma, has_beta, info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        library->fill_tensor_uniform(tensor, i, lo, hi);
+    }
+
+    void compute_target(const TensorShape            &shape,
+                        bool                          has_residual,
+                        bool                          has_add_output,
+                        bool                          in_place,
+                        bool                          has_gamma,
+                        bool                          has_beta,
+                        const LayerNormalizationInfo &info,
+                        DataType                      data_type)
+    {
+        const TensorShape param_shape(shape[0]);
+
+        // Create tensors
+        TensorType src      = create_tensor<TensorType>(shape, data_type);
+        TensorType residual = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma    = create_tensor<TensorType>(param_shape, data_type);
+        TensorType beta     = create_tensor<TensorType>(param_shape, data_type);
+
+        TensorType *add_output = nullptr;
+        if(has_add_output)
+        {
+            add_output = in_place ? &residual : &_target_add_output;
+        }
+
+        // Create and configure function
+        FunctionType norm;
+        norm.configure(&src, has_residual ? &residual : nullptr, has_gamma ? &gamma : nullptr,
+                       has_beta ? &beta : nullptr, add_output, &_target, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        residual.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        _target.allocator()->allocate();
+        if(has_add_output && !in_place)
+        {
+            _target_add_output.allocator()->allocate();
+        }
+
+        // Fill tensors, the input being offset to check the accuracy of the variance
+        fill(AccessorType(src), 0, 1.f, 3.f);
+        fill(AccessorType(residual), 1);
+        fill(AccessorType(gamma), 2, 0.5f, 1.5f);
+        fill(AccessorType(beta), 3);
+
+        // Compute function
+        norm.run();
+
+        if(in_place)
+        {
+            _target_add_output = std::move(residual);
+        }
+    }
+
+    void compute_reference(const TensorShape            &shape,
+                           bool                          has_residual,
+                           bool                          has_gamma,
+                           bool                          has_beta,
+                           const LayerNormalizationInfo &info,
+                           DataType                      data_type)
+    {
+        const TensorShape param_shape(shape[0]);
+
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        SimpleTensor<T> residual{ has_residual ? shape : TensorShape(), data_type };
+        SimpleTensor<T> gamma{ has_gamma ? param_shape : TensorShape(), data_type };
+        SimpleTensor<T> beta{ has_beta ? param_shape : TensorShape(), data_type };
+
+        // Fill reference
+        fill(src, 0, 1.f, 3.f);
+        if(has_residual)
+        {
+            fill(residual, 1);
+        }
+        if(has_gamma)
+        {
+            fill(gamma, 2, 0.5f, 1.5f);
+        }
+        if(has_beta)
+        {
+            fill(beta, 3);
+        }
+
+        _reference = reference::layer_normalization<T>(src, residual, gamma, beta, _reference_add_output, info);
+    }
+
+    TensorType      _target{};
+    TensorType      _target_add_output{};
+    SimpleTensor<T> _reference{};
+    SimpleTensor<T> _reference_add_output{};
+    bool            _has_add_output{ false };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LAYERNORMALIZATIONFIXTURE_H
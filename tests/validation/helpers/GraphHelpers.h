@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
+#define ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/backends/NEON/NEDeviceBackend.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace helper
+{
+/** Make sure the Neon backend of the graph API is registered
+ *
+ * The backends register themselves from static objects, which static builds drop unless the backend is referenced.
+ */
+inline void register_neon_graph_backend()
+{
+    auto &registry = graph::backends::BackendRegistry::get();
+    if (!registry.contains(graph::Target::NEON))
+    {
+        registry.add_backend<graph::backends::NEDeviceBackend>(graph::Target::NEON);
+    }
+}
+
+/** Count the nodes of a given type in a graph
+ *
+ * @param[in] g    Graph to count the nodes of
+ * @param[in] type Type of the nodes to count
+ *
+ * @return The number of nodes of type @p type
+ */
+inline size_t count_nodes(const graph::Graph &g, graph::NodeType type)
+{
+    return std::count_if(g.nodes().begin(), g.nodes().end(), [type](const std::unique_ptr<graph::INode> &node)
+                         { return node != nullptr && node->type() == type; });
+}
+
+/** Call a function on the coordinates of all the elements of a tensor
+ *
+ * @param[in] tensor Tensor to iterate over
+ * @param[in] func   Function called with the coordinates of each element
+ */
+template <typename F>
+void for_each_element(const ITensor &tensor, F &&func)
+{
+    Window win;
+    win.use_tensor_dimensions(tensor.info()->tensor_shape());
+    execute_window_loop(win, func);
+}
+
+/** Accessor filling a F32 tensor with values depending on the coordinates of its elements
+ *
+ * The values only depend on the coordinates and on the index of the inference in the run, so the first samples of a
+ * batch get the same values whatever the batch is. The coordinates of spatial NHWC tensors are taken in the NCHW
+ * order, so a tensor gets the same values in both layouts.
+ */
+class CoordinateFillAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_inferences (Optional) Number of inferences filled per run of the graph
+     * @param[in] seed           (Optional) Seed making the values of different tensors differ
+     */
+    explicit CoordinateFillAccessor(unsigned int num_inferences = 1, unsigned int seed = 0)
+        : _num_inferences(num_inferences), _seed(seed)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        // Signal the end of the run, the next run starts over with the first inference
+        if(_inference == _num_inferences)
+        {
+            _inference = 0;
+            return false;
+        }
+
+        TensorShape shape   = tensor.info()->tensor_shape();
+        const bool  is_nhwc = tensor.info()->data_layout() == DataLayout::NHWC && shape.num_dimensions() >= 3;
+        if(is_nhwc)
+        {
+            shape = TensorShape(shape[1], shape[2], shape[0], shape[3]);
+        }
+        for_each_element(tensor, [&](const Coordinates &id)
+        {
+            const Coordinates nchw_id = is_nhwc ? Coordinates(id[1], id[2], id[0], id[3]) : id;
+
+            size_t index  = 0;
+            size_t stride = 1;
+            for(size_t d = 0; d < shape.num_dimensions(); ++d)
+            {
+                index += nchw_id[d] * stride;
+                stride *= shape[d];
+            }
+            const size_t hash = index * 7 + _inference * 13 + _seed * 5;
+            *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = static_cast<float>(hash % 23) / 11.f - 1.f;
+        });
+        ++_inference;
+        return true;
+    }
+
+private:
+    unsigned int _num_inferences;
+    unsigned int _seed;
+    unsigned int _inference{ 0 };
+};
+
+/** Accessor appending the values of a F32 tensor to a list for every inference */
+class CaptureAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] outputs List the values of every inference are appended to
+     */
+    explicit CaptureAccessor(std::vector<std::vector<float>> &outputs)
+        : _outputs(outputs)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::vector<float> values;
+        values.reserve(tensor.info()->tensor_shape().total_size());
+        for_each_element(tensor, [&](const Coordinates &id)
+        {
+            values.push_back(*reinterpret_cast<const float *>(tensor.ptr_to_element(id)));
+        });
+        _outputs.push_back(std::move(values));
+        return true;
+    }
+
+private:
+    std::vector<std::vector<float>> &_outputs;
+};
+} // namespace helper
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
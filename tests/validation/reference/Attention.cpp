@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Attention.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> attention(const SimpleTensor<T> &query,
+                          const SimpleTensor<T> &key,
+                          const SimpleTensor<T> &value,
+                          const SimpleTensor<T> &mask,
+                          float                  scale,
+                          bool                   is_causal)
+{
+    const int head_size  = query.shape()[0];
+    const int num_q      = query.shape()[1];
+    const int num_heads  = query.shape()[2];
+    const int num_batch  = query.shape()[3];
+    const int num_kv     = key.shape()[1];
+    const int value_size = value.shape()[0];
+    const int q_offset   = num_kv - num_q;
+    const bool has_mask  = mask.num_elements() > 0;
+
+    TensorShape dst_shape = query.shape();
+    dst_shape.set(0, value_size);
+    SimpleTensor<T> dst{dst_shape, query.data_type()};
+
+    std::vector<float> scores(num_kv);
+
+    for (int b = 0; b < num_batch; ++b)
+    {
+        for (int h = 0; h < num_heads; ++h)
+        {
+            const int mb = has_mask && mask.shape()[3] == 1 ? 0 : b;
+            const int mh = has_mask && mask.shape()[2] == 1 ? 0 : h;
+
+            for (int i = 0; i < num_q; ++i)
+            {
+                const int q_base = ((b * num_heads + h) * num_q + i) * head_size;
+                float     max    = -std::numeric_limits<float>::infinity();
+
+                for (int j = 0; j < num_kv; ++j)
+                {
+                    float s = -std::numeric_limits<float>::infinity();
+                    if (!is_causal || j <= i + q_offset)
+                    {
+                        const int k_base = ((b * num_heads + h) * num_kv + j) * head_size;
+                        float     acc    = 0.f;
+                        for (int d = 0; d < head_size; ++d)
+                        {
+                            acc += static_cast<float>(query[q_base + d]) * static_cast<float>(key[k_base + d]);
+                        }
+                        s = acc * scale;
+                        if (has_mask)
+                        {
+                            const int m_idx =
+                                ((mb * mask.shape()[2] + mh) * mask.shape()[1] + i) * mask.shape()[0] + j;
+                            s += static_cast<float>(mask[m_idx]);
+                        }
+                    }
+                    scores[j] = s;
+                    max       = std::max(max, s);
+                }
+
+                float sum = 0.f;
+                for (int j = 0; j < num_kv; ++j)
+                {
+                    scores[j] = std::isinf(max) ? 0.f : std::exp(scores[j] - max);
+                    sum += scores[j];
+                }
+
+                const int dst_base = ((b * num_heads + h) * num_q + i) * value_size;
+                for (int d = 0; d < value_size; ++d)
+                {
+                    float acc = 0.f;
+                    for (int j = 0; j < num_kv; ++j)
+                    {
+                        acc += scores[j] * static_cast<float>(value[((b * num_heads + h) * num_kv + j) * value_size + d]);
+                    }
+                    dst[dst_base + d] = static_cast<T>(sum > 0.f ? acc / sum : 0.f);
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> attention(const SimpleTensor<float> &query,
+                                       const SimpleTensor<float> &key,
+                                       const SimpleTensor<float> &value,
+                                       const SimpleTensor<float> &mask,
+                                       float                      scale,
+                                       bool                       is_causal);
+template SimpleTensor<half>  attention(const SimpleTensor<half> &query,
+                                      const SimpleTensor<half> &key,
+                                      const SimpleTensor<half> &value,
+                                      const SimpleTensor<half> &mask,
+                                      float                     scale,
+                                      bool                      is_causal);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_ATTENTION_H
+#define ACL_TESTS_VALIDATION_REFERENCE_ATTENTION_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Scaled dot-product attention: softmax(scale * query x key^T + mask) x value
+ *
+ * @param[in] query     Query tensor of shape [D, Sq, H, B]
+ * @param[in] key       Key tensor of shape [D, Skv, H, B]
+ * @param[in] value     Value tensor of shape [Dv, Skv, H, B]
+ * @param[in] mask      Additive mask of shape [Skv, Sq, H or 1, B or 1]. Ignored when it has no elements
+ * @param[in] scale     Scale applied to the query-key products
+ * @param[in] is_causal True to mask out the keys following each query, the queries being aligned with the last keys
+ *
+ * @return Output tensor of shape [Dv, Sq, H, B]
+ */
+template <typename T>
+SimpleTensor<T> attention(const SimpleTensor<T> &query,
+                          const SimpleTensor<T> &key,
+                          const SimpleTensor<T> &value,
+                          const SimpleTensor<T> &mask,
+                          float                  scale,
+                          bool                   is_causal);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_ATTENTION_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "LayerNormalization.h"
+
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> layer_normalization(const SimpleTensor<T>        &src,
+                                    const SimpleTensor<T>        &residual,
+                                    const SimpleTensor<T>        &gamma,
+                                    const SimpleTensor<T>        &beta,
+                                    SimpleTensor<T>              &add_output,
+                                    const LayerNormalizationInfo &info)
+{
+    const bool has_residual = residual.num_elements() > 0;
+    const bool has_gamma    = gamma.num_elements() > 0;
+    const bool has_beta     = beta.num_elements() > 0;
+    const bool is_rms       = info.type == LayerNormalizationType::RMSNorm;
+
+    const int cols = src.shape()[0];
+    const int rows = src.num_elements() / cols;
+
+    SimpleTensor<T> dst{src.shape(), src.data_type()};
+    if (has_residual)
+    {
+        add_output = SimpleTensor<T>{src.shape(), src.data_type()};
+    }
+
+    std::vector<double> values(cols);
+    for (int r = 0; r < rows; ++r)
+    {
+        double mean = 0.0;
+        for (int i = 0; i < cols; ++i)
+        {
+            const int idx = r * cols + i;
+            if (has_residual)
+            {
+                add_output[idx] = static_cast<T>(static_cast<float>(src[idx]) + static_cast<float>(residual[idx]));
+                values[i]       = static_cast<float>(add_output[idx]);
+            }
+            else
+            {
+                values[i] = static_cast<float>(src[idx]);
+            }
+            mean += values[i];
+        }
+        mean = is_rms ? 0.0 : mean / cols;
+
+        double variance = 0.0;
+        for (int i = 0; i < cols; ++i)
+        {
+            variance += (values[i] - mean) * (values[i] - mean);
+        }
+        const double inv_stddev = 1.0 / std::sqrt(variance / cols + info.epsilon);
+
+        for (int i = 0; i < cols; ++i)
+        {
+            double v = (values[i] - mean) * inv_stddev;
+            if (has_gamma)
+            {
+                v *= static_cast<float>(gamma[i]);
+            }
+            if (has_beta)
+            {
+                v += static_cast<float>(beta[i]);
+            }
+            dst[r * cols + i] = static_cast<T>(static_cast<float>(v));
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> layer_normalization(const SimpleTensor<float> &src,
+                                                 const SimpleTensor<float> &residual,
+                                                 const SimpleTensor<float> &gamma,
+                                                 const SimpleTensor<float> &beta,
+                                                 SimpleTensor<float> &add_output,
+                                                 const LayerNormalizationInfo &info);
+template SimpleTensor<half> layer_normalization(const SimpleTensor<half> &src,
+                                                const SimpleTensor<half> &residual,
+                                                const SimpleTensor<half> &gamma,
+                                                const SimpleTensor<half> &beta,
+                                                SimpleTensor<half> &add_output,
+                                                const LayerNormalizationInfo &info);
+template SimpleTensor<bfloat16> layer_normalization(const SimpleTensor<bfloat16> &src,
+                                                    const SimpleTensor<bfloat16> &residual,
+                                                    const SimpleTensor<bfloat16> &gamma,
+                                                    const SimpleTensor<bfloat16> &beta,
+                                                    SimpleTensor<bfloat16> &add_output,
+                                                    const LayerNormalizationInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
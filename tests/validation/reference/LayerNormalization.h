@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
+#define ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
+
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Layer or RMS normalization of the rows of (src + residual), followed by an optional scale and offset
+ *
+ * @param[in]  src        Source tensor, normalized along dimension 0
+ * @param[in]  residual   Residual tensor added to @p src. Ignored when it has no elements
+ * @param[in]  gamma      Scale tensor of shape [src dimension 0]. Ignored when it has no elements
+ * @param[in]  beta       Offset tensor of shape [src dimension 0]. Ignored when it has no elements
+ * @param[out] add_output Sum of @p src and @p residual, rounded to T and normalized in its place. Left empty without residual
+ * @param[in]  info       Normalization type and epsilon
+ *
+ * @return Normalized tensor
+ */
+template <typename T>
+SimpleTensor<T> layer_normalization(const SimpleTensor<T>        &src,
+                                    const SimpleTensor<T>        &residual,
+                                    const SimpleTensor<T>        &gamma,
+                                    const SimpleTensor<T>        &beta,
+                                    SimpleTensor<T>              &add_output,
+                                    const LayerNormalizationInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_LAYERNORMALIZATION_H
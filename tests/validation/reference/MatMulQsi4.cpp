@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "MatMulQsi4.h"
+
+#include "support/Bfloat16.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Row quantized to 8 bits, each value being (q - offset) * scale */
+struct QuantizedRow
+{
+    std::vector<int32_t> values{};
+    int32_t              offset{0};
+    float                scale{0.f};
+};
+
+QuantizedRow quantize_symmetric(const float *row, unsigned int k)
+{
+    float amax = 0.f;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        amax = std::max(amax, std::fabs(row[i]));
+    }
+
+    QuantizedRow q;
+    q.scale = amax / 127.f;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        q.values.push_back(amax > 0.f ? static_cast<int32_t>(std::round(row[i] * (127.f / amax))) : 0);
+    }
+    return q;
+}
+
+/** Quantization of the rows by kai_run_lhs_quant_pack_qai8dxp_f32, over a range containing zero */
+QuantizedRow quantize_asymmetric(const float *row, unsigned int k)
+{
+    float rmin = 0.f;
+    float rmax = 0.f;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        rmin = std::min(rmin, row[i]);
+        rmax = std::max(rmax, row[i]);
+    }
+
+    const float scale    = rmin == rmax ? 1.f : 255.f / (rmax - rmin);
+    const float zp_min   = -128.f - rmin * scale;
+    const float zp_max   = 127.f - rmax * scale;
+    const float zp       = (-128.f + rmin * scale) + (127.f + rmax * scale) > 0.f ? zp_min : zp_max;
+    const auto  zp_round = static_cast<int32_t>(std::rint(std::min(127.f, std::max(-128.f, zp))));
+
+    QuantizedRow q;
+    q.offset = zp_round;
+    q.scale  = 1.f / scale;
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        const int32_t value = static_cast<int32_t>(std::round(row[i] * scale)) + zp_round;
+        q.values.push_back(std::min(127, std::max(-128, value)));
+    }
+    return q;
+}
+} // namespace
+
+SimpleTensor<float> matmul_qsi4(const SimpleTensor<float> &src,
+                                const std::vector<int>    &weights,
+                                const std::vector<float>  &scales,
+                                const std::vector<float>  &bias,
+                                const TensorShape         &dst_shape,
+                                unsigned int               block_len,
+                                bool                       asymmetric_src)
+{
+    SimpleTensor<float> dst{ dst_shape, DataType::F32 };
+
+    const unsigned int n          = dst_shape[0];
+    const unsigned int m          = dst_shape.total_size_upper(1);
+    const unsigned int k          = src.num_elements() / m;
+    const unsigned int scale_k    = block_len == 0 ? k : block_len;
+    const unsigned int num_blocks = k / scale_k;
+
+    // The micro-kernels read the weights with several blocks of scales per output channel as BF16 values
+    const bool bf16_scales = asymmetric_src && num_blocks > 1;
+
+    for(unsigned int y = 0; y < m; ++y)
+    {
+        const float       *row = src.data() + y * k;
+        const QuantizedRow q   = asymmetric_src ? quantize_asymmetric(row, k) : quantize_symmetric(row, k);
+
+        for(unsigned int c = 0; c < n; ++c)
+        {
+            float acc = 0.f;
+            for(unsigned int b = 0; b < num_blocks; ++b)
+            {
+                int32_t block_acc = 0;
+                for(unsigned int i = b * scale_k; i < (b + 1) * scale_k; ++i)
+                {
+                    block_acc += (q.values[i] - q.offset) * weights[c * k + i];
+                }
+                float scale = scales[c * num_blocks + b];
+                if(bf16_scales)
+                {
+                    scale = bf16_to_float(portable_float_to_bf16(scale));
+                }
+                acc += static_cast<float>(block_acc) * scale;
+            }
+            dst[y * n + c] = acc * q.scale + (bias.empty() ? 0.f : bias[c]);
+        }
+    }
+    return dst;
+}
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
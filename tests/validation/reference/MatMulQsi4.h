@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_MATMULQSI4_H
+#define ACL_TESTS_VALIDATION_REFERENCE_MATMULQSI4_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Multiply F32 rows by 4-bit weights, quantizing each row to 8 bits on the fly like @ref cpu::kernels::CpuMatMulQsi4Kernel
+ *
+ * The rows are quantized symmetrically by the generic kernel. The KleidiAI micro-kernels run on the cores with the dot
+ * product instructions quantize them with an offset, and read the scales of the blocks shorter than K as BF16 values.
+ *
+ * @param[in] src            Input rows of shape [K, M, ...]
+ * @param[in] weights        Values of the weights in [-8, 7], the K values of each output channel being contiguous
+ * @param[in] scales         Scales of the weights, the K / @p block_len scales of each output channel being contiguous
+ * @param[in] bias           Bias of each output channel. Ignored when empty
+ * @param[in] dst_shape      Shape of the output [N, M, ...]
+ * @param[in] block_len      Number of values of K sharing a scale, 0 for per channel weights
+ * @param[in] asymmetric_src True to quantize the rows the way the KleidiAI micro-kernels do
+ *
+ * @return Output tensor of shape @p dst_shape
+ */
+SimpleTensor<float> matmul_qsi4(const SimpleTensor<float> &src,
+                                const std::vector<int>    &weights,
+                                const std::vector<float>  &scales,
+                                const std::vector<float>  &bias,
+                                const TensorShape         &dst_shape,
+                                unsigned int               block_len,
+                                bool                       asymmetric_src);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_MATMULQSI4_H
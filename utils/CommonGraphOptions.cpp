@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,8 @@ namespace utils
     std::string true_str  = std::string("true");
 
     os << "Threads : " << common_params.threads << std::endl;
+    os << "Parallel branches : " << common_params.parallel_branches << std::endl;
+    os << "Pipeline stages : " << common_params.pipeline_stages << std::endl;
     os << "Target : " << common_params.target << std::endl;
     os << "Data type : " << common_params.data_type << std::endl;
     os << "Data layout : " << common_params.data_layout << std::endl;
@@ -88,8 +90,25 @@ namespace utils
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "MLGO file : " << common_params.mlgo_file << std::endl;
+    if (!common_params.weights_cache_file.empty())
+    {
+        os << "Weights cache file : " << common_params.weights_cache_file << std::endl;
+    }
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str)
        << std::endl;
+    os << "Layout planning enabled? : " << (common_params.plan_layout ? true_str : false_str) << std::endl;
+    os << "Data type planning enabled? : " << (common_params.plan_type ? true_str : false_str) << std::endl;
+    os << "Quantization folding enabled? : " << (common_params.fold_quantization ? true_str : false_str) << std::endl;
+    os << "Convolution tuner enabled? : " << (common_params.tune_convolution_method ? true_str : false_str)
+       << std::endl;
+    if (!common_params.convolution_tuner_file.empty())
+    {
+        os << "Convolution tuner file : " << common_params.convolution_tuner_file << std::endl;
+    }
+    if (!common_params.profiling_file.empty())
+    {
+        os << "Profiling file : " << common_params.profiling_file << std::endl;
+    }
     if (!common_params.data_path.empty())
     {
         os << "Data path : " << common_params.data_path << std::endl;
@@ -120,6 +139,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       threads(parser.add_option<SimpleOption<int>>("threads", 1)),
       batches(parser.add_option<SimpleOption<int>>("batches", 1)),
+      parallel_branches(parser.add_option<SimpleOption<unsigned int>>("parallel-branches", 1)),
+      pipeline_stages(parser.add_option<SimpleOption<unsigned int>>("pipeline-stages", 1)),
       target(),
       data_type(),
       data_layout(),
@@ -127,6 +148,10 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       enable_cl_cache(parser.add_option<ToggleOption>("enable-cl-cache")),
       tuner_mode(),
       fast_math_hint(parser.add_option<ToggleOption>("fast-math")),
+      plan_layout(parser.add_option<ToggleOption>("plan-layout")),
+      plan_type(parser.add_option<ToggleOption>("plan-type")),
+      fold_quantization(parser.add_option<ToggleOption>("fold-quantization")),
+      tune_convolutions(parser.add_option<ToggleOption>("tune-convolutions")),
       data_path(parser.add_option<SimpleOption<std::string>>("data")),
       image(parser.add_option<SimpleOption<std::string>>("image")),
       labels(parser.add_option<SimpleOption<std::string>>("labels")),
@@ -134,7 +159,10 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
       tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
-      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file"))
+      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file")),
+      weights_cache_file(parser.add_option<SimpleOption<std::string>>("weights-cache-file")),
+      conv_tuner_file(parser.add_option<SimpleOption<std::string>>("convolution-tuner-file")),
+      profiling_file(parser.add_option<SimpleOption<std::string>>("profiling-file"))
 {
     std::set<arm_compute::graph::Target> supported_targets{
         Target::NEON,
@@ -164,6 +192,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     help->set_help("Show this help message");
     threads->set_help("Number of threads to use");
     batches->set_help("Number of batches to use for the inputs");
+    parallel_branches->set_help("Maximum number of independent branches of the graph executed concurrently on the CPU");
+    pipeline_stages->set_help("Number of CPU pipeline stages processing consecutive inferences concurrently");
     target->set_help("Target to execute on");
     data_type->set_help("Data type to use");
     data_layout->set_help("Data layout to use");
@@ -174,6 +204,10 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
                          "Normal: slow but produces the LWS configurations on par with Exhaustive most of the time. "
                          "Rapid: fast but produces less performant LWS configurations");
     fast_math_hint->set_help("Enable fast math");
+    plan_layout->set_help("Choose the data layout of each layer from a cost model");
+    plan_type->set_help("Lower the precision of the layers where the cost model favours it");
+    fold_quantization->set_help("Fold the quantization round trips and requantizations into the quantized layers");
+    tune_convolutions->set_help("Pick the method of the CPU convolutions by measuring them on the real shapes");
     data_path->set_help("Path where graph parameters reside");
     image->set_help("Input image for the graph");
     labels->set_help("File containing the output labels");
@@ -182,6 +216,9 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
     mlgo_file->set_help("File to load MLGO heuristics");
+    weights_cache_file->set_help("File to load/save the prepared weights of the CPU functions");
+    conv_tuner_file->set_help("File to load/save the measured methods of the CPU convolutions");
+    profiling_file->set_help("File to save the timings of the CPU layers and kernels to, as a Chrome trace");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -191,11 +228,13 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     auto validation_range = parse_validation_range(options.validation_range->value());
 
     CommonGraphParams common_params;
-    common_params.help      = options.help->is_set() ? options.help->value() : false;
-    common_params.threads   = options.threads->value();
-    common_params.batches   = options.batches->value();
-    common_params.target    = options.target->value();
-    common_params.data_type = options.data_type->value();
+    common_params.help              = options.help->is_set() ? options.help->value() : false;
+    common_params.threads           = options.threads->value();
+    common_params.batches           = options.batches->value();
+    common_params.parallel_branches = options.parallel_branches->value();
+    common_params.pipeline_stages   = options.pipeline_stages->value();
+    common_params.target            = options.target->value();
+    common_params.data_type         = options.data_type->value();
     if (options.data_layout->is_set())
     {
         common_params.data_layout = options.data_layout->value();
@@ -206,6 +245,12 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
                                         : (options.enable_cl_cache->is_set() ? options.enable_cl_cache->value() : true);
     common_params.tuner_mode      = options.tuner_mode->value();
     common_params.fast_math_hint  = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
+    common_params.plan_layout     = options.plan_layout->is_set() ? options.plan_layout->value() : false;
+    common_params.plan_type       = options.plan_type->is_set() ? options.plan_type->value() : false;
+    common_params.fold_quantization =
+        options.fold_quantization->is_set() ? options.fold_quantization->value() : false;
+    common_params.tune_convolution_method =
+        options.tune_convolutions->is_set() ? options.tune_convolutions->value() : false;
     common_params.data_path       = options.data_path->value();
     common_params.image           = options.image->value();
     common_params.labels          = options.labels->value();
@@ -215,6 +260,9 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
     common_params.mlgo_file              = options.mlgo_file->value();
+    common_params.weights_cache_file     = options.weights_cache_file->value();
+    common_params.convolution_tuner_file = options.conv_tuner_file->value();
+    common_params.profiling_file         = options.profiling_file->value();
 
     return common_params;
 }
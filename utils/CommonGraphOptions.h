@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,12 +40,17 @@ namespace utils
  *
  * --help             : Print the example's help message.
  * --threads          : The number of threads to be used by the example during execution.
+ * --parallel-branches: Maximum number of independent branches of the graph executed concurrently on the CPU.
+ * --pipeline-stages  : Number of CPU pipeline stages processing consecutive inferences concurrently.
  * --target           : Execution target to be used by the examples. Supported target options: Neon, CL, CLVK.
  * --type             : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
  * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
  * --enable-cl-cache  : Toggle option to load the prebuilt opencl kernels from a cache file.
  * --fast-math        : Toggle option to enable the fast math option.
+ * --plan-layout      : Toggle option to let the graph choose the data layout of each layer.
+ * --plan-type        : Toggle option to let the graph lower the precision of each layer (FP16, BF16 fast math).
+ * --fold-quantization: Toggle option to fold the quantization round trips and requantizations of quantized graphs.
  * --data             : Path that contains the trainable parameter files of graph layers.
  * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
  * --labels           : File that contains the labels that classify upon.
@@ -95,6 +100,8 @@ struct CommonGraphParams
     bool                             help{false};
     int                              threads{0};
     int                              batches{1};
+    unsigned int                     parallel_branches{1};
+    unsigned int                     pipeline_stages{1};
     arm_compute::graph::Target       target{arm_compute::graph::Target::NEON};
     arm_compute::DataType            data_type{DataType::F32};
     arm_compute::DataLayout          data_layout{DataLayout::NHWC};
@@ -102,6 +109,10 @@ struct CommonGraphParams
     bool                             enable_cl_cache{false};
     arm_compute::CLTunerMode         tuner_mode{CLTunerMode::NORMAL};
     arm_compute::graph::FastMathHint fast_math_hint{arm_compute::graph::FastMathHint::Disabled};
+    bool                             plan_layout{false};
+    bool                             plan_type{false};
+    bool                             fold_quantization{false};
+    bool                             tune_convolution_method{false};
     std::string                      data_path{};
     std::string                      image{};
     std::string                      labels{};
@@ -109,6 +120,9 @@ struct CommonGraphParams
     std::string                      validation_path{};
     std::string                      tuner_file{};
     std::string                      mlgo_file{};
+    std::string                      weights_cache_file{};
+    std::string                      convolution_tuner_file{};
+    std::string                      profiling_file{};
     unsigned int                     validation_range_start{0};
     unsigned int                     validation_range_end{std::numeric_limits<unsigned int>::max()};
 };
@@ -150,24 +164,33 @@ public:
     /** Default destructor */
     ~CommonGraphOptions() = default;
 
-    ToggleOption                           *help;             /**< Show help option */
-    SimpleOption<int>                      *threads;          /**< Number of threads option */
-    SimpleOption<int>                      *batches;          /**< Number of batches */
-    EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
-    EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
-    EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
-    ToggleOption                           *enable_tuner;     /**< Enable tuner */
-    ToggleOption                           *enable_cl_cache;  /**< Enable opencl kernels cache */
-    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;       /**< Tuner mode */
-    ToggleOption                           *fast_math_hint;   /**< Fast math hint */
-    SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
-    SimpleOption<std::string>              *image;            /**< Image */
-    SimpleOption<std::string>              *labels;           /**< Labels */
-    SimpleOption<std::string>              *validation_file;  /**< Validation file */
-    SimpleOption<std::string>              *validation_path;  /**< Validation data path */
-    SimpleOption<std::string>              *validation_range; /**< Validation range */
-    SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
-    SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    ToggleOption                           *help;               /**< Show help option */
+    SimpleOption<int>                      *threads;            /**< Number of threads option */
+    SimpleOption<int>                      *batches;            /**< Number of batches */
+    SimpleOption<unsigned int>             *parallel_branches;  /**< Maximum number of branches executed concurrently */
+    SimpleOption<unsigned int>             *pipeline_stages;    /**< Number of pipeline stages */
+    EnumOption<arm_compute::graph::Target> *target;             /**< Graph execution target */
+    EnumOption<arm_compute::DataType>      *data_type;          /**< Graph data type */
+    EnumOption<arm_compute::DataLayout>    *data_layout;        /**< Graph data layout */
+    ToggleOption                           *enable_tuner;       /**< Enable tuner */
+    ToggleOption                           *enable_cl_cache;    /**< Enable opencl kernels cache */
+    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;         /**< Tuner mode */
+    ToggleOption                           *fast_math_hint;     /**< Fast math hint */
+    ToggleOption                           *plan_layout;        /**< Plan the data layout of each layer */
+    ToggleOption                           *plan_type;          /**< Plan the data type of each layer */
+    ToggleOption                           *fold_quantization;  /**< Fold the quantization round trips and requantizations */
+    ToggleOption                           *tune_convolutions;  /**< Measure the methods of the CPU convolutions */
+    SimpleOption<std::string>              *data_path;          /**< Trainable parameters path */
+    SimpleOption<std::string>              *image;              /**< Image */
+    SimpleOption<std::string>              *labels;             /**< Labels */
+    SimpleOption<std::string>              *validation_file;    /**< Validation file */
+    SimpleOption<std::string>              *validation_path;    /**< Validation data path */
+    SimpleOption<std::string>              *validation_range;   /**< Validation range */
+    SimpleOption<std::string>              *tuner_file;         /**< File to load/store the tuner's values from */
+    SimpleOption<std::string>              *mlgo_file;          /**< File to load the MLGO heuristics from */
+    SimpleOption<std::string>              *weights_cache_file; /**< File to load/store the prepared CPU weights from */
+    SimpleOption<std::string>              *conv_tuner_file;    /**< File to load/store the convolution methods from */
+    SimpleOption<std::string>              *profiling_file;     /**< File to save the Chrome trace of the CPU runs to */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
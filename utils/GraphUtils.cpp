@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,8 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <cstdint>
+#include <fstream>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
@@ -799,3 +801,165 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+namespace
+{
+/** First line of the packed weights files */
+constexpr const char *packed_weights_magic = "ACL_PACKED_WEIGHTS 1";
+
+/** Check whether the data of a NPY file can be used as the memory of a tensor as is
+ *
+ * @param[in] header      Header of the NPY file
+ * @param[in] file_layout Layout of the numpy tensor data
+ * @param[in] info        Info of the tensor to load
+ *
+ * @return True if the data type, shape and layout of the NPY data match the tensor's ones
+ */
+bool is_npy_importable(const npy::header_t &header, arm_compute::DataLayout file_layout, const arm_compute::ITensorInfo &info)
+{
+    const arm_compute::TensorShape &shape = info.tensor_shape();
+    if (header.dtype.str() != arm_compute::utils::get_typestring(info.data_type()) || !info.padding().empty() ||
+        header.shape.size() > arm_compute::TensorShape::num_max_dimensions)
+    {
+        return false;
+    }
+
+    // The data would need to be permuted
+    if (file_layout != info.data_layout() && shape.num_dimensions() > 2)
+    {
+        return false;
+    }
+
+    // The outermost dimensions of size 1 can be omitted on either side
+    for (size_t i = 0; i < arm_compute::TensorShape::num_max_dimensions; ++i)
+    {
+        const size_t npy_dim = i < header.shape.size() ? header.shape[i] : 1;
+        if (npy_dim != shape[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+NumPyMMapLoader::NumPyMMapLoader(std::string filename, DataLayout file_layout)
+    : _file(nullptr), _already_loaded(false), _filename(std::move(filename)), _offset(0), _file_layout(file_layout)
+{
+}
+
+NumPyMMapLoader::NumPyMMapLoader(std::shared_ptr<utils::mmap_io::MMappedFile> file,
+                                 std::string                                  filename,
+                                 size_t                                       offset,
+                                 DataLayout                                   file_layout)
+    : _file(std::move(file)),
+      _already_loaded(false),
+      _filename(std::move(filename)),
+      _offset(offset),
+      _file_layout(file_layout)
+{
+}
+
+bool NumPyMMapLoader::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        // Find the data following the header
+        std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Failed to load binary data from %s", _filename.c_str());
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        fs.seekg(_offset, std::ios_base::beg);
+        const npy::header_t header      = utils::parse_npy_header(fs);
+        const size_t        data_offset = fs.tellg();
+        fs.close();
+
+        bool  imported   = false;
+        auto *cpu_tensor = dynamic_cast<Tensor *>(&tensor);
+        if (cpu_tensor != nullptr && is_npy_importable(header, _file_layout, *tensor.info()))
+        {
+            if (_file == nullptr)
+            {
+                _file = std::make_shared<utils::mmap_io::MMappedFile>(_filename, 0 /** Whole file */, 0, true);
+            }
+
+            const size_t   data_size = tensor.info()->total_size();
+            unsigned char *data      = _file->data() + data_offset;
+            if (_file->is_mapped() && data_offset + data_size <= _file->map_size() &&
+                reinterpret_cast<uintptr_t>(data) % tensor.info()->element_size() == 0)
+            {
+                imported = bool(cpu_tensor->allocator()->import_memory(data));
+            }
+        }
+
+        if (!imported)
+        {
+            utils::NPYLoader loader;
+            loader.open(_filename, _file_layout, _offset);
+            loader.fill_tensor(tensor);
+        }
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+PackedWeightsFile::PackedWeightsFile(std::string filename) : _filename(std::move(filename)), _file(), _offsets()
+{
+    std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Failed to open packed weights file %s", _filename.c_str());
+
+    std::string magic;
+    std::getline(fs, magic);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(magic != packed_weights_magic, "%s is not a packed weights file", _filename.c_str());
+
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(!_file.map(_filename, 0 /** Whole file */, 0, true), "Failed to map %s",
+                                _filename.c_str());
+
+    size_t num_entries = 0;
+    fs >> num_entries;
+    for (size_t i = 0; i < num_entries; ++i)
+    {
+        std::string name;
+        size_t      offset = 0;
+        size_t      size   = 0;
+        fs >> name >> offset >> size;
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(fs.fail() || offset + size > _file.map_size(),
+                                    "Malformed index in packed weights file %s", _filename.c_str());
+        _offsets[name] = offset;
+    }
+}
+
+std::shared_ptr<PackedWeightsFile> PackedWeightsFile::open(const std::string &filename)
+{
+    // The weights of a graph are requested one by one: map the file once while any of its accessors is alive
+    static std::map<std::string, std::weak_ptr<PackedWeightsFile>> opened_files;
+
+    std::shared_ptr<PackedWeightsFile> file = opened_files[filename].lock();
+    if (file == nullptr)
+    {
+        file                   = std::make_shared<PackedWeightsFile>(filename);
+        opened_files[filename] = file;
+    }
+    return file;
+}
+
+bool PackedWeightsFile::is_packed_weights_file(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    std::string   magic;
+    return fs.good() && !std::getline(fs, magic).fail() && magic == packed_weights_magic;
+}
+
+std::unique_ptr<arm_compute::graph::ITensorAccessor> PackedWeightsFile::get_accessor(const std::string      &name,
+                                                                                      arm_compute::DataLayout file_layout)
+{
+    const size_t start = name.find_first_not_of('/');
+    const auto   it    = _offsets.find(start == std::string::npos ? name : name.substr(start));
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(it == _offsets.end(), "%s not found in %s", name.c_str(), _filename.c_str());
+
+    // The accessors share the ownership of the container to keep the mapping alive
+    std::shared_ptr<utils::mmap_io::MMappedFile> file(shared_from_this(), &_file);
+    return std::make_unique<NumPyMMapLoader>(std::move(file), _filename, it->second, file_layout);
+}
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/ITensorAccessor.h"
@@ -35,6 +36,8 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <map>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -456,6 +459,107 @@ private:
     const DataLayout  _file_layout;
 };
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Memory-mapped numpy binary loader class
+ *
+ * If the tensor is a CPU tensor with the same data type, shape and layout as the NPY data, the data is not copied:
+ * the mapping of the file is imported as the memory of the tensor instead. The weights are then read from the page
+ * cache on first use and the pages are shared by all the processes loading the same file. The mapping is private,
+ * hence writing to the tensor never modifies the file. Otherwise the data is copied like in @ref NumPyBinLoader.
+ *
+ * @note The accessor owns the mapping: it must outlive the tensor.
+ */
+class NumPyMMapLoader final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] filename    Binary file name
+     * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     */
+    NumPyMMapLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    /** Constructor to load a NPY file stored in an already mapped file
+     *
+     * @param[in] file        Mapping of the whole file containing the NPY file
+     * @param[in] filename    Name of the mapped file
+     * @param[in] offset      Offset in bytes of the NPY file in the mapped file
+     * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     */
+    NumPyMMapLoader(std::shared_ptr<utils::mmap_io::MMappedFile> file,
+                    std::string                                  filename,
+                    size_t                                       offset,
+                    DataLayout                                   file_layout = DataLayout::NCHW);
+    /** Allows instances to move constructed */
+    NumPyMMapLoader(NumPyMMapLoader &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<utils::mmap_io::MMappedFile> _file;
+    bool                                         _already_loaded;
+    const std::string                            _filename;
+    const size_t                                 _offset;
+    const DataLayout                             _file_layout;
+};
+
+/** Container of the NPY files of a network packed in a single file
+ *
+ * Packing the weights lets a graph map them with a single memory mapping shared by all its @ref NumPyMMapLoader.
+ * The file starts with a text index:
+ *
+ *     ACL_PACKED_WEIGHTS 1
+ *     <number of entries>
+ *     <name> <offset> <size>
+ *     ...
+ *
+ * with one line per NPY file, followed by the NPY files themselves at the given offsets in bytes from the start of
+ * the container. The offsets are multiples of 64 to keep the data aligned. scripts/pack_npy_weights.py creates such
+ * files from a directory of NPY files.
+ */
+class PackedWeightsFile : public std::enable_shared_from_this<PackedWeightsFile>
+{
+public:
+    /** Constructor
+     *
+     * @note Use @ref open to create the objects of this class, the accessors share their ownership.
+     *
+     * @param[in] filename Packed weights file to map
+     */
+    explicit PackedWeightsFile(std::string filename);
+
+    /** Open a packed weights file, sharing the mapping with the other users of the same file
+     *
+     * @param[in] filename Packed weights file to map
+     *
+     * @return The packed weights file
+     */
+    static std::shared_ptr<PackedWeightsFile> open(const std::string &filename);
+    /** Check whether a path is a packed weights file
+     *
+     * @param[in] filename Path to check
+     *
+     * @return True if the path is a packed weights file
+     */
+    static bool is_packed_weights_file(const std::string &filename);
+
+    /** Create an accessor loading one of the NPY files of the container
+     *
+     * @param[in] name        Name of the NPY file in the container. Leading '/' are ignored
+     * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     *
+     * @return The accessor
+     */
+    std::unique_ptr<graph::ITensorAccessor> get_accessor(const std::string &name,
+                                                         DataLayout         file_layout = DataLayout::NCHW);
+
+private:
+    std::string                   _filename;
+    utils::mmap_io::MMappedFile   _file;
+    std::map<std::string, size_t> _offsets;
+};
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+
 /** Generates appropriate random accessor
  *
  * @param[in] lower Lower random values bound
@@ -472,7 +576,8 @@ get_random_accessor(PixelValue lower, PixelValue upper, const std::random_device
 
 /** Generates appropriate weights accessor according to the specified path
  *
- * @note If path is empty will generate a DummyAccessor else will generate a NumPyBinLoader
+ * @note If path is empty will generate a DummyAccessor, if path is a packed weights file will load data_file from it,
+ *       else will generate a NumPyMMapLoader (NumPyBinLoader on platforms without memory mapped files)
  *
  * @param[in] path        Path to the data files
  * @param[in] data_file   Relative path to the data files from path
@@ -487,10 +592,21 @@ get_weights_accessor(const std::string &path, const std::string &data_file, Data
     {
         return std::make_unique<DummyAccessor>();
     }
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    else if (PackedWeightsFile::is_packed_weights_file(path))
+    {
+        return PackedWeightsFile::open(path)->get_accessor(data_file, file_layout);
+    }
+    else
+    {
+        return std::make_unique<NumPyMMapLoader>(path + data_file, file_layout);
+    }
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
     else
     {
         return std::make_unique<NumPyBinLoader>(path + data_file, file_layout);
     }
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 }
 
 /** Generates appropriate input accessor according to the specified graph parameters
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@
 #include "arm_compute/function_info/ConvolutionInfo.h"
 #include "arm_compute/function_info/FullyConnectedLayerInfo.h"
 #include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/function_info/LayerNormalizationInfo.h"
 #include "arm_compute/function_info/MatMulInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
@@ -786,6 +787,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const DataType &data_type)
         case DataType::QSYMM8_PER_CHANNEL:
             os << "QSYMM8_PER_CHANNEL";
             break;
+        case DataType::QSYMM4_PER_CHANNEL:
+            os << "QSYMM4_PER_CHANNEL";
+            break;
+        case DataType::QSYMM4_PER_BLOCK:
+            os << "QSYMM4_PER_BLOCK";
+            break;
         case DataType::S8:
             os << "S8";
             break;
@@ -2724,7 +2731,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const Conv2dInfo &conv_inf
        << "dilation=" << conv_info.dilation << ", "
        << "act_info=" << to_string(conv_info.act_info) << ", "
        << "enable_fast_math=" << conv_info.enable_fast_math << ", "
-       << "num_groups=" << conv_info.num_groups << ","
+       << "num_groups=" << conv_info.num_groups << ", "
+       << "accumulate=" << conv_info.accumulate << ","
        << "}";
     return os;
 }
@@ -3441,6 +3449,41 @@ inline std::string to_string(const arm_compute::ScatterInfo &info)
     return str.str();
 }
 
+/** Formatted output of the arm_compute::LayerNormalizationType type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  type arm_compute::LayerNormalizationType type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const LayerNormalizationType &type)
+{
+    switch (type)
+    {
+        case LayerNormalizationType::LayerNorm:
+            os << "LAYER_NORM";
+            break;
+        case LayerNormalizationType::RMSNorm:
+            os << "RMS_NORM";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::LayerNormalizationType type.
+ *
+ * @param[in] type arm_compute::LayerNormalizationType type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::LayerNormalizationType &type)
+{
+    std::stringstream str;
+    str << type;
+    return str.str();
+}
+
 /** Formatted output of the bool data type.
  *
  * @param[in] info bool type to output.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -310,8 +310,9 @@ public:
      *
      * @param[in] npy_filename File to open
      * @param[in] file_layout  (Optional) Layout in which the weights are stored in the file.
+     * @param[in] offset       (Optional) Offset in bytes of the NPY data in the file, e.g. in a container of NPY files.
      */
-    void open(const std::string &npy_filename, DataLayout file_layout = DataLayout::NCHW)
+    void open(const std::string &npy_filename, DataLayout file_layout = DataLayout::NCHW, size_t offset = 0)
     {
         ARM_COMPUTE_ERROR_ON(is_open());
         try
@@ -319,6 +320,7 @@ public:
             _fs.open(npy_filename, std::ios::in | std::ios::binary);
             ARM_COMPUTE_EXIT_ON_MSG_VAR(!_fs.good(), "Failed to load binary data from %s", npy_filename.c_str());
             _fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+            _fs.seekg(offset, std::ios_base::beg);
             _file_layout = file_layout;
 
             npy::header_t header = parse_npy_header(_fs);